@@ -48,7 +48,14 @@ class Agent
     };
 
     /**
-     * Computes the new velocity of this agent.
+     * Computes the preferred velocity of this agent.
+     */
+    virtual void computePreferredVelocity() = 0;
+
+    /**
+     * Computes the new velocity of this agent. This must only read the preferred
+     * velocities of other agents, so that the new velocities of all agents can be
+     * computed at the same time once every preferred velocity has been computed.
      */
     virtual void computeNewVelocity() = 0;
 
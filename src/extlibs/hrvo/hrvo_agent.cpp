@@ -34,6 +34,7 @@
 
 #include <algorithm>
 #include <cmath>
+#include <functional>
 #include <iostream>
 #include <limits>
 
@@ -53,6 +54,15 @@ HRVOAgent::HRVOAgent(Simulator *simulator, const Vector &position, std::size_t g
       prefSpeed_(prefSpeed),
       uncertaintyOffset_(uncertaintyOffset)
 {
+    // Preallocate the buffers for the most candidates there can be, so that computing
+    // the new velocity doesn't allocate
+    const std::size_t max_num_candidates =
+        1 + 6 * maxNeighbors_ + 2 * maxNeighbors_ * (maxNeighbors_ - 1);
+    candidates_.reserve(max_num_candidates);
+    candidate_order_.reserve(max_num_candidates);
+    velocityObstacles_.reserve(maxNeighbors_);
+    velocityObstacleArrays_.reserve(maxNeighbors_);
+    insideVelocityObstacle_.reserve(maxNeighbors_);
 }
 
 void HRVOAgent::computeNeighbors()
@@ -152,11 +162,10 @@ void HRVOAgent::computeNewVelocity()
 {
     // Based on The Hybrid Reciprocal Velocity Obstacle paper:
     // https://gamma.cs.unc.edu/HRVO/HRVO-T-RO.pdf
-    computePreferredVelocity();
     computeNeighbors();
 
     velocityObstacles_.clear();
-    velocityObstacles_.reserve(neighbors_.size());
+    velocityObstacleArrays_.clear();
 
     // Create Velocity Obstacles for neighbors
     for (const auto &neighbor : neighbors_)
@@ -164,12 +173,15 @@ void HRVOAgent::computeNewVelocity()
         const std::unique_ptr<Agent> &other_agent = simulator_->agents_[neighbor.second];
         VelocityObstacle velocity_obstacle = other_agent->createVelocityObstacle(*this);
         velocityObstacles_.push_back(velocity_obstacle);
+        velocityObstacleArrays_.push_back(velocity_obstacle);
     }
+    insideVelocityObstacle_.resize(velocityObstacles_.size());
 
     // Calculate what velocities (candidates) are not inside any velocity obstacle
     // This is likely implementing the ClearPath efficient geometric algorithm as stated
     // in the HRVO paper to find the closest possible velocity to our preferred velocity.
     candidates_.clear();
+    candidate_order_.clear();
 
     Candidate candidate;
 
@@ -185,8 +197,16 @@ void HRVOAgent::computeNewVelocity()
         candidate.position_ = max_speed_ * pref_velocity_.normalize();
     }
 
-    candidates_.insert(std::make_pair(
-        (pref_velocity_ - candidate.position_).lengthSquared(), candidate));
+    // Every other candidate is limited to the maximum speed, so none of them can be
+    // closer to the preferred velocity than this one. If it is not inside any velocity
+    // obstacle, the other candidates don't need to be created
+    if (findFirstVelocityObstacleContaining(candidate) == -1)
+    {
+        new_velocity_ = candidate.position_;
+        return;
+    }
+
+    addCandidate(candidate);
 
     for (int i = 0; i < static_cast<int>(velocityObstacles_.size()); ++i)
     {
@@ -207,8 +227,7 @@ void HRVOAgent::computeNewVelocity()
 
             if (candidate.position_.lengthSquared() < max_speed_ * max_speed_)
             {
-                candidates_.insert(std::make_pair(
-                    (pref_velocity_ - candidate.position_).lengthSquared(), candidate));
+                addCandidate(candidate);
             }
         }
 
@@ -221,8 +240,7 @@ void HRVOAgent::computeNewVelocity()
 
             if (candidate.position_.lengthSquared() < max_speed_ * max_speed_)
             {
-                candidates_.insert(std::make_pair(
-                    (pref_velocity_ - candidate.position_).lengthSquared(), candidate));
+                addCandidate(candidate);
             }
         }
     }
@@ -251,16 +269,14 @@ void HRVOAgent::computeNewVelocity()
             {
                 candidate.position_ =
                     velocityObstacles_[j].apex_ + t1 * velocityObstacles_[j].side1_;
-                candidates_.insert(std::make_pair(
-                    (pref_velocity_ - candidate.position_).lengthSquared(), candidate));
+                addCandidate(candidate);
             }
 
             if (t2 >= 0.0f)
             {
                 candidate.position_ =
                     velocityObstacles_[j].apex_ + t2 * velocityObstacles_[j].side1_;
-                candidates_.insert(std::make_pair(
-                    (pref_velocity_ - candidate.position_).lengthSquared(), candidate));
+                addCandidate(candidate);
             }
         }
 
@@ -283,16 +299,14 @@ void HRVOAgent::computeNewVelocity()
             {
                 candidate.position_ =
                     velocityObstacles_[j].apex_ + t1 * velocityObstacles_[j].side2_;
-                candidates_.insert(std::make_pair(
-                    (pref_velocity_ - candidate.position_).lengthSquared(), candidate));
+                addCandidate(candidate);
             }
 
             if (t2 >= 0.0f)
             {
                 candidate.position_ =
                     velocityObstacles_[j].apex_ + t2 * velocityObstacles_[j].side2_;
-                candidates_.insert(std::make_pair(
-                    (pref_velocity_ - candidate.position_).lengthSquared(), candidate));
+                addCandidate(candidate);
             }
         }
     }
@@ -325,9 +339,7 @@ void HRVOAgent::computeNewVelocity()
 
                     if (candidate.position_.lengthSquared() < max_speed_ * max_speed_)
                     {
-                        candidates_.insert(std::make_pair(
-                            (pref_velocity_ - candidate.position_).lengthSquared(),
-                            candidate));
+                        addCandidate(candidate);
                     }
                 }
             }
@@ -352,9 +364,7 @@ void HRVOAgent::computeNewVelocity()
 
                     if (candidate.position_.lengthSquared() < max_speed_ * max_speed_)
                     {
-                        candidates_.insert(std::make_pair(
-                            (pref_velocity_ - candidate.position_).lengthSquared(),
-                            candidate));
+                        addCandidate(candidate);
                     }
                 }
             }
@@ -379,9 +389,7 @@ void HRVOAgent::computeNewVelocity()
 
                     if (candidate.position_.lengthSquared() < max_speed_ * max_speed_)
                     {
-                        candidates_.insert(std::make_pair(
-                            (pref_velocity_ - candidate.position_).lengthSquared(),
-                            candidate));
+                        addCandidate(candidate);
                     }
                 }
             }
@@ -406,52 +414,115 @@ void HRVOAgent::computeNewVelocity()
 
                     if (candidate.position_.lengthSquared() < max_speed_ * max_speed_)
                     {
-                        candidates_.insert(std::make_pair(
-                            (pref_velocity_ - candidate.position_).lengthSquared(),
-                            candidate));
+                        addCandidate(candidate);
                     }
                 }
             }
         }
     }
 
+    // Check the candidates closest to the preferred velocity first, stopping at the
+    // first one that is not inside any velocity obstacle
+    std::make_heap(candidate_order_.begin(), candidate_order_.end(), std::greater<>());
+
     int optimal = -1;
 
-    for (std::pair<float, Candidate> candidate_pair : candidates_)
+    while (!candidate_order_.empty())
     {
-        candidate  = candidate_pair.second;
-        bool valid = true;
+        std::pop_heap(candidate_order_.begin(), candidate_order_.end(), std::greater<>());
+        candidate = candidates_[candidate_order_.back().second];
+        candidate_order_.pop_back();
 
-        for (int j = 0; j < static_cast<int>(velocityObstacles_.size()); ++j)
+        int velocity_obstacle = findFirstVelocityObstacleContaining(candidate);
+        if (velocity_obstacle == -1)
         {
-            if (j != candidate.velocityObstacle1_ && j != candidate.velocityObstacle2_ &&
-                (velocityObstacles_[j].side2_)
-                        .determinant(candidate.position_ - velocityObstacles_[j].apex_) <
-                    0.0f &&
-                (velocityObstacles_[j].side1_)
-                        .determinant(candidate.position_ - velocityObstacles_[j].apex_) >
-                    0.0f)
-            {
-                valid = false;
-
-                if (j > optimal)
-                {
-                    optimal       = j;
-                    new_velocity_ = candidate.position_;
-                }
-
-                break;
-            }
+            new_velocity_ = candidate.position_;
+            break;
         }
 
-        if (valid)
+        if (velocity_obstacle > optimal)
         {
+            optimal       = velocity_obstacle;
             new_velocity_ = candidate.position_;
-            break;
         }
     }
 }
 
+void HRVOAgent::addCandidate(const Candidate &candidate)
+{
+    candidate_order_.emplace_back(
+        static_cast<float>((pref_velocity_ - candidate.position_).lengthSquared()),
+        static_cast<int>(candidates_.size()));
+    candidates_.push_back(candidate);
+}
+
+int HRVOAgent::findFirstVelocityObstacleContaining(const Candidate &candidate)
+{
+    const std::size_t num_velocity_obstacles = velocityObstacles_.size();
+    const double x                           = candidate.position_.x();
+    const double y                           = candidate.position_.y();
+    const double *apex_x                     = velocityObstacleArrays_.apex_x_.data();
+    const double *apex_y                     = velocityObstacleArrays_.apex_y_.data();
+    const double *side1_x                    = velocityObstacleArrays_.side1_x_.data();
+    const double *side1_y                    = velocityObstacleArrays_.side1_y_.data();
+    const double *side2_x                    = velocityObstacleArrays_.side2_x_.data();
+    const double *side2_y                    = velocityObstacleArrays_.side2_y_.data();
+    double *inside                           = insideVelocityObstacle_.data();
+
+    // The candidate is inside a velocity obstacle if it is to the left of the first
+    // side and to the right of the second side, which is when both determinants are
+    // positive. This loop only uses arithmetic so that it is vectorized, and then the
+    // first velocity obstacle that contains the candidate is found
+    for (std::size_t j = 0; j < num_velocity_obstacles; ++j)
+    {
+        const double dx = x - apex_x[j];
+        const double dy = y - apex_y[j];
+        inside[j]       = std::min(side1_x[j] * dy - side1_y[j] * dx,
+                             side2_y[j] * dx - side2_x[j] * dy);
+    }
+
+    for (int j = 0; j < static_cast<int>(num_velocity_obstacles); ++j)
+    {
+        if (inside[j] > 0.0 && j != candidate.velocityObstacle1_ &&
+            j != candidate.velocityObstacle2_)
+        {
+            return j;
+        }
+    }
+    return -1;
+}
+
+void HRVOAgent::VelocityObstacleArrays::clear()
+{
+    apex_x_.clear();
+    apex_y_.clear();
+    side1_x_.clear();
+    side1_y_.clear();
+    side2_x_.clear();
+    side2_y_.clear();
+}
+
+void HRVOAgent::VelocityObstacleArrays::reserve(std::size_t num_velocity_obstacles)
+{
+    apex_x_.reserve(num_velocity_obstacles);
+    apex_y_.reserve(num_velocity_obstacles);
+    side1_x_.reserve(num_velocity_obstacles);
+    side1_y_.reserve(num_velocity_obstacles);
+    side2_x_.reserve(num_velocity_obstacles);
+    side2_y_.reserve(num_velocity_obstacles);
+}
+
+void HRVOAgent::VelocityObstacleArrays::push_back(
+    const VelocityObstacle &velocity_obstacle)
+{
+    apex_x_.push_back(velocity_obstacle.apex_.x());
+    apex_y_.push_back(velocity_obstacle.apex_.y());
+    side1_x_.push_back(velocity_obstacle.side1_.x());
+    side1_y_.push_back(velocity_obstacle.side1_.y());
+    side2_x_.push_back(velocity_obstacle.side2_.x());
+    side2_y_.push_back(velocity_obstacle.side2_.y());
+}
+
 void HRVOAgent::computePreferredVelocity()
 {
     if (prefSpeed_ <= 0.01f || max_accel_ <= 0.01f)
@@ -513,22 +584,30 @@ void HRVOAgent::insertNeighbor(std::size_t agentNo, float &rangeSq)
         Vector other_agent_relative_pos = other_agent->getPosition() - position_;
         const float distSq              = other_agent_relative_pos.lengthSquared();
 
-        Vector goal_pos = simulator_->goals_[goal_index_]->getCurrentGoalPosition();
-        Vector relative_goal_pos = goal_pos - position_;
-
-        // Whether the other robot is with in 45 degrees of the goal, relative to us
-        const float forty_five_deg_ratio = 1.f / std::sqrt(2.f);
-        bool is_other_agent_in_front =
-            relative_goal_pos.normalize().dot(other_agent_relative_pos.normalize()) >
-            forty_five_deg_ratio;
-
-        bool is_other_agent_moving_towards_us =
-            velocity_.normalize().dot((other_agent->getVelocity()).normalize()) <
-            -forty_five_deg_ratio;
-
-        // Whether the other agent is within a 1.5-meter radius of our goal
-        bool is_other_agent_near_goal =
-            (other_agent->getPosition() - goal_pos).lengthSquared() < 1.5f;
+        // Whether the other agent is in front of us, moving towards us, and near our
+        // goal. This is only needed for agents outside our search range, so it is only
+        // computed for them
+        auto is_other_agent_approaching_from_goal = [&]() {
+            Vector goal_pos = simulator_->goals_[goal_index_]->getCurrentGoalPosition();
+            Vector relative_goal_pos = goal_pos - position_;
+
+            // Whether the other robot is with in 45 degrees of the goal, relative to us
+            const float forty_five_deg_ratio = 1.f / std::sqrt(2.f);
+            bool is_other_agent_in_front =
+                relative_goal_pos.normalize().dot(other_agent_relative_pos.normalize()) >
+                forty_five_deg_ratio;
+
+            bool is_other_agent_moving_towards_us =
+                velocity_.normalize().dot((other_agent->getVelocity()).normalize()) <
+                -forty_five_deg_ratio;
+
+            // Whether the other agent is within a 1.5-meter radius of our goal
+            bool is_other_agent_near_goal =
+                (other_agent->getPosition() - goal_pos).lengthSquared() < 1.5f;
+
+            return is_other_agent_in_front && is_other_agent_moving_towards_us &&
+                   is_other_agent_near_goal;
+        };
 
         // Helper lambda function
         auto add_other_agent = [&]() {
@@ -555,8 +634,7 @@ void HRVOAgent::insertNeighbor(std::size_t agentNo, float &rangeSq)
         {
             add_other_agent();
         }
-        else if (distSq > rangeSq && is_other_agent_in_front &&
-                 is_other_agent_moving_towards_us && is_other_agent_near_goal)
+        else if (distSq > rangeSq && is_other_agent_approaching_from_goal())
         {
             // This is an edge case for when the other agent is outside our search range,
             // but is moving towards us from behind our destination, so it is posing a
@@ -33,7 +33,6 @@
 #pragma once
 
 #include <cstddef>
-#include <map>
 #include <set>
 #include <utility>
 #include <vector>
@@ -95,7 +94,7 @@ class HRVOAgent : public Agent
     /**
      * Computes the preferred velocity of this agent.
      */
-    void computePreferredVelocity();
+    void computePreferredVelocity() override;
 
     /**
      * Inserts a neighbor into the set of neighbors of this agent.
@@ -124,15 +123,75 @@ class HRVOAgent : public Agent
         int velocityObstacle2_;
     };
 
+    /**
+     * The velocity obstacles stored as a structure of arrays, so that checking a
+     * candidate against every velocity obstacle is a loop the compiler can vectorize
+     */
+    class VelocityObstacleArrays
+    {
+       public:
+        /**
+         * Removes every velocity obstacle, keeping the allocated memory
+         */
+        void clear();
+
+        /**
+         * Reserves memory for the given number of velocity obstacles
+         *
+         * @param num_velocity_obstacles The number of velocity obstacles
+         */
+        void reserve(std::size_t num_velocity_obstacles);
+
+        /**
+         * Adds a velocity obstacle to the end of the arrays
+         *
+         * @param velocity_obstacle The velocity obstacle to add
+         */
+        void push_back(const VelocityObstacle &velocity_obstacle);
+
+        std::vector<double> apex_x_;
+        std::vector<double> apex_y_;
+        std::vector<double> side1_x_;
+        std::vector<double> side1_y_;
+        std::vector<double> side2_x_;
+        std::vector<double> side2_y_;
+    };
+
+    /**
+     * Adds a candidate to the candidate buffer
+     *
+     * @param candidate The candidate to add
+     */
+    void addCandidate(const Candidate &candidate);
+
+    /**
+     * Finds the first velocity obstacle that contains the candidate, ignoring the
+     * velocity obstacles the candidate was created from
+     *
+     * @param candidate The candidate to check
+     *
+     * @return The number of the first velocity obstacle that contains the candidate, or
+     * -1 if the candidate is not inside any velocity obstacle
+     */
+    int findFirstVelocityObstacleContaining(const Candidate &candidate);
+
    public:
     float prefSpeed_;
     std::size_t maxNeighbors_;
     float neighborDist_;
     float uncertaintyOffset_;
-    std::multimap<float, Candidate> candidates_;
+    // The candidates are stored in a flat buffer that is reused every step.
+    // candidate_order_ is a min heap of (distance to the preferred velocity, candidate
+    // number) pairs, so that candidates are checked closest first and equally close
+    // candidates are checked in the order they were added
+    std::vector<Candidate> candidates_;
+    std::vector<std::pair<float, int>> candidate_order_;
     // distance -> Agent Index
     std::set<std::pair<float, std::size_t>> neighbors_;
     std::vector<VelocityObstacle> velocityObstacles_;
+    VelocityObstacleArrays velocityObstacleArrays_;
+    // Positive for each velocity obstacle that contains the candidate being checked
+    std::vector<double> insideVelocityObstacle_;
 
     friend class KdTree;
     friend class Simulator;
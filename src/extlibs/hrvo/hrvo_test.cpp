@@ -410,3 +410,57 @@ TEST_F(HRVOTest, friendly_robot_going_around_ball_obstacle)
     primitive_set.set_stay_away_from_ball(true);
     instantiate_robots_in_world(friendly_start_dest_points, {});
 }
+
+// This test is disabled to speed up CI, it can be enabled by removing "DISABLED_" from
+// the test name
+TEST(HRVOPerformanceTest, DISABLED_robots_around_circle_step_latency)
+{
+    const unsigned int num_steps = 100;
+    const Timestamp current_time = Timestamp::fromSeconds(123);
+    const std::vector<std::optional<std::size_t>> num_worker_threads = {0, std::nullopt};
+
+    for (unsigned int num_robots : {11, 16, 22, 32})
+    {
+        // Every robot moves to the opposite side of the circle, so every robot has to
+        // avoid every other robot
+        std::vector<Robot> friendly_robots;
+        TbotsProto::PrimitiveSet primitive_set;
+        float circle_radius = std::max(float(num_robots) / 10, 2.f);
+        for (unsigned int i = 0; i < num_robots; ++i)
+        {
+            float angle = 2.0f * static_cast<float>(M_PI) * i / num_robots;
+            Point position(std::cos(angle) * circle_radius,
+                           std::sin(angle) * circle_radius);
+            friendly_robots.emplace_back(Robot(i, position, Vector(), Angle(),
+                                               AngularVelocity::zero(), current_time));
+            (*primitive_set.mutable_robot_primitives())[i] = *createMovePrimitive(
+                -position, 0.0, Angle(), TbotsProto::DribblerMode::OFF, AutoChipOrKick(),
+                TbotsProto::MaxAllowedSpeedMode(), 1.0, create2021RobotConstants());
+        }
+        Team friendly_team(Duration::fromMilliseconds(1000));
+        friendly_team.updateRobots(friendly_robots);
+        World world(Field::createSSLDivisionBField(),
+                    Ball(Point(), Vector(), current_time), friendly_team,
+                    Team(Duration::fromMilliseconds(1000)));
+
+        for (const auto& num_threads : num_worker_threads)
+        {
+            Simulator simulator(1.f / SIMULATOR_FRAME_RATE, num_threads);
+            simulator.updatePrimitiveSet(primitive_set);
+            simulator.updateWorld(world);
+
+            auto start_time = std::chrono::high_resolution_clock::now();
+            for (unsigned int i = 0; i < num_steps; i++)
+            {
+                simulator.doStep();
+            }
+            std::chrono::duration<double, std::micro> duration =
+                std::chrono::high_resolution_clock::now() - start_time;
+
+            std::cout << num_robots << " robots, "
+                      << (num_threads ? std::to_string(*num_threads) : "default")
+                      << " worker threads: " << duration.count() / num_steps
+                      << " us per step" << std::endl;
+        }
+    }
+}
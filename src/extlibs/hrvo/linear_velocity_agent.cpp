@@ -9,7 +9,7 @@ LinearVelocityAgent::LinearVelocityAgent(Simulator *simulator, const Vector &pos
 {
 }
 
-void LinearVelocityAgent::computeNewVelocity()
+void LinearVelocityAgent::computePreferredVelocity()
 {
     // Preferring a velocity which points directly towards goal
     pref_velocity_ =
@@ -19,7 +19,10 @@ void LinearVelocityAgent::computeNewVelocity()
     {
         pref_velocity_ = (pref_velocity_).normalize() * max_speed_;
     }
+}
 
+void LinearVelocityAgent::computeNewVelocity()
+{
     const Vector dv = pref_velocity_ - velocity_;
     if (dv.length() <= max_accel_ * simulator_->getTimeStep())
     {
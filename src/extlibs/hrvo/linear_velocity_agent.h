@@ -26,6 +26,12 @@ class LinearVelocityAgent : public Agent
                         const Vector &velocity, float maxSpeed, float maxAccel,
                         std::size_t goal_index, float goalRadius);
 
+    /**
+     * Computes the preferred velocity of this agent, which points directly towards its
+     * goal.
+     */
+    void computePreferredVelocity() override;
+
     /**
      * Computes the new velocity of this agent.
      */
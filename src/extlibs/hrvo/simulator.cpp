@@ -32,7 +32,9 @@
 
 #include "extlibs/hrvo/simulator.h"
 
+#include <algorithm>
 #include <stdexcept>
+#include <thread>
 
 #include "extlibs/hrvo/agent.h"
 #include "extlibs/hrvo/goal.h"
@@ -42,11 +44,13 @@
 #include "software/geom/algorithms/contains.h"
 #include "software/geom/algorithms/intersection.h"
 
-Simulator::Simulator(float time_step)
+Simulator::Simulator(float time_step, std::optional<std::size_t> num_worker_threads)
     : globalTime_(0.0f),
       timeStep_(time_step),
       reachedGoals_(false),
-      kdTree_(std::make_unique<KdTree>(this))
+      kdTree_(std::make_unique<KdTree>(this)),
+      thread_pool_(std::make_unique<ThreadPool>(num_worker_threads.value_or(
+          std::max<unsigned int>(std::thread::hardware_concurrency(), 1) - 1)))
 {
 }
 
@@ -154,10 +158,7 @@ std::size_t Simulator::addHRVORobotAgent(const Robot &robot, int max_neighbors)
     float pref_speed   = 1e-4;
     float max_speed    = 1e-4;
 
-    const std::set<RobotCapability> &unavailable_capabilities =
-        robot.getUnavailableCapabilities();
-    bool can_move = unavailable_capabilities.find(RobotCapability::Move) ==
-                    unavailable_capabilities.end();
+    bool can_move = !robot.getUnavailableCapabilities().contains(RobotCapability::Move);
     if (can_move)
     {
         velocity   = Vector(static_cast<float>(robot.velocity().x()),
@@ -286,11 +287,16 @@ void Simulator::doStep()
 
     kdTree_->build();
 
+    // Agents create velocity obstacles from the preferred velocities of other agents,
+    // so every preferred velocity is computed before any new velocity
     for (auto &agent : agents_)
     {
-        agent->computeNewVelocity();
+        agent->computePreferredVelocity();
     }
 
+    thread_pool_->parallelFor(agents_.size(),
+                              [this](size_t i) { agents_[i]->computeNewVelocity(); });
+
     for (auto &agent : agents_)
     {
         agent->update();
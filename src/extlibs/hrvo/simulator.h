@@ -33,6 +33,7 @@
 #pragma once
 
 #include <limits>
+#include <optional>
 #include <vector>
 
 #include "extlibs/hrvo/agent.h"
@@ -40,12 +41,22 @@
 #include "extlibs/hrvo/kd_tree.h"
 #include "proto/tbots_software_msgs.pb.h"
 #include "software/geom/vector.h"
+#include "software/multithreading/thread_pool.h"
 #include "software/world/world.h"
 
 class Simulator
 {
    public:
-    explicit Simulator(float time_step);
+    /**
+     * Creates a new Simulator
+     *
+     * @param time_step The amount of time which the simulator advances by every step
+     * @param num_worker_threads The number of threads, in addition to the thread calling
+     * doStep, which compute the new velocities of the agents. Defaults to one thread for
+     * every other core
+     */
+    explicit Simulator(float time_step,
+                       std::optional<std::size_t> num_worker_threads = std::nullopt);
     ~Simulator() = default;
 
     /**
@@ -138,6 +149,9 @@ class Simulator
      * Performs a simulation step; updates the position, and velocity
      * of each agent, and the progress of each towards its goal by moving
      * the simulation time_step seconds forward
+     *
+     * The new velocities of the agents are independent of each other once every
+     * preferred velocity has been computed, so they are computed in parallel
      */
     void doStep();
 
@@ -264,6 +278,9 @@ class Simulator
     std::vector<std::unique_ptr<Goal>> goals_;
 
    private:
+    // Computes the new velocities of the agents in parallel
+    std::unique_ptr<ThreadPool> thread_pool_;
+
     // friendly robot id to agent index
     std::map<unsigned int, unsigned int> friendly_robot_id_map;
 
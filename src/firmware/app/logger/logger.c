@@ -18,7 +18,10 @@ typedef struct Logger
 // However, the logger is the _only_ exception to that rule, as dependency injecting
 // the logger into every object that wants to log, is simply overkill. Ontop of that,
 // we cannot have useful log macros like TLOG_WARN(...), TLOG_ERROR(...), etc...
-static Logger_t logger;
+//
+// The logger is thread local so that simulators running on different threads can each
+// log for the robot they are currently simulating.
+static _Thread_local Logger_t logger;
 
 void app_logger_init(unsigned robot_id,
                      void (*robot_log_msg_handler)(TbotsProto_RobotLog log_msg))
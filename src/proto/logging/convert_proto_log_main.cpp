@@ -0,0 +1,68 @@
+#include <boost/program_options.hpp>
+#include <iostream>
+
+#include "proto/logging/indexed_proto_log_writer.h"
+#include "proto/logging/proto_log_converter.h"
+#include "software/logger/logger.h"
+
+/*
+ * This standalone program converts the directories of RepeatedAnyMsg chunks written by
+ * ProtoLoggers to a single indexed proto log, which can be seeked and read much faster.
+ *
+ * Usage:
+ * convert_proto_log_main --output_log match.tbotslog \
+ *     proto_log/Backend_SensorProto proto_log/AI_PrimitiveSet
+ */
+
+int main(int argc, char **argv)
+{
+    namespace po = boost::program_options;
+
+    std::string output_log;
+    std::vector<std::string> replay_dirs;
+
+    po::options_description desc("Options");
+    desc.add_options()("help,h", "Show this help message")(
+        "output_log", po::value<std::string>(&output_log)->required(),
+        "The path of the indexed proto log to create")(
+        "replay_dirs", po::value<std::vector<std::string>>(&replay_dirs)->required(),
+        "The ProtoLogger directories to convert, one for every message type");
+    po::positional_options_description positional_desc;
+    positional_desc.add("replay_dirs", -1);
+
+    po::variables_map vm;
+    try
+    {
+        po::store(po::command_line_parser(argc, argv)
+                      .options(desc)
+                      .positional(positional_desc)
+                      .run(),
+                  vm);
+        if (vm.count("help"))
+        {
+            std::cout << desc << std::endl;
+            return 0;
+        }
+        po::notify(vm);
+    }
+    catch (const po::error &e)
+    {
+        std::cerr << e.what() << std::endl << desc << std::endl;
+        return 1;
+    }
+
+    auto logWorker               = g3::LogWorker::createLogWorker();
+    auto colour_cout_sink_handle = logWorker->addSink(
+        std::make_unique<ColouredCoutSink>(false), &ColouredCoutSink::displayColouredLog);
+    g3::initializeLogging(logWorker.get());
+
+    IndexedProtoLogWriter log_writer(output_log);
+    for (const std::string &replay_dir : replay_dirs)
+    {
+        size_t num_msgs = convertProtoLogToIndexedProtoLog(replay_dir, log_writer);
+        LOG(INFO) << "Converted " << num_msgs << " messages from " << replay_dir;
+    }
+    log_writer.close();
+
+    return 0;
+}
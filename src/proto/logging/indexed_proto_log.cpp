@@ -0,0 +1,34 @@
+#include "proto/logging/indexed_proto_log.h"
+
+#include "proto/tbots_timestamp_msg.pb.h"
+
+std::optional<Timestamp> IndexedProtoLog::findMsgTimestamp(
+    const google::protobuf::Message& msg)
+{
+    const google::protobuf::Descriptor* descriptor = msg.GetDescriptor();
+    const google::protobuf::Reflection* reflection = msg.GetReflection();
+    const std::string& timestamp_type_name =
+        TbotsProto::Timestamp::descriptor()->full_name();
+
+    for (int i = 0; i < descriptor->field_count(); i++)
+    {
+        const google::protobuf::FieldDescriptor* field = descriptor->field(i);
+        if (field->type() == google::protobuf::FieldDescriptor::TYPE_MESSAGE &&
+            !field->is_repeated() &&
+            field->message_type()->full_name() == timestamp_type_name &&
+            reflection->HasField(msg, field))
+        {
+            const google::protobuf::Message& timestamp_msg =
+                reflection->GetMessage(msg, field);
+            const google::protobuf::FieldDescriptor* seconds_field =
+                timestamp_msg.GetDescriptor()->FindFieldByName("epoch_timestamp_seconds");
+            double seconds =
+                timestamp_msg.GetReflection()->GetDouble(timestamp_msg, seconds_field);
+            if (seconds >= 0)
+            {
+                return Timestamp::fromSeconds(seconds);
+            }
+        }
+    }
+    return std::nullopt;
+}
@@ -0,0 +1,89 @@
+#pragma once
+
+#include <google/protobuf/message.h>
+
+#include <cstdint>
+#include <optional>
+
+#include "software/time/timestamp.h"
+
+/**
+ * The layout of an indexed proto log file. Every message of every logged type is appended
+ * to a single file as it is logged, without wrapping it in a google::protobuf::Any, and
+ * an index of all the messages is appended when the log is closed. This lets
+ * IndexedProtoLogReader memory map the file and read any message without reading the
+ * messages before it.
+ *
+ * All integers and doubles are stored in the byte order of the machine that wrote the
+ * log (little endian on every machine we use).
+ *
+ * | FileHeader |
+ * | RecordHeader | serialized message or stream declaration |
+ * | RecordHeader | serialized message or stream declaration |
+ * | ... |
+ * | uint32 number of streams | (uint32 type name size | type name) for every stream |
+ * | IndexEntry for every message |
+ * | FileTrailer |
+ *
+ * Every message type gets its own "stream" of messages. A stream is declared by a record
+ * with the stream id STREAM_DECLARATION_ID containing the full protobuf name of the
+ * message type, and streams are numbered from 0 in the order they are declared.
+ *
+ * The index and trailer are only written when the log is closed. If the process that was
+ * logging crashed, the index is rebuilt by reading the record headers instead.
+ */
+namespace IndexedProtoLog
+{
+    static constexpr char FILE_MAGIC[8]    = {'T', 'B', 'O', 'T', 'S', 'L', 'O', 'G'};
+    static constexpr char TRAILER_MAGIC[8] = {'T', 'B', 'O', 'T', 'S', 'I', 'D', 'X'};
+    static constexpr uint32_t VERSION      = 1;
+    static constexpr uint32_t STREAM_DECLARATION_ID = UINT32_MAX;
+
+    struct FileHeader
+    {
+        char magic[8];
+        uint32_t version;
+        uint32_t reserved;
+    };
+
+    struct RecordHeader
+    {
+        // The size of the record after this header
+        uint32_t size;
+        uint32_t stream_id;
+        double timestamp_seconds;
+    };
+
+    struct IndexEntry
+    {
+        double timestamp_seconds;
+        // The offset of the serialized message from the start of the file
+        uint64_t offset;
+        uint32_t size;
+        uint32_t stream_id;
+    };
+
+    struct FileTrailer
+    {
+        // The offset of the number of streams from the start of the file
+        uint64_t index_offset;
+        uint64_t num_entries;
+        char magic[8];
+    };
+
+    static_assert(sizeof(FileHeader) == 16 && sizeof(RecordHeader) == 16 &&
+                      sizeof(IndexEntry) == 24 && sizeof(FileTrailer) == 24,
+                  "The indexed proto log structs must not contain padding");
+
+    /**
+     * Finds the time a message was created from the first TbotsProto::Timestamp field
+     * that is set in the message, such as SensorProto::backend_received_time or
+     * TbotsProto::PrimitiveSet::time_sent
+     *
+     * @param msg The message
+     *
+     * @return the time the message was created, or std::nullopt if the message has no
+     * TbotsProto::Timestamp field that is set
+     */
+    std::optional<Timestamp> findMsgTimestamp(const google::protobuf::Message& msg);
+}  // namespace IndexedProtoLog
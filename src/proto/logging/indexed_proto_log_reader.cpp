@@ -0,0 +1,237 @@
+#include "proto/logging/indexed_proto_log_reader.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cstring>
+
+#include "software/logger/logger.h"
+
+namespace
+{
+    /**
+     * Copies a value out of the mapped file, which may not be aligned for the type
+     */
+    template <typename T>
+    T readValue(const char* data)
+    {
+        T value;
+        std::memcpy(&value, data, sizeof(T));
+        return value;
+    }
+}  // namespace
+
+IndexedProtoLogReader::IndexedProtoLogReader(const std::string& log_path)
+    : log_path(log_path),
+      mapped_log(nullptr),
+      mapped_log_size(0),
+      has_index(false),
+      msg_types(),
+      msg_records()
+{
+    int fd = open(log_path.c_str(), O_RDONLY);
+    if (fd < 0)
+    {
+        throw std::invalid_argument(log_path + " does not exist or can't be read!");
+    }
+
+    struct stat log_stat;
+    if (fstat(fd, &log_stat) != 0 ||
+        static_cast<size_t>(log_stat.st_size) < sizeof(IndexedProtoLog::FileHeader))
+    {
+        ::close(fd);
+        throw std::invalid_argument(log_path + " is not an indexed proto log!");
+    }
+    mapped_log_size = static_cast<size_t>(log_stat.st_size);
+
+    // the mapping stays valid after the file descriptor is closed
+    void* mapping = mmap(nullptr, mapped_log_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (mapping == MAP_FAILED)
+    {
+        throw std::invalid_argument("Failed to memory map " + log_path);
+    }
+    mapped_log = static_cast<const char*>(mapping);
+
+    auto header = readValue<IndexedProtoLog::FileHeader>(mapped_log);
+    if (std::memcmp(header.magic, IndexedProtoLog::FILE_MAGIC, sizeof(header.magic)) !=
+            0 ||
+        header.version != IndexedProtoLog::VERSION)
+    {
+        munmap(const_cast<char*>(mapped_log), mapped_log_size);
+        throw std::invalid_argument(log_path +
+                                    " is not an indexed proto log of a known version!");
+    }
+
+    try
+    {
+        has_index = readIndex();
+        if (!has_index)
+        {
+            LOG(WARNING) << log_path
+                         << " has no index, it was probably not closed properly. "
+                            "Rebuilding the index from the messages.";
+            recoverIndex();
+        }
+    }
+    catch (const std::invalid_argument&)
+    {
+        munmap(const_cast<char*>(mapped_log), mapped_log_size);
+        throw;
+    }
+
+    // messages are logged in the order they are received, which is not necessarily the
+    // order of their timestamps
+    for (auto& [msg_type, records] : msg_records)
+    {
+        std::stable_sort(records.begin(), records.end(),
+                         [](const MsgRecord& lhs, const MsgRecord& rhs) {
+                             return lhs.timestamp_seconds < rhs.timestamp_seconds;
+                         });
+    }
+}
+
+IndexedProtoLogReader::~IndexedProtoLogReader()
+{
+    munmap(const_cast<char*>(mapped_log), mapped_log_size);
+}
+
+const std::vector<std::string>& IndexedProtoLogReader::getMsgTypes() const
+{
+    return msg_types;
+}
+
+bool IndexedProtoLogReader::hasIndex() const
+{
+    return has_index;
+}
+
+bool IndexedProtoLogReader::readIndex()
+{
+    if (mapped_log_size <
+        sizeof(IndexedProtoLog::FileHeader) + sizeof(IndexedProtoLog::FileTrailer))
+    {
+        return false;
+    }
+
+    auto trailer = readValue<IndexedProtoLog::FileTrailer>(
+        mapped_log + mapped_log_size - sizeof(IndexedProtoLog::FileTrailer));
+    if (std::memcmp(trailer.magic, IndexedProtoLog::TRAILER_MAGIC,
+                    sizeof(trailer.magic)) != 0)
+    {
+        return false;
+    }
+
+    const size_t index_end = mapped_log_size - sizeof(IndexedProtoLog::FileTrailer);
+    size_t offset          = trailer.index_offset;
+    if (offset > index_end || index_end - offset < sizeof(uint32_t))
+    {
+        return false;
+    }
+    auto num_streams = readValue<uint32_t>(mapped_log + offset);
+    offset += sizeof(uint32_t);
+    std::vector<std::string> stream_types;
+    for (uint32_t stream_id = 0; stream_id < num_streams; stream_id++)
+    {
+        if (index_end - offset < sizeof(uint32_t))
+        {
+            return false;
+        }
+        auto type_size = readValue<uint32_t>(mapped_log + offset);
+        offset += sizeof(uint32_t);
+        if (index_end - offset < type_size)
+        {
+            return false;
+        }
+        stream_types.emplace_back(mapped_log + offset, type_size);
+        offset += type_size;
+    }
+
+    if ((index_end - offset) % sizeof(IndexedProtoLog::IndexEntry) != 0 ||
+        (index_end - offset) / sizeof(IndexedProtoLog::IndexEntry) != trailer.num_entries)
+    {
+        return false;
+    }
+
+    msg_types = std::move(stream_types);
+    for (uint64_t i = 0; i < trailer.num_entries; i++)
+    {
+        auto entry = readValue<IndexedProtoLog::IndexEntry>(
+            mapped_log + offset + i * sizeof(IndexedProtoLog::IndexEntry));
+        addMsgRecord(entry.stream_id, entry.timestamp_seconds, entry.offset, entry.size);
+    }
+    return true;
+}
+
+void IndexedProtoLogReader::recoverIndex()
+{
+    size_t offset = sizeof(IndexedProtoLog::FileHeader);
+    while (offset + sizeof(IndexedProtoLog::RecordHeader) <= mapped_log_size)
+    {
+        auto header = readValue<IndexedProtoLog::RecordHeader>(mapped_log + offset);
+        offset += sizeof(IndexedProtoLog::RecordHeader);
+        if (mapped_log_size - offset < header.size)
+        {
+            // the last record was only partially written
+            break;
+        }
+
+        if (header.stream_id == IndexedProtoLog::STREAM_DECLARATION_ID)
+        {
+            msg_types.emplace_back(mapped_log + offset, header.size);
+        }
+        else if (header.stream_id < msg_types.size())
+        {
+            addMsgRecord(header.stream_id, header.timestamp_seconds, offset, header.size);
+        }
+        else
+        {
+            LOG(WARNING) << "Stopped reading " << log_path.string()
+                         << " at a message of undeclared stream " << header.stream_id;
+            break;
+        }
+        offset += header.size;
+    }
+}
+
+void IndexedProtoLogReader::addMsgRecord(uint32_t stream_id, double timestamp_seconds,
+                                         uint64_t offset, uint32_t size)
+{
+    if (stream_id >= msg_types.size() || offset > mapped_log_size ||
+        mapped_log_size - offset < size)
+    {
+        throw std::invalid_argument(log_path.string() +
+                                    " has a message that is not in the log!");
+    }
+    msg_records[msg_types[stream_id]].emplace_back(
+        MsgRecord{timestamp_seconds, mapped_log + offset, size});
+}
+
+const std::vector<IndexedProtoLogReader::MsgRecord>& IndexedProtoLogReader::getMsgRecords(
+    const std::string& message_type) const
+{
+    static const std::vector<MsgRecord> NO_MSG_RECORDS;
+
+    auto records_iter = msg_records.find(message_type);
+    if (records_iter == msg_records.end())
+    {
+        return NO_MSG_RECORDS;
+    }
+    return records_iter->second;
+}
+
+const IndexedProtoLogReader::MsgRecord& IndexedProtoLogReader::getMsgRecord(
+    const std::string& message_type, size_t msg_idx) const
+{
+    const std::vector<MsgRecord>& records = getMsgRecords(message_type);
+    if (msg_idx >= records.size())
+    {
+        throw std::out_of_range("Message " + std::to_string(msg_idx) + " of type " +
+                                message_type + " is not in " + log_path.string() +
+                                ", which has " + std::to_string(records.size()) +
+                                " messages of that type");
+    }
+    return records[msg_idx];
+}
@@ -0,0 +1,221 @@
+#pragma once
+
+#include <google/protobuf/message.h>
+
+#include <algorithm>
+#include <filesystem>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "proto/logging/indexed_proto_log.h"
+#include "software/time/timestamp.h"
+#include "software/util/typename/typename.h"
+
+/**
+ * Reads an indexed proto log file written by an IndexedProtoLogWriter. See
+ * indexed_proto_log.h for the layout of the file.
+ *
+ * The file is memory mapped and only its index is read up front, so opening an hours
+ * long log is fast and any message can be read without reading the messages before it.
+ * The messages of every type are ordered by their timestamps, and can be read in any
+ * order, ex. backwards:
+ *
+ * ```
+ * IndexedProtoLogReader reader("match.tbotslog");
+ * for (size_t i = reader.numMsgs<SensorProto>(); i-- > 0;)
+ * {
+ *     SensorProto sensor_msg = reader.getMsg<SensorProto>(i);
+ * }
+ * ```
+ */
+class IndexedProtoLogReader
+{
+   public:
+    /**
+     * Opens an indexed proto log file. If the log has no index because the process that
+     * wrote it crashed, the index is rebuilt from the messages in the file.
+     *
+     * @param log_path The path of the log file
+     *
+     * @throws std::invalid_argument if the file doesn't exist or is not an indexed proto
+     * log
+     */
+    explicit IndexedProtoLogReader(const std::string& log_path);
+
+    IndexedProtoLogReader(const IndexedProtoLogReader&) = delete;
+    IndexedProtoLogReader& operator=(const IndexedProtoLogReader&) = delete;
+    ~IndexedProtoLogReader();
+
+    /**
+     * Gets the full protobuf names of the types of messages in the log, in the order
+     * they were first logged
+     *
+     * @return the types of messages in the log
+     */
+    const std::vector<std::string>& getMsgTypes() const;
+
+    /**
+     * Returns whether the log was closed properly and has an index. If it doesn't, the
+     * index was rebuilt and the last message may be missing.
+     *
+     * @return whether the log has an index
+     */
+    bool hasIndex() const;
+
+    /**
+     * Gets the number of messages of type MsgT in the log
+     *
+     * @return the number of messages of type MsgT
+     */
+    template <typename MsgT>
+    size_t numMsgs() const;
+
+    /**
+     * Reads the msg_idx'th message of type MsgT, ordered by timestamp
+     *
+     * @param msg_idx The index of the message
+     *
+     * @throws std::out_of_range if there are not more than msg_idx messages of type MsgT
+     * @throws std::invalid_argument if the message can't be parsed
+     *
+     * @return the msg_idx'th message of type MsgT
+     */
+    template <typename MsgT>
+    MsgT getMsg(size_t msg_idx) const;
+
+    /**
+     * Gets the timestamp of the msg_idx'th message of type MsgT without parsing it
+     *
+     * @param msg_idx The index of the message
+     *
+     * @throws std::out_of_range if there are not more than msg_idx messages of type MsgT
+     *
+     * @return the timestamp of the msg_idx'th message of type MsgT
+     */
+    template <typename MsgT>
+    Timestamp getMsgTimestamp(size_t msg_idx) const;
+
+    /**
+     * Finds the first message of type MsgT at or after the given time
+     *
+     * @param timestamp The time to seek to
+     *
+     * @return the index of the first message of type MsgT at or after the timestamp, or
+     * numMsgs<MsgT>() if every message is before the timestamp
+     */
+    template <typename MsgT>
+    size_t findMsgIdx(const Timestamp& timestamp) const;
+
+   private:
+    // A message in the mapped file
+    struct MsgRecord
+    {
+        double timestamp_seconds;
+        const char* data;
+        uint32_t size;
+    };
+
+    /**
+     * Reads the index at the end of the file
+     *
+     * @return false if the file has no valid index
+     */
+    bool readIndex();
+
+    /**
+     * Rebuilds the index by reading the header of every record in the file
+     */
+    void recoverIndex();
+
+    /**
+     * Adds a message to the stream with the given id
+     *
+     * @param stream_id The id of the stream
+     * @param timestamp_seconds The timestamp of the message
+     * @param offset The offset of the message from the start of the file
+     * @param size The size of the message
+     *
+     * @throws std::invalid_argument if the stream or message is not in the file
+     */
+    void addMsgRecord(uint32_t stream_id, double timestamp_seconds, uint64_t offset,
+                      uint32_t size);
+
+    /**
+     * Gets the messages of a type
+     *
+     * @param message_type The full protobuf name of the message type
+     *
+     * @return the messages of the type, ordered by timestamp
+     */
+    const std::vector<MsgRecord>& getMsgRecords(const std::string& message_type) const;
+
+    /**
+     * Gets the msg_idx'th message of a type
+     *
+     * @param message_type The full protobuf name of the message type
+     * @param msg_idx The index of the message
+     *
+     * @throws std::out_of_range if there are not more than msg_idx messages of the type
+     *
+     * @return the msg_idx'th message of the type
+     */
+    const MsgRecord& getMsgRecord(const std::string& message_type, size_t msg_idx) const;
+
+    std::filesystem::path log_path;
+    const char* mapped_log;
+    size_t mapped_log_size;
+    bool has_index;
+    std::vector<std::string> msg_types;
+    std::unordered_map<std::string, std::vector<MsgRecord>> msg_records;
+};
+
+template <typename MsgT>
+size_t IndexedProtoLogReader::numMsgs() const
+{
+    static_assert(std::is_base_of_v<google::protobuf::Message, MsgT>,
+                  "MsgT must be a derived class of google::protobuf::Message!");
+    return getMsgRecords(MsgT::descriptor()->full_name()).size();
+}
+
+template <typename MsgT>
+MsgT IndexedProtoLogReader::getMsg(size_t msg_idx) const
+{
+    static_assert(std::is_base_of_v<google::protobuf::Message, MsgT>,
+                  "MsgT must be a derived class of google::protobuf::Message!");
+
+    const MsgRecord& msg_record = getMsgRecord(MsgT::descriptor()->full_name(), msg_idx);
+    MsgT msg;
+    if (!msg.ParseFromArray(msg_record.data, static_cast<int>(msg_record.size)))
+    {
+        throw std::invalid_argument("Failed to parse " + TYPENAME(MsgT) + " " +
+                                    std::to_string(msg_idx) + " from " +
+                                    log_path.string());
+    }
+    return msg;
+}
+
+template <typename MsgT>
+Timestamp IndexedProtoLogReader::getMsgTimestamp(size_t msg_idx) const
+{
+    static_assert(std::is_base_of_v<google::protobuf::Message, MsgT>,
+                  "MsgT must be a derived class of google::protobuf::Message!");
+    return Timestamp::fromSeconds(
+        getMsgRecord(MsgT::descriptor()->full_name(), msg_idx).timestamp_seconds);
+}
+
+template <typename MsgT>
+size_t IndexedProtoLogReader::findMsgIdx(const Timestamp& timestamp) const
+{
+    static_assert(std::is_base_of_v<google::protobuf::Message, MsgT>,
+                  "MsgT must be a derived class of google::protobuf::Message!");
+
+    const std::vector<MsgRecord>& records =
+        getMsgRecords(MsgT::descriptor()->full_name());
+    auto record_iter =
+        std::lower_bound(records.begin(), records.end(), timestamp.toSeconds(),
+                         [](const MsgRecord& record, double timestamp_seconds) {
+                             return record.timestamp_seconds < timestamp_seconds;
+                         });
+    return static_cast<size_t>(record_iter - records.begin());
+}
@@ -0,0 +1,248 @@
+#include <google/protobuf/util/message_differencer.h>
+#include <gtest/gtest.h>
+
+#include "proto/logging/indexed_proto_log_reader.h"
+#include "proto/logging/indexed_proto_log_writer.h"
+#include "proto/logging/indexed_proto_logger.h"
+#include "proto/logging/proto_log_converter.h"
+#include "proto/logging/proto_log_reader.h"
+#include "proto/sensor_msg.pb.h"
+#include "proto/tbots_software_msgs.pb.h"
+#include "software/multithreading/subject.hpp"
+
+// the working directory of tests are the bazel WORKSPACE root (in this case, src)
+// this path is relative to the current working directory, i.e. the bazel root
+constexpr const char* REPLAY_TEST_PATH_SUFFIX = "proto/logging/test_logs";
+
+namespace fs = std::filesystem;
+
+class IndexedProtoLogTest : public ::testing::Test
+{
+   protected:
+    void SetUp() override
+    {
+        log_path = fs::current_path() /
+                   (std::string(
+                        ::testing::UnitTest::GetInstance()->current_test_info()->name()) +
+                    ".tbotslog");
+        fs::remove(log_path);
+    }
+
+    void TearDown() override
+    {
+        fs::remove(log_path);
+    }
+
+    static SensorProto createSensorMsg(double timestamp_seconds)
+    {
+        SensorProto sensor_msg;
+        sensor_msg.mutable_backend_received_time()->set_epoch_timestamp_seconds(
+            timestamp_seconds);
+        sensor_msg.add_robot_status_msgs()->set_robot_id(
+            static_cast<unsigned int>(timestamp_seconds));
+        return sensor_msg;
+    }
+
+    static TbotsProto::PrimitiveSet createPrimitiveSet(double timestamp_seconds)
+    {
+        TbotsProto::PrimitiveSet primitive_set;
+        primitive_set.mutable_time_sent()->set_epoch_timestamp_seconds(timestamp_seconds);
+        primitive_set.set_stay_away_from_ball(true);
+        return primitive_set;
+    }
+
+    fs::path log_path;
+};
+
+TEST_F(IndexedProtoLogTest, test_read_messages_of_every_type)
+{
+    {
+        IndexedProtoLogWriter writer(log_path);
+        for (int i = 0; i < 100; i++)
+        {
+            writer.writeMsg(createSensorMsg(i), Timestamp::fromSeconds(i));
+            if (i % 2 == 0)
+            {
+                writer.writeMsg(createPrimitiveSet(i), Timestamp::fromSeconds(i + 0.5));
+            }
+        }
+    }
+
+    IndexedProtoLogReader reader(log_path);
+    EXPECT_TRUE(reader.hasIndex());
+    EXPECT_EQ(std::vector<std::string>({"SensorProto", "TbotsProto.PrimitiveSet"}),
+              reader.getMsgTypes());
+    ASSERT_EQ(100, reader.numMsgs<SensorProto>());
+    ASSERT_EQ(50, reader.numMsgs<TbotsProto::PrimitiveSet>());
+    EXPECT_EQ(0, reader.numMsgs<TbotsProto::Vision>());
+
+    // read the messages backwards to make sure they don't depend on each other
+    for (size_t i = reader.numMsgs<SensorProto>(); i-- > 0;)
+    {
+        EXPECT_TRUE(google::protobuf::util::MessageDifferencer::Equivalent(
+            createSensorMsg(static_cast<double>(i)), reader.getMsg<SensorProto>(i)));
+        EXPECT_EQ(Timestamp::fromSeconds(static_cast<double>(i)),
+                  reader.getMsgTimestamp<SensorProto>(i));
+    }
+    for (size_t i = reader.numMsgs<TbotsProto::PrimitiveSet>(); i-- > 0;)
+    {
+        EXPECT_TRUE(google::protobuf::util::MessageDifferencer::Equivalent(
+            createPrimitiveSet(static_cast<double>(i * 2)),
+            reader.getMsg<TbotsProto::PrimitiveSet>(i)));
+    }
+
+    EXPECT_THROW(reader.getMsg<SensorProto>(100), std::out_of_range);
+    EXPECT_THROW(reader.getMsg<TbotsProto::Vision>(0), std::out_of_range);
+}
+
+TEST_F(IndexedProtoLogTest, test_find_message_at_timestamp)
+{
+    {
+        IndexedProtoLogWriter writer(log_path);
+        for (int i = 0; i < 10; i++)
+        {
+            writer.writeMsg(createSensorMsg(i), Timestamp::fromSeconds(10 + i));
+        }
+    }
+
+    IndexedProtoLogReader reader(log_path);
+    EXPECT_EQ(0, reader.findMsgIdx<SensorProto>(Timestamp::fromSeconds(0)));
+    EXPECT_EQ(0, reader.findMsgIdx<SensorProto>(Timestamp::fromSeconds(10)));
+    EXPECT_EQ(4, reader.findMsgIdx<SensorProto>(Timestamp::fromSeconds(13.5)));
+    EXPECT_EQ(9, reader.findMsgIdx<SensorProto>(Timestamp::fromSeconds(19)));
+    EXPECT_EQ(10, reader.findMsgIdx<SensorProto>(Timestamp::fromSeconds(19.5)));
+    EXPECT_EQ(0, reader.findMsgIdx<TbotsProto::PrimitiveSet>(Timestamp::fromSeconds(0)));
+}
+
+TEST_F(IndexedProtoLogTest, test_messages_are_ordered_by_timestamp)
+{
+    {
+        IndexedProtoLogWriter writer(log_path);
+        writer.writeMsg(createSensorMsg(2), Timestamp::fromSeconds(2));
+        writer.writeMsg(createSensorMsg(0), Timestamp::fromSeconds(0));
+        writer.writeMsg(createSensorMsg(1), Timestamp::fromSeconds(1));
+    }
+
+    IndexedProtoLogReader reader(log_path);
+    ASSERT_EQ(3, reader.numMsgs<SensorProto>());
+    for (size_t i = 0; i < 3; i++)
+    {
+        EXPECT_TRUE(google::protobuf::util::MessageDifferencer::Equivalent(
+            createSensorMsg(static_cast<double>(i)), reader.getMsg<SensorProto>(i)));
+    }
+}
+
+TEST_F(IndexedProtoLogTest, test_recover_log_that_was_not_closed)
+{
+    IndexedProtoLogWriter writer(log_path);
+    for (int i = 0; i < 10; i++)
+    {
+        writer.writeMsg(createSensorMsg(i), Timestamp::fromSeconds(i));
+        writer.writeMsg(createPrimitiveSet(i), Timestamp::fromSeconds(i));
+    }
+    writer.flush();
+
+    // the writer is still open, so the log has no index
+    IndexedProtoLogReader reader(log_path);
+    EXPECT_FALSE(reader.hasIndex());
+    ASSERT_EQ(10, reader.numMsgs<SensorProto>());
+    ASSERT_EQ(10, reader.numMsgs<TbotsProto::PrimitiveSet>());
+    EXPECT_TRUE(google::protobuf::util::MessageDifferencer::Equivalent(
+        createSensorMsg(9), reader.getMsg<SensorProto>(9)));
+
+    // the process crashed while the last message was being written
+    fs::path truncated_log_path = log_path;
+    truncated_log_path += ".truncated";
+    fs::copy_file(log_path, truncated_log_path, fs::copy_options::overwrite_existing);
+    fs::resize_file(truncated_log_path, fs::file_size(log_path) - 3);
+    IndexedProtoLogReader truncated_reader(truncated_log_path);
+    EXPECT_FALSE(truncated_reader.hasIndex());
+    EXPECT_EQ(10, truncated_reader.numMsgs<SensorProto>());
+    EXPECT_EQ(9, truncated_reader.numMsgs<TbotsProto::PrimitiveSet>());
+    fs::remove(truncated_log_path);
+}
+
+TEST_F(IndexedProtoLogTest, test_writer_does_not_overwrite_log)
+{
+    IndexedProtoLogWriter writer(log_path);
+    EXPECT_THROW(IndexedProtoLogWriter another_writer(log_path), std::invalid_argument);
+}
+
+TEST_F(IndexedProtoLogTest, test_reader_throws_for_file_that_is_not_a_log)
+{
+    EXPECT_THROW(IndexedProtoLogReader reader(log_path), std::invalid_argument);
+    std::ofstream(log_path) << "this is not an indexed proto log";
+    EXPECT_THROW(IndexedProtoLogReader reader(log_path), std::invalid_argument);
+}
+
+TEST_F(IndexedProtoLogTest, test_indexed_proto_logger)
+{
+    class TestSubject : public Subject<SensorProto>
+    {
+       public:
+        void sendValue(SensorProto val)
+        {
+            sendValueToObservers(val);
+        }
+    };
+
+    {
+        auto writer = std::make_shared<IndexedProtoLogWriter>(log_path);
+        TestSubject subject;
+        subject.registerObserver(
+            std::make_shared<IndexedProtoLogger<SensorProto>>(writer));
+        for (int i = 0; i < 10; i++)
+        {
+            subject.sendValue(createSensorMsg(i));
+        }
+
+        // the messages are logged in another thread, wait until they are all logged
+        for (int attempt = 0; attempt < 100; attempt++)
+        {
+            writer->flush();
+            if (IndexedProtoLogReader(log_path).numMsgs<SensorProto>() == 10)
+            {
+                break;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+    }
+
+    IndexedProtoLogReader reader(log_path);
+    ASSERT_EQ(10, reader.numMsgs<SensorProto>());
+    for (size_t i = 0; i < 10; i++)
+    {
+        // the messages are indexed by their backend_received_time
+        EXPECT_EQ(Timestamp::fromSeconds(static_cast<double>(i)),
+                  reader.getMsgTimestamp<SensorProto>(i));
+    }
+}
+
+TEST_F(IndexedProtoLogTest, test_convert_proto_log)
+{
+    std::vector<SensorProto> proto_log_msgs;
+    ProtoLogReader proto_log_reader(fs::current_path() / REPLAY_TEST_PATH_SUFFIX);
+    while (auto sensor_msg = proto_log_reader.getNextMsg<SensorProto>())
+    {
+        proto_log_msgs.emplace_back(*sensor_msg);
+    }
+
+    {
+        IndexedProtoLogWriter writer(log_path);
+        EXPECT_EQ(proto_log_msgs.size(),
+                  convertProtoLogToIndexedProtoLog(
+                      fs::current_path() / REPLAY_TEST_PATH_SUFFIX, writer));
+    }
+
+    IndexedProtoLogReader reader(log_path);
+    ASSERT_EQ(proto_log_msgs.size(), reader.numMsgs<SensorProto>());
+    for (size_t i = 0; i < proto_log_msgs.size(); i++)
+    {
+        EXPECT_TRUE(google::protobuf::util::MessageDifferencer::Equivalent(
+            proto_log_msgs[i], reader.getMsg<SensorProto>(i)));
+        EXPECT_EQ(
+            Timestamp::fromSeconds(
+                proto_log_msgs[i].backend_received_time().epoch_timestamp_seconds()),
+            reader.getMsgTimestamp<SensorProto>(i));
+    }
+}
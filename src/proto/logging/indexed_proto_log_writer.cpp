@@ -0,0 +1,164 @@
+#include "proto/logging/indexed_proto_log_writer.h"
+
+#include <cstring>
+
+#include "software/logger/logger.h"
+
+IndexedProtoLogWriter::IndexedProtoLogWriter(const std::string& log_path)
+    : log_path(log_path),
+      log_ofstream(),
+      file_offset(0),
+      stream_ids(),
+      stream_types(),
+      index(),
+      serialized_msg_buffer(),
+      closed(false),
+      writer_mutex()
+{
+    if (std::filesystem::exists(this->log_path))
+    {
+        // silently overwriting a log would destroy a previous replay
+        throw std::invalid_argument(log_path + " already exists! Find another path!");
+    }
+    if (this->log_path.has_parent_path())
+    {
+        std::filesystem::create_directories(this->log_path.parent_path());
+    }
+
+    log_ofstream.open(this->log_path, std::ios_base::out | std::ios_base::binary);
+    if (!log_ofstream.is_open())
+    {
+        throw std::invalid_argument("Failed to create " + log_path);
+    }
+
+    IndexedProtoLog::FileHeader header{};
+    std::memcpy(header.magic, IndexedProtoLog::FILE_MAGIC, sizeof(header.magic));
+    header.version = IndexedProtoLog::VERSION;
+    writeBytes(&header, sizeof(header));
+
+    LOG(INFO) << "Logging protobufs to " << this->log_path.string();
+}
+
+IndexedProtoLogWriter::~IndexedProtoLogWriter()
+{
+    close();
+}
+
+void IndexedProtoLogWriter::writeMsg(const google::protobuf::Message& msg,
+                                     const Timestamp& timestamp)
+{
+    std::scoped_lock lock(writer_mutex);
+    if (closed)
+    {
+        LOG(WARNING) << "Dropping " << msg.GetTypeName() << " written to closed log "
+                     << log_path.string();
+        return;
+    }
+    if (!msg.SerializeToString(&serialized_msg_buffer))
+    {
+        LOG(WARNING) << "Failed to serialize " << msg.GetTypeName() << " to "
+                     << log_path.string();
+        return;
+    }
+    writeRecord(getStreamId(msg.GetTypeName()), timestamp.toSeconds(),
+                serialized_msg_buffer);
+}
+
+void IndexedProtoLogWriter::writeSerializedMsg(const std::string& message_type,
+                                               const std::string& serialized_msg,
+                                               const Timestamp& timestamp)
+{
+    std::scoped_lock lock(writer_mutex);
+    if (closed)
+    {
+        LOG(WARNING) << "Dropping " << message_type << " written to closed log "
+                     << log_path.string();
+        return;
+    }
+    writeRecord(getStreamId(message_type), timestamp.toSeconds(), serialized_msg);
+}
+
+void IndexedProtoLogWriter::flush()
+{
+    std::scoped_lock lock(writer_mutex);
+    if (!closed)
+    {
+        log_ofstream.flush();
+    }
+}
+
+void IndexedProtoLogWriter::close()
+{
+    std::scoped_lock lock(writer_mutex);
+    if (closed)
+    {
+        return;
+    }
+
+    IndexedProtoLog::FileTrailer trailer{};
+    trailer.index_offset = file_offset;
+    trailer.num_entries  = index.size();
+    std::memcpy(trailer.magic, IndexedProtoLog::TRAILER_MAGIC, sizeof(trailer.magic));
+
+    uint32_t num_streams = static_cast<uint32_t>(stream_types.size());
+    writeBytes(&num_streams, sizeof(num_streams));
+    for (const std::string& stream_type : stream_types)
+    {
+        uint32_t type_size = static_cast<uint32_t>(stream_type.size());
+        writeBytes(&type_size, sizeof(type_size));
+        writeBytes(stream_type.data(), stream_type.size());
+    }
+    writeBytes(index.data(), index.size() * sizeof(IndexedProtoLog::IndexEntry));
+    writeBytes(&trailer, sizeof(trailer));
+
+    log_ofstream.close();
+    closed = true;
+
+    if (log_ofstream.fail())
+    {
+        LOG(WARNING) << "Failed to write the index of " << log_path.string();
+    }
+    else
+    {
+        LOG(DEBUG) << "Saved " << index.size() << " messages to " << log_path.string();
+    }
+}
+
+uint32_t IndexedProtoLogWriter::getStreamId(const std::string& message_type)
+{
+    auto stream_id_iter = stream_ids.find(message_type);
+    if (stream_id_iter != stream_ids.end())
+    {
+        return stream_id_iter->second;
+    }
+
+    uint32_t stream_id = static_cast<uint32_t>(stream_types.size());
+    writeRecord(IndexedProtoLog::STREAM_DECLARATION_ID, 0, message_type);
+    stream_ids.emplace(message_type, stream_id);
+    stream_types.emplace_back(message_type);
+    return stream_id;
+}
+
+void IndexedProtoLogWriter::writeRecord(uint32_t stream_id, double timestamp_seconds,
+                                        const std::string& data)
+{
+    IndexedProtoLog::RecordHeader header{};
+    header.size              = static_cast<uint32_t>(data.size());
+    header.stream_id         = stream_id;
+    header.timestamp_seconds = timestamp_seconds;
+    writeBytes(&header, sizeof(header));
+
+    if (stream_id != IndexedProtoLog::STREAM_DECLARATION_ID)
+    {
+        index.emplace_back(IndexedProtoLog::IndexEntry{timestamp_seconds, file_offset,
+                                                       header.size, stream_id});
+    }
+    writeBytes(data.data(), data.size());
+}
+
+void IndexedProtoLogWriter::writeBytes(const void* data, size_t size)
+{
+    log_ofstream.write(static_cast<const char*>(data),
+                       static_cast<std::streamsize>(size));
+    file_offset += size;
+}
@@ -0,0 +1,113 @@
+#pragma once
+
+#include <google/protobuf/message.h>
+
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "proto/logging/indexed_proto_log.h"
+#include "software/time/timestamp.h"
+
+/**
+ * Writes messages of any protobuf type to a single indexed proto log file, which can be
+ * read with an IndexedProtoLogReader. See indexed_proto_log.h for the layout of the file.
+ *
+ * Messages are appended to the file as they are written, and the index of all the
+ * messages is appended when the writer is closed. Messages can be written from any
+ * thread.
+ */
+class IndexedProtoLogWriter
+{
+   public:
+    /**
+     * Creates an IndexedProtoLogWriter that writes to a new file
+     *
+     * @param log_path The path of the log file to create
+     *
+     * @throws std::invalid_argument if the file already exists or can't be created
+     */
+    explicit IndexedProtoLogWriter(const std::string& log_path);
+
+    // if we allow copying of an `IndexedProtoLogWriter`, we could end up with 2 writers
+    // writing over each other and possibly resulting in lost data
+    IndexedProtoLogWriter(const IndexedProtoLogWriter&) = delete;
+    ~IndexedProtoLogWriter();
+
+    /**
+     * Appends a message to the stream of its type
+     *
+     * @param msg The message to write
+     * @param timestamp The time the message was created, which the message can be looked
+     * up by
+     */
+    void writeMsg(const google::protobuf::Message& msg, const Timestamp& timestamp);
+
+    /**
+     * Appends a message that is already serialized to the stream of its type
+     *
+     * @param message_type The full protobuf name of the type of the message, ex.
+     * "TbotsProto.PrimitiveSet"
+     * @param serialized_msg The serialized message
+     * @param timestamp The time the message was created, which the message can be looked
+     * up by
+     */
+    void writeSerializedMsg(const std::string& message_type,
+                            const std::string& serialized_msg,
+                            const Timestamp& timestamp);
+
+    /**
+     * Flushes all written messages to the file, so that they can be recovered if the
+     * process crashes before the log is closed
+     */
+    void flush();
+
+    /**
+     * Writes the index to the end of the file and closes it. Messages can't be written
+     * after the log is closed. This is a no-op if the log is already closed.
+     */
+    void close();
+
+   private:
+    /**
+     * Gets the id of the stream for a message type, and declares the stream if it
+     * hasn't been declared yet
+     *
+     * @param message_type The full protobuf name of the message type
+     *
+     * @return the id of the stream for the message type
+     */
+    uint32_t getStreamId(const std::string& message_type);
+
+    /**
+     * Appends a record to the file
+     *
+     * @param stream_id The id of the stream of the record
+     * @param timestamp_seconds The timestamp of the record
+     * @param data The contents of the record
+     */
+    void writeRecord(uint32_t stream_id, double timestamp_seconds,
+                     const std::string& data);
+
+    /**
+     * Appends raw bytes to the file and advances the file offset
+     *
+     * @param data The bytes to write
+     * @param size The number of bytes to write
+     */
+    void writeBytes(const void* data, size_t size);
+
+    std::filesystem::path log_path;
+    std::ofstream log_ofstream;
+    uint64_t file_offset;
+    std::unordered_map<std::string, uint32_t> stream_ids;
+    std::vector<std::string> stream_types;
+    std::vector<IndexedProtoLog::IndexEntry> index;
+    // reused to serialize messages without allocating every time
+    std::string serialized_msg_buffer;
+    bool closed;
+    std::mutex writer_mutex;
+};
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <optional>
+
+#include "proto/logging/indexed_proto_log_writer.h"
+#include "software/multithreading/configurable_threaded_observer.h"
+
+/**
+ * Logs every MsgT it observes to the stream of MsgT in an indexed proto log. Loggers of
+ * different message types can share the same IndexedProtoLogWriter, so that a whole
+ * match is logged to a single file.
+ *
+ * @tparam MsgT The type of protobuf message to log
+ */
+template <typename MsgT>
+class IndexedProtoLogger : public ConfigurableThreadedObserver<MsgT>
+{
+    static_assert(
+        std::is_base_of_v<google::protobuf::Message, MsgT>,
+        "IndexedProtoLogger can only be instantiated with a protobuf message as template parameter!");
+
+   public:
+    /**
+     * Creates an IndexedProtoLogger
+     *
+     * @param log_writer The writer of the log to log messages to
+     * @param get_msg_timestamp Gets the timestamp of a message to index it by. If not
+     * provided, messages are indexed by the first TbotsProto::Timestamp field set in the
+     * message, or by the time they were received by the logger if there is none.
+     * @param policy The order to log received messages in. By default every message is
+     * logged in the order it was received.
+     */
+    explicit IndexedProtoLogger(
+        std::shared_ptr<IndexedProtoLogWriter> log_writer,
+        std::optional<std::function<Timestamp(const MsgT&)>> get_msg_timestamp =
+            std::nullopt,
+        ThreadedObserverPolicy policy = ThreadedObserverPolicy::FIRST_IN_FIRST_OUT);
+
+    IndexedProtoLogger(const IndexedProtoLogger&) = delete;
+
+   private:
+    void onValueReceived(MsgT msg) override;
+
+    std::shared_ptr<IndexedProtoLogWriter> log_writer;
+    std::optional<std::function<Timestamp(const MsgT&)>> get_msg_timestamp;
+};
+
+#include "proto/logging/indexed_proto_logger.tpp"
@@ -0,0 +1,37 @@
+#include <chrono>
+
+#include "proto/logging/indexed_proto_logger.h"
+
+template <typename MsgT>
+IndexedProtoLogger<MsgT>::IndexedProtoLogger(
+    std::shared_ptr<IndexedProtoLogWriter> log_writer,
+    std::optional<std::function<Timestamp(const MsgT&)>> get_msg_timestamp,
+    ThreadedObserverPolicy policy)
+    : ConfigurableThreadedObserver<MsgT>(policy, 2000),
+      log_writer(log_writer),
+      get_msg_timestamp(get_msg_timestamp)
+{
+}
+
+template <typename MsgT>
+void IndexedProtoLogger<MsgT>::onValueReceived(MsgT msg)
+{
+    std::optional<Timestamp> timestamp;
+    if (get_msg_timestamp)
+    {
+        timestamp = (*get_msg_timestamp)(msg);
+    }
+    else
+    {
+        timestamp = IndexedProtoLog::findMsgTimestamp(msg);
+    }
+
+    if (!timestamp)
+    {
+        timestamp = Timestamp::fromSeconds(
+            std::chrono::duration<double>(
+                std::chrono::system_clock::now().time_since_epoch())
+                .count());
+    }
+    log_writer->writeMsg(msg, *timestamp);
+}
@@ -0,0 +1,96 @@
+#include "proto/logging/proto_log_converter.h"
+
+#include <google/protobuf/util/delimited_message_util.h>
+
+#include <algorithm>
+#include <fstream>
+#include <memory>
+
+#include "proto/repeated_any_msg.pb.h"
+#include "software/logger/logger.h"
+
+namespace fs = std::filesystem;
+
+size_t convertProtoLogToIndexedProtoLog(const std::string& replay_dir,
+                                        IndexedProtoLogWriter& log_writer)
+{
+    if (!fs::is_directory(replay_dir))
+    {
+        throw std::invalid_argument(replay_dir +
+                                    " does not exist or is not a directory!");
+    }
+
+    // chunk files are numerically named, but not necessarily starting at 0
+    std::vector<size_t> chunk_indices;
+    for (const auto& dir_entry : fs::directory_iterator(replay_dir))
+    {
+        const std::string filename = dir_entry.path().filename().string();
+        if (!filename.empty() && std::all_of(filename.begin(), filename.end(), ::isdigit))
+        {
+            chunk_indices.emplace_back(std::stoul(filename));
+        }
+    }
+    if (chunk_indices.empty())
+    {
+        throw std::invalid_argument(
+            replay_dir +
+            " contains no files with numerical names! It is not a valid replay_logging directory!");
+    }
+    std::sort(chunk_indices.begin(), chunk_indices.end());
+
+    size_t num_msgs_converted = 0;
+    Timestamp last_timestamp;
+    RepeatedAnyMsg chunk;
+    std::unique_ptr<google::protobuf::Message> msg;
+    for (size_t chunk_idx : chunk_indices)
+    {
+        fs::path chunk_path = fs::path(replay_dir) / std::to_string(chunk_idx);
+        std::ifstream chunk_ifstream(chunk_path,
+                                     std::ios_base::in | std::ios_base::binary);
+        google::protobuf::io::IstreamInputStream chunk_input(&chunk_ifstream);
+        google::protobuf::io::CodedInputStream coded_input(&chunk_input);
+        // parsing a delimited message merges it into the previous chunk
+        chunk.Clear();
+        if (!google::protobuf::util::ParseDelimitedFromCodedStream(&chunk, &coded_input,
+                                                                   nullptr))
+        {
+            throw std::invalid_argument("Failed to parse protobuf from file " +
+                                        chunk_path.string());
+        }
+
+        for (const google::protobuf::Any& any_msg : chunk.messages())
+        {
+            // the type url is "type.googleapis.com/<full name of the message type>"
+            const std::string& type_url = any_msg.type_url();
+            const std::string msg_type  = type_url.substr(type_url.find_last_of('/') + 1);
+
+            // the message is only parsed to find its timestamp
+            const google::protobuf::Descriptor* descriptor =
+                google::protobuf::DescriptorPool::generated_pool()->FindMessageTypeByName(
+                    msg_type);
+            if (descriptor)
+            {
+                if (!msg || msg->GetDescriptor() != descriptor)
+                {
+                    msg.reset(google::protobuf::MessageFactory::generated_factory()
+                                  ->GetPrototype(descriptor)
+                                  ->New());
+                }
+                if (msg->ParseFromString(any_msg.value()))
+                {
+                    last_timestamp =
+                        IndexedProtoLog::findMsgTimestamp(*msg).value_or(last_timestamp);
+                }
+            }
+            else
+            {
+                LOG(WARNING) << "Unknown message type " << msg_type << " in "
+                             << chunk_path.string() << ", it will not be timestamped";
+            }
+
+            log_writer.writeSerializedMsg(msg_type, any_msg.value(), last_timestamp);
+            num_msgs_converted++;
+        }
+    }
+    return num_msgs_converted;
+}
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <string>
+
+#include "proto/logging/indexed_proto_log_writer.h"
+
+/**
+ * Converts a directory of RepeatedAnyMsg chunks written by a ProtoLogger to a stream of
+ * an indexed proto log. The messages are copied out of their google::protobuf::Any
+ * without being re-serialized, and are indexed by the first TbotsProto::Timestamp field
+ * set in them. Messages without a timestamp are indexed by the timestamp of the message
+ * before them, so that they stay in order.
+ *
+ * @param replay_dir The directory of numerically named chunk files to convert
+ * @param log_writer The writer of the indexed proto log to convert the messages to
+ *
+ * @throws std::invalid_argument if the directory is not a ProtoLogger directory or a
+ * chunk can't be parsed
+ *
+ * @return the number of messages that were converted
+ */
+size_t convertProtoLogToIndexedProtoLog(const std::string& replay_dir,
+                                        IndexedProtoLogWriter& log_writer);
@@ -2,10 +2,10 @@
 #include <filesystem>
 
 #include "proto/repeated_any_msg.pb.h"
-#include "software/multithreading/first_in_first_out_threaded_observer.h"
+#include "software/multithreading/configurable_threaded_observer.h"
 
 template <typename MsgT>
-class ProtoLogger : public FirstInFirstOutThreadedObserver<MsgT>
+class ProtoLogger : public ConfigurableThreadedObserver<MsgT>
 {
     static_assert(
         std::is_base_of_v<google::protobuf::Message, MsgT>,
@@ -21,11 +21,15 @@ class ProtoLogger : public FirstInFirstOutThreadedObserver<MsgT>
      * @param output_directory The absolute path of the directory that we output
      *                         RepeatedAnyMsg chunk files to.
      * @param _msgs_per_chunk number of messages per chunk
+     * @param message_sort_comparator Sorts the messages of a chunk before it is saved
+     * @param policy The order to log received messages in. By default every message is
+     * logged in the order it was received.
      */
-    explicit ProtoLogger(const std::string& output_directory,
-                         int _msgs_per_chunk = DEFAULT_MSGS_PER_CHUNK,
-                         std::optional<std::function<bool(const MsgT&, const MsgT&)>>
-                             message_sort_comparator = std::nullopt);
+    explicit ProtoLogger(
+        const std::string& output_directory, int _msgs_per_chunk = DEFAULT_MSGS_PER_CHUNK,
+        std::optional<std::function<bool(const MsgT&, const MsgT&)>>
+            message_sort_comparator   = std::nullopt,
+        ThreadedObserverPolicy policy = ThreadedObserverPolicy::FIRST_IN_FIRST_OUT);
 
     // if we allow copying of a `ProtoLogger`, we could end up with 2 `ProtoLogger`s
     // writing over each other and possibly resulting in lost data
@@ -8,8 +8,9 @@
 template <typename MsgT>
 ProtoLogger<MsgT>::ProtoLogger(
     const std::string& output_directory, int _msgs_per_chunk,
-    std::optional<std::function<bool(const MsgT&, const MsgT&)>> message_sort_comparator)
-    : FirstInFirstOutThreadedObserver<MsgT>(2000),
+    std::optional<std::function<bool(const MsgT&, const MsgT&)>> message_sort_comparator,
+    ThreadedObserverPolicy policy)
+    : ConfigurableThreadedObserver<MsgT>(policy, 2000),
       current_chunk(),
       current_chunk_idx(0),
       output_dir_path(output_directory),
@@ -1,23 +1,250 @@
 #include "proto/message_translation/primitive_google_to_nanopb_converter.h"
 
-#include <pb_decode.h>
+#include <stdexcept>
 
-TbotsProto_Primitive createNanoPbPrimitive(const TbotsProto::Primitive& google_primitive)
+namespace
 {
-    // Serialize the message to an array of raw values
-    std::vector<uint8_t> serialized_proto(google_primitive.ByteSizeLong());
-    google_primitive.SerializeToArray(serialized_proto.data(),
-                                      static_cast<int>(google_primitive.ByteSizeLong()));
+    /**
+     * Convert the given google timestamp proto to a NanoPb message
+     *
+     * @param google_timestamp The google timestamp proto to convert
+     *
+     * @return The NanoPb message representing the given timestamp
+     */
+    TbotsProto_Timestamp createNanoPbTimestamp(
+        const TbotsProto::Timestamp& google_timestamp)
+    {
+        TbotsProto_Timestamp nanopb_timestamp = TbotsProto_Timestamp_init_zero;
+        nanopb_timestamp.epoch_timestamp_seconds =
+            google_timestamp.epoch_timestamp_seconds();
+        return nanopb_timestamp;
+    }
+
+    /**
+     * Convert the given google latency trace proto to a NanoPb message
+     *
+     * @param google_latency_trace The google latency trace proto to convert
+     *
+     * @return The NanoPb message representing the given latency trace
+     */
+    TbotsProto_LatencyTrace createNanoPbLatencyTrace(
+        const TbotsProto::LatencyTrace& google_latency_trace)
+    {
+        TbotsProto_LatencyTrace nanopb_latency_trace = TbotsProto_LatencyTrace_init_zero;
+        nanopb_latency_trace.vision_capture_time =
+            createNanoPbTimestamp(google_latency_trace.vision_capture_time());
+        nanopb_latency_trace.vision_sent_time =
+            createNanoPbTimestamp(google_latency_trace.vision_sent_time());
+        nanopb_latency_trace.backend_received_time =
+            createNanoPbTimestamp(google_latency_trace.backend_received_time());
+        nanopb_latency_trace.sensor_fusion_start_time =
+            createNanoPbTimestamp(google_latency_trace.sensor_fusion_start_time());
+        nanopb_latency_trace.world_sent_time =
+            createNanoPbTimestamp(google_latency_trace.world_sent_time());
+        nanopb_latency_trace.ai_start_time =
+            createNanoPbTimestamp(google_latency_trace.ai_start_time());
+        nanopb_latency_trace.primitive_set_sent_time =
+            createNanoPbTimestamp(google_latency_trace.primitive_set_sent_time());
+        return nanopb_latency_trace;
+    }
+
+    /**
+     * Convert the given google path proto to a NanoPb message
+     *
+     * @param google_path The google path proto to convert
+     *
+     * @throws std::runtime_error if the path has more points than the NanoPb message
+     * can hold
+     *
+     * @return The NanoPb message representing the given path
+     */
+    TbotsProto_Path createNanoPbPath(const TbotsProto::Path& google_path)
+    {
+        TbotsProto_Path nanopb_path = TbotsProto_Path_init_zero;
+        if (static_cast<size_t>(google_path.point_size()) >
+            pb_arraysize(TbotsProto_Path, point))
+        {
+            throw std::runtime_error(
+                "Too many points in the path when converting google Path proto to NanoPb");
+        }
 
+        nanopb_path.point_count = static_cast<pb_size_t>(google_path.point_size());
+        for (int i = 0; i < google_path.point_size(); i++)
+        {
+            nanopb_path.point[i].x_meters = google_path.point(i).x_meters();
+            nanopb_path.point[i].y_meters = google_path.point(i).y_meters();
+        }
+        return nanopb_path;
+    }
+
+    /**
+     * Convert the given google move primitive proto to a NanoPb message
+     *
+     * @param google_move The google move primitive proto to convert
+     *
+     * @return The NanoPb message representing the given move primitive
+     */
+    TbotsProto_MovePrimitive createNanoPbMovePrimitive(
+        const TbotsProto::MovePrimitive& google_move)
+    {
+        TbotsProto_MovePrimitive nanopb_move = TbotsProto_MovePrimitive_init_zero;
+        nanopb_move.path                     = createNanoPbPath(google_move.path());
+        nanopb_move.final_speed_m_per_s      = google_move.final_speed_m_per_s();
+        nanopb_move.final_angle.radians      = google_move.final_angle().radians();
+        nanopb_move.dribbler_speed_rpm       = google_move.dribbler_speed_rpm();
+        nanopb_move.max_speed_m_per_s        = google_move.max_speed_m_per_s();
+        nanopb_move.target_spin_rev_per_s    = google_move.target_spin_rev_per_s();
+
+        const TbotsProto::MovePrimitive::AutoChipOrKick& google_auto_chip_or_kick =
+            google_move.auto_chip_or_kick();
+        switch (google_auto_chip_or_kick.auto_chip_or_kick_case())
+        {
+            case TbotsProto::MovePrimitive::AutoChipOrKick::kAutokickSpeedMPerS:
+                nanopb_move.auto_chip_or_kick.which_auto_chip_or_kick =
+                    TbotsProto_MovePrimitive_AutoChipOrKick_autokick_speed_m_per_s_tag;
+                nanopb_move.auto_chip_or_kick.auto_chip_or_kick.autokick_speed_m_per_s =
+                    google_auto_chip_or_kick.autokick_speed_m_per_s();
+                break;
+            case TbotsProto::MovePrimitive::AutoChipOrKick::kAutochipDistanceMeters:
+                nanopb_move.auto_chip_or_kick.which_auto_chip_or_kick =
+                    TbotsProto_MovePrimitive_AutoChipOrKick_autochip_distance_meters_tag;
+                nanopb_move.auto_chip_or_kick.auto_chip_or_kick.autochip_distance_meters =
+                    google_auto_chip_or_kick.autochip_distance_meters();
+                break;
+            case TbotsProto::MovePrimitive::AutoChipOrKick::AUTO_CHIP_OR_KICK_NOT_SET:
+                break;
+        }
+        return nanopb_move;
+    }
+
+    /**
+     * Convert the given google direct control primitive proto to a NanoPb message
+     *
+     * @param google_direct_control The google direct control primitive proto to
+     * convert
+     *
+     * @return The NanoPb message representing the given direct control primitive
+     */
+    TbotsProto_DirectControlPrimitive createNanoPbDirectControlPrimitive(
+        const TbotsProto::DirectControlPrimitive& google_direct_control)
+    {
+        TbotsProto_DirectControlPrimitive nanopb_direct_control =
+            TbotsProto_DirectControlPrimitive_init_zero;
 
+        switch (google_direct_control.wheel_control_case())
+        {
+            case TbotsProto::DirectControlPrimitive::kDirectPerWheelControl:
+            {
+                const TbotsProto::DirectControlPrimitive::DirectPerWheelControl&
+                    google_per_wheel_control =
+                        google_direct_control.direct_per_wheel_control();
+                TbotsProto_DirectControlPrimitive_DirectPerWheelControl&
+                    nanopb_per_wheel_control =
+                        nanopb_direct_control.wheel_control.direct_per_wheel_control;
+                nanopb_direct_control.which_wheel_control =
+                    TbotsProto_DirectControlPrimitive_direct_per_wheel_control_tag;
+                nanopb_per_wheel_control.front_left_wheel_rpm =
+                    google_per_wheel_control.front_left_wheel_rpm();
+                nanopb_per_wheel_control.back_left_wheel_rpm =
+                    google_per_wheel_control.back_left_wheel_rpm();
+                nanopb_per_wheel_control.front_right_wheel_rpm =
+                    google_per_wheel_control.front_right_wheel_rpm();
+                nanopb_per_wheel_control.back_right_wheel_rpm =
+                    google_per_wheel_control.back_right_wheel_rpm();
+                break;
+            }
+            case TbotsProto::DirectControlPrimitive::kDirectVelocityControl:
+            {
+                const TbotsProto::DirectControlPrimitive::DirectVelocityControl&
+                    google_velocity_control =
+                        google_direct_control.direct_velocity_control();
+                TbotsProto_DirectControlPrimitive_DirectVelocityControl&
+                    nanopb_velocity_control =
+                        nanopb_direct_control.wheel_control.direct_velocity_control;
+                nanopb_direct_control.which_wheel_control =
+                    TbotsProto_DirectControlPrimitive_direct_velocity_control_tag;
+                nanopb_velocity_control.velocity.x_component_meters =
+                    google_velocity_control.velocity().x_component_meters();
+                nanopb_velocity_control.velocity.y_component_meters =
+                    google_velocity_control.velocity().y_component_meters();
+                nanopb_velocity_control.angular_velocity.radians_per_second =
+                    google_velocity_control.angular_velocity().radians_per_second();
+                break;
+            }
+            case TbotsProto::DirectControlPrimitive::WHEEL_CONTROL_NOT_SET:
+                break;
+        }
+
+        nanopb_direct_control.charge_mode =
+            static_cast<TbotsProto_DirectControlPrimitive_ChargeMode>(
+                google_direct_control.charge_mode());
+
+        switch (google_direct_control.chick_command_case())
+        {
+            case TbotsProto::DirectControlPrimitive::kKickSpeedMPerS:
+                nanopb_direct_control.which_chick_command =
+                    TbotsProto_DirectControlPrimitive_kick_speed_m_per_s_tag;
+                nanopb_direct_control.chick_command.kick_speed_m_per_s =
+                    google_direct_control.kick_speed_m_per_s();
+                break;
+            case TbotsProto::DirectControlPrimitive::kChipDistanceMeters:
+                nanopb_direct_control.which_chick_command =
+                    TbotsProto_DirectControlPrimitive_chip_distance_meters_tag;
+                nanopb_direct_control.chick_command.chip_distance_meters =
+                    google_direct_control.chip_distance_meters();
+                break;
+            case TbotsProto::DirectControlPrimitive::kAutokickSpeedMPerS:
+                nanopb_direct_control.which_chick_command =
+                    TbotsProto_DirectControlPrimitive_autokick_speed_m_per_s_tag;
+                nanopb_direct_control.chick_command.autokick_speed_m_per_s =
+                    google_direct_control.autokick_speed_m_per_s();
+                break;
+            case TbotsProto::DirectControlPrimitive::kAutochipDistanceMeters:
+                nanopb_direct_control.which_chick_command =
+                    TbotsProto_DirectControlPrimitive_autochip_distance_meters_tag;
+                nanopb_direct_control.chick_command.autochip_distance_meters =
+                    google_direct_control.autochip_distance_meters();
+                break;
+            case TbotsProto::DirectControlPrimitive::CHICK_COMMAND_NOT_SET:
+                break;
+        }
+
+        nanopb_direct_control.dribbler_speed_rpm =
+            google_direct_control.dribbler_speed_rpm();
+        return nanopb_direct_control;
+    }
+}  // namespace
+
+TbotsProto_Primitive createNanoPbPrimitive(const TbotsProto::Primitive& google_primitive)
+{
+    // The fields are copied directly instead of serializing the google message and
+    // decoding it with NanoPb, since this runs for every robot on every tick and
+    // doesn't need to allocate
     TbotsProto_Primitive nanopb_primitive = TbotsProto_Primitive_init_zero;
 
-    pb_istream_t pb_in_stream = pb_istream_from_buffer(
-        static_cast<uint8_t*>(serialized_proto.data()), serialized_proto.size());
-    if (!pb_decode(&pb_in_stream, TbotsProto_Primitive_fields, &nanopb_primitive))
+    switch (google_primitive.primitive_case())
     {
-        throw std::runtime_error(
-            "Failed to decode serialized primitive to NanoPb when converting google Primitive proto to NanoPb");
+        case TbotsProto::Primitive::kEstop:
+            nanopb_primitive.which_primitive = TbotsProto_Primitive_estop_tag;
+            break;
+        case TbotsProto::Primitive::kMove:
+            nanopb_primitive.which_primitive = TbotsProto_Primitive_move_tag;
+            nanopb_primitive.primitive.move =
+                createNanoPbMovePrimitive(google_primitive.move());
+            break;
+        case TbotsProto::Primitive::kStop:
+            nanopb_primitive.which_primitive = TbotsProto_Primitive_stop_tag;
+            nanopb_primitive.primitive.stop.stop_type =
+                static_cast<TbotsProto_StopPrimitive_StopType>(
+                    google_primitive.stop().stop_type());
+            break;
+        case TbotsProto::Primitive::kDirectControl:
+            nanopb_primitive.which_primitive = TbotsProto_Primitive_direct_control_tag;
+            nanopb_primitive.primitive.direct_control =
+                createNanoPbDirectControlPrimitive(google_primitive.direct_control());
+            break;
+        case TbotsProto::Primitive::PRIMITIVE_NOT_SET:
+            break;
     }
 
     return nanopb_primitive;
@@ -26,20 +253,29 @@ TbotsProto_Primitive createNanoPbPrimitive(const TbotsProto::Primitive& google_p
 TbotsProto_PrimitiveSet createNanoPbPrimitiveSet(
     const TbotsProto::PrimitiveSet& google_primitive_set)
 {
-    // Serialize the message to an array of raw values
-    std::vector<uint8_t> serialized_proto(google_primitive_set.ByteSizeLong());
-    google_primitive_set.SerializeToArray(
-        serialized_proto.data(), static_cast<int>(google_primitive_set.ByteSizeLong()));
-
-
     TbotsProto_PrimitiveSet nanopb_primitive_set = TbotsProto_PrimitiveSet_init_zero;
 
-    pb_istream_t pb_in_stream = pb_istream_from_buffer(
-        static_cast<uint8_t*>(serialized_proto.data()), serialized_proto.size());
-    if (!pb_decode(&pb_in_stream, TbotsProto_PrimitiveSet_fields, &nanopb_primitive_set))
+    if (google_primitive_set.robot_primitives().size() >
+        pb_arraysize(TbotsProto_PrimitiveSet, robot_primitives))
     {
         throw std::runtime_error(
-            "Failed to decode serialized primitive_set to NanoPb when converting google PrimitiveSet proto to NanoPb");
+            "Too many robot primitives when converting google PrimitiveSet proto to NanoPb");
+    }
+
+    nanopb_primitive_set.time_sent =
+        createNanoPbTimestamp(google_primitive_set.time_sent());
+    nanopb_primitive_set.stay_away_from_ball = google_primitive_set.stay_away_from_ball();
+    nanopb_primitive_set.latency_trace =
+        createNanoPbLatencyTrace(google_primitive_set.latency_trace());
+
+    for (const auto& [robot_id, google_primitive] :
+         google_primitive_set.robot_primitives())
+    {
+        TbotsProto_PrimitiveSet_RobotPrimitivesEntry& robot_primitive =
+            nanopb_primitive_set
+                .robot_primitives[nanopb_primitive_set.robot_primitives_count++];
+        robot_primitive.key   = robot_id;
+        robot_primitive.value = createNanoPbPrimitive(google_primitive);
     }
 
     return nanopb_primitive_set;
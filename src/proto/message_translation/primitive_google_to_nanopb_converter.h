@@ -10,10 +10,14 @@ extern "C"
 }
 
 /**
- * Convert the given google primitive proto to a NanoPb message
+ * Convert the given google primitive proto to a NanoPb message. The fields are copied
+ * directly, without serializing the google proto or allocating.
  *
  * @param google_primitive The google primitive proto to convert to a NanoPb message
  *
+ * @throws std::runtime_error if the primitive has a path with more points than the
+ * NanoPb message can hold
+ *
  * @return The NanoPb message representing the given primitive
  */
 TbotsProto_Primitive createNanoPbPrimitive(const TbotsProto::Primitive& google_primitive);
@@ -24,6 +28,9 @@ TbotsProto_Primitive createNanoPbPrimitive(const TbotsProto::Primitive& google_p
  * @param google_primitive_set The google primitive set proto to convert to a NanoPb
  * message
  *
+ * @throws std::runtime_error if the primitive set has more robot primitives, or a
+ * primitive has more path points, than the NanoPb message can hold
+ *
  * @return The NanoPb message representing the given primitive
  */
 TbotsProto_PrimitiveSet createNanoPbPrimitiveSet(
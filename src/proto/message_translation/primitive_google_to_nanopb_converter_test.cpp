@@ -3,20 +3,137 @@
 #include <google/protobuf/util/message_differencer.h>
 #include <gtest/gtest.h>
 #include <math.h>
+#include <pb_decode.h>
+#include <pb_encode.h>
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
 
 #include "proto/primitive/primitive_msg_factory.h"
 #include "shared/2015_robot_constants.h"
+#include "software/test_util/test_util.h"
 
 /**
- * Rather then testing every single primitive to make sure it's converted correctly,
- * we have a single simple integration test to ensure the primitive is being converted
- * at all, as all the code to actually perform the conversion is not here (it's generated
- * from the proto, or defined in other visitors)
+ * The conversion copies every field by hand, so it is checked against the google
+ * proto by round tripping a PrimitiveSet with every kind of primitive through NanoPb,
+ * and against converting by serializing the google proto and decoding it with NanoPb
  */
 
 class PrimitiveGoogleToNanoPbConverterTest : public testing::Test
 {
    protected:
+    /**
+     * Creates a PrimitiveSet with every kind of primitive, and every field set
+     *
+     * @return the PrimitiveSet
+     */
+    TbotsProto::PrimitiveSet createPrimitiveSetWithEveryPrimitive()
+    {
+        TbotsProto::PrimitiveSet primitive_set;
+        primitive_set.mutable_time_sent()->set_epoch_timestamp_seconds(1634.5);
+        primitive_set.set_stay_away_from_ball(true);
+
+        TbotsProto::LatencyTrace& latency_trace = *primitive_set.mutable_latency_trace();
+        latency_trace.mutable_vision_capture_time()->set_epoch_timestamp_seconds(1.0);
+        latency_trace.mutable_vision_sent_time()->set_epoch_timestamp_seconds(2.0);
+        latency_trace.mutable_backend_received_time()->set_epoch_timestamp_seconds(3.0);
+        latency_trace.mutable_sensor_fusion_start_time()->set_epoch_timestamp_seconds(
+            4.0);
+        latency_trace.mutable_world_sent_time()->set_epoch_timestamp_seconds(5.0);
+        latency_trace.mutable_ai_start_time()->set_epoch_timestamp_seconds(6.0);
+        latency_trace.mutable_primitive_set_sent_time()->set_epoch_timestamp_seconds(7.0);
+
+        auto& robot_primitives = *primitive_set.mutable_robot_primitives();
+        robot_primitives[0]    = *createMovePrimitive(
+            Point(1, 2), 100, Angle::half(), TbotsProto::DribblerMode::MAX_FORCE,
+            {AutoChipOrKickMode::AUTOCHIP, 2.5},
+            TbotsProto::MaxAllowedSpeedMode::PHYSICAL_LIMIT, 1.5, robot_constants);
+        robot_primitives[1] = *createMovePrimitive(
+            Point(-3, 0.5), 2, Angle::quarter(), TbotsProto::DribblerMode::INDEFINITE,
+            {AutoChipOrKickMode::AUTOKICK, 4.5},
+            TbotsProto::MaxAllowedSpeedMode::STOP_COMMAND, 0.0, robot_constants);
+        robot_primitives[2] = *createStopPrimitive(true);
+        robot_primitives[3] = *createEstopPrimitive();
+
+        robot_primitives[4] = *createDirectControlPrimitive(
+            Vector(1, -2), AngularVelocity::fromRadians(3), 5000);
+        robot_primitives[4].mutable_direct_control()->set_charge_mode(
+            TbotsProto::DirectControlPrimitive::CHARGE);
+        robot_primitives[4].mutable_direct_control()->set_chip_distance_meters(1.5);
+
+        TbotsProto::DirectControlPrimitive& direct_per_wheel_control =
+            *robot_primitives[5].mutable_direct_control();
+        auto& per_wheel_control =
+            *direct_per_wheel_control.mutable_direct_per_wheel_control();
+        per_wheel_control.set_front_left_wheel_rpm(100);
+        per_wheel_control.set_back_left_wheel_rpm(-200);
+        per_wheel_control.set_front_right_wheel_rpm(300);
+        per_wheel_control.set_back_right_wheel_rpm(-400);
+        direct_per_wheel_control.set_charge_mode(
+            TbotsProto::DirectControlPrimitive::FLOAT);
+        direct_per_wheel_control.set_kick_speed_m_per_s(5.5);
+        direct_per_wheel_control.set_dribbler_speed_rpm(-1000);
+
+        robot_primitives[6] = *createDirectControlPrimitive(
+            Vector(0.5, 0.5), AngularVelocity::fromRadians(-1), 0);
+        robot_primitives[6].mutable_direct_control()->set_autokick_speed_m_per_s(3.0);
+
+        robot_primitives[7] =
+            *createDirectControlPrimitive(Vector(-0.5, 0.5), AngularVelocity::zero(), 0);
+        robot_primitives[7].mutable_direct_control()->set_autochip_distance_meters(2.0);
+
+        return primitive_set;
+    }
+
+    /**
+     * Converts the given google PrimitiveSet to NanoPb by serializing it and decoding
+     * it with NanoPb
+     *
+     * @param google_primitive_set The google PrimitiveSet to convert
+     *
+     * @return The NanoPb PrimitiveSet
+     */
+    static TbotsProto_PrimitiveSet createNanoPbPrimitiveSetBySerializing(
+        const TbotsProto::PrimitiveSet& google_primitive_set)
+    {
+        std::vector<uint8_t> serialized_proto(google_primitive_set.ByteSizeLong());
+        google_primitive_set.SerializeToArray(serialized_proto.data(),
+                                              static_cast<int>(serialized_proto.size()));
+
+        TbotsProto_PrimitiveSet nanopb_primitive_set = TbotsProto_PrimitiveSet_init_zero;
+        pb_istream_t pb_in_stream =
+            pb_istream_from_buffer(serialized_proto.data(), serialized_proto.size());
+        if (!pb_decode(&pb_in_stream, TbotsProto_PrimitiveSet_fields,
+                       &nanopb_primitive_set))
+        {
+            throw std::runtime_error("Failed to decode serialized PrimitiveSet");
+        }
+        return nanopb_primitive_set;
+    }
+
+    /**
+     * Encodes the given NanoPb PrimitiveSet
+     *
+     * @param nanopb_primitive_set The NanoPb PrimitiveSet to encode
+     *
+     * @return the encoded PrimitiveSet
+     */
+    static std::string encodeNanoPbPrimitiveSet(
+        const TbotsProto_PrimitiveSet& nanopb_primitive_set)
+    {
+        size_t encoded_size = 0;
+        EXPECT_TRUE(pb_get_encoded_size(&encoded_size, TbotsProto_PrimitiveSet_fields,
+                                        &nanopb_primitive_set));
+
+        std::string encoded_primitive_set(encoded_size, '\0');
+        pb_ostream_t pb_out_stream = pb_ostream_from_buffer(
+            reinterpret_cast<uint8_t*>(encoded_primitive_set.data()), encoded_size);
+        EXPECT_TRUE(pb_encode(&pb_out_stream, TbotsProto_PrimitiveSet_fields,
+                              &nanopb_primitive_set));
+        return encoded_primitive_set;
+    }
+
     RobotConstants_t robot_constants = create2015RobotConstants();
 };
 
@@ -94,3 +211,101 @@ TEST_F(PrimitiveGoogleToNanoPbConverterTest, convert_primitive_set)
         }
     }
 }
+
+TEST_F(PrimitiveGoogleToNanoPbConverterTest, round_trip_every_primitive)
+{
+    TbotsProto::PrimitiveSet google_primitive_set =
+        createPrimitiveSetWithEveryPrimitive();
+
+    TbotsProto::PrimitiveSet round_tripped_primitive_set;
+    ASSERT_TRUE(round_tripped_primitive_set.ParseFromString(
+        encodeNanoPbPrimitiveSet(createNanoPbPrimitiveSet(google_primitive_set))));
+
+    EXPECT_TRUE(google::protobuf::util::MessageDifferencer::Equals(
+        google_primitive_set, round_tripped_primitive_set));
+}
+
+TEST_F(PrimitiveGoogleToNanoPbConverterTest,
+       convert_primitive_set_the_same_as_serializing_and_decoding)
+{
+    TbotsProto::PrimitiveSet google_primitive_set =
+        createPrimitiveSetWithEveryPrimitive();
+
+    TbotsProto_PrimitiveSet nanopb_primitive_set =
+        createNanoPbPrimitiveSet(google_primitive_set);
+    TbotsProto_PrimitiveSet expected_nanopb_primitive_set =
+        createNanoPbPrimitiveSetBySerializing(google_primitive_set);
+
+    // The robot primitives of a map may be converted in any order
+    ASSERT_EQ(expected_nanopb_primitive_set.robot_primitives_count,
+              nanopb_primitive_set.robot_primitives_count);
+    for (TbotsProto_PrimitiveSet* primitive_set :
+         {&nanopb_primitive_set, &expected_nanopb_primitive_set})
+    {
+        std::sort(primitive_set->robot_primitives,
+                  primitive_set->robot_primitives + primitive_set->robot_primitives_count,
+                  [](const auto& a, const auto& b) { return a.key < b.key; });
+    }
+    EXPECT_EQ(encodeNanoPbPrimitiveSet(expected_nanopb_primitive_set),
+              encodeNanoPbPrimitiveSet(nanopb_primitive_set));
+}
+
+TEST_F(PrimitiveGoogleToNanoPbConverterTest, convert_empty_primitive)
+{
+    TbotsProto_Primitive nanopb_primitive =
+        createNanoPbPrimitive(TbotsProto::Primitive());
+    EXPECT_EQ(0, nanopb_primitive.which_primitive);
+}
+
+TEST_F(PrimitiveGoogleToNanoPbConverterTest, convert_path_with_too_many_points)
+{
+    TbotsProto::Primitive google_primitive = *createMovePrimitive(
+        Point(1, 2), 0, Angle::zero(), TbotsProto::DribblerMode::OFF,
+        {AutoChipOrKickMode::OFF, 0}, TbotsProto::MaxAllowedSpeedMode::PHYSICAL_LIMIT,
+        0.0, robot_constants);
+    for (unsigned int i = 0; i < pb_arraysize(TbotsProto_Path, point); i++)
+    {
+        *google_primitive.mutable_move()->mutable_path()->add_point() =
+            google_primitive.move().path().point(0);
+    }
+
+    EXPECT_THROW(createNanoPbPrimitive(google_primitive), std::runtime_error);
+}
+
+// This test is disabled to speed up CI, it can be enabled by removing "DISABLED_" from
+// the test name
+TEST_F(PrimitiveGoogleToNanoPbConverterTest,
+       DISABLED_convert_primitive_set_compared_to_serializing_and_decoding)
+{
+    const unsigned int NUM_ITERATIONS = 100000;
+
+    // A full team of robots, like the AI sends every tick
+    TbotsProto::PrimitiveSet google_primitive_set;
+    for (unsigned int robot_id = 0; robot_id < 11; robot_id++)
+    {
+        (*google_primitive_set.mutable_robot_primitives())[robot_id] =
+            *createMovePrimitive(
+                Point(robot_id, 2), 1, Angle::half(), TbotsProto::DribblerMode::MAX_FORCE,
+                {AutoChipOrKickMode::AUTOKICK, 3},
+                TbotsProto::MaxAllowedSpeedMode::PHYSICAL_LIMIT, 0.0, robot_constants);
+    }
+
+    auto time_conversion = [&](const std::string& name, auto convert) {
+        // The number of robot primitives is summed so the conversion isn't optimized
+        // out
+        pb_size_t num_robot_primitives = 0;
+        auto start_time                = std::chrono::system_clock::now();
+        for (unsigned int i = 0; i < NUM_ITERATIONS; i++)
+        {
+            num_robot_primitives += convert(google_primitive_set).robot_primitives_count;
+        }
+        double duration_ms = ::TestUtil::millisecondsSince(start_time);
+
+        std::cout << name << ": " << duration_ms * 1000.0 / NUM_ITERATIONS
+                  << "us per PrimitiveSet (" << num_robot_primitives
+                  << " robot primitives converted)" << std::endl;
+    };
+
+    time_conversion("Serialize and decode", createNanoPbPrimitiveSetBySerializing);
+    time_conversion("Copy fields directly", createNanoPbPrimitiveSet);
+}
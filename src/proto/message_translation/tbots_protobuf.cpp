@@ -68,7 +68,7 @@ std::unique_ptr<TbotsProto::Robot> createRobot(const Robot& robot)
     *(robot_msg->mutable_current_state()) = *createRobotStateProto(robot);
     *(robot_msg->mutable_timestamp())     = *createTimestamp(robot.timestamp());
 
-    for (RobotCapability capability : robot.getUnavailableCapabilities())
+    for (RobotCapability capability : robot.getUnavailableCapabilities().toSet())
     {
         switch (capability)
         {
@@ -80,6 +80,9 @@ static const short unsigned int REDIS_DEFAULT_PORT      = 6379;
 static const short unsigned int VISION_PORT    = 42069;
 static const short unsigned int PRIMITIVE_PORT = 42070;
 
+// robots listen for their own RobotPrimitive on ROBOT_PRIMITIVE_PORT_BASE + robot id
+static const short unsigned int ROBOT_PRIMITIVE_PORT_BASE = 42080;
+
 // the port the AI receives msgs from the robot
 static const short unsigned int ROBOT_STATUS_PORT = 42071;
 static const short unsigned int ROBOT_LOGS_PORT   = 42072;
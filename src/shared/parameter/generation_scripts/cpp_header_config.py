@@ -41,6 +41,8 @@ CONFIG_PUBLIC_ENTRY = """const std::shared_ptr<const {config_name}> {immutable_a
     }}"""
 
 
+CONFIG_SNAPSHOT_ENTRY = "{config_name}::Snapshot {config_snapshot_name};"
+
 CONFIG_PRIVATE_ENTRY = "std::shared_ptr<{config_name}> {config_variable_name};"
 
 IMMUTABLE_PARAMETER_LIST_CONFIG_ENTRY = (
@@ -67,6 +69,17 @@ CONFIG_CLASS = """class {config_name} : public Config
 
     void loadFromProto(const TbotsProto::{config_name}& config_proto);
 
+    // The values of the parameters of this config and its included configs at one
+    // point in time. Reading a snapshot never goes through the parameters, so code
+    // that reads the config many times per tick can take a snapshot once per tick
+    // and see the same values for the whole tick.
+    struct Snapshot
+    {{
+        {snapshot_entries}
+    }};
+
+    Snapshot snapshot() const;
+
    private:
     MutableParameterList mutable_internal_param_list;
     ParameterList immutable_internal_param_list;
@@ -169,6 +182,7 @@ class CppHeaderConfig(object):
             config_name=self.config_name,
             config_constructor_header=self.config_constructor_header,
             public_entries=self.public_entries,
+            snapshot_entries=self.snapshot_entries,
             private_entries=self.private_entries,
         )
 
@@ -207,6 +221,22 @@ class CppHeaderConfig(object):
             config_variable_name=self.config_variable_name,
         )
 
+    @property
+    def config_snapshot_entry(self):
+        return CONFIG_SNAPSHOT_ENTRY.format(
+            config_name=self.config_name,
+            config_snapshot_name=to_snake_case(self.config_name),
+        )
+
+    @property
+    def snapshot_entries(self):
+        return CppHeaderConfig.join_with_tabs(
+            "\n",
+            [param.snapshot_entry for param in self.parameters]
+            + [conf.config_snapshot_entry for conf in self.configs],
+            INDENT_TWICE,
+        )
+
     @property
     def config_private_entry(self):
         return CONFIG_PRIVATE_ENTRY.format(
@@ -46,6 +46,10 @@ TO_PROTO_ENTRY = "config_proto.set_{param_name}({param_variable_name}->value());
 
 LOAD_FROM_PROTO_ENTRY = "{param_variable_name}->setValue(config_proto.{param_name}());"
 
+SNAPSHOT_ENTRY = "{type} {param_name};"
+
+TO_SNAPSHOT_ENTRY = "snapshot.{param_name} = {param_variable_name}->value();"
+
 
 class CppParameter(object):
     def __init__(self, param_type: str, param_metadata: dict):
@@ -259,3 +263,13 @@ class CppParameter(object):
         return LOAD_FROM_PROTO_ENTRY.format(
             param_name=self.param_name, param_variable_name=self.param_variable_name,
         )
+
+    @property
+    def snapshot_entry(self):
+        return SNAPSHOT_ENTRY.format(type=self.cpp_type, param_name=self.param_name)
+
+    @property
+    def to_snapshot_entry(self):
+        return TO_SNAPSHOT_ENTRY.format(
+            param_name=self.param_name, param_variable_name=self.param_variable_name,
+        )
@@ -61,6 +61,8 @@ LOAD_FROM_PROTO_ENTRY = (
     "{config_variable_name}->loadFromProto({config_variable_name}_proto);\n"
 )
 
+TO_SNAPSHOT_ENTRY = "snapshot.{config_snapshot_name} = {config_variable_name}->snapshot();"
+
 CONFIG_CLASS = """
 {config_name}::{config_constructor_header}
 {{
@@ -113,6 +115,13 @@ void {config_name}::loadFromProto(const TbotsProto::{config_name}& config_proto)
     {load_from_proto_contents}
 }}
 
+{config_name}::Snapshot {config_name}::snapshot() const
+{{
+    Snapshot snapshot;
+    {to_snapshot_contents}
+    return snapshot;
+}}
+
 const MutableParameterList& {config_name}::getMutableParameterList()
 {{
     return mutable_internal_param_list;
@@ -222,6 +231,7 @@ class CppSourceConfig(object):
             command_line_arg_structs=self.command_line_arg_structs,
             to_proto_contents=self.to_proto_contents,
             load_from_proto_contents=self.load_from_proto_contents,
+            to_snapshot_contents=self.to_snapshot_contents,
             load_command_line_args_into_config_contents=self.load_command_line_args_into_config_contents,
         )
 
@@ -432,3 +442,18 @@ class CppSourceConfig(object):
             ],
             INDENT_ONCE,
         )
+
+    @property
+    def to_snapshot_contents(self):
+        return CppSourceConfig.join_with_tabs(
+            "\n",
+            [param.to_snapshot_entry for param in self.parameters]
+            + [
+                TO_SNAPSHOT_ENTRY.format(
+                    config_snapshot_name=to_snake_case(config.config_name),
+                    config_variable_name=config.config_variable_name,
+                )
+                for config in self.configs
+            ],
+            INDENT_ONCE,
+        )
@@ -1,12 +1,29 @@
 #pragma once
 
+#include <atomic>
 #include <functional>
 #include <memory>
 #include <mutex>
 #include <optional>
 #include <string>
+#include <type_traits>
 #include <vector>
 
+/**
+ * A named value that can be changed while the program is running, and read from any
+ * thread without locking
+ *
+ * Values that are trivially copyable (bools, numbers and enums) are stored in an
+ * atomic. Other values (strings) are published RCU-style: every value that is set is
+ * stored as an immutable version in a shared_ptr, and readers atomically load the
+ * shared_ptr to the latest version and copy it. A version is freed once it has been
+ * replaced and the last reader copying it is done.
+ *
+ * Setting a value still locks a mutex, so that the callbacks see values in the order
+ * they were set.
+ *
+ * @tparam T The type of the value
+ */
 template <class T>
 class Parameter
 {
@@ -19,8 +36,8 @@ class Parameter
      */
     explicit Parameter<T>(const std::string& name, T value)
     {
-        this->name_  = name;
-        this->value_ = value;
+        this->name_ = name;
+        storeValue(value);
     }
 
     /**
@@ -30,8 +47,14 @@ class Parameter
      */
     const T value() const
     {
-        std::scoped_lock lock(this->value_mutex_);
-        return this->value_;
+        if constexpr (STORED_IN_ATOMIC)
+        {
+            return value_.load(std::memory_order_acquire);
+        }
+        else
+        {
+            return *std::atomic_load_explicit(&value_, std::memory_order_acquire);
+        }
     }
 
     /**
@@ -54,7 +77,7 @@ class Parameter
     virtual bool setValue(const T new_value)
     {
         std::scoped_lock value_lock(this->value_mutex_);
-        this->value_ = new_value;
+        storeValue(new_value);
 
         std::scoped_lock callback_lock(this->callback_mutex_);
         for (auto callback_func : callback_functions)
@@ -78,9 +101,6 @@ class Parameter
     }
 
    protected:
-    // Store the value so it can be retrieved without fetching from the server again
-    T value_;
-
     // Store the name of the parameter
     std::string name_;
 
@@ -89,6 +109,31 @@ class Parameter
     mutable std::vector<std::function<void(T)>> callback_functions;
 
    private:
+    /**
+     * Stores the value so that it is returned by value(). Only one thread can store a
+     * value at a time.
+     *
+     * @param new_value The value to store
+     */
+    void storeValue(const T& new_value)
+    {
+        if constexpr (STORED_IN_ATOMIC)
+        {
+            value_.store(new_value, std::memory_order_release);
+        }
+        else
+        {
+            std::atomic_store_explicit(&value_, std::make_shared<const T>(new_value),
+                                       std::memory_order_release);
+        }
+    }
+
+    static constexpr bool STORED_IN_ATOMIC = std::is_trivially_copyable_v<T>;
+
+    // The value, or the latest version of the value if it can't be stored in an atomic.
+    // The shared_ptr must only be accessed with std::atomic_load and std::atomic_store
+    std::conditional_t<STORED_IN_ATOMIC, std::atomic<T>, std::shared_ptr<const T>> value_;
+
     // mutexes are marked as mutable so that they can be acquired in a const function
     mutable std::recursive_mutex value_mutex_;
     mutable std::recursive_mutex callback_mutex_;
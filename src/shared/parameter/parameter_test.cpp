@@ -2,7 +2,12 @@
 
 #include <gtest/gtest.h>
 
+#include <atomic>
+#include <chrono>
+#include <iostream>
 #include <optional>
+#include <thread>
+#include <vector>
 
 #include "shared/parameter/enumerated_parameter.h"
 #include "shared/parameter/numeric_parameter.h"
@@ -226,3 +231,91 @@ TEST(ParameterTest, register_callback_on_const_parameter)
     test_param->setValue(1);
     EXPECT_EQ(test_value, 2);
 }
+
+TEST(ParameterTest, string_parameter_read_while_being_set)
+{
+    Parameter<std::string> test_param("test_param", "first value");
+
+    std::atomic_bool done_setting(false);
+    std::thread setter_thread([&]() {
+        for (int i = 0; i < 1000; i++)
+        {
+            test_param.setValue(i % 2 == 0 ? "second value" : "first value");
+        }
+        done_setting = true;
+    });
+
+    // Every read should see one of the values that were set, never a value that is
+    // being written
+    while (!done_setting)
+    {
+        std::string value = test_param.value();
+        EXPECT_TRUE(value == "first value" || value == "second value");
+    }
+    setter_thread.join();
+
+    EXPECT_EQ("first value", test_param.value());
+}
+
+TEST(ParameterTest, numeric_parameter_read_while_being_set)
+{
+    NumericParameter<double> test_param("test_param", 0.0, 0.0, 1000.0);
+
+    std::thread setter_thread([&]() {
+        for (int i = 0; i <= 1000; i++)
+        {
+            test_param.setValue(static_cast<double>(i));
+        }
+    });
+
+    // Values are only ever set in increasing order
+    double last_value = 0.0;
+    while (last_value < 1000.0)
+    {
+        double value = test_param.value();
+        EXPECT_GE(value, last_value);
+        last_value = value;
+    }
+    setter_thread.join();
+}
+
+// This test is disabled to speed up CI, it can be enabled by removing "DISABLED_" from
+// the test name
+TEST(ParameterTest, DISABLED_concurrent_value_reads)
+{
+    // Like the threads that rate passes, which read the passing config in every
+    // objective evaluation
+    const unsigned int num_reads_per_thread = 10000000;
+    NumericParameter<double> test_param("test_param", 1.0, 0.0, 10.0);
+
+    for (unsigned int num_threads : {1u, 2u, 4u, 8u})
+    {
+        std::vector<std::thread> reader_threads;
+        std::atomic<double> sum(0);
+
+        auto start_time = std::chrono::steady_clock::now();
+        for (unsigned int i = 0; i < num_threads; i++)
+        {
+            reader_threads.emplace_back([&]() {
+                double thread_sum = 0;
+                for (unsigned int j = 0; j < num_reads_per_thread; j++)
+                {
+                    thread_sum += test_param.value();
+                }
+                sum = sum + thread_sum;
+            });
+        }
+        for (std::thread& reader_thread : reader_threads)
+        {
+            reader_thread.join();
+        }
+        double duration_s =
+            std::chrono::duration<double>(std::chrono::steady_clock::now() - start_time)
+                .count();
+
+        EXPECT_EQ(num_threads * num_reads_per_thread, sum);
+        std::cout << num_threads << " thread(s): "
+                  << num_threads * num_reads_per_thread / duration_s / 1e6
+                  << " million reads per second" << std::endl;
+    }
+}
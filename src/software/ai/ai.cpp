@@ -1,16 +1,37 @@
 #include "software/ai/ai.h"
 
+#include <algorithm>
 #include <chrono>
 
 #include "software/ai/hl/stp/play/halt_play.h"
 #include "software/ai/hl/stp/stp.h"
 #include "software/ai/navigator/path_manager/velocity_obstacle_path_manager.h"
 #include "software/ai/navigator/path_planner/theta_star_path_planner.h"
+#include "software/util/latency_profiler/latency_profiler.h"
+
+/**
+ * Creates a path planner for each thread that plans paths
+ *
+ * @param num_path_planning_threads The number of threads that plan paths
+ *
+ * @return a ThetaStarPathPlanner for each thread
+ */
+static std::vector<std::unique_ptr<PathPlanner>> createPathPlanners(
+    size_t num_path_planning_threads)
+{
+    std::vector<std::unique_ptr<PathPlanner>> path_planners;
+    for (size_t i = 0; i < std::max<size_t>(num_path_planning_threads, 1); i++)
+    {
+        path_planners.emplace_back(std::make_unique<ThetaStarPathPlanner>());
+    }
+    return path_planners;
+}
 
 AI::AI(std::shared_ptr<const AiConfig> ai_config)
     : navigator(std::make_shared<Navigator>(
           std::make_unique<VelocityObstaclePathManager>(
-              std::make_unique<ThetaStarPathPlanner>(),
+              createPathPlanners(static_cast<size_t>(
+                  ai_config->getNavigatorConfig()->getNumPathPlanningThreads()->value())),
               RobotNavigationObstacleFactory(
                   ai_config->getRobotNavigationObstacleConfig())),
           RobotNavigationObstacleFactory(ai_config->getRobotNavigationObstacleConfig()),
@@ -27,6 +48,8 @@ void AI::overridePlay(std::unique_ptr<Play> play)
 
 std::unique_ptr<TbotsProto::PrimitiveSet> AI::getPrimitives(const World &world) const
 {
+    ScopedLatencyTimer latency_timer(LatencyStage::AI_TICK);
+
     std::vector<std::unique_ptr<Intent>> assigned_intents = stp->getIntents(world);
 
     return navigator->getAssignedPrimitives(world, assigned_intents);
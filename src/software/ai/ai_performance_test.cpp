@@ -0,0 +1,46 @@
+#include <gtest/gtest.h>
+
+#include <iostream>
+
+#include "software/ai/ai.h"
+#include "software/test_util/test_util.h"
+
+// This test is disabled to speed up CI, it can be enabled by removing "DISABLED_" from
+// the test name
+TEST(AIPerformanceTest, DISABLED_div_b_11_robots_tick_latency)
+{
+    // Both full teams on a division B field, in open play
+    World world = ::TestUtil::createBlankTestingWorldDivB();
+    world       = ::TestUtil::setFriendlyRobotPositions(
+        world,
+        {Point(-4.2, 0), Point(-3.5, 2.5), Point(-3.5, 1), Point(-3.5, -1),
+         Point(-3.5, -2.5), Point(-2, 2), Point(-2, 0), Point(-2, -2), Point(-0.5, 2.5),
+         Point(-0.5, 0.5), Point(-0.5, -2.5)},
+        Timestamp::fromSeconds(0));
+    world = ::TestUtil::setEnemyRobotPositions(
+        world,
+        {Point(4.2, 0), Point(3.5, 2), Point(3.5, 0.5), Point(3.5, -0.5), Point(3.5, -2),
+         Point(2, 1.5), Point(2, 0), Point(2, -1.5), Point(0.8, 2.5), Point(0.8, 0),
+         Point(0.8, -2.5)},
+        Timestamp::fromSeconds(0));
+    world =
+        ::TestUtil::setBallPosition(world, Point(0.2, 0.3), Timestamp::fromSeconds(0));
+    world.updateRefereeCommand(RefereeCommand::FORCE_START);
+
+    AI ai(std::make_shared<const ThunderbotsConfig>()->getAiConfig());
+
+    const unsigned int num_ticks = 200;
+
+    // Every tick gets its own copy of the World, like the AI does when SensorFusion
+    // publishes it
+    auto start_time = std::chrono::system_clock::now();
+    for (unsigned int i = 0; i < num_ticks; i++)
+    {
+        World world_copy   = world;
+        auto primitive_set = ai.getPrimitives(world_copy);
+        ASSERT_TRUE(primitive_set);
+    }
+    double duration_ms = ::TestUtil::millisecondsSince(start_time);
+
+    std::cout << "AI tick: " << duration_ms / num_ticks << " ms" << std::endl;
+}
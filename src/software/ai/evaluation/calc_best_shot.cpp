@@ -1,5 +1,7 @@
 #include "software/ai/evaluation/calc_best_shot.h"
 
+#include <boost/container/small_vector.hpp>
+
 std::optional<Shot> calcBestShotOnGoal(const Segment &goal_post, const Point &shot_origin,
                                        const std::vector<Robot> &robot_obstacles,
                                        TeamType goal, double radius)
@@ -9,7 +11,10 @@ std::optional<Shot> calcBestShotOnGoal(const Segment &goal_post, const Point &sh
     Angle pos_post_angle = (goal_post.getStart() - shot_origin).orientation();
     Angle neg_post_angle = (goal_post.getEnd() - shot_origin).orientation();
 
-    std::vector<AngleSegment> obstacles;
+    // This is called in the inner loop of the pass cost function, so the obstacles
+    // are kept on the stack unless there are more of them than robots on the field
+    boost::container::small_vector<AngleSegment, AngleMap::NUM_INLINE_ANGLE_SEGMENTS>
+        obstacles;
     obstacles.reserve(max_num_obstacles);
 
     if (goal == TeamType::FRIENDLY)
@@ -111,9 +111,6 @@ TEST(CalcBestShotTest,
     Robot shooting_robot =
         Robot(0, Point(1, world.field().enemyGoalpostNeg().y()), Vector(0, 0),
               Angle::zero(), AngularVelocity::zero(), Timestamp::fromSeconds(0));
-    Robot friendly_blocking_robot =
-        Robot(1, Point(1.3, world.field().enemyGoalpostNeg().y() - 0.05), Vector(0, 0),
-              Angle::zero(), AngularVelocity::zero(), Timestamp::fromSeconds(0));
     team.updateRobots({shooting_robot});
     world.updateFriendlyTeamState(team);
 
@@ -142,9 +139,6 @@ TEST(CalcBestShotTest,
     Robot shooting_robot =
         Robot(0, Point(-1, world.field().friendlyGoalpostNeg().y()), Vector(0, 0),
               Angle::zero(), AngularVelocity::zero(), Timestamp::fromSeconds(0));
-    Robot enemy_blocking_robot =
-        Robot(1, Point(-1.3, world.field().enemyGoalpostNeg().y() - 0.05), Vector(0, 0),
-              Angle::zero(), AngularVelocity::zero(), Timestamp::fromSeconds(0));
     team.updateRobots({shooting_robot});
     world.updateEnemyTeamState(team);
 
@@ -0,0 +1,194 @@
+#include "software/ai/hl/stp/hungarian_solver.h"
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+HungarianSolver::HungarianSolver()
+    : row_potentials(),
+      col_potentials(),
+      col_to_row(),
+      previous_col_on_path(),
+      min_reduced_cost(),
+      col_on_path(),
+      row_assigned(),
+      row_to_col(),
+      num_augmenting_paths(0)
+{
+}
+
+const std::vector<int>& HungarianSolver::solve(
+    const std::vector<double>& costs, size_t num_rows, size_t num_cols,
+    const std::vector<int>& warm_start_assignment)
+{
+    if (num_rows > num_cols)
+    {
+        throw std::invalid_argument(
+            "HungarianSolver needs at least as many columns as rows");
+    }
+    if (costs.size() != num_rows * num_cols)
+    {
+        throw std::invalid_argument("HungarianSolver costs don't match the problem size");
+    }
+
+    // The problem is made square by adding rows that cost nothing in every column, so
+    // that every column is assigned. The cost of assigning row i to column j, with both
+    // indexed from 1
+    const size_t size = num_cols;
+    auto cost         = [&](size_t i, size_t j) {
+        return i <= num_rows ? costs[(i - 1) * num_cols + (j - 1)] : 0.0;
+    };
+
+    // The reduced cost of assigning row i to column j, which is never negative. Pairs
+    // with zero reduced cost are "tight" and can be part of the optimal assignment
+    auto reduced_cost = [&](size_t i, size_t j) {
+        return cost(i, j) - row_potentials[i] - col_potentials[j];
+    };
+
+    const bool warm_start = !warm_start_assignment.empty();
+    if (!warm_start || col_potentials.size() != size + 1)
+    {
+        col_potentials.assign(size + 1, 0.0);
+    }
+    row_potentials.assign(size + 1, 0.0);
+    col_to_row.assign(size + 1, 0);
+    previous_col_on_path.resize(size + 1);
+    min_reduced_cost.resize(size + 1);
+    col_on_path.resize(size + 1);
+    row_assigned.assign(size + 1, false);
+    row_to_col.assign(num_rows, -1);
+    num_augmenting_paths = 0;
+
+    // Any column potentials make a feasible dual solution once the potential of every
+    // row is the smallest cost of that row minus the column potential
+    for (size_t i = 1; i <= size; i++)
+    {
+        double min_cost = std::numeric_limits<double>::infinity();
+        for (size_t j = 1; j <= size; j++)
+        {
+            min_cost = std::min(min_cost, cost(i, j) - col_potentials[j]);
+        }
+        row_potentials[i] = min_cost;
+    }
+    if (!warm_start)
+    {
+        for (size_t j = 1; j <= size; j++)
+        {
+            double min_cost = std::numeric_limits<double>::infinity();
+            for (size_t i = 1; i <= size; i++)
+            {
+                min_cost = std::min(min_cost, cost(i, j) - row_potentials[i]);
+            }
+            col_potentials[j] = min_cost;
+        }
+    }
+
+    auto assign = [&](size_t i, size_t j) {
+        col_to_row[j]   = i;
+        row_assigned[i] = true;
+    };
+
+    // Rows keep their warm start column if it is still tight, since the previous
+    // potentials make the previous assignment optimal again
+    if (warm_start)
+    {
+        for (size_t i = 1; i <= num_rows && i <= warm_start_assignment.size(); i++)
+        {
+            int warm_start_col = warm_start_assignment[i - 1];
+            if (warm_start_col >= 0 && static_cast<size_t>(warm_start_col) < size &&
+                col_to_row[warm_start_col + 1] == 0 &&
+                reduced_cost(i, warm_start_col + 1) <= 0.0)
+            {
+                assign(i, warm_start_col + 1);
+            }
+        }
+    }
+
+    // Then the remaining rows are greedily assigned to the first free tight column
+    for (size_t i = 1; i <= size; i++)
+    {
+        for (size_t j = 1; j <= size && !row_assigned[i]; j++)
+        {
+            if (col_to_row[j] == 0 && reduced_cost(i, j) <= 0.0)
+            {
+                assign(i, j);
+            }
+        }
+    }
+
+    for (size_t row = 1; row <= size; row++)
+    {
+        if (row_assigned[row])
+        {
+            continue;
+        }
+        num_augmenting_paths++;
+
+        // Find the shortest augmenting path from the row to an unassigned column with
+        // Dijkstra's algorithm over the reduced costs, starting from the root column 0
+        col_to_row[0] = row;
+        size_t col    = 0;
+        std::fill(min_reduced_cost.begin(), min_reduced_cost.end(),
+                  std::numeric_limits<double>::infinity());
+        std::fill(col_on_path.begin(), col_on_path.end(), false);
+        do
+        {
+            col_on_path[col]   = true;
+            size_t path_row    = col_to_row[col];
+            double delta       = std::numeric_limits<double>::infinity();
+            size_t closest_col = 0;
+            for (size_t j = 1; j <= size; j++)
+            {
+                if (!col_on_path[j])
+                {
+                    double path_reduced_cost = reduced_cost(path_row, j);
+                    if (path_reduced_cost < min_reduced_cost[j])
+                    {
+                        min_reduced_cost[j]     = path_reduced_cost;
+                        previous_col_on_path[j] = col;
+                    }
+                    if (min_reduced_cost[j] < delta)
+                    {
+                        delta       = min_reduced_cost[j];
+                        closest_col = j;
+                    }
+                }
+            }
+            for (size_t j = 0; j <= size; j++)
+            {
+                if (col_on_path[j])
+                {
+                    row_potentials[col_to_row[j]] += delta;
+                    col_potentials[j] -= delta;
+                }
+                else
+                {
+                    min_reduced_cost[j] -= delta;
+                }
+            }
+            col = closest_col;
+        } while (col_to_row[col] != 0);
+
+        // Flip the assignments along the path
+        do
+        {
+            size_t previous_col = previous_col_on_path[col];
+            col_to_row[col]     = col_to_row[previous_col];
+            col                 = previous_col;
+        } while (col != 0);
+    }
+
+    for (size_t j = 1; j <= size; j++)
+    {
+        if (col_to_row[j] <= num_rows)
+        {
+            row_to_col[col_to_row[j] - 1] = static_cast<int>(j - 1);
+        }
+    }
+    return row_to_col;
+}
+
+size_t HungarianSolver::numAugmentingPaths() const
+{
+    return num_augmenting_paths;
+}
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+/**
+ * Solves the assignment problem with the Hungarian algorithm, using shortest augmenting
+ * paths. https://en.wikipedia.org/wiki/Hungarian_algorithm
+ *
+ * The solver remembers the dual variables (the "potentials") of the columns from its
+ * last solve. When the costs barely change between solves, as they do from one AI tick
+ * to the next, the previous assignment and potentials are still almost optimal, so
+ * solves can be warm started from them. Only the rows whose previous column is no
+ * longer optimal for them need to be assigned again.
+ *
+ * All buffers are reused between solves, so solving a problem that is not larger than
+ * the previous one doesn't allocate.
+ */
+class HungarianSolver
+{
+   public:
+    /**
+     * Creates a HungarianSolver
+     */
+    explicit HungarianSolver();
+
+    /**
+     * Finds the assignment of rows to columns that minimizes the total cost. Every row
+     * is assigned to a different column.
+     *
+     * When multiple assignments have the same cost, rows keep the column they had in
+     * the warm start assignment, and otherwise rows are greedily given the first column
+     * that is optimal for them, in row order.
+     *
+     * @param costs The cost of assigning every row to every column, in row-major order
+     * @param num_rows The number of rows
+     * @param num_cols The number of columns, which must be at least the number of rows
+     * @param warm_start_assignment The column every row was assigned to by a previous
+     * solve, indexed by row, where -1 means that the row wasn't assigned. The
+     * potentials of the columns are reused from the previous solve if it had the same
+     * number of columns, where column i of the previous solve is column i of this one.
+     * Pass an empty vector to solve the problem from scratch
+     *
+     * @return The column every row is assigned to, indexed by row
+     */
+    const std::vector<int>& solve(const std::vector<double>& costs, size_t num_rows,
+                                  size_t num_cols,
+                                  const std::vector<int>& warm_start_assignment = {});
+
+    /**
+     * Gets the number of rows that had to be assigned with an augmenting path in the
+     * last solve, instead of keeping their warm start column
+     *
+     * @return the number of augmenting paths in the last solve
+     */
+    size_t numAugmentingPaths() const;
+
+   private:
+    // The potentials are indexed from 1 and the assignments use 0 to mean unassigned,
+    // so index 0 is used as the root of the augmenting paths
+    std::vector<double> row_potentials;
+    std::vector<double> col_potentials;
+    // The row assigned to every column, where 0 means unassigned
+    std::vector<size_t> col_to_row;
+    std::vector<size_t> previous_col_on_path;
+    std::vector<double> min_reduced_cost;
+    std::vector<bool> col_on_path;
+    std::vector<bool> row_assigned;
+    std::vector<int> row_to_col;
+    size_t num_augmenting_paths;
+};
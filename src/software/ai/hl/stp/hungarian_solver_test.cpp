@@ -0,0 +1,170 @@
+#include "software/ai/hl/stp/hungarian_solver.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+
+/**
+ * Finds the minimum total cost of assigning every row to a different column by trying
+ * every assignment
+ *
+ * @param costs The cost of assigning every row to every column, in row-major order
+ * @param num_rows The number of rows
+ * @param num_cols The number of columns
+ *
+ * @return The minimum total cost
+ */
+double bruteForceMinCost(const std::vector<double>& costs, size_t num_rows,
+                         size_t num_cols)
+{
+    std::vector<size_t> cols(num_cols);
+    std::iota(cols.begin(), cols.end(), 0);
+    double min_cost = std::numeric_limits<double>::infinity();
+    do
+    {
+        double total_cost = 0;
+        for (size_t row = 0; row < num_rows; row++)
+        {
+            total_cost += costs[row * num_cols + cols[row]];
+        }
+        min_cost = std::min(min_cost, total_cost);
+    } while (std::next_permutation(cols.begin(), cols.end()));
+    return min_cost;
+}
+
+/**
+ * Checks that every row is assigned to a different column and returns the total cost of
+ * the assignment
+ */
+double assignmentCost(const std::vector<double>& costs, size_t num_rows, size_t num_cols,
+                      const std::vector<int>& assignment)
+{
+    EXPECT_EQ(num_rows, assignment.size());
+    std::vector<bool> col_used(num_cols, false);
+    double total_cost = 0;
+    for (size_t row = 0; row < assignment.size(); row++)
+    {
+        EXPECT_GE(assignment[row], 0);
+        EXPECT_LT(assignment[row], static_cast<int>(num_cols));
+        EXPECT_FALSE(col_used[assignment[row]]);
+        col_used[assignment[row]] = true;
+        total_cost += costs[row * num_cols + assignment[row]];
+    }
+    return total_cost;
+}
+
+TEST(HungarianSolverTest, test_empty_problem)
+{
+    HungarianSolver solver;
+    EXPECT_TRUE(solver.solve({}, 0, 0).empty());
+}
+
+TEST(HungarianSolverTest, test_more_rows_than_columns_throws)
+{
+    HungarianSolver solver;
+    EXPECT_THROW(solver.solve({0, 0}, 2, 1), std::invalid_argument);
+}
+
+TEST(HungarianSolverTest, test_all_costs_equal_assigns_in_order)
+{
+    HungarianSolver solver;
+    std::vector<int> assignment = solver.solve(std::vector<double>(9, 0.5), 3, 3);
+    EXPECT_EQ(std::vector<int>({0, 1, 2}), assignment);
+}
+
+TEST(HungarianSolverTest, test_equal_costs_are_assigned_like_munkres)
+{
+    // Row 0 gets column 1, and rows 1 and 2 cost the same in columns 0 and 2
+    std::vector<double> costs = {0.5, 0.15, 0.5, 0.5, 0.22, 0.5, 0.5, 0.42, 0.5};
+
+    HungarianSolver solver;
+    std::vector<int> assignment = solver.solve(costs, 3, 3);
+    EXPECT_EQ(std::vector<int>({1, 2, 0}), assignment);
+}
+
+TEST(HungarianSolverTest, test_optimal_for_random_square_and_rectangular_problems)
+{
+    std::mt19937 random_num_gen(42);
+    std::uniform_real_distribution<double> cost_distribution(0, 1);
+
+    HungarianSolver solver;
+    for (size_t num_cols = 1; num_cols <= 7; num_cols++)
+    {
+        for (size_t num_rows = 1; num_rows <= num_cols; num_rows++)
+        {
+            for (int trial = 0; trial < 20; trial++)
+            {
+                std::vector<double> costs(num_rows * num_cols);
+                for (double& cost : costs)
+                {
+                    // Round the costs so that there are ties
+                    cost = std::round(cost_distribution(random_num_gen) * 8) / 8;
+                }
+                std::vector<int> assignment = solver.solve(costs, num_rows, num_cols);
+                EXPECT_DOUBLE_EQ(bruteForceMinCost(costs, num_rows, num_cols),
+                                 assignmentCost(costs, num_rows, num_cols, assignment));
+            }
+        }
+    }
+}
+
+TEST(HungarianSolverTest, test_warm_start_is_optimal_when_costs_change)
+{
+    std::mt19937 random_num_gen(7);
+    std::uniform_real_distribution<double> cost_distribution(0, 1);
+    std::normal_distribution<double> cost_change_distribution(0, 0.05);
+
+    for (size_t num_rows : {3, 5, 7})
+    {
+        for (size_t num_cols : {num_rows, num_rows + 1})
+        {
+            std::vector<double> costs(num_rows * num_cols);
+            for (double& cost : costs)
+            {
+                cost = cost_distribution(random_num_gen);
+            }
+
+            HungarianSolver solver;
+            std::vector<int> assignment = solver.solve(costs, num_rows, num_cols);
+            for (int tick = 0; tick < 50; tick++)
+            {
+                for (double& cost : costs)
+                {
+                    cost = std::clamp(cost + cost_change_distribution(random_num_gen),
+                                      0.0, 1.0);
+                }
+                assignment = solver.solve(costs, num_rows, num_cols, assignment);
+                EXPECT_DOUBLE_EQ(bruteForceMinCost(costs, num_rows, num_cols),
+                                 assignmentCost(costs, num_rows, num_cols, assignment));
+            }
+        }
+    }
+}
+
+TEST(HungarianSolverTest, test_warm_start_keeps_optimal_assignment)
+{
+    std::vector<double> costs = {0.1, 0.9, 0.9, 0.9, 0.2, 0.9, 0.9, 0.9, 0.3};
+
+    HungarianSolver solver;
+    std::vector<int> assignment = solver.solve(costs, 3, 3);
+    EXPECT_EQ(std::vector<int>({0, 1, 2}), assignment);
+
+    // The costs changed slightly, but the assignment is still optimal
+    costs[0]   = 0.15;
+    costs[4]   = 0.25;
+    assignment = solver.solve(costs, 3, 3, assignment);
+    EXPECT_EQ(std::vector<int>({0, 1, 2}), assignment);
+    EXPECT_EQ(0, solver.numAugmentingPaths());
+}
+
+TEST(HungarianSolverTest, test_warm_start_keeps_assignment_when_costs_are_equal)
+{
+    HungarianSolver solver;
+    std::vector<double> costs(9, 0.5);
+    std::vector<int> assignment = solver.solve(costs, 3, 3, {2, 0, 1});
+    EXPECT_EQ(std::vector<int>({2, 0, 1}), assignment);
+    assignment = solver.solve(costs, 3, 3, assignment);
+    EXPECT_EQ(std::vector<int>({2, 0, 1}), assignment);
+}
@@ -1,7 +1,6 @@
 #include "software/ai/hl/stp/stp.h"
 
 #include <google/protobuf/map.h>
-#include <munkres/munkres.h>
 
 #include <algorithm>
 #include <boost/bind.hpp>
@@ -19,6 +18,7 @@
 #include "software/ai/motion_constraint/motion_constraint_set_builder.h"
 #include "software/logger/logger.h"
 #include "software/util/generic_factory/generic_factory.h"
+#include "software/util/latency_profiler/latency_profiler.h"
 #include "software/util/typename/typename.h"
 
 STP::STP(std::shared_ptr<const AiConfig> ai_config)
@@ -28,7 +28,8 @@ STP::STP(std::shared_ptr<const AiConfig> ai_config)
       stop_tactics(),
       current_play(std::make_unique<HaltPlay>(ai_config)),
       fsm(std::make_unique<FSM<PlaySelectionFSM>>(PlaySelectionFSM{ai_config})),
-      override_play(nullptr)
+      override_play(nullptr),
+      tactic_assigner()
 {
     ai_config->getAiControlConfig()->getCurrentAiPlay()->registerCallbackFunction(
         [this, ai_config](std::string new_override_play_name) {
@@ -55,6 +56,8 @@ STP::STP(std::shared_ptr<const AiConfig> ai_config)
 
 std::vector<std::unique_ptr<Intent>> STP::getIntentsFromCurrentPlay(const World& world)
 {
+    ScopedLatencyTimer latency_timer(LatencyStage::PLAY_UPDATE);
+
     fsm->process_event(PlaySelectionFSM::Update(
         [this](std::unique_ptr<Play> play) { current_play = std::move(play); },
         world.gameState()));
@@ -120,6 +123,8 @@ std::map<std::shared_ptr<const Tactic>, Robot> STP::assignRobotsToTactics(
     ConstPriorityTacticVector tactics, const World& world,
     bool automatically_assign_goalie)
 {
+    ScopedLatencyTimer latency_timer(LatencyStage::TACTIC_ASSIGNMENT);
+
     robot_tactic_assignment.clear();
 
     std::optional<Robot> goalie_robot = world.friendlyTeam().goalie();
@@ -151,11 +156,13 @@ std::map<std::shared_ptr<const Tactic>, Robot> STP::assignRobotsToTactics(
     // (also known as the Munkres algorithm)
     // https://en.wikipedia.org/wiki/Hungarian_algorithm
     //
-    // https://github.com/saebyn/munkres-cpp is the implementation of the Hungarian
-    // algorithm that we use here
-    for (auto tactic_vector : tactics)
+    // The TacticAssigner caches the robot costs and warm starts the Hungarian algorithm
+    // from the assignment of the previous tick
+    tactic_assigner.startTick(world);
+    for (size_t priority = 0; priority < tactics.size(); priority++)
     {
-        size_t num_tactics = tactic_vector.size();
+        ConstTacticVector tactic_vector = tactics[priority];
+        size_t num_tactics              = tactic_vector.size();
 
         if (robots.size() < tactic_vector.size())
         {
@@ -177,82 +184,30 @@ std::map<std::shared_ptr<const Tactic>, Robot> STP::assignRobotsToTactics(
         size_t num_rows = robots.size();
         size_t num_cols = tactic_vector.size();
 
-        // The Matrix constructor will assert if the rows and columns of the matrix are
-        // not >= 1, so we perform that check first and skip over this tactic_vector if
-        // it is empty. This represents the cases where there are either no tactics or no
-        // robots
+        // Skip over this tactic_vector if it is empty. This represents the cases where
+        // there are either no tactics or no robots
         if (num_rows == 0 || num_cols == 0)
         {
             continue;
         }
 
-        // The rows of the matrix are the "workers" (the robots) and the columns are the
-        // "jobs" (the Tactics).
-        Matrix<double> matrix(num_rows, num_cols);
+        const std::vector<int>& robot_to_tactic =
+            tactic_assigner.assign(priority, tactic_vector, robots, world);
 
-        // Initialize the matrix with the cost of assigning each Robot to each Tactic
-        for (size_t row = 0; row < num_rows; row++)
-        {
-            for (size_t col = 0; col < num_cols; col++)
-            {
-                Robot robot                           = robots.at(row);
-                std::shared_ptr<const Tactic>& tactic = tactic_vector.at(col);
-                double robot_cost_for_tactic = tactic->calculateRobotCost(robot, world);
-
-                std::set<RobotCapability> required_capabilities =
-                    tactic->robotCapabilityRequirements();
-                std::set<RobotCapability> robot_capabilities =
-                    robot.getAvailableCapabilities();
-                std::set<RobotCapability> missing_capabilities;
-                std::set_difference(
-                    required_capabilities.begin(), required_capabilities.end(),
-                    robot_capabilities.begin(), robot_capabilities.end(),
-                    std::inserter(missing_capabilities, missing_capabilities.begin()));
-
-                if (missing_capabilities.size() > 0)
-                {
-                    matrix(row, col) = robot_cost_for_tactic + 10.0f;
-                }
-                else
-                {
-                    // capability requirements are satisfied, use real cost
-                    matrix(row, col) = robot_cost_for_tactic;
-                }
-            }
-        }
-
-        // Apply the Munkres/Hungarian algorithm to the matrix.
-        Munkres<double> m;
-        m.solve(matrix);
-
-        // The Munkres matrix gets solved such that there will be exactly one 0 in every
-        // row and exactly one 0 in every column. All other values will be -1. The 0's
-        // indicate the "workers" and "jobs" (robots and tactics for us) that are most
-        // optimally paired together
-        //
-        // Example matrices:
-        //        -1, 0,-1,         and            0,-1,
-        //         0,-1,-1,                       -1, 0,
-        //        -1,-1, 0,
         auto remaining_robots = robots;
 
         for (size_t row = 0; row < num_rows; row++)
         {
-            for (size_t col = 0; col < num_tactics; col++)
+            size_t col = static_cast<size_t>(robot_to_tactic[row]);
+            if (col < num_tactics)
             {
-                auto val = matrix(row, col);
-                if (val == 0)
-                {
-                    robot_tactic_assignment.emplace(tactic_vector.at(col),
-                                                    robots.at(row));
-                    remaining_robots.erase(
-                        std::remove_if(remaining_robots.begin(), remaining_robots.end(),
-                                       [robots, row](const Robot& robot) {
-                                           return robot.id() == robots.at(row).id();
-                                       }),
-                        remaining_robots.end());
-                    break;
-                }
+                robot_tactic_assignment.emplace(tactic_vector.at(col), robots.at(row));
+                remaining_robots.erase(
+                    std::remove_if(remaining_robots.begin(), remaining_robots.end(),
+                                   [robots, row](const Robot& robot) {
+                                       return robot.id() == robots.at(row).id();
+                                   }),
+                    remaining_robots.end());
             }
         }
 
@@ -262,6 +217,11 @@ std::map<std::shared_ptr<const Tactic>, Robot> STP::assignRobotsToTactics(
     return robot_tactic_assignment;
 }
 
+const TacticAssignmentStats& STP::getTacticAssignmentStats() const
+{
+    return tactic_assigner.getStats();
+}
+
 void STP::overridePlay(std::unique_ptr<Play> play)
 {
     override_play = std::move(play);
@@ -8,6 +8,7 @@
 #include "shared/parameter/cpp_dynamic_parameters.h"
 #include "software/ai/hl/stp/play/play.h"
 #include "software/ai/hl/stp/play_selection_fsm.h"
+#include "software/ai/hl/stp/tactic_assigner.h"
 #include "software/ai/intent/intent.h"
 
 /**
@@ -134,6 +135,14 @@ class STP
         ConstPriorityTacticVector tactics, const World &world,
         bool automatically_assign_goalie);
 
+    /**
+     * Gets the counters for assigning robots to tactics in the last tick, such as how
+     * long it took and how many robot costs were reused from the previous tick
+     *
+     * @return the tactic assignment counters of the last tick
+     */
+    const TacticAssignmentStats &getTacticAssignmentStats() const;
+
    private:
     /**
      * Gets the intents the current play wants to run
@@ -160,4 +169,5 @@ class STP
     std::unique_ptr<FSM<PlaySelectionFSM>> fsm;
     bool override_play_changed;
     std::unique_ptr<Play> override_play;
+    TacticAssigner tactic_assigner;
 };
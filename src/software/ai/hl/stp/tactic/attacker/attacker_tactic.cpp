@@ -70,6 +70,11 @@ double AttackerTactic::calculateRobotCost(const Robot& robot, const World& world
     return std::clamp<double>(cost, 0, 1);
 }
 
+RobotCostDependency AttackerTactic::robotCostDependency() const
+{
+    return RobotCostDependency::ROBOT_AND_BALL;
+}
+
 void AttackerTactic::accept(TacticVisitor& visitor) const
 {
     visitor.visit(*this);
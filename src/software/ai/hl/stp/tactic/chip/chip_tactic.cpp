@@ -32,6 +32,11 @@ double ChipTactic::calculateRobotCost(const Robot &robot, const World &world) co
     return std::clamp<double>(cost, 0, 1);
 }
 
+RobotCostDependency ChipTactic::robotCostDependency() const
+{
+    return RobotCostDependency::ROBOT_AND_BALL;
+}
+
 void ChipTactic::accept(TacticVisitor &visitor) const
 {
     visitor.visit(*this);
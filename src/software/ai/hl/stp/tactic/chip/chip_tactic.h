@@ -48,6 +48,7 @@ class ChipTactic : public Tactic
      * to this tactic. Lower cost values indicate a more preferred robot.
      */
     double calculateRobotCost(const Robot& robot, const World& world) const override;
+    RobotCostDependency robotCostDependency() const override;
 
     void accept(TacticVisitor& visitor) const override;
 
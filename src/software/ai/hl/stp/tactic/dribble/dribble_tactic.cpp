@@ -37,6 +37,11 @@ double DribbleTactic::calculateRobotCost(const Robot &robot, const World &world)
     return std::clamp<double>(cost, 0, 1);
 }
 
+RobotCostDependency DribbleTactic::robotCostDependency() const
+{
+    return RobotCostDependency::ROBOT_AND_BALL;
+}
+
 void DribbleTactic::updateIntent(const TacticUpdate &tactic_update)
 {
     fsm.process_event(DribbleFSM::Update(control_params, tactic_update));
@@ -12,6 +12,12 @@ GetBehindBallTactic::GetBehindBallTactic()
 void GetBehindBallTactic::updateControlParams(const Point &ball_location,
                                               Angle chick_direction)
 {
+    if (ball_location.x() != control_params.ball_location.x() ||
+        ball_location.y() != control_params.ball_location.y())
+    {
+        invalidateRobotCosts();
+    }
+
     control_params.ball_location   = ball_location;
     control_params.chick_direction = chick_direction;
 }
@@ -27,6 +33,11 @@ double GetBehindBallTactic::calculateRobotCost(const Robot &robot,
     return std::clamp<double>(cost, 0, 1);
 }
 
+RobotCostDependency GetBehindBallTactic::robotCostDependency() const
+{
+    return RobotCostDependency::ROBOT;
+}
+
 void GetBehindBallTactic::updateIntent(const TacticUpdate &tactic_update)
 {
     fsm.process_event(GetBehindBallFSM::Update(control_params, tactic_update));
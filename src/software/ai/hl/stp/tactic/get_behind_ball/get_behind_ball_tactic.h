@@ -34,6 +34,7 @@ class GetBehindBallTactic : public Tactic
      * to this tactic. Lower cost values indicate a more preferred robot.
      */
     double calculateRobotCost(const Robot& robot, const World& world) const override;
+    RobotCostDependency robotCostDependency() const override;
 
     void accept(TacticVisitor& visitor) const override;
 
@@ -24,6 +24,11 @@ double GoalieTactic::calculateRobotCost(const Robot &robot, const World &world)
     }
 }
 
+RobotCostDependency GoalieTactic::robotCostDependency() const
+{
+    return RobotCostDependency::ROBOT;
+}
+
 void GoalieTactic::updateIntent(const TacticUpdate &tactic_update)
 {
     fsm.process_event(GoalieFSM::Update({}, tactic_update));
@@ -31,6 +31,8 @@ class GoalieTactic : public Tactic
 
     double calculateRobotCost(const Robot &robot, const World &world) const override;
 
+    RobotCostDependency robotCostDependency() const override;
+
     void accept(TacticVisitor &visitor) const override;
 
     DEFINE_TACTIC_DONE_AND_GET_FSM_STATE
@@ -32,6 +32,11 @@ double KickTactic::calculateRobotCost(const Robot &robot, const World &world) co
     return std::clamp<double>(cost, 0, 1);
 }
 
+RobotCostDependency KickTactic::robotCostDependency() const
+{
+    return RobotCostDependency::ROBOT_AND_BALL;
+}
+
 void KickTactic::accept(TacticVisitor &visitor) const
 {
     visitor.visit(*this);
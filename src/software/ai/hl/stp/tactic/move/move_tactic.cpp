@@ -23,6 +23,12 @@ void MoveTactic::updateControlParams(
     TbotsProto::BallCollisionType ball_collision_type, AutoChipOrKick auto_chip_or_kick,
     TbotsProto::MaxAllowedSpeedMode max_allowed_speed_mode, double target_spin_rev_per_s)
 {
+    if (destination.x() != control_params.destination.x() ||
+        destination.y() != control_params.destination.y())
+    {
+        invalidateRobotCosts();
+    }
+
     // Update the control parameters stored by this Tactic
     control_params.destination            = destination;
     control_params.final_orientation      = final_orientation;
@@ -38,6 +44,12 @@ void MoveTactic::updateControlParams(
     Point destination, Angle final_orientation, double final_speed,
     TbotsProto::MaxAllowedSpeedMode max_allowed_speed_mode)
 {
+    if (destination.x() != control_params.destination.x() ||
+        destination.y() != control_params.destination.y())
+    {
+        invalidateRobotCosts();
+    }
+
     // Update the control parameters stored by this Tactic
     control_params.destination            = destination;
     control_params.final_orientation      = final_orientation;
@@ -59,6 +71,11 @@ double MoveTactic::calculateRobotCost(const Robot &robot, const World &world) co
     return std::clamp<double>(cost, 0, 1);
 }
 
+RobotCostDependency MoveTactic::robotCostDependency() const
+{
+    return RobotCostDependency::ROBOT;
+}
+
 void MoveTactic::updateIntent(const TacticUpdate &tactic_update)
 {
     fsm.process_event(MoveFSM::Update(control_params, tactic_update));
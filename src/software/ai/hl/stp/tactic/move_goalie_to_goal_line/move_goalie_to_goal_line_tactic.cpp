@@ -22,6 +22,11 @@ double MoveGoalieToGoalLineTactic::calculateRobotCost(const Robot &robot,
     }
 }
 
+RobotCostDependency MoveGoalieToGoalLineTactic::robotCostDependency() const
+{
+    return RobotCostDependency::ROBOT;
+}
+
 void MoveGoalieToGoalLineTactic::updateIntent(const TacticUpdate &tactic_update)
 {
     fsm.process_event(MoveGoalieToGoalLineFSM::Update({}, tactic_update));
@@ -17,6 +17,11 @@ double PenaltyKickTactic::calculateRobotCost(const Robot& robot, const World& wo
     return std::clamp<double>(cost, 0, 1);
 }
 
+RobotCostDependency PenaltyKickTactic::robotCostDependency() const
+{
+    return RobotCostDependency::ROBOT_AND_BALL;
+}
+
 void PenaltyKickTactic::accept(TacticVisitor& visitor) const
 {
     visitor.visit(*this);
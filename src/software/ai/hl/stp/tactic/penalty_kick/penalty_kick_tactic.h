@@ -32,6 +32,7 @@ class PenaltyKickTactic : public Tactic
      * to this tactic. Lower cost values indicate a more preferred robot.
      */
     double calculateRobotCost(const Robot &robot, const World &world) const override;
+    RobotCostDependency robotCostDependency() const override;
 
     DEFINE_TACTIC_DONE_AND_GET_FSM_STATE
 
@@ -28,6 +28,11 @@ double PivotKickTactic::calculateRobotCost(const Robot &robot, const World &worl
     }
 }
 
+RobotCostDependency PivotKickTactic::robotCostDependency() const
+{
+    return RobotCostDependency::ROBOT_AND_BALL;
+}
+
 void PivotKickTactic::accept(TacticVisitor &visitor) const
 {
     visitor.visit(*this);
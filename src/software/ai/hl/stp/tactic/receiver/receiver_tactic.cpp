@@ -17,6 +17,15 @@ ReceiverTactic::ReceiverTactic()
 void ReceiverTactic::updateControlParams(std::optional<Pass> updated_pass,
                                          bool disable_one_touch_shot)
 {
+    // The robot cost only depends on where the pass is received
+    if (updated_pass.has_value() != control_params.pass.has_value() ||
+        (updated_pass.has_value() &&
+         (updated_pass->receiverPoint().x() != control_params.pass->receiverPoint().x() ||
+          updated_pass->receiverPoint().y() != control_params.pass->receiverPoint().y())))
+    {
+        invalidateRobotCosts();
+    }
+
     // Update the control parameters stored by this Tactic
     control_params.pass                   = updated_pass;
     control_params.disable_one_touch_shot = disable_one_touch_shot;
@@ -44,6 +53,11 @@ double ReceiverTactic::calculateRobotCost(const Robot& robot, const World& world
     return std::clamp<double>(cost, 0, 1);
 }
 
+RobotCostDependency ReceiverTactic::robotCostDependency() const
+{
+    return RobotCostDependency::ROBOT;
+}
+
 void ReceiverTactic::accept(TacticVisitor& visitor) const
 {
     visitor.visit(*this);
@@ -38,6 +38,7 @@ class ReceiverTactic : public Tactic
      * to this tactic. Lower cost values indicate a more preferred robot.
      */
     double calculateRobotCost(const Robot& robot, const World& world) const override;
+    RobotCostDependency robotCostDependency() const override;
 
     /**
      * Calculate the angle the robot should be at in order to perform the given shot
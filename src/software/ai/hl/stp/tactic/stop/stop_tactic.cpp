@@ -13,6 +13,11 @@ double StopTactic::calculateRobotCost(const Robot &robot, const World &world) co
     return 0.5;
 }
 
+RobotCostDependency StopTactic::robotCostDependency() const
+{
+    return RobotCostDependency::ROBOT;
+}
+
 void StopTactic::updateIntent(const TacticUpdate &tactic_update)
 {
     fsm.process_event(StopFSM::Update({}, tactic_update));
@@ -5,7 +5,7 @@
 #include "software/util/typename/typename.h"
 
 Tactic::Tactic(const std::set<RobotCapability> &capability_reqs_)
-    : intent(), capability_reqs(capability_reqs_)
+    : intent(), capability_reqs(capability_reqs_), robot_cost_version(0)
 {
 }
 
@@ -19,6 +19,21 @@ std::set<RobotCapability> &Tactic::mutableRobotCapabilityRequirements()
     return capability_reqs;
 }
 
+RobotCostDependency Tactic::robotCostDependency() const
+{
+    return RobotCostDependency::WORLD;
+}
+
+unsigned int Tactic::robotCostVersion() const
+{
+    return robot_cost_version;
+}
+
+void Tactic::invalidateRobotCosts()
+{
+    robot_cost_version++;
+}
+
 std::unique_ptr<Intent> Tactic::get(const Robot &robot, const World &world)
 {
     updateIntent(TacticUpdate(robot, world, [this](std::unique_ptr<Intent> new_intent) {
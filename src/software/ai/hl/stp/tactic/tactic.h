@@ -23,6 +23,21 @@
         }                                                                                \
     };
 
+/**
+ * What the cost of assigning a robot to a tactic depends on, besides the robot itself
+ * and the parameters of the tactic
+ */
+enum class RobotCostDependency
+{
+    // The cost only depends on the robot, the tactic parameters, the field and the
+    // friendly goalie
+    ROBOT,
+    // The cost also depends on the ball
+    ROBOT_AND_BALL,
+    // The cost can depend on anything in the World
+    WORLD
+};
+
 /**
  * In the STP framework, a Tactic represents a role or objective for a single robot.
  * This can be thought of as a "position" on a typical soccer team. Some examples are:
@@ -92,6 +107,23 @@ class Tactic
      */
     virtual double calculateRobotCost(const Robot &robot, const World &world) const = 0;
 
+    /**
+     * Gets what the cost calculated by calculateRobotCost depends on. Costs that don't
+     * depend on the whole World are cached between ticks, until the robot, the tactic
+     * parameters, or the parts of the World they depend on change
+     *
+     * @return what the robot cost of this tactic depends on
+     */
+    virtual RobotCostDependency robotCostDependency() const;
+
+    /**
+     * Gets the version of the tactic parameters that calculateRobotCost depends on. The
+     * version changes every time one of those parameters changes
+     *
+     * @return the version of the robot cost parameters
+     */
+    unsigned int robotCostVersion() const;
+
     /**
      * Updates and returns the next intent from this tactic
      *
@@ -111,6 +143,14 @@ class Tactic
 
     virtual ~Tactic() = default;
 
+   protected:
+    /**
+     * Marks the robot costs of this tactic as changed. Tactics whose robot costs don't
+     * depend on the whole World must call this whenever a parameter that
+     * calculateRobotCost depends on changes
+     */
+    void invalidateRobotCosts();
+
    private:
     std::unique_ptr<Intent> intent;
 
@@ -124,4 +164,6 @@ class Tactic
 
     // robot capability requirements
     std::set<RobotCapability> capability_reqs;
+
+    unsigned int robot_cost_version;
 };
@@ -0,0 +1,212 @@
+#include "software/ai/hl/stp/tactic_assigner.h"
+
+#include <algorithm>
+#include <chrono>
+
+TacticAssigner::TacticAssigner()
+    : cached_costs(),
+      last_field(std::nullopt),
+      last_goalie_id(std::nullopt),
+      field_version(0),
+      last_ball_state(std::nullopt),
+      ball_version(0),
+      priority_assignments(),
+      robot_states(),
+      costs(),
+      warm_start_assignment(),
+      stats()
+{
+}
+
+void TacticAssigner::startTick(const World& world)
+{
+    stats = TacticAssignmentStats();
+
+    // Only keep the costs of the tactics that were assigned in the last tick, so that
+    // tactics that are no longer used don't stay alive
+    for (auto iter = cached_costs.begin(); iter != cached_costs.end();)
+    {
+        if (iter->second.used)
+        {
+            iter->second.used = false;
+            iter++;
+        }
+        else
+        {
+            iter = cached_costs.erase(iter);
+        }
+    }
+
+    if (!last_field || *last_field != world.field() ||
+        last_goalie_id != world.friendlyTeam().getGoalieId())
+    {
+        last_field     = world.field();
+        last_goalie_id = world.friendlyTeam().getGoalieId();
+        field_version++;
+    }
+    if (!last_ball_state || *last_ball_state != world.ball().currentState())
+    {
+        last_ball_state = world.ball().currentState();
+        ball_version++;
+    }
+}
+
+const std::vector<int>& TacticAssigner::assign(
+    size_t priority, const std::vector<std::shared_ptr<const Tactic>>& tactics,
+    const std::vector<Robot>& robots, const World& world)
+{
+    const size_t num_rows = robots.size();
+    const size_t num_cols = tactics.size();
+
+    auto cost_start_time = std::chrono::steady_clock::now();
+
+    // The capability requirements of each Tactic are the same for every robot, so
+    // they are only converted to RobotCapabilities once
+    std::vector<RobotCapabilities> required_capabilities;
+    required_capabilities.reserve(num_cols);
+    for (const auto& tactic : tactics)
+    {
+        required_capabilities.emplace_back(tactic->robotCapabilityRequirements());
+    }
+
+    robot_states.clear();
+    for (const Robot& robot : robots)
+    {
+        robot_states.emplace_back(robot.currentState());
+    }
+
+    // The rows of the matrix are the "workers" (the robots) and the columns are the
+    // "jobs" (the Tactics).
+    costs.resize(num_rows * num_cols);
+    for (size_t col = 0; col < num_cols; col++)
+    {
+        CachedTacticCosts* cached_tactic_costs = getCachedTacticCosts(tactics[col]);
+        for (size_t row = 0; row < num_rows; row++)
+        {
+            const Robot& robot           = robots[row];
+            double robot_cost_for_tactic = 0;
+            std::optional<CachedRobotCost>* cached_robot_cost =
+                cached_tactic_costs && robot.id() < MAX_ROBOT_IDS
+                    ? &cached_tactic_costs->robot_costs[robot.id()]
+                    : nullptr;
+            if (cached_robot_cost && *cached_robot_cost &&
+                (*cached_robot_cost)->robot_state == robot_states[row])
+            {
+                stats.num_costs_cached++;
+                robot_cost_for_tactic = (*cached_robot_cost)->cost;
+            }
+            else
+            {
+                stats.num_costs_calculated++;
+                robot_cost_for_tactic = tactics[col]->calculateRobotCost(robot, world);
+                if (cached_robot_cost)
+                {
+                    *cached_robot_cost =
+                        CachedRobotCost{robot_states[row], robot_cost_for_tactic};
+                }
+            }
+
+            if (!(required_capabilities[col] <= robot.getAvailableCapabilities()))
+            {
+                costs[row * num_cols + col] = robot_cost_for_tactic + 10.0f;
+            }
+            else
+            {
+                // capability requirements are satisfied, use real cost
+                costs[row * num_cols + col] = robot_cost_for_tactic;
+            }
+        }
+    }
+
+    auto solve_start_time = std::chrono::steady_clock::now();
+
+    if (priority_assignments.size() <= priority)
+    {
+        priority_assignments.resize(priority + 1);
+    }
+    PriorityAssignment& priority_assignment = priority_assignments[priority];
+
+    // Every robot starts from the tactic it was assigned to in the last tick, if that
+    // tactic is still in this priority tier
+    warm_start_assignment.clear();
+    if (!priority_assignment.previous_assignment.empty())
+    {
+        warm_start_assignment.resize(num_rows, -1);
+        for (size_t row = 0; row < num_rows; row++)
+        {
+            auto previous_iter = std::find_if(
+                priority_assignment.previous_assignment.begin(),
+                priority_assignment.previous_assignment.end(),
+                [&](const auto& previous) { return previous.first == robots[row].id(); });
+            if (previous_iter == priority_assignment.previous_assignment.end())
+            {
+                continue;
+            }
+            for (size_t col = 0; col < num_cols; col++)
+            {
+                if (tactics[col].get() == previous_iter->second)
+                {
+                    warm_start_assignment[row] = static_cast<int>(col);
+                    break;
+                }
+            }
+        }
+    }
+
+    const std::vector<int>& assignment = priority_assignment.solver.solve(
+        costs, num_rows, num_cols, warm_start_assignment);
+
+    priority_assignment.previous_assignment.clear();
+    for (size_t row = 0; row < num_rows; row++)
+    {
+        priority_assignment.previous_assignment.emplace_back(
+            robots[row].id(), tactics[assignment[row]].get());
+    }
+
+    auto end_time = std::chrono::steady_clock::now();
+    stats.num_robots_reassigned +=
+        static_cast<unsigned int>(priority_assignment.solver.numAugmentingPaths());
+    stats.cost_duration =
+        stats.cost_duration +
+        Duration::fromSeconds(
+            std::chrono::duration<double>(solve_start_time - cost_start_time).count());
+    stats.solve_duration =
+        stats.solve_duration +
+        Duration::fromSeconds(
+            std::chrono::duration<double>(end_time - solve_start_time).count());
+
+    return assignment;
+}
+
+const TacticAssignmentStats& TacticAssigner::getStats() const
+{
+    return stats;
+}
+
+TacticAssigner::CachedTacticCosts* TacticAssigner::getCachedTacticCosts(
+    const std::shared_ptr<const Tactic>& tactic)
+{
+    RobotCostDependency dependency = tactic->robotCostDependency();
+    if (dependency == RobotCostDependency::WORLD)
+    {
+        return nullptr;
+    }
+
+    auto [iter, inserted]                  = cached_costs.try_emplace(tactic.get());
+    CachedTacticCosts& cached_tactic_costs = iter->second;
+    // Costs that don't depend on the ball stay cached when the ball moves
+    const unsigned int required_ball_version =
+        dependency == RobotCostDependency::ROBOT_AND_BALL ? ball_version : 0;
+    if (inserted || cached_tactic_costs.tactic_version != tactic->robotCostVersion() ||
+        cached_tactic_costs.field_version != field_version ||
+        cached_tactic_costs.ball_version != required_ball_version)
+    {
+        cached_tactic_costs.tactic         = tactic;
+        cached_tactic_costs.tactic_version = tactic->robotCostVersion();
+        cached_tactic_costs.field_version  = field_version;
+        cached_tactic_costs.ball_version   = required_ball_version;
+        cached_tactic_costs.robot_costs.fill(std::nullopt);
+    }
+    cached_tactic_costs.used = true;
+    return &cached_tactic_costs;
+}
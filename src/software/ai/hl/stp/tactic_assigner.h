@@ -0,0 +1,138 @@
+#pragma once
+
+#include <array>
+#include <memory>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+#include "shared/constants.h"
+#include "software/ai/hl/stp/hungarian_solver.h"
+#include "software/ai/hl/stp/tactic/tactic.h"
+#include "software/time/duration.h"
+#include "software/world/world.h"
+
+/**
+ * Counters for assigning robots to tactics in a single tick
+ */
+struct TacticAssignmentStats
+{
+    // The number of robot costs that were calculated by the tactics
+    unsigned int num_costs_calculated = 0;
+    // The number of robot costs that were reused from a previous tick
+    unsigned int num_costs_cached = 0;
+    // The number of robots that couldn't keep their assignment from the previous tick
+    // and had to be assigned again
+    unsigned int num_robots_reassigned = 0;
+    // The time spent getting the robot costs
+    Duration cost_duration;
+    // The time spent solving the assignments
+    Duration solve_duration;
+};
+
+/**
+ * Assigns robots to tactics so that the total cost of the assignment is minimized, for
+ * every priority tier of tactics that STP assigns.
+ *
+ * The assignment barely changes from one tick to the next, so the TacticAssigner reuses
+ * as much as it can from the previous tick:
+ * - The cost of assigning every robot to every tactic is cached, and only calculated
+ *   again when the robot, the tactic parameters, or the parts of the World the cost
+ *   depends on changed. See Tactic::robotCostDependency
+ * - The Hungarian algorithm is warm started from the previous assignment of the same
+ *   priority tier, so only the robots whose previous tactic is no longer optimal for
+ *   them are assigned again
+ */
+class TacticAssigner
+{
+   public:
+    /**
+     * Creates a TacticAssigner with nothing cached
+     */
+    explicit TacticAssigner();
+
+    /**
+     * Starts assigning robots for a new tick. This must be called before the tactics
+     * of every priority tier are assigned.
+     *
+     * @param world The World the robots are assigned in
+     */
+    void startTick(const World& world);
+
+    /**
+     * Assigns robots to the tactics of a priority tier
+     *
+     * @param priority The index of the priority tier of the tactics
+     * @param tactics The tactics to assign robots to, which must be at least as many as
+     * the robots
+     * @param robots The robots to assign
+     * @param world The World the robots are assigned in, which must be the World
+     * startTick was called with
+     *
+     * @return The index of the tactic every robot is assigned to, indexed like the
+     * robots
+     */
+    const std::vector<int>& assign(
+        size_t priority, const std::vector<std::shared_ptr<const Tactic>>& tactics,
+        const std::vector<Robot>& robots, const World& world);
+
+    /**
+     * Gets the counters for the current tick
+     *
+     * @return the counters for the current tick
+     */
+    const TacticAssignmentStats& getStats() const;
+
+   private:
+    struct CachedRobotCost
+    {
+        RobotState robot_state;
+        double cost;
+    };
+
+    struct CachedTacticCosts
+    {
+        // The tactic is kept alive so that no other tactic can have the same address
+        // while its costs are cached
+        std::shared_ptr<const Tactic> tactic;
+        unsigned int tactic_version;
+        unsigned int field_version;
+        unsigned int ball_version;
+        std::array<std::optional<CachedRobotCost>, MAX_ROBOT_IDS> robot_costs;
+        bool used;
+    };
+
+    struct PriorityAssignment
+    {
+        HungarianSolver solver;
+        // The tactic each robot was assigned to in the last tick
+        std::vector<std::pair<RobotId, const Tactic*>> previous_assignment;
+    };
+
+    /**
+     * Gets the cached robot costs of the tactic, which are cleared if they are no
+     * longer valid
+     *
+     * @param tactic The tactic
+     *
+     * @return the cached robot costs of the tactic, or nullptr if its robot costs
+     * can't be cached
+     */
+    CachedTacticCosts* getCachedTacticCosts(const std::shared_ptr<const Tactic>& tactic);
+
+    std::unordered_map<const Tactic*, CachedTacticCosts> cached_costs;
+
+    // The versions change every time the parts of the World that robot costs can
+    // depend on change
+    std::optional<Field> last_field;
+    std::optional<RobotId> last_goalie_id;
+    unsigned int field_version;
+    std::optional<BallState> last_ball_state;
+    unsigned int ball_version;
+
+    std::vector<PriorityAssignment> priority_assignments;
+    std::vector<RobotState> robot_states;
+    std::vector<double> costs;
+    std::vector<int> warm_start_assignment;
+    TacticAssignmentStats stats;
+};
@@ -0,0 +1,285 @@
+#include "software/ai/hl/stp/tactic_assigner.h"
+
+#include <gtest/gtest.h>
+
+#include <iostream>
+
+#include "software/ai/hl/stp/tactic/crease_defender/crease_defender_tactic.h"
+#include "software/ai/hl/stp/tactic/kick/kick_tactic.h"
+#include "software/ai/hl/stp/tactic/move/move_tactic.h"
+#include "software/ai/hl/stp/tactic/stop/stop_tactic.h"
+#include "software/test_util/test_util.h"
+
+class TacticAssignerTest : public ::testing::Test
+{
+   protected:
+    void SetUp() override
+    {
+        world = ::TestUtil::createBlankTestingWorld();
+        world = ::TestUtil::setFriendlyRobotPositions(
+            world, {Point(-1, 1), Point(1, 1), Point(0, -2)}, Timestamp::fromSeconds(0));
+        robots = world.friendlyTeam().getAllRobots();
+
+        move_tactic = std::make_shared<MoveTactic>();
+        move_tactic->updateControlParams(Point(1, 0), Angle::zero(), 0,
+                                         TbotsProto::MaxAllowedSpeedMode::PHYSICAL_LIMIT);
+        kick_tactic = std::make_shared<KickTactic>();
+        kick_tactic->updateControlParams(Point(0, 0), Angle::zero(), 5);
+        stop_tactic = std::make_shared<StopTactic>(false);
+        tactics     = {move_tactic, kick_tactic, stop_tactic};
+    }
+
+    World world = ::TestUtil::createBlankTestingWorld();
+    std::vector<Robot> robots;
+    std::shared_ptr<MoveTactic> move_tactic;
+    std::shared_ptr<KickTactic> kick_tactic;
+    std::shared_ptr<StopTactic> stop_tactic;
+    std::vector<std::shared_ptr<const Tactic>> tactics;
+    TacticAssigner tactic_assigner;
+};
+
+TEST_F(TacticAssignerTest, test_assigns_cheapest_robots)
+{
+    tactic_assigner.startTick(world);
+    std::vector<int> assignment = tactic_assigner.assign(0, tactics, robots, world);
+
+    // Robot 1 is closest to the move destination and robot 0 is the next closest to the
+    // ball
+    EXPECT_EQ(std::vector<int>({1, 0, 2}), assignment);
+    EXPECT_EQ(9, tactic_assigner.getStats().num_costs_calculated);
+    EXPECT_EQ(0, tactic_assigner.getStats().num_costs_cached);
+}
+
+TEST_F(TacticAssignerTest, test_costs_are_cached_when_nothing_changes)
+{
+    tactic_assigner.startTick(world);
+    std::vector<int> first_assignment = tactic_assigner.assign(0, tactics, robots, world);
+
+    tactic_assigner.startTick(world);
+    std::vector<int> second_assignment =
+        tactic_assigner.assign(0, tactics, robots, world);
+
+    EXPECT_EQ(first_assignment, second_assignment);
+    EXPECT_EQ(0, tactic_assigner.getStats().num_costs_calculated);
+    EXPECT_EQ(9, tactic_assigner.getStats().num_costs_cached);
+    EXPECT_EQ(0, tactic_assigner.getStats().num_robots_reassigned);
+}
+
+TEST_F(TacticAssignerTest, test_only_costs_of_moved_robot_are_calculated)
+{
+    tactic_assigner.startTick(world);
+    tactic_assigner.assign(0, tactics, robots, world);
+
+    world = ::TestUtil::setFriendlyRobotPositions(
+        world, {Point(-1, 1), Point(1, 1), Point(0.5, 0)}, Timestamp::fromSeconds(1));
+    robots = world.friendlyTeam().getAllRobots();
+
+    tactic_assigner.startTick(world);
+    tactic_assigner.assign(0, tactics, robots, world);
+
+    EXPECT_EQ(3, tactic_assigner.getStats().num_costs_calculated);
+    EXPECT_EQ(6, tactic_assigner.getStats().num_costs_cached);
+}
+
+TEST_F(TacticAssignerTest, test_costs_are_calculated_when_tactic_parameters_change)
+{
+    tactic_assigner.startTick(world);
+    tactic_assigner.assign(0, tactics, robots, world);
+
+    // Updating the parameters without changing the destination keeps the costs cached
+    move_tactic->updateControlParams(Point(1, 0), Angle::half(), 0,
+                                     TbotsProto::MaxAllowedSpeedMode::PHYSICAL_LIMIT);
+    tactic_assigner.startTick(world);
+    tactic_assigner.assign(0, tactics, robots, world);
+    EXPECT_EQ(0, tactic_assigner.getStats().num_costs_calculated);
+
+    move_tactic->updateControlParams(Point(0, -2), Angle::zero(), 0,
+                                     TbotsProto::MaxAllowedSpeedMode::PHYSICAL_LIMIT);
+    tactic_assigner.startTick(world);
+    std::vector<int> assignment = tactic_assigner.assign(0, tactics, robots, world);
+
+    EXPECT_EQ(3, tactic_assigner.getStats().num_costs_calculated);
+    EXPECT_EQ(6, tactic_assigner.getStats().num_costs_cached);
+    EXPECT_EQ(0, assignment[2]);
+}
+
+TEST_F(TacticAssignerTest, test_costs_depending_on_ball_are_calculated_when_ball_moves)
+{
+    tactic_assigner.startTick(world);
+    tactic_assigner.assign(0, tactics, robots, world);
+
+    world = ::TestUtil::setBallPosition(world, Point(0, -1.5), Timestamp::fromSeconds(1));
+    tactic_assigner.startTick(world);
+    std::vector<int> assignment = tactic_assigner.assign(0, tactics, robots, world);
+
+    // Only the costs of the KickTactic depend on the ball
+    EXPECT_EQ(3, tactic_assigner.getStats().num_costs_calculated);
+    EXPECT_EQ(6, tactic_assigner.getStats().num_costs_cached);
+    EXPECT_EQ(1, assignment[2]);
+}
+
+TEST_F(TacticAssignerTest, test_costs_of_world_dependent_tactics_are_never_cached)
+{
+    auto crease_defender_tactic =
+        std::make_shared<CreaseDefenderTactic>(std::make_shared<const ThunderbotsConfig>()
+                                                   ->getAiConfig()
+                                                   ->getRobotNavigationObstacleConfig());
+    tactics = {crease_defender_tactic, kick_tactic, stop_tactic};
+
+    tactic_assigner.startTick(world);
+    tactic_assigner.assign(0, tactics, robots, world);
+    tactic_assigner.startTick(world);
+    tactic_assigner.assign(0, tactics, robots, world);
+
+    EXPECT_EQ(3, tactic_assigner.getStats().num_costs_calculated);
+    EXPECT_EQ(6, tactic_assigner.getStats().num_costs_cached);
+}
+
+TEST_F(TacticAssignerTest, test_robots_keep_tactics_with_equal_costs)
+{
+    std::vector<std::shared_ptr<const Tactic>> stop_tactics = {
+        std::make_shared<StopTactic>(false), std::make_shared<StopTactic>(false),
+        std::make_shared<StopTactic>(false)};
+
+    tactic_assigner.startTick(world);
+    EXPECT_EQ(std::vector<int>({0, 1, 2}),
+              tactic_assigner.assign(0, stop_tactics, robots, world));
+
+    // The same robots in a different order keep their StopTactics
+    std::reverse(robots.begin(), robots.end());
+    tactic_assigner.startTick(world);
+    EXPECT_EQ(std::vector<int>({2, 1, 0}),
+              tactic_assigner.assign(0, stop_tactics, robots, world));
+    EXPECT_EQ(0, tactic_assigner.getStats().num_robots_reassigned);
+}
+
+// This test is disabled to speed up CI, it can be enabled by removing "DISABLED_" from
+// the test name
+TEST(TacticAssignerPerformanceTest, DISABLED_11_robots_11_tactics_in_3_tiers)
+{
+    auto ai_config = std::make_shared<const ThunderbotsConfig>()->getAiConfig();
+
+    std::vector<Point> robot_positions;
+    for (int i = 0; i < 11; i++)
+    {
+        robot_positions.emplace_back(Point(-4 + 0.7 * i, 0.25 * i - 1.5));
+    }
+    World world = ::TestUtil::createBlankTestingWorldDivB();
+    world =
+        ::TestUtil::setBallPosition(world, Point(0.5, 0.5), Timestamp::fromSeconds(0));
+
+    // Like a defensive play: crease defenders first, then a kicker, then the rest of
+    // the robots move into position
+    std::vector<std::vector<std::shared_ptr<const Tactic>>> tiers(3);
+    for (int i = 0; i < 2; i++)
+    {
+        auto crease_defender_tactic = std::make_shared<CreaseDefenderTactic>(
+            ai_config->getRobotNavigationObstacleConfig());
+        crease_defender_tactic->updateControlParams(
+            Point(0.5, 0.5), i == 0 ? TbotsProto::CreaseDefenderAlignment::LEFT
+                                    : TbotsProto::CreaseDefenderAlignment::RIGHT);
+        tiers[0].emplace_back(crease_defender_tactic);
+    }
+    auto kick_tactic = std::make_shared<KickTactic>();
+    kick_tactic->updateControlParams(Point(0.5, 0.5), Angle::zero(), 5);
+    tiers[1].emplace_back(kick_tactic);
+    for (int i = 0; i < 8; i++)
+    {
+        auto move_tactic = std::make_shared<MoveTactic>();
+        move_tactic->updateControlParams(Point(-3 + 0.8 * i, 2 - 0.5 * i), Angle::zero(),
+                                         0,
+                                         TbotsProto::MaxAllowedSpeedMode::PHYSICAL_LIMIT);
+        tiers[2].emplace_back(move_tactic);
+    }
+
+    std::vector<std::shared_ptr<const Tactic>> stop_tactics;
+    for (int i = 0; i < 11; i++)
+    {
+        stop_tactics.emplace_back(std::make_shared<StopTactic>(false));
+    }
+
+    // Assigns the tiers like STP does, where the robots that are assigned in a tier
+    // aren't assigned in the tiers after it
+    auto assign_tiers = [&](TacticAssigner& tactic_assigner, const World& world) {
+        tactic_assigner.startTick(world);
+        std::vector<Robot> robots = world.friendlyTeam().getAllRobots();
+        for (size_t priority = 0; priority < tiers.size(); priority++)
+        {
+            auto tactics = tiers[priority];
+            for (size_t i = 0; tactics.size() < robots.size(); i++)
+            {
+                tactics.emplace_back(stop_tactics[i]);
+            }
+            const std::vector<int>& assignment =
+                tactic_assigner.assign(priority, tactics, robots, world);
+
+            std::vector<Robot> remaining_robots;
+            for (size_t row = 0; row < robots.size(); row++)
+            {
+                if (assignment[row] >= static_cast<int>(tiers[priority].size()))
+                {
+                    remaining_robots.emplace_back(robots[row]);
+                }
+            }
+            robots = remaining_robots;
+        }
+    };
+
+    const unsigned int num_ticks = 10000;
+    std::vector<World> worlds;
+    for (unsigned int tick = 0; tick < num_ticks; tick++)
+    {
+        // The robots drift a little bit every tick, except for the last 4 robots
+        std::vector<Point> positions = robot_positions;
+        for (size_t i = 0; i < 7; i++)
+        {
+            positions[i] = positions[i] +
+                           Vector(0.0001 * tick, 0.0001 * static_cast<double>(i) * tick);
+        }
+        worlds.emplace_back(::TestUtil::setFriendlyRobotPositions(
+            world, positions, Timestamp::fromSeconds(tick / 60.0)));
+    }
+
+    auto start_time = std::chrono::system_clock::now();
+    for (const World& tick_world : worlds)
+    {
+        // Nothing is reused from the previous tick
+        TacticAssigner tactic_assigner;
+        assign_tiers(tactic_assigner, tick_world);
+    }
+    double cold_us = ::TestUtil::millisecondsSince(start_time) * 1000 / num_ticks;
+
+    TacticAssigner tactic_assigner;
+    TacticAssignmentStats total_stats;
+    start_time = std::chrono::system_clock::now();
+    for (const World& tick_world : worlds)
+    {
+        assign_tiers(tactic_assigner, tick_world);
+        const TacticAssignmentStats& stats = tactic_assigner.getStats();
+        total_stats.num_costs_calculated += stats.num_costs_calculated;
+        total_stats.num_costs_cached += stats.num_costs_cached;
+        total_stats.num_robots_reassigned += stats.num_robots_reassigned;
+        total_stats.cost_duration  = total_stats.cost_duration + stats.cost_duration;
+        total_stats.solve_duration = total_stats.solve_duration + stats.solve_duration;
+    }
+    double warm_us = ::TestUtil::millisecondsSince(start_time) * 1000 / num_ticks;
+
+    std::cout << "Cold assignment: " << cold_us << " us per tick" << std::endl;
+    std::cout << "Cached and warm started assignment: " << warm_us << " us per tick"
+              << std::endl;
+    std::cout << "  costs calculated per tick: "
+              << total_stats.num_costs_calculated / static_cast<double>(num_ticks)
+              << std::endl;
+    std::cout << "  costs cached per tick: "
+              << total_stats.num_costs_cached / static_cast<double>(num_ticks)
+              << std::endl;
+    std::cout << "  robots reassigned per tick: "
+              << total_stats.num_robots_reassigned / static_cast<double>(num_ticks)
+              << std::endl;
+    std::cout << "  getting costs: "
+              << total_stats.cost_duration.toMilliseconds() * 1000 / num_ticks
+              << " us per tick" << std::endl;
+    std::cout << "  solving: "
+              << total_stats.solve_duration.toMilliseconds() * 1000 / num_ticks
+              << " us per tick" << std::endl;
+}
@@ -7,6 +7,7 @@
 #include "software/ai/navigator/navigating_primitive_creator.h"
 #include "software/geom/algorithms/distance.h"
 #include "software/logger/logger.h"
+#include "software/util/latency_profiler/latency_profiler.h"
 
 Navigator::Navigator(std::unique_ptr<PathManager> path_manager,
                      RobotNavigationObstacleFactory robot_navigation_obstacle_factory,
@@ -32,6 +33,8 @@ void Navigator::visit(const MoveIntent &intent)
 std::unique_ptr<TbotsProto::PrimitiveSet> Navigator::getAssignedPrimitives(
     const World &world, const std::vector<std::unique_ptr<Intent>> &intents)
 {
+    ScopedLatencyTimer latency_timer(LatencyStage::NAVIGATOR);
+
     // Initialize variables
     navigating_intents.clear();
     planned_paths.clear();
@@ -88,7 +91,7 @@ std::unique_ptr<TbotsProto::PrimitiveSet> Navigator::getAssignedPrimitives(
         }
     }
 
-    LOG(VISUALIZE) << path_visualization_proto;
+    sendVisualization(path_visualization_proto);
 
     return std::move(primitive_set_msg);
 }
@@ -101,6 +104,11 @@ std::unordered_set<PathObjective> Navigator::createPathObjectives(
     auto ball_obstacle =
         robot_navigation_obstacle_factory.createFromBallPosition(world.ball().position());
 
+    // Obstacles that are the same for several robots are only created once, so the path
+    // manager can tell that they are shared and only rasterize them once
+    std::map<MotionConstraint, std::vector<ObstaclePtr>> motion_constraint_obstacles;
+    std::map<bool, std::vector<ObstaclePtr>> enemy_robot_obstacles;
+
     for (const auto &robot_id : direct_primitive_intent_robots)
     {
         auto robot = world.friendlyTeam().getRobotById(robot_id);
@@ -128,17 +136,39 @@ std::unordered_set<PathObjective> Navigator::createPathObjectives(
 
         if (robot)
         {
-            auto motion_constraint_obstacles =
-                robot_navigation_obstacle_factory.createFromMotionConstraints(
-                    intent->getMotionConstraints(), world);
-            obstacles.insert(obstacles.end(), motion_constraint_obstacles.begin(),
-                             motion_constraint_obstacles.end());
-
-            std::vector<ObstaclePtr> enemy_robot_obstacles =
-                robot_navigation_obstacle_factory.createEnemyCollisionAvoidance(
-                    world.enemyTeam(), robot->velocity().length());
-            obstacles.insert(obstacles.end(), enemy_robot_obstacles.begin(),
-                             enemy_robot_obstacles.end());
+            for (MotionConstraint motion_constraint : intent->getMotionConstraints())
+            {
+                auto constraint_obstacles =
+                    motion_constraint_obstacles.find(motion_constraint);
+                if (constraint_obstacles == motion_constraint_obstacles.end())
+                {
+                    constraint_obstacles =
+                        motion_constraint_obstacles
+                            .emplace(motion_constraint, robot_navigation_obstacle_factory
+                                                            .createFromMotionConstraint(
+                                                                motion_constraint, world))
+                            .first;
+                }
+                obstacles.insert(obstacles.end(), constraint_obstacles->second.begin(),
+                                 constraint_obstacles->second.end());
+            }
+
+            double robot_speed = robot->velocity().length();
+            bool allows_enemy_robot_collisions =
+                robot_navigation_obstacle_factory.allowsEnemyRobotCollisions(robot_speed);
+            auto enemy_obstacles =
+                enemy_robot_obstacles.find(allows_enemy_robot_collisions);
+            if (enemy_obstacles == enemy_robot_obstacles.end())
+            {
+                enemy_obstacles = enemy_robot_obstacles
+                                      .emplace(allows_enemy_robot_collisions,
+                                               robot_navigation_obstacle_factory
+                                                   .createEnemyCollisionAvoidance(
+                                                       world.enemyTeam(), robot_speed))
+                                      .first;
+            }
+            obstacles.insert(obstacles.end(), enemy_obstacles->second.begin(),
+                             enemy_obstacles->second.end());
 
             if (intent->getBallCollisionType() == TbotsProto::BallCollisionType::AVOID)
             {
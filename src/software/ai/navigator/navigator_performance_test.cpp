@@ -0,0 +1,79 @@
+#include <gtest/gtest.h>
+
+#include <iostream>
+#include <thread>
+
+#include "software/ai/intent/move_intent.h"
+#include "software/ai/navigator/navigator.h"
+#include "software/ai/navigator/path_manager/velocity_obstacle_path_manager.h"
+#include "software/ai/navigator/path_planner/theta_star_path_planner.h"
+#include "software/test_util/test_util.h"
+
+// This test is disabled to speed up CI, it can be enabled by removing "DISABLED_" from
+// the test name
+TEST(NavigatorPerformanceTest, DISABLED_div_b_11_robots_assigned_primitives_latency)
+{
+    // Both full teams on a division B field, with every friendly robot moving through
+    // the enemy half
+    World world = ::TestUtil::createBlankTestingWorldDivB();
+    world       = ::TestUtil::setFriendlyRobotPositions(
+        world,
+        {Point(-4.2, 0), Point(-3.5, 2.5), Point(-3.5, 1), Point(-3.5, -1),
+         Point(-3.5, -2.5), Point(-2, 2), Point(-2, 0), Point(-2, -2), Point(-0.5, 2.5),
+         Point(-0.5, 0.5), Point(-0.5, -2.5)},
+        Timestamp::fromSeconds(0));
+    world = ::TestUtil::setEnemyRobotPositions(
+        world,
+        {Point(4.2, 0), Point(3.5, 2), Point(3.5, 0.5), Point(3.5, -0.5), Point(3.5, -2),
+         Point(2, 1.5), Point(2, 0), Point(2, -1.5), Point(0.8, 2.5), Point(0.8, 0),
+         Point(0.8, -2.5)},
+        Timestamp::fromSeconds(0));
+    world =
+        ::TestUtil::setBallPosition(world, Point(0.2, 0.3), Timestamp::fromSeconds(0));
+
+    const std::vector<Point> destinations = {
+        Point(-4, 0.5),   Point(1.5, 2.8),  Point(2.5, 1),   Point(2.5, -1),
+        Point(1.5, -2.8), Point(3, 2.8),    Point(3, 0.9),   Point(3, -0.9),
+        Point(-1, -2),    Point(-2.5, 1.5), Point(2.7, -2.9)};
+
+    RobotConstants_t robot_constants = create2021RobotConstants();
+    std::vector<std::unique_ptr<Intent>> intents;
+    for (unsigned int id = 0; id < destinations.size(); id++)
+    {
+        intents.emplace_back(std::make_unique<MoveIntent>(
+            id, destinations[id], Angle::zero(), 0, TbotsProto::DribblerMode::OFF,
+            TbotsProto::BallCollisionType::AVOID,
+            AutoChipOrKick{AutoChipOrKickMode::OFF, 0},
+            TbotsProto::MaxAllowedSpeedMode::PHYSICAL_LIMIT, 0.0, robot_constants));
+    }
+
+    const unsigned int num_ticks = 50;
+    const size_t max_num_threads =
+        std::max<size_t>(std::thread::hardware_concurrency(), 4);
+    for (size_t num_threads = 1; num_threads <= max_num_threads; num_threads++)
+    {
+        std::vector<std::unique_ptr<PathPlanner>> path_planners;
+        for (size_t i = 0; i < num_threads; i++)
+        {
+            path_planners.emplace_back(std::make_unique<ThetaStarPathPlanner>());
+        }
+        RobotNavigationObstacleFactory robot_navigation_obstacle_factory(
+            std::make_shared<const RobotNavigationObstacleConfig>());
+        Navigator navigator(
+            std::make_unique<VelocityObstaclePathManager>(
+                std::move(path_planners), robot_navigation_obstacle_factory),
+            robot_navigation_obstacle_factory, std::make_shared<const NavigatorConfig>());
+
+        const auto start_time = std::chrono::system_clock::now();
+        for (unsigned int i = 0; i < num_ticks; i++)
+        {
+            auto primitive_set = navigator.getAssignedPrimitives(world, intents);
+            ASSERT_EQ(destinations.size(), primitive_set->robot_primitives().size());
+        }
+        double duration_ms = ::TestUtil::millisecondsSince(start_time);
+
+        std::cout << num_threads
+                  << " path planning thread(s): " << duration_ms / num_ticks
+                  << " ms per tick" << std::endl;
+    }
+}
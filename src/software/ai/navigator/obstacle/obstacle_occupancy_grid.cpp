@@ -0,0 +1,123 @@
+#include "software/ai/navigator/obstacle/obstacle_occupancy_grid.h"
+
+#include <algorithm>
+#include <cmath>
+
+ObstacleOccupancyGrid::ObstacleOccupancyGrid() : ObstacleOccupancyGrid(Point(), 1.0, 0, 0)
+{
+}
+
+ObstacleOccupancyGrid::ObstacleOccupancyGrid(const Point &origin, double resolution,
+                                             unsigned int num_x_cells,
+                                             unsigned int num_y_cells)
+    : origin_(origin),
+      resolution_(resolution),
+      num_x_cells_(num_x_cells),
+      num_y_cells_(num_y_cells),
+      blocked_cells_(static_cast<size_t>(num_x_cells) * num_y_cells, false)
+{
+}
+
+void ObstacleOccupancyGrid::addObstacle(const ObstaclePtr &obstacle)
+{
+    for (unsigned int index : findBlockedCellIndices(*obstacle))
+    {
+        blocked_cells_[index] = true;
+    }
+    obstacles_.emplace_back(obstacle);
+}
+
+void ObstacleOccupancyGrid::addObstacles(const std::vector<ObstaclePtr> &obstacles)
+{
+    for (const ObstaclePtr &obstacle : obstacles)
+    {
+        addObstacle(obstacle);
+    }
+}
+
+void ObstacleOccupancyGrid::addObstacles(const ObstacleOccupancyGrid &other)
+{
+    if (!hasSameCellsAs(other))
+    {
+        addObstacles(other.obstacles_);
+        return;
+    }
+
+    for (size_t i = 0; i < blocked_cells_.size(); i++)
+    {
+        if (other.blocked_cells_[i])
+        {
+            blocked_cells_[i] = true;
+        }
+    }
+    obstacles_.insert(obstacles_.end(), other.obstacles_.begin(), other.obstacles_.end());
+}
+
+void ObstacleOccupancyGrid::clear()
+{
+    std::fill(blocked_cells_.begin(), blocked_cells_.end(), false);
+    obstacles_.clear();
+}
+
+std::vector<unsigned int> ObstacleOccupancyGrid::findBlockedCellIndices(
+    const Obstacle &obstacle) const
+{
+    std::vector<unsigned int> cell_indices;
+    for (const Point &blocked_point : obstacle.rasterize(resolution_))
+    {
+        double x = std::floor((blocked_point.x() - origin_.x()) / resolution_);
+        double y = std::floor((blocked_point.y() - origin_.y()) / resolution_);
+        if (x >= 0 && x < num_x_cells_ && y >= 0 && y < num_y_cells_)
+        {
+            cell_indices.emplace_back(
+                cellIndex(static_cast<unsigned int>(x), static_cast<unsigned int>(y)));
+        }
+    }
+    return cell_indices;
+}
+
+unsigned int ObstacleOccupancyGrid::cellIndex(unsigned int x, unsigned int y) const
+{
+    return x * num_y_cells_ + y;
+}
+
+bool ObstacleOccupancyGrid::isBlocked(unsigned int index) const
+{
+    return blocked_cells_[index];
+}
+
+void ObstacleOccupancyGrid::setBlocked(unsigned int index, bool blocked)
+{
+    blocked_cells_[index] = blocked;
+}
+
+bool ObstacleOccupancyGrid::hasSameCellsAs(const ObstacleOccupancyGrid &other) const
+{
+    return origin_ == other.origin_ && resolution_ == other.resolution_ &&
+           num_x_cells_ == other.num_x_cells_ && num_y_cells_ == other.num_y_cells_;
+}
+
+const std::vector<ObstaclePtr> &ObstacleOccupancyGrid::obstacles() const
+{
+    return obstacles_;
+}
+
+const Point &ObstacleOccupancyGrid::origin() const
+{
+    return origin_;
+}
+
+double ObstacleOccupancyGrid::resolution() const
+{
+    return resolution_;
+}
+
+unsigned int ObstacleOccupancyGrid::numXCells() const
+{
+    return num_x_cells_;
+}
+
+unsigned int ObstacleOccupancyGrid::numYCells() const
+{
+    return num_y_cells_;
+}
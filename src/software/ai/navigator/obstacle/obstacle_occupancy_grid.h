@@ -0,0 +1,138 @@
+#pragma once
+
+#include <vector>
+
+#include "software/ai/navigator/obstacle/obstacle.hpp"
+#include "software/geom/point.h"
+
+/**
+ * An ObstacleOccupancyGrid divides an area into square cells and records which of the
+ * cells are blocked by obstacles.
+ *
+ * Rasterizing obstacles is the most expensive part of setting up a grid based path
+ * planner, and most obstacles (ex. the defense areas and enemy robots) are the same for
+ * every robot the navigator plans a path for in a tick. The shared obstacles can be
+ * rasterized into a grid once per tick, and each path planner can read the blocked cells
+ * and then only rasterize the obstacles that are specific to its robot.
+ *
+ * Cell (x, y) covers the points from origin + (x, y) * resolution up to, but not
+ * including, origin + (x + 1, y + 1) * resolution.
+ */
+class ObstacleOccupancyGrid
+{
+   public:
+    /**
+     * Creates an ObstacleOccupancyGrid with no cells and no obstacles
+     */
+    ObstacleOccupancyGrid();
+
+    /**
+     * Creates an ObstacleOccupancyGrid where none of the cells are blocked
+     *
+     * @param origin The corner of cell (0, 0) with the lowest x and y coordinates
+     * @param resolution The side length of each cell, in metres
+     * @param num_x_cells The number of cells along the x axis
+     * @param num_y_cells The number of cells along the y axis
+     */
+    explicit ObstacleOccupancyGrid(const Point &origin, double resolution,
+                                   unsigned int num_x_cells, unsigned int num_y_cells);
+
+    /**
+     * Blocks all the cells covered by the given obstacle
+     *
+     * @param obstacle The obstacle to add
+     */
+    void addObstacle(const ObstaclePtr &obstacle);
+
+    /**
+     * Blocks all the cells covered by the given obstacles
+     *
+     * @param obstacles The obstacles to add
+     */
+    void addObstacles(const std::vector<ObstaclePtr> &obstacles);
+
+    /**
+     * Blocks all the cells blocked in the given grid, and adds its obstacles to the
+     * obstacles of this grid. The obstacles of the given grid are rasterized again if
+     * it does not have the same cells as this grid.
+     *
+     * @param other The grid to add the obstacles of
+     */
+    void addObstacles(const ObstacleOccupancyGrid &other);
+
+    /**
+     * Unblocks every cell and removes all the obstacles, keeping the same cells
+     */
+    void clear();
+
+    /**
+     * Finds the indices of the cells covered by the given obstacle. This does not block
+     * the cells, so it can be used to cache the cells of an obstacle that will be added
+     * to several grids with the same cells.
+     *
+     * @param obstacle The obstacle to find the cells of
+     *
+     * @return the indices of the cells covered by obstacle
+     */
+    std::vector<unsigned int> findBlockedCellIndices(const Obstacle &obstacle) const;
+
+    /**
+     * Gets the index of a cell
+     *
+     * @param x The x coordinate of the cell
+     * @param y The y coordinate of the cell
+     *
+     * @return the index of cell (x, y)
+     */
+    unsigned int cellIndex(unsigned int x, unsigned int y) const;
+
+    /**
+     * Returns whether or not a cell is blocked
+     *
+     * @param index The index of the cell
+     *
+     * @return true if the cell is blocked
+     */
+    bool isBlocked(unsigned int index) const;
+
+    /**
+     * Sets whether or not a cell is blocked
+     *
+     * @param index The index of the cell
+     * @param blocked Whether or not the cell is blocked
+     */
+    void setBlocked(unsigned int index, bool blocked);
+
+    /**
+     * Returns whether or not the given grid divides the same area into the same cells
+     * as this grid
+     *
+     * @param other The grid to compare to
+     *
+     * @return true if other has the same origin, resolution and number of cells as this
+     * grid
+     */
+    bool hasSameCellsAs(const ObstacleOccupancyGrid &other) const;
+
+    /**
+     * Gets the obstacles that were added to this grid
+     *
+     * @return the obstacles that were added to this grid
+     */
+    const std::vector<ObstaclePtr> &obstacles() const;
+
+    const Point &origin() const;
+    double resolution() const;
+    unsigned int numXCells() const;
+    unsigned int numYCells() const;
+
+   private:
+    Point origin_;
+    double resolution_;
+    unsigned int num_x_cells_;
+    unsigned int num_y_cells_;
+
+    // Whether each cell is blocked, indexed by cellIndex
+    std::vector<bool> blocked_cells_;
+    std::vector<ObstaclePtr> obstacles_;
+};
@@ -0,0 +1,145 @@
+#include "software/ai/navigator/obstacle/obstacle_occupancy_grid.h"
+
+#include <gtest/gtest.h>
+
+#include "software/geom/circle.h"
+#include "software/geom/rectangle.h"
+
+class ObstacleOccupancyGridTest : public testing::Test
+{
+   protected:
+    ObstacleOccupancyGridTest()
+        : grid(Point(-1, -1), 0.1, 20, 20),
+          rectangle_obstacle(std::make_shared<GeomObstacle<Rectangle>>(
+              Rectangle(Point(-0.55, -0.55), Point(-0.25, -0.25)))),
+          circle_obstacle(
+              std::make_shared<GeomObstacle<Circle>>(Circle(Point(0.5, 0.5), 0.2)))
+    {
+    }
+
+    /**
+     * Counts the number of blocked cells in a grid
+     *
+     * @param grid The grid to count the blocked cells of
+     *
+     * @return the number of blocked cells in grid
+     */
+    static unsigned int numBlockedCells(const ObstacleOccupancyGrid& grid)
+    {
+        unsigned int num_blocked_cells = 0;
+        for (unsigned int i = 0; i < grid.numXCells() * grid.numYCells(); i++)
+        {
+            if (grid.isBlocked(i))
+            {
+                num_blocked_cells++;
+            }
+        }
+        return num_blocked_cells;
+    }
+
+    ObstacleOccupancyGrid grid;
+    ObstaclePtr rectangle_obstacle;
+    ObstaclePtr circle_obstacle;
+};
+
+TEST_F(ObstacleOccupancyGridTest, new_grid_has_no_blocked_cells)
+{
+    EXPECT_EQ(0, numBlockedCells(grid));
+    EXPECT_TRUE(grid.obstacles().empty());
+}
+
+TEST_F(ObstacleOccupancyGridTest, default_grid_has_no_cells)
+{
+    ObstacleOccupancyGrid default_grid;
+    EXPECT_EQ(0, default_grid.numXCells());
+    EXPECT_EQ(0, default_grid.numYCells());
+    EXPECT_TRUE(default_grid.obstacles().empty());
+}
+
+TEST_F(ObstacleOccupancyGridTest, add_obstacle_blocks_only_cells_covered_by_obstacle)
+{
+    grid.addObstacle(rectangle_obstacle);
+
+    // Cell (6, 6) covers the points from (-0.4, -0.4) to (-0.3, -0.3)
+    EXPECT_TRUE(grid.isBlocked(grid.cellIndex(6, 6)));
+    EXPECT_FALSE(grid.isBlocked(grid.cellIndex(10, 10)));
+    EXPECT_FALSE(grid.isBlocked(grid.cellIndex(2, 2)));
+    EXPECT_FALSE(grid.isBlocked(grid.cellIndex(6, 15)));
+    EXPECT_EQ(std::vector<ObstaclePtr>({rectangle_obstacle}), grid.obstacles());
+}
+
+TEST_F(ObstacleOccupancyGridTest, obstacle_outside_of_grid_does_not_block_any_cells)
+{
+    grid.addObstacle(std::make_shared<GeomObstacle<Circle>>(Circle(Point(3, 3), 0.5)));
+
+    EXPECT_EQ(0, numBlockedCells(grid));
+    EXPECT_EQ(1, grid.obstacles().size());
+}
+
+TEST_F(ObstacleOccupancyGridTest, find_blocked_cell_indices_does_not_block_cells)
+{
+    std::vector<unsigned int> cell_indices =
+        grid.findBlockedCellIndices(*circle_obstacle);
+
+    EXPECT_FALSE(cell_indices.empty());
+    EXPECT_EQ(0, numBlockedCells(grid));
+
+    grid.addObstacle(circle_obstacle);
+    for (unsigned int index : cell_indices)
+    {
+        EXPECT_TRUE(grid.isBlocked(index));
+    }
+}
+
+TEST_F(ObstacleOccupancyGridTest, add_obstacles_from_grid_with_same_cells)
+{
+    ObstacleOccupancyGrid shared_grid(Point(-1, -1), 0.1, 20, 20);
+    shared_grid.addObstacle(rectangle_obstacle);
+
+    grid.addObstacle(circle_obstacle);
+    grid.addObstacles(shared_grid);
+
+    ObstacleOccupancyGrid expected_grid(Point(-1, -1), 0.1, 20, 20);
+    expected_grid.addObstacles({circle_obstacle, rectangle_obstacle});
+
+    for (unsigned int i = 0; i < grid.numXCells() * grid.numYCells(); i++)
+    {
+        EXPECT_EQ(expected_grid.isBlocked(i), grid.isBlocked(i));
+    }
+    EXPECT_EQ(expected_grid.obstacles(), grid.obstacles());
+}
+
+TEST_F(ObstacleOccupancyGridTest, add_obstacles_from_grid_with_different_cells)
+{
+    ObstacleOccupancyGrid coarse_grid(Point(-1, -1), 0.5, 4, 4);
+    coarse_grid.addObstacle(rectangle_obstacle);
+
+    grid.addObstacles(coarse_grid);
+
+    ObstacleOccupancyGrid expected_grid(Point(-1, -1), 0.1, 20, 20);
+    expected_grid.addObstacle(rectangle_obstacle);
+
+    for (unsigned int i = 0; i < grid.numXCells() * grid.numYCells(); i++)
+    {
+        EXPECT_EQ(expected_grid.isBlocked(i), grid.isBlocked(i));
+    }
+}
+
+TEST_F(ObstacleOccupancyGridTest, set_blocked)
+{
+    grid.setBlocked(grid.cellIndex(3, 4), true);
+    EXPECT_TRUE(grid.isBlocked(grid.cellIndex(3, 4)));
+    EXPECT_EQ(1, numBlockedCells(grid));
+
+    grid.setBlocked(grid.cellIndex(3, 4), false);
+    EXPECT_EQ(0, numBlockedCells(grid));
+}
+
+TEST_F(ObstacleOccupancyGridTest, has_same_cells_as)
+{
+    EXPECT_TRUE(grid.hasSameCellsAs(ObstacleOccupancyGrid(Point(-1, -1), 0.1, 20, 20)));
+    EXPECT_FALSE(grid.hasSameCellsAs(ObstacleOccupancyGrid(Point(-1, 0), 0.1, 20, 20)));
+    EXPECT_FALSE(grid.hasSameCellsAs(ObstacleOccupancyGrid(Point(-1, -1), 0.2, 20, 20)));
+    EXPECT_FALSE(grid.hasSameCellsAs(ObstacleOccupancyGrid(Point(-1, -1), 0.1, 10, 20)));
+    EXPECT_FALSE(grid.hasSameCellsAs(ObstacleOccupancyGrid(Point(-1, -1), 0.1, 20, 10)));
+}
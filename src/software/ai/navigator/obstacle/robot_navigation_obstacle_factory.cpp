@@ -179,7 +179,7 @@ std::vector<ObstaclePtr> RobotNavigationObstacleFactory::createFromTeam(
 std::vector<ObstaclePtr> RobotNavigationObstacleFactory::createEnemyCollisionAvoidance(
     const Team &enemy_team, double friendly_robot_speed) const
 {
-    if (friendly_robot_speed < config->getAllowedRobotCollisionSpeed()->value())
+    if (allowsEnemyRobotCollisions(friendly_robot_speed))
     {
         std::vector<ObstaclePtr> obstacles;
         for (const auto &robot : enemy_team.getAllRobots())
@@ -196,6 +196,12 @@ std::vector<ObstaclePtr> RobotNavigationObstacleFactory::createEnemyCollisionAvo
     }
 }
 
+bool RobotNavigationObstacleFactory::allowsEnemyRobotCollisions(
+    double friendly_robot_speed) const
+{
+    return friendly_robot_speed < config->getAllowedRobotCollisionSpeed()->value();
+}
+
 ObstaclePtr RobotNavigationObstacleFactory::createFromBallPosition(
     const Point &ball_position) const
 {
@@ -86,6 +86,17 @@ class RobotNavigationObstacleFactory
     std::vector<ObstaclePtr> createEnemyCollisionAvoidance(
         const Team &enemy_team, double friendly_robot_speed) const;
 
+    /**
+     * Returns whether a friendly robot moving at the given speed is slow enough to be
+     * allowed to collide with enemy robots. The obstacles created by
+     * createEnemyCollisionAvoidance only depend on the friendly robot speed through this.
+     *
+     * @param friendly_robot_speed The speed of the friendly robot
+     *
+     * @return true if the friendly robot is allowed to collide with enemy robots
+     */
+    bool allowsEnemyRobotCollisions(double friendly_robot_speed) const;
+
     /**
      * Create circle obstacle around robot with additional radius scaling
      *
@@ -1,11 +1,34 @@
 #include "software/ai/navigator/path_manager/velocity_obstacle_path_manager.h"
 
+#include <algorithm>
+#include <stdexcept>
+#include <unordered_map>
+
 VelocityObstaclePathManager::VelocityObstaclePathManager(
     std::unique_ptr<PathPlanner> path_planner,
     RobotNavigationObstacleFactory robot_navigation_obstacle_factory)
-    : path_planner(std::move(path_planner)),
+    : VelocityObstaclePathManager(
+          [&path_planner]() {
+              std::vector<std::unique_ptr<PathPlanner>> path_planners;
+              path_planners.emplace_back(std::move(path_planner));
+              return path_planners;
+          }(),
+          std::move(robot_navigation_obstacle_factory))
+{
+}
+
+VelocityObstaclePathManager::VelocityObstaclePathManager(
+    std::vector<std::unique_ptr<PathPlanner>> path_planners,
+    RobotNavigationObstacleFactory robot_navigation_obstacle_factory)
+    : path_planners(std::move(path_planners)),
+      thread_pool(this->path_planners.empty() ? 0 : this->path_planners.size() - 1),
       robot_navigation_obstacle_factory(std::move(robot_navigation_obstacle_factory))
 {
+    if (this->path_planners.empty())
+    {
+        throw std::invalid_argument(
+            "VelocityObstaclePathManager needs at least one path planner");
+    }
 }
 
 const std::map<RobotId, std::optional<Path>> VelocityObstaclePathManager::getManagedPaths(
@@ -14,49 +37,132 @@ const std::map<RobotId, std::optional<Path>> VelocityObstaclePathManager::getMan
     std::map<RobotId, std::optional<Path>> managed_paths;
     path_planning_obstacles.clear();
 
+    objective_start_obstacles.clear();
+    for (auto const &objective : objectives)
+    {
+        objective_start_obstacles.emplace(
+            objective.robot_id,
+            robot_navigation_obstacle_factory.createFromRobotPosition(objective.start));
+    }
+
+    // The order of the objectives in the unordered_set is unspecified, so we plan in
+    // order of robot id to make the planned paths deterministic
+    std::vector<const PathObjective *> ordered_objectives;
+    ordered_objectives.reserve(objectives.size());
+    for (auto const &objective : objectives)
+    {
+        ordered_objectives.push_back(&objective);
+    }
+    std::sort(ordered_objectives.begin(), ordered_objectives.end(),
+              [](const PathObjective *a, const PathObjective *b) {
+                  return a->robot_id < b->robot_id;
+              });
+
+    // The obstacles that every objective has are rasterized once for all the paths,
+    // and only the other obstacles of each path are given to the path planner
+    std::vector<ObstaclePtr> shared_obstacles =
+        getObstaclesSharedByAllObjectives(objectives);
+    const ObstacleOccupancyGrid shared_obstacle_grid =
+        path_planners.front()->createObstacleOccupancyGrid(navigable_area,
+                                                           shared_obstacles);
+    std::unordered_set<const Obstacle *> shared_obstacle_ptrs;
+    for (const ObstaclePtr &obstacle : shared_obstacles)
+    {
+        shared_obstacle_ptrs.insert(obstacle.get());
+    }
+
     // Velocity obstacles used to avoid collisions.
     // As we plan a path for each robot, a corresponding obstacle will be added
     // to this list so that paths planned later do not collide with the path we just
     // planned. Please see: https://en.wikipedia.org/wiki/Velocity_obstacle
+    // Obstacles are only added once a whole wave has been planned, so the paths in a
+    // wave don't depend on each other.
     std::vector<ObstaclePtr> current_velocity_obstacles;
 
-    for (auto const &current_objective : objectives)
+    const size_t wave_size = path_planners.size();
+    std::vector<std::vector<ObstaclePtr>> wave_path_obstacles(wave_size);
+    std::vector<std::optional<Path>> wave_paths(wave_size);
+
+    for (size_t wave_start = 0; wave_start < ordered_objectives.size();
+         wave_start += wave_size)
     {
-        // find path with relevant obstacles
-        std::vector<ObstaclePtr> path_obstacles =
-            getObstaclesAroundStartOfOtherObjectives(objectives, current_objective);
-        path_obstacles.insert(path_obstacles.end(), current_velocity_obstacles.begin(),
-                              current_velocity_obstacles.end());
-        path_obstacles.insert(path_obstacles.end(), current_objective.obstacles.begin(),
-                              current_objective.obstacles.end());
-        path_planning_obstacles.insert(path_planning_obstacles.end(),
-                                       path_obstacles.begin(), path_obstacles.end());
-        auto path = path_planner->findPath(current_objective.start, current_objective.end,
-                                           navigable_area, path_obstacles);
-
-        // store path in managed_paths
-        managed_paths.insert({current_objective.robot_id, path});
-
-        // store velocity obstacle for current path
-        if (path && path->getNumKnots() >= 2)
+        size_t num_paths_in_wave =
+            std::min(wave_size, ordered_objectives.size() - wave_start);
+
+        thread_pool.parallelFor(num_paths_in_wave, [&](size_t i) {
+            const PathObjective &current_objective = *ordered_objectives[wave_start + i];
+
+            // find path with relevant obstacles
+            std::vector<ObstaclePtr> &path_obstacles = wave_path_obstacles[i];
+            path_obstacles =
+                getObstaclesAroundStartOfOtherObjectives(objectives, current_objective);
+            path_obstacles.insert(path_obstacles.end(),
+                                  current_velocity_obstacles.begin(),
+                                  current_velocity_obstacles.end());
+            path_obstacles.insert(path_obstacles.end(),
+                                  current_objective.obstacles.begin(),
+                                  current_objective.obstacles.end());
+
+            std::vector<ObstaclePtr> unshared_path_obstacles;
+            for (const ObstaclePtr &obstacle : path_obstacles)
+            {
+                if (shared_obstacle_ptrs.count(obstacle.get()) == 0)
+                {
+                    unshared_path_obstacles.push_back(obstacle);
+                }
+            }
+            // Path can't be assigned, so it is copied into the slot for this path
+            std::optional<Path> path = path_planners[i]->findPath(
+                current_objective.start, current_objective.end, navigable_area,
+                shared_obstacle_grid, unshared_path_obstacles);
+            wave_paths[i].reset();
+            if (path)
+            {
+                wave_paths[i].emplace(*path);
+            }
+        });
+
+        for (size_t i = 0; i < num_paths_in_wave; i++)
         {
-            // We want to avoid the start of every other path, assuming that
-            // there is a robot moving along the path from the path's start
-            std::vector<Point> path_points = path->getKnots();
-            Vector initial_path_velocity =
-                (path_points[1] - current_objective.start)
-                    .normalize(current_objective.current_speed);
-            Robot mock_path_robot(0, current_objective.start, initial_path_velocity,
-                                  Angle::zero(), AngularVelocity::zero(),
-                                  Timestamp::fromSeconds(0));
-            current_velocity_obstacles.emplace_back(
-                robot_navigation_obstacle_factory.createFromRobot(mock_path_robot));
+            const PathObjective &current_objective = *ordered_objectives[wave_start + i];
+            path_planning_obstacles.insert(path_planning_obstacles.end(),
+                                           wave_path_obstacles[i].begin(),
+                                           wave_path_obstacles[i].end());
+
+            // store path in managed_paths
+            managed_paths.insert({current_objective.robot_id, wave_paths[i]});
+
+            // store velocity obstacle for current path
+            auto velocity_obstacle =
+                createVelocityObstacle(current_objective, wave_paths[i]);
+            if (velocity_obstacle)
+            {
+                current_velocity_obstacles.emplace_back(*velocity_obstacle);
+            }
         }
     }
 
     return managed_paths;
 }
 
+std::optional<ObstaclePtr> VelocityObstaclePathManager::createVelocityObstacle(
+    const PathObjective &objective, const std::optional<Path> &path) const
+{
+    if (!path || path->getNumKnots() < 2)
+    {
+        return std::nullopt;
+    }
+
+    // We want to avoid the start of every other path, assuming that
+    // there is a robot moving along the path from the path's start
+    std::vector<Point> path_points = path->getKnots();
+    Vector initial_path_velocity =
+        (path_points[1] - objective.start).normalize(objective.current_speed);
+    Robot mock_path_robot(0, objective.start, initial_path_velocity, Angle::zero(),
+                          AngularVelocity::zero(), Timestamp::fromSeconds(0));
+    return robot_navigation_obstacle_factory.createFromRobot(mock_path_robot);
+}
+
 const std::vector<ObstaclePtr> VelocityObstaclePathManager::getObstacles(void) const
 {
     return path_planning_obstacles;
@@ -65,16 +171,56 @@ const std::vector<ObstaclePtr> VelocityObstaclePathManager::getObstacles(void) c
 const std::vector<ObstaclePtr>
 VelocityObstaclePathManager::getObstaclesAroundStartOfOtherObjectives(
     const std::unordered_set<PathObjective> &objectives,
-    const PathObjective &current_objective)
+    const PathObjective &current_objective) const
 {
     std::vector<ObstaclePtr> obstacles;
     for (auto const &obj : objectives)
     {
         if (obj != current_objective)
         {
-            obstacles.push_back(
-                robot_navigation_obstacle_factory.createFromRobotPosition(obj.start));
+            obstacles.push_back(objective_start_obstacles.at(obj.robot_id));
         }
     }
     return obstacles;
 }
+
+std::vector<ObstaclePtr> VelocityObstaclePathManager::getObstaclesSharedByAllObjectives(
+    const std::unordered_set<PathObjective> &objectives)
+{
+    if (objectives.empty())
+    {
+        return {};
+    }
+
+    // Count the number of objectives that have each obstacle, only counting each
+    // objective once even if it has the same obstacle more than once
+    std::unordered_map<const Obstacle *, std::pair<unsigned int, const PathObjective *>>
+        num_objectives_with_obstacle;
+    for (auto const &objective : objectives)
+    {
+        for (const ObstaclePtr &obstacle : objective.obstacles)
+        {
+            auto &[num_objectives, last_objective] =
+                num_objectives_with_obstacle[obstacle.get()];
+            if (last_objective != &objective)
+            {
+                num_objectives++;
+                last_objective = &objective;
+            }
+        }
+    }
+
+    std::vector<ObstaclePtr> shared_obstacles;
+    for (const ObstaclePtr &obstacle : objectives.begin()->obstacles)
+    {
+        auto &[num_objectives, last_objective] =
+            num_objectives_with_obstacle.at(obstacle.get());
+        if (num_objectives == objectives.size())
+        {
+            shared_obstacles.push_back(obstacle);
+            // Make sure each obstacle is only added once
+            num_objectives = 0;
+        }
+    }
+    return shared_obstacles;
+}
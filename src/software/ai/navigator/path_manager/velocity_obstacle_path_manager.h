@@ -3,6 +3,7 @@
 #include "software/ai/navigator/obstacle/obstacle.hpp"
 #include "software/ai/navigator/obstacle/robot_navigation_obstacle_factory.h"
 #include "software/ai/navigator/path_manager/path_manager.h"
+#include "software/multithreading/thread_pool.h"
 
 /**
  * VelocityObstaclePathManager uses obstacles to arbitrate between paths.
@@ -10,6 +11,14 @@
  * collisions. This approach implicitly uses the idea of [Minkowski
  * space](https://en.wikipedia.org/wiki/Minkowski_space), but where we assume that a robot
  * will occupy all the positions along the path for the next time step.
+ *
+ * Paths are planned in order of increasing robot id, and each path avoids the velocity
+ * obstacles of the paths planned before it. With more than one path planner, the paths
+ * are planned in waves of as many robots as there are path planners. The paths in a
+ * wave are planned in parallel and avoid the velocity obstacles of the paths in the
+ * waves before it, but not of the other paths in the same wave. The planned paths only
+ * depend on the objectives and the number of path planners, not on the order of the
+ * objectives or the timing of the threads.
  */
 
 class VelocityObstaclePathManager : public PathManager
@@ -20,26 +29,75 @@ class VelocityObstaclePathManager : public PathManager
         const Rectangle& navigable_area) override;
     const std::vector<ObstaclePtr> getObstacles(void) const override;
 
+    /**
+     * Creates a VelocityObstaclePathManager that plans one path at a time
+     *
+     * @param path_planner The path planner used to plan every path
+     * @param robot_navigation_obstacle_factory Used to create the velocity obstacles
+     */
     explicit VelocityObstaclePathManager(
         std::unique_ptr<PathPlanner> path_planner,
         RobotNavigationObstacleFactory robot_navigation_obstacle_factory);
 
+    /**
+     * Creates a VelocityObstaclePathManager that plans as many paths at the same time
+     * as it is given path planners
+     *
+     * @param path_planners The path planners used to plan paths, which must not be
+     * empty. Each path planner is only used by one thread at a time.
+     * @param robot_navigation_obstacle_factory Used to create the velocity obstacles
+     */
+    explicit VelocityObstaclePathManager(
+        std::vector<std::unique_ptr<PathPlanner>> path_planners,
+        RobotNavigationObstacleFactory robot_navigation_obstacle_factory);
 
    private:
     /**
-     * Creates obstacles around the start of objectives
+     * Gets the obstacles around the start of objectives
      * except for current_index
      *
-     * @param objectives objectives to make obstacles
+     * @param objectives objectives to get obstacles for, which must all have an
+     * obstacle in objective_start_obstacles
      * @param current_objective objective to skip
      *
      * @return list of obstacles that around other objectives' starts
      */
     const std::vector<ObstaclePtr> getObstaclesAroundStartOfOtherObjectives(
         const std::unordered_set<PathObjective>& objectives,
-        const PathObjective& current_objective);
+        const PathObjective& current_objective) const;
 
-    std::unique_ptr<PathPlanner> path_planner;
+    /**
+     * Creates a velocity obstacle for a robot following the given path
+     *
+     * @param objective The objective the path was planned for
+     * @param path The path planned for the objective
+     *
+     * @return the velocity obstacle of the path, or std::nullopt if the path doesn't
+     * move the robot
+     */
+    std::optional<ObstaclePtr> createVelocityObstacle(
+        const PathObjective& objective, const std::optional<Path>& path) const;
+
+    /**
+     * Gets the obstacles that all the objectives have
+     *
+     * @param objectives objectives to get the shared obstacles of
+     *
+     * @return list of the obstacles that all the objectives have
+     */
+    static std::vector<ObstaclePtr> getObstaclesSharedByAllObjectives(
+        const std::unordered_set<PathObjective>& objectives);
+
+    // The paths in each wave are planned with a different path planner
+    std::vector<std::unique_ptr<PathPlanner>> path_planners;
+    // The calling thread also plans paths, so this has one less thread than there are
+    // path planners
+    ThreadPool thread_pool;
     RobotNavigationObstacleFactory robot_navigation_obstacle_factory;
     std::vector<ObstaclePtr> path_planning_obstacles;
+
+    // The obstacle around the start of each objective. These are created once per
+    // call to getManagedPaths and shared between the paths planned for every robot,
+    // so the path planner can reuse the work it does for each obstacle.
+    std::map<RobotId, ObstaclePtr> objective_start_obstacles;
 };
@@ -3,6 +3,7 @@
 #include <gtest/gtest.h>
 
 #include "software/ai/navigator/path_planner/straight_line_path_planner.h"
+#include "software/ai/navigator/path_planner/theta_star_path_planner.h"
 #include "software/geom/point.h"
 
 TEST(TestVelocityObstaclePathManager, test_no_obstacles)
@@ -37,3 +38,161 @@ TEST(TestVelocityObstaclePathManager, test_no_obstacles)
     EXPECT_EQ(path_points2.front(), po2.start);
     EXPECT_EQ(path_points2.back(), po2.end);
 }
+
+class ParallelVelocityObstaclePathManagerTest : public testing::Test
+{
+   protected:
+    ParallelVelocityObstaclePathManagerTest()
+        : robot_navigation_obstacle_factory(
+              std::make_shared<const RobotNavigationObstacleConfig>()),
+          navigable_area(Point(-4.5, -3), Point(4.5, 3))
+    {
+        // Robots that start close to each other and cross each other's paths, so the
+        // planned paths depend on the velocity obstacles of the paths planned before
+        std::vector<ObstaclePtr> obstacles = {
+            robot_navigation_obstacle_factory.createFromRobotPosition(Point(0, 0))};
+        path_objectives.emplace_back(Point(-2, 0.2), Point(2, -0.2), 1.5, obstacles, 0);
+        path_objectives.emplace_back(Point(-2, -0.2), Point(2, 0.2), 1.5, obstacles, 1);
+        path_objectives.emplace_back(Point(2, 0.2), Point(-2, 0.2), 1.5, obstacles, 2);
+        path_objectives.emplace_back(Point(2, -0.2), Point(-2, -0.2), 1.5, obstacles, 3);
+        path_objectives.emplace_back(Point(0, 2), Point(0, -2), 1.5, obstacles, 4);
+    }
+
+    /**
+     * Creates a VelocityObstaclePathManager with the given number of
+     * ThetaStarPathPlanners
+     *
+     * @param num_path_planners The number of path planners
+     *
+     * @return a VelocityObstaclePathManager with num_path_planners path planners
+     */
+    std::unique_ptr<VelocityObstaclePathManager> createPathManager(
+        size_t num_path_planners)
+    {
+        std::vector<std::unique_ptr<PathPlanner>> path_planners;
+        for (size_t i = 0; i < num_path_planners; i++)
+        {
+            path_planners.emplace_back(std::make_unique<ThetaStarPathPlanner>());
+        }
+        return std::make_unique<VelocityObstaclePathManager>(
+            std::move(path_planners), robot_navigation_obstacle_factory);
+    }
+
+    /**
+     * Plans paths for the path objectives, inserting them into the unordered_set in
+     * the given order
+     *
+     * @param path_manager The path manager to plan the paths with
+     * @param objective_order The order to insert the path objectives in
+     *
+     * @return the planned paths
+     */
+    std::map<RobotId, std::optional<Path>> planPaths(
+        VelocityObstaclePathManager& path_manager,
+        const std::vector<size_t>& objective_order)
+    {
+        std::unordered_set<PathObjective> objectives;
+        for (size_t i : objective_order)
+        {
+            objectives.insert(path_objectives[i]);
+        }
+        return path_manager.getManagedPaths(objectives, navigable_area);
+    }
+
+    /**
+     * Checks that two paths have the same knots
+     *
+     * @param expected The expected path
+     * @param actual The actual path
+     */
+    static void expectSamePath(const std::optional<Path>& expected,
+                               const std::optional<Path>& actual)
+    {
+        ASSERT_EQ(expected.has_value(), actual.has_value());
+        if (expected)
+        {
+            EXPECT_EQ(expected->getKnots(), actual->getKnots());
+        }
+    }
+
+    RobotNavigationObstacleFactory robot_navigation_obstacle_factory;
+    Rectangle navigable_area;
+    std::vector<PathObjective> path_objectives;
+};
+
+TEST_F(ParallelVelocityObstaclePathManagerTest, no_path_planners_throws)
+{
+    EXPECT_THROW(createPathManager(0), std::invalid_argument);
+}
+
+TEST_F(ParallelVelocityObstaclePathManagerTest,
+       paths_do_not_depend_on_order_of_objectives)
+{
+    for (size_t num_path_planners : {1, 2, 3, 5})
+    {
+        auto path_manager         = createPathManager(num_path_planners);
+        auto paths                = planPaths(*path_manager, {0, 1, 2, 3, 4});
+        auto reversed_order_paths = planPaths(*path_manager, {4, 3, 2, 1, 0});
+        auto shuffled_order_paths = planPaths(*path_manager, {2, 4, 0, 3, 1});
+
+        ASSERT_EQ(path_objectives.size(), paths.size());
+        for (const auto& [robot_id, path] : paths)
+        {
+            expectSamePath(path, reversed_order_paths.at(robot_id));
+            expectSamePath(path, shuffled_order_paths.at(robot_id));
+        }
+    }
+}
+
+TEST_F(ParallelVelocityObstaclePathManagerTest, paths_do_not_depend_on_thread_timing)
+{
+    auto path_manager = createPathManager(3);
+    auto paths        = planPaths(*path_manager, {0, 1, 2, 3, 4});
+    for (unsigned int i = 0; i < 10; i++)
+    {
+        auto repeated_paths = planPaths(*path_manager, {0, 1, 2, 3, 4});
+        for (const auto& [robot_id, path] : paths)
+        {
+            expectSamePath(path, repeated_paths.at(robot_id));
+        }
+    }
+}
+
+TEST_F(ParallelVelocityObstaclePathManagerTest,
+       paths_in_same_wave_ignore_each_others_velocity_obstacles)
+{
+    // With as many path planners as robots, every path is planned in the first wave,
+    // so each path is the same as the path planned for its robot alone with the start
+    // obstacles of the other robots
+    auto path_manager = createPathManager(path_objectives.size());
+    auto paths        = planPaths(*path_manager, {0, 1, 2, 3, 4});
+
+    ThetaStarPathPlanner path_planner;
+    for (const PathObjective& objective : path_objectives)
+    {
+        std::vector<ObstaclePtr> obstacles = objective.obstacles;
+        for (const PathObjective& other_objective : path_objectives)
+        {
+            if (other_objective.robot_id != objective.robot_id)
+            {
+                obstacles.emplace_back(
+                    robot_navigation_obstacle_factory.createFromRobotPosition(
+                        other_objective.start));
+            }
+        }
+        expectSamePath(path_planner.findPath(objective.start, objective.end,
+                                             navigable_area, obstacles),
+                       paths.at(objective.robot_id));
+    }
+}
+
+TEST_F(ParallelVelocityObstaclePathManagerTest,
+       first_wave_paths_match_sequential_planning)
+{
+    // The robot with the lowest id is always planned first, so it never avoids any
+    // velocity obstacles
+    auto sequential_paths = planPaths(*createPathManager(1), {0, 1, 2, 3, 4});
+    auto parallel_paths   = planPaths(*createPathManager(2), {0, 1, 2, 3, 4});
+
+    expectSamePath(sequential_paths.at(0), parallel_paths.at(0));
+}
@@ -3,6 +3,15 @@
 EnlsvgPathPlanner::EnlsvgPathPlanner(const Rectangle &navigable_area,
                                      const std::vector<ObstaclePtr> &obstacles,
                                      double grid_boundary_offset, double resolution)
+    : EnlsvgPathPlanner(navigable_area, ObstacleOccupancyGrid(), obstacles,
+                        grid_boundary_offset, resolution)
+{
+}
+
+EnlsvgPathPlanner::EnlsvgPathPlanner(const Rectangle &navigable_area,
+                                     const ObstacleOccupancyGrid &obstacle_grid,
+                                     const std::vector<ObstaclePtr> &obstacles,
+                                     double grid_boundary_offset, double resolution)
     : resolution(resolution),
       num_grid_rows(static_cast<int>(round(navigable_area.xLength() / resolution))),
       num_grid_cols(static_cast<int>(round(navigable_area.yLength() / resolution))),
@@ -13,12 +22,29 @@ EnlsvgPathPlanner::EnlsvgPathPlanner(const Rectangle &navigable_area,
           convertPointToEnlsvgPoint(navigable_area.posXPosYCorner()).x),
       enlsvg_grid(std::make_unique<EnlsvgGrid>(num_grid_rows, num_grid_cols))
 {
-    createObstaclesInGrid(obstacles, grid_boundary_offset);
+    createObstaclesInGrid(navigable_area, obstacle_grid, obstacles, grid_boundary_offset);
     enlsvg_algo = std::make_unique<const EnlsvgAlgorithm>(*enlsvg_grid);
     enlsvg_mem  = std::make_unique<EnlsvgMemory>(*enlsvg_algo);
 }
 
-void EnlsvgPathPlanner::createObstaclesInGrid(const std::vector<ObstaclePtr> &obstacles,
+ObstacleOccupancyGrid EnlsvgPathPlanner::createObstacleOccupancyGrid(
+    const Rectangle &navigable_area, const std::vector<ObstaclePtr> &obstacles,
+    double resolution)
+{
+    // Each internal coordinate is at the centre of its cell, since points are rounded
+    // to the nearest internal coordinate
+    Point origin = navigable_area.negXNegYCorner() - Vector(resolution, resolution) / 2;
+    ObstacleOccupancyGrid grid(
+        origin, resolution,
+        static_cast<unsigned int>(round(navigable_area.xLength() / resolution)),
+        static_cast<unsigned int>(round(navigable_area.yLength() / resolution)));
+    grid.addObstacles(obstacles);
+    return grid;
+}
+
+void EnlsvgPathPlanner::createObstaclesInGrid(const Rectangle &navigable_area,
+                                              const ObstacleOccupancyGrid &obstacle_grid,
+                                              const std::vector<ObstaclePtr> &obstacles,
                                               double boundary_margin) const
 {
     // block boundary areas
@@ -40,16 +66,21 @@ void EnlsvgPathPlanner::createObstaclesInGrid(const std::vector<ObstaclePtr> &ob
         }
     }
 
-    for (auto &obstacle : obstacles)
-    {
-        auto blocked_points = obstacle->rasterize(resolution);
+    // Copies the cells blocked in obstacle_grid if it has the same cells, and only
+    // rasterizes the other obstacles
+    ObstacleOccupancyGrid all_obstacles_grid =
+        createObstacleOccupancyGrid(navigable_area, {}, resolution);
+    all_obstacles_grid.addObstacles(obstacle_grid);
+    all_obstacles_grid.addObstacles(obstacles);
 
-        for (Point &blocked_point : blocked_points)
+    for (unsigned x = 0; x < all_obstacles_grid.numXCells(); ++x)
+    {
+        for (unsigned y = 0; y < all_obstacles_grid.numYCells(); ++y)
         {
-            EnlsvgPoint blocked_coord = convertPointToEnlsvgPoint(blocked_point);
-            if (isCoordNavigable(blocked_coord))
+            if (all_obstacles_grid.isBlocked(all_obstacles_grid.cellIndex(x, y)) &&
+                isCoordNavigable(EnlsvgPoint(x, y)))
             {
-                enlsvg_grid->setBlocked(blocked_coord.x, blocked_coord.y, true);
+                enlsvg_grid->setBlocked(x, y, true);
             }
         }
     }
@@ -3,6 +3,7 @@
 
 #include "extlibs/enlsvg/Pathfinding/ENLSVG.h"
 #include "software/ai/navigator/obstacle/obstacle.hpp"
+#include "software/ai/navigator/obstacle/obstacle_occupancy_grid.h"
 #include "software/geom/linear_spline2d.h"
 #include "software/logger/logger.h"
 #include "software/world/world.h"
@@ -41,6 +42,42 @@ class EnlsvgPathPlanner
                       const std::vector<ObstaclePtr> &obstacles,
                       double boundary_margin_offset = 0.0, double resolution = 0.09);
 
+    /**
+     * Creates an EnlsvgPathPlanner object the same way as the constructor above, except
+     * that the cells blocked by the obstacles in obstacle_grid are copied instead of
+     * rasterizing the obstacles again. This lets planners that share obstacles be
+     * created without rasterizing the shared obstacles for each planner.
+     *
+     * @param navigable_area         The total area that the path planner must path plan
+     * inside
+     * @param obstacle_grid          A grid of obstacles to consider when path planning,
+     * created by createObstacleOccupancyGrid with the same navigable_area and resolution
+     * @param obstacles              A list of other obstacles to consider when path
+     * planning
+     * @param boundary_margin_offset Padding from the edges of the navigable_area to set
+     * as an obstacle
+     * @param resolution             The resolution of the internal representation of the
+     * grid. Uses the same units as boundary_margin_offset
+     */
+    EnlsvgPathPlanner(const Rectangle &navigable_area,
+                      const ObstacleOccupancyGrid &obstacle_grid,
+                      const std::vector<ObstaclePtr> &obstacles,
+                      double boundary_margin_offset = 0.0, double resolution = 0.09);
+
+    /**
+     * Creates a grid of the given obstacles with the same cells as the internal grid of
+     * an EnlsvgPathPlanner with the given navigable_area and resolution
+     *
+     * @param navigable_area The total area that the path planner must path plan inside
+     * @param obstacles      A list of obstacles to add to the grid
+     * @param resolution     The resolution of the internal representation of the grid
+     *
+     * @return a grid of the given obstacles
+     */
+    static ObstacleOccupancyGrid createObstacleOccupancyGrid(
+        const Rectangle &navigable_area, const std::vector<ObstaclePtr> &obstacles,
+        double resolution = 0.09);
+
     /**
      * Returns a path that is an optimized path between start and end. Has no checking on
      * whether the start and end are valid and within field boundaries.
@@ -130,12 +167,16 @@ class EnlsvgPathPlanner
      * obstacle-izing regions from the edges of the grids based on the
      * grid_boundary_margin_offset.
      *
+     * @param navigable_area                 the area the grid covers
+     * @param obstacle_grid                  a grid of obstacles
      * @param obstacles                      a list of obstacles
      * @param grid_boundary_margin_offset    an offset that represents the width of the
      * region from the edges of the grid to consider as an obstacle. Has the same units as
      * the resolution parameter in EnlsvgPathPlanner()
      */
-    void createObstaclesInGrid(const std::vector<ObstaclePtr> &obstacles,
+    void createObstaclesInGrid(const Rectangle &navigable_area,
+                               const ObstacleOccupancyGrid &obstacle_grid,
+                               const std::vector<ObstaclePtr> &obstacles,
                                double grid_boundary_margin_offset) const;
 
     /**
@@ -43,6 +43,40 @@ TEST_F(TestEnlsvgPathPlanner, test_enlsvg_path_planner_empty_grid)
     EXPECT_EQ(dest, path->getEndPoint());
 }
 
+TEST_F(TestEnlsvgPathPlanner,
+       test_enlsvg_path_planner_obstacle_grid_gives_same_path_as_obstacles)
+{
+    Field field = Field::createSSLDivisionBField();
+    Point start{-4, 0}, dest{4, 0.5};
+    Rectangle navigable_area = field.fieldBoundary();
+
+    std::vector<ObstaclePtr> shared_obstacles = {
+        robot_navigation_obstacle_factory.createFromShape(field.friendlyDefenseArea()),
+        robot_navigation_obstacle_factory.createFromRobotPosition({-1, 0}),
+        robot_navigation_obstacle_factory.createFromRobotPosition({1, 0.5}),
+    };
+    std::vector<ObstaclePtr> other_obstacles = {
+        robot_navigation_obstacle_factory.createFromShape(
+            Rectangle(Point(2, -1), Point(2.5, 1.5))),
+    };
+    std::vector<ObstaclePtr> all_obstacles = shared_obstacles;
+    all_obstacles.insert(all_obstacles.end(), other_obstacles.begin(),
+                         other_obstacles.end());
+
+    EnlsvgPathPlanner planner_with_obstacle_grid(
+        navigable_area,
+        EnlsvgPathPlanner::createObstacleOccupancyGrid(navigable_area, shared_obstacles),
+        other_obstacles, field.boundaryMargin());
+    EnlsvgPathPlanner planner_with_obstacles(navigable_area, all_obstacles,
+                                             field.boundaryMargin());
+    auto path_with_obstacle_grid = planner_with_obstacle_grid.findPath(start, dest);
+    auto path_with_obstacles     = planner_with_obstacles.findPath(start, dest);
+
+    ASSERT_TRUE(path_with_obstacle_grid != std::nullopt);
+    ASSERT_TRUE(path_with_obstacles != std::nullopt);
+    EXPECT_EQ(path_with_obstacles->getKnots(), path_with_obstacle_grid->getKnots());
+}
+
 TEST_F(TestEnlsvgPathPlanner, test_enlsvg_path_planner_no_navigable_area)
 {
     Field field = Field::createSSLDivisionAField();
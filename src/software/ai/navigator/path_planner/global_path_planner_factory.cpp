@@ -7,6 +7,18 @@ GlobalPathPlannerFactory::GlobalPathPlannerFactory(
     RobotNavigationObstacleFactory obstacle_factory =
         RobotNavigationObstacleFactory(navigation_obstacle_config);
     std::vector<MotionConstraint> all_constraints = allValuesMotionConstraint();
+    Rectangle navigable_area                      = world.field().fieldBoundary();
+
+    // Rasterize the obstacles of each motion constraint once, so that creating the
+    // planner for each combination of motion constraints only has to combine the grids
+    std::map<MotionConstraint, ObstacleOccupancyGrid> motion_constraint_obstacle_grids;
+    for (MotionConstraint constraint : all_constraints)
+    {
+        motion_constraint_obstacle_grids.emplace(
+            constraint, EnlsvgPathPlanner::createObstacleOccupancyGrid(
+                            navigable_area, obstacle_factory.createFromMotionConstraint(
+                                                constraint, world)));
+    }
 
     // The idea of this is similar to Gray codes
     // (https://en.wikipedia.org/wiki/Gray_code#History_and_practical_application). The
@@ -17,6 +29,8 @@ GlobalPathPlannerFactory::GlobalPathPlannerFactory(
     for (unsigned counter = 0; counter < std::pow(2, all_constraints.size()); ++counter)
     {
         std::set<MotionConstraint> motion_constraint_obstacles;
+        ObstacleOccupancyGrid obstacle_grid =
+            EnlsvgPathPlanner::createObstacleOccupancyGrid(navigable_area, {});
 
         // Use the value of the counter and bit arithmetic to get the motion constraint
         // obstacles out
@@ -26,14 +40,15 @@ GlobalPathPlannerFactory::GlobalPathPlannerFactory(
             if (constraint_bits & 1)
             {
                 motion_constraint_obstacles.emplace(all_constraints[j]);
+                obstacle_grid.addObstacles(
+                    motion_constraint_obstacle_grids.at(all_constraints[j]));
             }
         }
 
-        auto obstacles = obstacle_factory.createFromMotionConstraints(
-            motion_constraint_obstacles, world);
         planners.emplace(std::make_pair(
             motion_constraint_obstacles,
-            std::make_shared<EnlsvgPathPlanner>(world.field().fieldBoundary(), obstacles,
+            std::make_shared<EnlsvgPathPlanner>(navigable_area, obstacle_grid,
+                                                std::vector<ObstaclePtr>(),
                                                 ROBOT_MAX_RADIUS_METERS)));
     }
 }
@@ -9,6 +9,8 @@
 class NoPathTestPathPlanner : public PathPlanner
 {
    public:
+    using PathPlanner::findPath;
+
     /**
      * Returns an empty path
      *
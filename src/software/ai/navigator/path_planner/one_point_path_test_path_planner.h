@@ -11,6 +11,8 @@
 class OnePointPathTestPathPlanner : public PathPlanner
 {
    public:
+    using PathPlanner::findPath;
+
     std::optional<Path> findPath(const Point &start, const Point &destination,
                                  const Rectangle &navigable_area,
                                  const std::vector<ObstaclePtr> &obstacles) override;
@@ -4,6 +4,7 @@
 #include <vector>
 
 #include "software/ai/navigator/obstacle/obstacle.hpp"
+#include "software/ai/navigator/obstacle/obstacle_occupancy_grid.h"
 #include "software/geom/linear_spline2d.h"
 #include "software/geom/point.h"
 #include "software/geom/rectangle.h"
@@ -36,5 +37,56 @@ class PathPlanner
                                          const Rectangle &navigable_area,
                                          const std::vector<ObstaclePtr> &obstacles) = 0;
 
+    /**
+     * Returns a path between start and destination, avoiding both the obstacles in
+     * shared_obstacle_grid and the given obstacles. This lets obstacles that are shared
+     * between several paths be rasterized once with createObstacleOccupancyGrid, rather
+     * than once for every path.
+     *
+     * By default this plans around the obstacles of shared_obstacle_grid as if they
+     * were given with the other obstacles. Grid based path planners should override
+     * this to use the blocked cells of the grid.
+     *
+     * @param start start point
+     * @param destination destination point
+     * @param navigable_area Rectangle representing the navigable area
+     * @param shared_obstacle_grid grid of obstacles to avoid, created by
+     * createObstacleOccupancyGrid with the same navigable_area
+     * @param obstacles other obstacles to avoid
+     *
+     * @return a path between start and destination
+     *     * no path is represented by std::nullopt
+     */
+    virtual std::optional<Path> findPath(
+        const Point &start, const Point &destination, const Rectangle &navigable_area,
+        const ObstacleOccupancyGrid &shared_obstacle_grid,
+        const std::vector<ObstaclePtr> &obstacles)
+    {
+        std::vector<ObstaclePtr> all_obstacles = shared_obstacle_grid.obstacles();
+        all_obstacles.insert(all_obstacles.end(), obstacles.begin(), obstacles.end());
+        return findPath(start, destination, navigable_area, all_obstacles);
+    }
+
+    /**
+     * Creates a grid of the given obstacles that can be passed to findPath to plan any
+     * number of paths in the navigable area around the obstacles
+     *
+     * By default the grid has no cells and just holds the obstacles. Grid based path
+     * planners should override this to create a grid with the same cells that they plan
+     * paths on.
+     *
+     * @param navigable_area Rectangle representing the navigable area
+     * @param obstacles obstacles to add to the grid
+     *
+     * @return a grid of the given obstacles
+     */
+    virtual ObstacleOccupancyGrid createObstacleOccupancyGrid(
+        const Rectangle &navigable_area, const std::vector<ObstaclePtr> &obstacles) const
+    {
+        ObstacleOccupancyGrid obstacle_grid;
+        obstacle_grid.addObstacles(obstacles);
+        return obstacle_grid;
+    }
+
     virtual ~PathPlanner() = default;
 };
@@ -324,3 +324,96 @@ INSTANTIATE_TEST_CASE_P(
     All, PlannerPerformanceTest,
     ::testing::Combine(testing::ValuesIn(path_planner_names_and_constructors),
                        testing::ValuesIn(PathPlannerTestCaseFactory::getTestCases())));
+
+// This test is disabled to speed up CI, it can be enabled by removing "DISABLED_" from
+// the test name
+TEST(PlannerThroughputTest, DISABLED_theta_star_paths_planned_per_tick)
+{
+    // Simulates the navigator planning a path for every robot on a team each tick,
+    // with all the robots avoiding the same obstacles. This compares planning with a
+    // single ThetaStarPathPlanner reused across robots and ticks, which can reuse its
+    // grids and the cells blocked by each obstacle, against creating a new planner
+    // for every path, both with and without rasterizing the obstacles into a shared
+    // ObstacleOccupancyGrid once per tick
+    const unsigned int num_robots  = 11;
+    const unsigned int num_ticks   = 10;
+    const Rectangle navigable_area = Field::createSSLDivisionBField().fieldBoundary();
+
+    RobotNavigationObstacleFactory robot_navigation_obstacle_factory(
+        std::make_shared<const RobotNavigationObstacleConfig>());
+    std::vector<ObstaclePtr> obstacles;
+    for (double x : {-3.0, 0.0, 2.0})
+    {
+        for (double y = -2.0; y <= 2.5; y += 0.5)
+        {
+            obstacles.emplace_back(
+                robot_navigation_obstacle_factory.createFromRobotPosition({x, y}));
+        }
+    }
+
+    std::vector<std::pair<Point, Point>> starts_and_ends;
+    for (unsigned int i = 0; i < num_robots; i++)
+    {
+        double y = -2.75 + 5.5 * i / (num_robots - 1);
+        starts_and_ends.emplace_back(Point(-4.25, y), Point(4.25, -y));
+    }
+
+    auto plan_paths = [&](const std::function<PathPlanner&()>& get_planner) {
+        unsigned int num_paths = 0;
+        auto start_time        = std::chrono::system_clock::now();
+        for (unsigned int tick = 0; tick < num_ticks; tick++)
+        {
+            for (const auto& [start, end] : starts_and_ends)
+            {
+                if (get_planner().findPath(start, end, navigable_area, obstacles))
+                {
+                    num_paths++;
+                }
+            }
+        }
+        double duration_ms = ::TestUtil::millisecondsSince(start_time);
+        EXPECT_EQ(num_robots * num_ticks, num_paths);
+        return duration_ms;
+    };
+
+    ThetaStarPathPlanner reused_planner;
+    double reused_planner_ms =
+        plan_paths([&]() -> PathPlanner& { return reused_planner; });
+
+    std::unique_ptr<ThetaStarPathPlanner> fresh_planner;
+    double fresh_planner_ms = plan_paths([&]() -> PathPlanner& {
+        fresh_planner = std::make_unique<ThetaStarPathPlanner>();
+        return *fresh_planner;
+    });
+
+    unsigned int num_shared_grid_paths = 0;
+    auto start_time                    = std::chrono::system_clock::now();
+    for (unsigned int tick = 0; tick < num_ticks; tick++)
+    {
+        ObstacleOccupancyGrid shared_obstacle_grid =
+            ThetaStarPathPlanner().createObstacleOccupancyGrid(navigable_area, obstacles);
+        for (const auto& [start, end] : starts_and_ends)
+        {
+            if (ThetaStarPathPlanner().findPath(start, end, navigable_area,
+                                                shared_obstacle_grid, {}))
+            {
+                num_shared_grid_paths++;
+            }
+        }
+    }
+    double shared_grid_ms = ::TestUtil::millisecondsSince(start_time);
+    EXPECT_EQ(num_robots * num_ticks, num_shared_grid_paths);
+
+    double num_paths = static_cast<double>(num_robots * num_ticks);
+    std::cout << std::endl
+              << num_robots << " robots | " << num_ticks << " ticks | "
+              << obstacles.size() << " shared obstacles" << std::endl;
+    std::cout << "Reused planner = " << reused_planner_ms << "ms | "
+              << num_paths / (reused_planner_ms / 1000.0) << " paths/s" << std::endl;
+    std::cout << "New planner per path = " << fresh_planner_ms << "ms | "
+              << num_paths / (fresh_planner_ms / 1000.0) << " paths/s" << std::endl;
+    std::cout << "New planner per path with shared obstacle grid = " << shared_grid_ms
+              << "ms | " << num_paths / (shared_grid_ms / 1000.0) << " paths/s"
+              << std::endl
+              << std::endl;
+}
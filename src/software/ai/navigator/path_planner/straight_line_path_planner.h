@@ -11,6 +11,8 @@
 class StraightLinePathPlanner : public PathPlanner
 {
    public:
+    using PathPlanner::findPath;
+
     /**
      * Returns a path that is a straight line between start and destination.
      *
@@ -1,5 +1,7 @@
 #include "software/ai/navigator/path_planner/theta_star_path_planner.h"
 
+#include <algorithm>
+#include <functional>
 #include <stack>
 
 #include "software/geom/algorithms/distance.h"
@@ -10,7 +12,10 @@ ThetaStarPathPlanner::ThetaStarPathPlanner()
     : num_grid_rows(0),
       num_grid_cols(0),
       max_navigable_x_coord(0),
-      max_navigable_y_coord(0)
+      max_navigable_y_coord(0),
+      shared_obstacle_grid_overlay(nullptr),
+      unblocked_start_cell_index(NO_CELL_INDEX),
+      unblocked_end_cell_index(NO_CELL_INDEX)
 {
 }
 
@@ -20,26 +25,65 @@ bool ThetaStarPathPlanner::isCoordNavigable(const Coordinate &coord) const
     return (coord.row() < num_grid_rows) && (coord.col() < num_grid_cols);
 }
 
-void ThetaStarPathPlanner::findAllBlockedCoords()
+void ThetaStarPathPlanner::findAllBlockedCoords(const std::vector<ObstaclePtr> &obstacles)
 {
-    for (auto &obstacle : obstacles)
-    {
-        auto blocked_points = obstacle->rasterize(SIZE_OF_GRID_CELL_IN_METERS);
+    // Only keep the cached cells of the obstacles we are given this time. Moving the
+    // cache nodes between the maps avoids reallocating them.
+    std::swap(blocked_cells_cache, prev_blocked_cells_cache);
+    blocked_cells_cache.clear();
 
-        for (Point &blocked_point : blocked_points)
+    for (const ObstaclePtr &obstacle : obstacles)
+    {
+        auto cached_cells = blocked_cells_cache.find(obstacle.get());
+        if (cached_cells == blocked_cells_cache.end())
         {
-            Coordinate blocked_coord = convertPointToCoord(blocked_point);
-            if (isCoordNavigable(blocked_coord))
+            auto prev_cached_cells = prev_blocked_cells_cache.find(obstacle.get());
+            if (prev_cached_cells != prev_blocked_cells_cache.end())
             {
-                blocked_grid[blocked_coord.row()][blocked_coord.col()] = true;
+                cached_cells =
+                    blocked_cells_cache
+                        .insert(prev_blocked_cells_cache.extract(prev_cached_cells))
+                        .position;
+            }
+            else
+            {
+                BlockedCells blocked_cells{
+                    obstacle, obstacle_grid.findBlockedCellIndices(*obstacle)};
+                cached_cells =
+                    blocked_cells_cache.emplace(obstacle.get(), std::move(blocked_cells))
+                        .first;
             }
         }
+
+        for (unsigned int index : cached_cells->second.cell_indices)
+        {
+            obstacle_grid.setBlocked(index, true);
+        }
     }
+
+    // Anything left here was not given to us this time
+    prev_blocked_cells_cache.clear();
+}
+
+unsigned int ThetaStarPathPlanner::cellIndex(const Coordinate &coord) const
+{
+    return obstacle_grid.cellIndex(coord.row(), coord.col());
+}
+
+bool ThetaStarPathPlanner::isBlocked(const Coordinate &coord) const
+{
+    return isCellBlocked(cellIndex(coord));
 }
 
-bool ThetaStarPathPlanner::isBlocked(const Coordinate &coord)
+bool ThetaStarPathPlanner::isCellBlocked(unsigned int index) const
 {
-    return blocked_grid[coord.row()][coord.col()];
+    if (index == unblocked_start_cell_index || index == unblocked_end_cell_index)
+    {
+        return false;
+    }
+    return obstacle_grid.isBlocked(index) ||
+           (shared_obstacle_grid_overlay &&
+            shared_obstacle_grid_overlay->isBlocked(index));
 }
 
 double ThetaStarPathPlanner::coordDistance(const Coordinate &coord1,
@@ -50,7 +94,8 @@ double ThetaStarPathPlanner::coordDistance(const Coordinate &coord1,
     return distance(p1, p2);
 }
 
-bool ThetaStarPathPlanner::lineOfSight(const Coordinate &coord0, const Coordinate &coord1)
+bool ThetaStarPathPlanner::lineOfSight(const Coordinate &coord0,
+                                       const Coordinate &coord1) const
 {
     int dy = coord1.col() - coord0.col();
     int dx = coord1.row() - coord0.row();
@@ -80,7 +125,7 @@ bool ThetaStarPathPlanner::lineOfSight(const Coordinate &coord0, const Coordinat
 }
 
 bool ThetaStarPathPlanner::checkLine(const Coordinate &coord0, const Coordinate &coord1,
-                                     const bool isLineLow)
+                                     const bool isLineLow) const
 {
     // Main represents the axis that is being incremented (x if line is low)
     // Sec represents the secondary axis that is dependent on Main axis (y if line is low)
@@ -144,10 +189,10 @@ std::vector<Point> ThetaStarPathPlanner::tracePath(const Coordinate &end) const
     std::stack<Coordinate> path;
 
     // loop until parent equals current
-    while (!(cell_heuristics[current.row()][current.col()].parent() == current))
+    while (!(cell_heuristics[cellIndex(current)].parent() == current))
     {
         path.push(current);
-        current = cell_heuristics[current.row()][current.col()].parent();
+        current = cell_heuristics[cellIndex(current)].parent();
     }
 
     path.push(current);
@@ -169,24 +214,25 @@ bool ThetaStarPathPlanner::updateVertex(const Coordinate &current, const Coordin
     {
         // If the successor is already on the closed list or if it is blocked, then ignore
         // it.  Else do the following
-        if (closed_list.find(next) == closed_list.end() && !isBlocked(next))
+        unsigned int next_index = cellIndex(next);
+        if (!closed_grid[next_index] && !isCellBlocked(next_index))
         {
             double updated_best_path_cost;
             Coordinate next_parent;
-            Coordinate parent = cell_heuristics[current.row()][current.col()].parent();
+            const CellHeuristic &current_heuristic = cell_heuristics[cellIndex(current)];
+            Coordinate parent                      = current_heuristic.parent();
             if (lineOfSight(parent, next))
             {
                 next_parent = parent;
                 updated_best_path_cost =
-                    cell_heuristics[parent.row()][parent.col()].bestPathCost() +
+                    cell_heuristics[cellIndex(parent)].bestPathCost() +
                     coordDistance(parent, next);
             }
             else
             {
                 next_parent = current;
                 updated_best_path_cost =
-                    cell_heuristics[current.row()][current.col()].bestPathCost() +
-                    coordDistance(current, next);
+                    current_heuristic.bestPathCost() + coordDistance(current, next);
             }
 
             double next_start_to_end_cost_estimate =
@@ -198,15 +244,17 @@ bool ThetaStarPathPlanner::updateVertex(const Coordinate &current, const Coordin
             //                               OR
             // If it is on the open list already, check to see if this path to that square
             // is better, using start_to_end_cost_estimate as the measure.
-            if (!cell_heuristics[next.row()][next.col()].isInitialized() ||
-                cell_heuristics[next.row()][next.col()].pathCostAndEndDistHeuristic() >
+            CellHeuristic &next_heuristic = cell_heuristics[next_index];
+            if (!next_heuristic.isInitialized() ||
+                next_heuristic.pathCostAndEndDistHeuristic() >
                     next_start_to_end_cost_estimate)
             {
-                open_list.insert(std::make_pair(next_start_to_end_cost_estimate, next));
+                open_list.emplace_back(next_start_to_end_cost_estimate, next);
+                std::push_heap(open_list.begin(), open_list.end(), std::greater<>());
 
                 // Update the details of this CellHeuristic
-                cell_heuristics[next.row()][next.col()].update(
-                    next_parent, next_start_to_end_cost_estimate, updated_best_path_cost);
+                next_heuristic.update(next_parent, next_start_to_end_cost_estimate,
+                                      updated_best_path_cost);
             }
             // If the end is the same as the current successor
             if (next == end)
@@ -222,6 +270,14 @@ bool ThetaStarPathPlanner::updateVertex(const Coordinate &current, const Coordin
 std::optional<Path> ThetaStarPathPlanner::findPath(
     const Point &start, const Point &end, const Rectangle &navigable_area,
     const std::vector<ObstaclePtr> &obstacles)
+{
+    return findPath(start, end, navigable_area, ObstacleOccupancyGrid(), obstacles);
+}
+
+std::optional<Path> ThetaStarPathPlanner::findPath(
+    const Point &start, const Point &end, const Rectangle &navigable_area,
+    const ObstacleOccupancyGrid &shared_obstacle_grid,
+    const std::vector<ObstaclePtr> &obstacles)
 {
     bool navigable_area_contains_start =
         (start.x() >= navigable_area.xMin()) && (start.x() <= navigable_area.xMax()) &&
@@ -234,9 +290,20 @@ std::optional<Path> ThetaStarPathPlanner::findPath(
         return std::nullopt;
     }
 
-    resetAndInitializeMemberVariables(navigable_area, obstacles);
+    resetAndInitializeMemberVariables(navigable_area, shared_obstacle_grid);
 
-    findAllBlockedCoords();
+    if (shared_obstacle_grid_overlay || shared_obstacle_grid.obstacles().empty())
+    {
+        findAllBlockedCoords(obstacles);
+    }
+    else
+    {
+        // The shared grid was not created for this navigable area, so its obstacles
+        // have to be rasterized again
+        std::vector<ObstaclePtr> all_obstacles = shared_obstacle_grid.obstacles();
+        all_obstacles.insert(all_obstacles.end(), obstacles.begin(), obstacles.end());
+        findAllBlockedCoords(all_obstacles);
+    }
 
     Point closest_end      = findClosestFreePoint(end);
     Coordinate start_coord = convertPointToCoord(start);
@@ -262,12 +329,12 @@ std::optional<Path> ThetaStarPathPlanner::findPath(
     }
 
     // Initialising the parameters of the starting cell
-    cell_heuristics[start_coord.row()][start_coord.col()].update(start_coord, 0.0, 0.0);
-    open_list.insert(std::make_pair(0.0, start_coord));
+    cell_heuristics[cellIndex(start_coord)].update(start_coord, 0.0, 0.0);
+    open_list.emplace_back(0.0, start_coord);
 
     // Avoiding the situation where closest_end point is free but end_coord is blocked
-    blocked_grid[start_coord.row()][start_coord.col()] = false;
-    blocked_grid[end_coord.row()][end_coord.col()]     = false;
+    unblocked_start_cell_index = cellIndex(start_coord);
+    unblocked_end_cell_index   = cellIndex(end_coord);
 
     bool found_end = findPathToEnd(end_coord);
 
@@ -354,13 +421,20 @@ bool ThetaStarPathPlanner::findPathToEnd(const Coordinate &end_coord)
 {
     while (!open_list.empty())
     {
-        Coordinate current_coord(open_list.begin()->second);
-
-        // Remove this vertex from the open list
-        open_list.erase(open_list.begin());
+        // Remove the vertex with the lowest cost from the open list
+        std::pop_heap(open_list.begin(), open_list.end(), std::greater<>());
+        Coordinate current_coord(open_list.back().second);
+        open_list.pop_back();
+
+        // Skip stale entries for vertices that were already visited through a cheaper
+        // entry. Visiting them again would not change anything.
+        if (closed_grid[cellIndex(current_coord)])
+        {
+            continue;
+        }
 
         // Add this vertex to the closed list
-        closed_list.insert(current_coord);
+        closed_grid[cellIndex(current_coord)] = true;
 
         // Check if the the destination is in the neighbouring coordinates
         if (visitNeighbours(current_coord, end_coord))
@@ -572,35 +646,79 @@ ThetaStarPathPlanner::Coordinate ThetaStarPathPlanner::convertPointToCoord(
                                        SIZE_OF_GRID_CELL_IN_METERS));
 }
 
+ObstacleOccupancyGrid ThetaStarPathPlanner::createObstacleOccupancyGrid(
+    const Rectangle &navigable_area, const std::vector<ObstaclePtr> &obstacles) const
+{
+    ObstacleOccupancyGrid grid = createEmptyObstacleGrid(navigable_area);
+    grid.addObstacles(obstacles);
+    return grid;
+}
+
+ObstacleOccupancyGrid ThetaStarPathPlanner::createEmptyObstacleGrid(
+    const Rectangle &navigable_area) const
+{
+    double max_x_coord = maxNavigableCoord(navigable_area.xLength());
+    double max_y_coord = maxNavigableCoord(navigable_area.yLength());
+    auto num_rows      = static_cast<unsigned int>(
+        (max_x_coord * 2.0 + ROBOT_MAX_RADIUS_METERS) / SIZE_OF_GRID_CELL_IN_METERS);
+    auto num_cols = static_cast<unsigned int>(
+        (max_y_coord * 2.0 + ROBOT_MAX_RADIUS_METERS) / SIZE_OF_GRID_CELL_IN_METERS);
+
+    // Coordinate (0, 0) is at the bottom left corner of the navigable area, inset by
+    // the robot radius
+    Point origin(navigable_area.centre().x() - max_x_coord,
+                 navigable_area.centre().y() - max_y_coord);
+    return ObstacleOccupancyGrid(origin, SIZE_OF_GRID_CELL_IN_METERS, num_rows, num_cols);
+}
+
+double ThetaStarPathPlanner::maxNavigableCoord(double navigable_area_length)
+{
+    return std::max(navigable_area_length / 2.0 - ROBOT_MAX_RADIUS_METERS, 0.0);
+}
+
 void ThetaStarPathPlanner::resetAndInitializeMemberVariables(
-    const Rectangle &navigable_area, const std::vector<ObstaclePtr> &obstacles)
+    const Rectangle &navigable_area, const ObstacleOccupancyGrid &shared_obstacle_grid)
 {
+    ObstacleOccupancyGrid empty_obstacle_grid = createEmptyObstacleGrid(navigable_area);
+
     // Initialize member variables
-    this->obstacles = obstacles;
-    centre          = navigable_area.centre();
-    max_navigable_x_coord =
-        std::max(navigable_area.xLength() / 2.0 - ROBOT_MAX_RADIUS_METERS, 0.0);
-    max_navigable_y_coord =
-        std::max(navigable_area.yLength() / 2.0 - ROBOT_MAX_RADIUS_METERS, 0.0);
-    num_grid_rows =
-        static_cast<int>((max_navigable_x_coord * 2.0 + ROBOT_MAX_RADIUS_METERS) /
-                         SIZE_OF_GRID_CELL_IN_METERS);
-    num_grid_cols =
-        static_cast<int>((max_navigable_y_coord * 2.0 + ROBOT_MAX_RADIUS_METERS) /
-                         SIZE_OF_GRID_CELL_IN_METERS);
-
-    // add assertion to ensure that the key value in Coordinate and Coordinate pair would
-    // not overflow, overflow would happen when grid row or col is larger than 1<<16
+    centre                = navigable_area.centre();
+    max_navigable_x_coord = maxNavigableCoord(navigable_area.xLength());
+    max_navigable_y_coord = maxNavigableCoord(navigable_area.yLength());
+    num_grid_rows         = empty_obstacle_grid.numXCells();
+    num_grid_cols         = empty_obstacle_grid.numYCells();
+
+    // add assertion to ensure that the key value in Coordinate would not overflow,
+    // overflow would happen when grid row or col is larger than 1<<16
     assert(num_grid_rows < (1 << 16));
     assert(num_grid_cols < (1 << 16));
 
-    // Reset data structures to path plan again
+    // The cached blocked cells are only valid for the grid they were found on
+    if (!obstacle_grid.hasSameCellsAs(empty_obstacle_grid))
+    {
+        blocked_cells_cache.clear();
+    }
+
+    // Reset data structures to path plan again. Assigning to the existing grids reuses
+    // their memory when the grid is the same size.
+    size_t num_cells = static_cast<size_t>(num_grid_rows) * num_grid_cols;
     open_list.clear();
-    closed_list.clear();
-    line_of_sight_cache.clear();
-    cell_heuristics = std::vector<std::vector<CellHeuristic>>(
-        num_grid_rows,
-        std::vector<CellHeuristic>(num_grid_cols, ThetaStarPathPlanner::CellHeuristic()));
-    blocked_grid = std::vector<std::vector<bool>>(
-        num_grid_rows, std::vector<bool>(num_grid_cols, false));
+    closed_grid.assign(num_cells, false);
+    cell_heuristics.assign(num_cells, ThetaStarPathPlanner::CellHeuristic());
+    if (obstacle_grid.hasSameCellsAs(empty_obstacle_grid))
+    {
+        obstacle_grid.clear();
+    }
+    else
+    {
+        obstacle_grid = std::move(empty_obstacle_grid);
+    }
+
+    // The shared grid is read in place rather than copied into obstacle_grid, so that
+    // its blocked cells aren't copied for every path
+    shared_obstacle_grid_overlay = obstacle_grid.hasSameCellsAs(shared_obstacle_grid)
+                                       ? &shared_obstacle_grid
+                                       : nullptr;
+    unblocked_start_cell_index = NO_CELL_INDEX;
+    unblocked_end_cell_index   = NO_CELL_INDEX;
 }
@@ -1,10 +1,8 @@
 #pragma once
 
 #include <cassert>
-#include <map>
-#include <set>
+#include <limits>
 #include <unordered_map>
-#include <unordered_set>
 
 #include "software/ai/navigator/path_planner/path_planner.h"
 
@@ -20,6 +18,14 @@
  * Read
  * https://web.archive.org/web/20190218161704/http://aigamedev.com/open/tutorial/theta-star-any-angle-paths/
  * for an explanation of how that works, including pseudocode and diagrams.
+ *
+ * All the per-cell state is stored in flat arrays that are reused between calls to
+ * findPath, so planning a path does not reallocate the grid. The cells blocked by each
+ * obstacle are also cached between calls, so obstacles that are shared between the
+ * paths planned for different robots in the same tick are only rasterized once.
+ * Obstacles shared by every path in a tick can instead be rasterized into an
+ * ObstacleOccupancyGrid with createObstacleOccupancyGrid, which findPath reads the
+ * blocked cells of in place.
  */
 
 class ThetaStarPathPlanner : public PathPlanner
@@ -42,6 +48,15 @@ class ThetaStarPathPlanner : public PathPlanner
                                  const Rectangle &navigable_area,
                                  const std::vector<ObstaclePtr> &obstacles) override;
 
+    std::optional<Path> findPath(const Point &start, const Point &end,
+                                 const Rectangle &navigable_area,
+                                 const ObstacleOccupancyGrid &shared_obstacle_grid,
+                                 const std::vector<ObstaclePtr> &obstacles) override;
+
+    ObstacleOccupancyGrid createObstacleOccupancyGrid(
+        const Rectangle &navigable_area,
+        const std::vector<ObstaclePtr> &obstacles) const override;
+
     class Coordinate
     {
        public:
@@ -102,66 +117,6 @@ class ThetaStarPathPlanner : public PathPlanner
     };
 
    private:
-    class CoordinatePair
-    {
-       public:
-        CoordinatePair(const Coordinate &coord1, const Coordinate &coord2)
-            : coord1_(coord1),
-              coord2_(coord2),
-              internal_comparison_key_(computeComparisonKey(coord1, coord2))
-        {
-        }
-
-        CoordinatePair() : coord1_(), coord2_() {}
-
-        const Coordinate &firstCoordinate(void) const
-        {
-            return coord1_;
-        }
-
-        const Coordinate &secondCoordinate(void) const
-        {
-            return coord2_;
-        }
-
-        bool operator<(const CoordinatePair &other) const
-        {
-            return internal_comparison_key_ < other.internal_comparison_key_;
-        }
-
-       private:
-        /**
-         * Calculate the key value given a pair of coordinates. The key of the coordinate
-         * with smaller row value, or smaller col value when row values are equal will
-         * occupy the low 32 bits in the key for this CoordinatePair. The key value of the
-         * other coordinate will occupy the high 32 bits in the key for this
-         * CoordinatePair.
-         *
-         * @param coord1 the first coordinate
-         * @param coord2 the second coordinate
-         * @return the key value in unsigned long
-         */
-        static unsigned long computeComparisonKey(const Coordinate &coord1,
-                                                  const Coordinate &coord2)
-        {
-            unsigned long key1 = coord1.internalComparisonKey();
-            unsigned long key2 = coord2.internalComparisonKey();
-            if (coord1.row() < coord2.row() ||
-                (coord1.row() == coord2.row() && coord1.col() < coord2.col()))
-            {
-                return key1 + key2 * (((unsigned long)1) << 32);
-            }
-            else
-            {
-                return key2 + key1 * (((unsigned long)1) << 32);
-            }
-        }
-
-        Coordinate coord1_;
-        Coordinate coord2_;
-        unsigned long internal_comparison_key_;
-    };
-
     class CellHeuristic
     {
        public:
@@ -249,20 +204,43 @@ class ThetaStarPathPlanner : public PathPlanner
     bool isCoordNavigable(const Coordinate &coord) const;
 
     /**
-     * Calculates all of the coordinates that are blocked by an obstacle and stores it in
-     * blocked_grid
+     * Calculates all of the coordinates that are blocked by the given obstacles and
+     * blocks them in obstacle_grid. The blocked cells of obstacles that were also given
+     * to the previous call to findPath are reused instead of rasterizing them again.
+     *
+     * @param obstacles obstacles to avoid
+     */
+    void findAllBlockedCoords(const std::vector<ObstaclePtr> &obstacles);
+
+    /**
+     * Gets the index of the given coordinate in the flat grid arrays
+     *
+     * @param coord Coordinate to get the index of
+     *
+     * @return the index of coord in the flat grid arrays
      */
-    void findAllBlockedCoords();
+    unsigned int cellIndex(const Coordinate &coord) const;
 
     /**
      * Returns whether or not a cell is blocked
-     * Checks blocked_grid to see if coord was set to blocked
+     * Checks obstacle_grid to see if coord was set to blocked
      *
      * @param coord Coordinate to consider
      *
      * @return true if cell is blocked
      */
-    bool isBlocked(const Coordinate &coord);
+    bool isBlocked(const Coordinate &coord) const;
+
+    /**
+     * Returns whether or not a cell is blocked, either by the obstacles given to
+     * findPath or by the shared obstacle grid. The cells of the start and end of the
+     * path are never blocked once they have been found.
+     *
+     * @param index The index of the cell
+     *
+     * @return true if the cell is blocked
+     */
+    bool isCellBlocked(unsigned int index) const;
 
     /**
      * Computes Euclidean distance from coord1 to coord2
@@ -306,7 +284,7 @@ class ThetaStarPathPlanner : public PathPlanner
      *
      * @return true if line of sight from coord0 to coord1
      */
-    bool lineOfSight(const Coordinate &coord0, const Coordinate &coord1);
+    bool lineOfSight(const Coordinate &coord0, const Coordinate &coord1) const;
 
     /**
      * Supplementary method for lineOfSight to check for line of sight depending on
@@ -321,7 +299,7 @@ class ThetaStarPathPlanner : public PathPlanner
      * @return true if line of sight from coord0 to coord1
      */
     bool checkLine(const Coordinate &coord0, const Coordinate &coord1,
-                   const bool isLineLow);
+                   const bool isLineLow) const;
 
     /**
      * Finds closest unblocked cell to current_cell
@@ -422,10 +400,32 @@ class ThetaStarPathPlanner : public PathPlanner
      * Resets and initializes member variables to prepare for planning a new path
      *
      * @param navigable_area Rectangle representing the navigable area
-     * @param obstacles obstacles to avoid
+     * @param shared_obstacle_grid grid of obstacles to read in place of rasterizing
+     * them, if it has the same cells as obstacle_grid
+     */
+    void resetAndInitializeMemberVariables(
+        const Rectangle &navigable_area,
+        const ObstacleOccupancyGrid &shared_obstacle_grid);
+
+    /**
+     * Creates an ObstacleOccupancyGrid with no obstacles that has the same cells as the
+     * grid paths are planned on in the navigable area
+     *
+     * @param navigable_area Rectangle representing the navigable area
+     *
+     * @return an empty grid with the cells paths are planned on
      */
-    void resetAndInitializeMemberVariables(const Rectangle &navigable_area,
-                                           const std::vector<ObstaclePtr> &obstacles);
+    ObstacleOccupancyGrid createEmptyObstacleGrid(const Rectangle &navigable_area) const;
+
+    /**
+     * Gets the furthest distance from the centre of the navigable area that a path can
+     * go, along an axis where the navigable area has the given length
+     *
+     * @param navigable_area_length the length of the navigable area along the axis
+     *
+     * @return the max navigable distance from the centre along the axis
+     */
+    static double maxNavigableCoord(double navigable_area_length);
 
     // if close to end then return direct path to end point
     static constexpr double CLOSE_TO_END_THRESHOLD = 0.01;  // in metres
@@ -437,7 +437,6 @@ class ThetaStarPathPlanner : public PathPlanner
     const double SIZE_OF_GRID_CELL_IN_METERS =
         ROBOT_MAX_RADIUS_METERS;  // this is the n in the O(n^2) algorithm :p
 
-    std::vector<ObstaclePtr> obstacles;
     Point centre;
     unsigned int num_grid_rows;
     unsigned int num_grid_cols;
@@ -445,25 +444,50 @@ class ThetaStarPathPlanner : public PathPlanner
     double max_navigable_y_coord;
     Coordinate start_motion_coord;
 
-    // open_list represents Coordinates that we'd like to visit. Elements are pairs of
-    // start_to_end_cost_estimate and Coordinate, so the set is implicitly ordered by
-    // start_to_end_cost_estimate (and then by Coordinate to break ties). This ensures
-    // that open_list.begin() is the Coordinate with the lowest start_to_end_cost_estimate
-    std::set<std::pair<double, Coordinate>> open_list;
+    // open_list represents Coordinates that we'd like to visit. It is a binary min-heap
+    // (see std::push_heap) of pairs of start_to_end_cost_estimate and Coordinate, so
+    // the front of the heap is the Coordinate with the lowest
+    // start_to_end_cost_estimate (and then the lowest Coordinate to break ties). When
+    // a Coordinate is given a lower cost it is pushed again rather than updated, so
+    // entries for Coordinates that are already closed are skipped when popped.
+    std::vector<std::pair<double, Coordinate>> open_list;
+
+    // The grids below are flat arrays indexed by cellIndex, and are sized for the
+    // navigable area of the last call to findPath
 
-    // closed_list represent coords we've already visited so
+    // closed_grid represent coords we've already visited so
     // it contains coords for which we calculated the CellHeuristic
-    std::set<Coordinate> closed_list;
+    std::vector<bool> closed_grid;
+
+    // The details of the CellHeuristic of each Coordinate
+    std::vector<CellHeuristic> cell_heuristics;
+
+    // Whether each Coordinate is blocked by the obstacles given to findPath
+    ObstacleOccupancyGrid obstacle_grid;
 
-    // Declare a 2D array of structure to hold the details of that CellHeuristic
-    std::vector<std::vector<CellHeuristic>> cell_heuristics;
+    // The shared obstacle grid given to the current call to findPath, if it has the same
+    // cells as obstacle_grid. A Coordinate is blocked if it is blocked in either grid.
+    // This is only valid during the call to findPath it was given to.
+    const ObstacleOccupancyGrid *shared_obstacle_grid_overlay;
 
-    // Declare a 2D array of structure to hold if a coordinate is blocked
-    // true  --> Coordinate is blocked
-    // false --> Coordinate is not blocked
-    std::vector<std::vector<bool>> blocked_grid;
+    // The cells of the start and end of the path, which are never blocked so that we
+    // can leave and reach them even if they are inside an obstacle
+    static constexpr unsigned int NO_CELL_INDEX =
+        std::numeric_limits<unsigned int>::max();
+    unsigned int unblocked_start_cell_index;
+    unsigned int unblocked_end_cell_index;
+
+    // The cells blocked by an obstacle, as indices into the grids
+    struct BlockedCells
+    {
+        // The obstacle is held here so that its address can't be reused by a
+        // different obstacle while it is cached
+        ObstaclePtr obstacle;
+        std::vector<unsigned int> cell_indices;
+    };
 
-    // Cache of line of sight that maps a pair of
-    // coordinates to whether those two Coordinates have line of sight between them
-    std::map<CoordinatePair, bool> line_of_sight_cache;
+    // The cells blocked by each obstacle given to the last call to findPath, keyed by
+    // obstacle address. This is cleared if the navigable area changes.
+    std::unordered_map<const Obstacle *, BlockedCells> blocked_cells_cache;
+    std::unordered_map<const Obstacle *, BlockedCells> prev_blocked_cells_cache;
 };
@@ -473,3 +473,38 @@ TEST_F(TestThetaStarPathPlanner, test_theta_star_path_planner_start_in_enemy_hal
     Rectangle bounding_box({4.5, 3.3}, {-1.3, -3.2});
     checkPathDoesNotExceedBoundingBox(path->getKnots(), bounding_box);
 }
+
+TEST_F(TestThetaStarPathPlanner,
+       test_theta_star_path_planner_shared_obstacle_grid_gives_same_path_as_obstacles)
+{
+    Point start{-2.5, 0}, end{4, 0.5};
+    Field field              = Field::createSSLDivisionBField();
+    Rectangle navigable_area = field.fieldBoundary();
+
+    std::vector<ObstaclePtr> shared_obstacles = {
+        robot_navigation_obstacle_factory.createFromShape(field.friendlyDefenseArea()),
+        robot_navigation_obstacle_factory.createFromRobotPosition({-1, 0}),
+        robot_navigation_obstacle_factory.createFromRobotPosition({1, 0.5}),
+    };
+    std::vector<ObstaclePtr> robot_obstacles = {
+        robot_navigation_obstacle_factory.createFromShape(
+            Rectangle(Point(2, -1), Point(2.5, 1.5))),
+    };
+    std::vector<ObstaclePtr> all_obstacles = shared_obstacles;
+    all_obstacles.insert(all_obstacles.end(), robot_obstacles.begin(),
+                         robot_obstacles.end());
+
+    ObstacleOccupancyGrid shared_obstacle_grid =
+        planner->createObstacleOccupancyGrid(navigable_area, shared_obstacles);
+    auto path_with_shared_obstacle_grid = planner->findPath(
+        start, end, navigable_area, shared_obstacle_grid, robot_obstacles);
+    auto path_with_obstacles =
+        planner->findPath(start, end, navigable_area, all_obstacles);
+
+    ASSERT_TRUE(path_with_shared_obstacle_grid != std::nullopt);
+    ASSERT_TRUE(path_with_obstacles != std::nullopt);
+    EXPECT_EQ(path_with_obstacles->getKnots(),
+              path_with_shared_obstacle_grid->getKnots());
+    checkPathDoesNotIntersectObstacle(path_with_shared_obstacle_grid->getKnots(),
+                                      all_obstacles);
+}
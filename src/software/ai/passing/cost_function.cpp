@@ -1,5 +1,7 @@
 #include "software/ai/passing/cost_function.h"
 
+#include <algorithm>
+#include <limits>
 #include <numeric>
 
 #include "shared/parameter/cpp_dynamic_parameters.h"
@@ -11,28 +13,381 @@
 #include "software/geom/algorithms/contains.h"
 #include "software/logger/logger.h"
 
+namespace
+{
+    // The distance an enemy robot needs to reach its max speed, assuming the
+    // linear acceleration profile used by getTimeToPositionForRobot
+    const double ENEMY_DIST_TO_MAX_SPEED =
+        std::pow(ENEMY_ROBOT_MAX_SPEED_METERS_PER_SECOND /
+                     ENEMY_ROBOT_MAX_ACCELERATION_METERS_PER_SECOND_SQUARED,
+                 2) *
+        ENEMY_ROBOT_MAX_ACCELERATION_METERS_PER_SECOND_SQUARED / 2;
+
+    /**
+     * Calculates how long an enemy robot takes to travel the given distance. This is
+     * the same as getTimeToPositionForRobot with the enemy robot constants, written
+     * without branches so that it can be vectorized.
+     *
+     * @param distance The distance for the enemy robot to travel
+     *
+     * @return the time in seconds the enemy robot takes to travel the given distance
+     */
+    inline double enemyTimeToTravel(double distance)
+    {
+        double dist = std::max(0.0, distance - ROBOT_MAX_RADIUS_METERS);
+        double acceleration_time =
+            std::sqrt(2 * std::min(dist / 2, ENEMY_DIST_TO_MAX_SPEED) /
+                      ENEMY_ROBOT_MAX_ACCELERATION_METERS_PER_SECOND_SQUARED);
+        double time_at_max_velocity = std::max(0.0, dist - 2 * ENEMY_DIST_TO_MAX_SPEED) /
+                                      ENEMY_ROBOT_MAX_SPEED_METERS_PER_SECOND;
+        return 2 * acceleration_time + time_at_max_velocity;
+    }
+
+    /**
+     * The result of evaluating every enemy in a snapshot against a pass
+     */
+    struct EnemyPassRisks
+    {
+        // The smallest difference (over all enemies) between when an enemy could
+        // reach the pass and when the ball gets there, in seconds
+        double min_robot_ball_time_diff;
+
+        // The sum of the squared distances from each enemy to the receiver point
+        double sum_squared_dist_to_receiver;
+    };
+
+    /**
+     * Evaluates every enemy in the given snapshot against the given pass in a
+     * single loop. This is the hot loop of the pass cost function, so it only does
+     * arithmetic on the packed arrays of the snapshot: no allocation, no copies of
+     * Robots and no branches.
+     *
+     * The intercept and proximity risks are monotonic in the values returned, so
+     * they can be calculated from them once instead of once per enemy.
+     *
+     * @param enemy_team The snapshot of the enemy team
+     * @param pass The pass to evaluate
+     * @param enemy_reaction_time How long we think the enemy will take to react
+     *
+     * @return The risks of the enemies interfering with the pass
+     */
+    EnemyPassRisks calculateEnemyPassRisks(const EnemyTeamSnapshot& enemy_team,
+                                           const Pass& pass,
+                                           const Duration& enemy_reaction_time)
+    {
+        const double passer_x = pass.passerPoint().x();
+        const double passer_y = pass.passerPoint().y();
+        const double pass_x   = pass.receiverPoint().x() - passer_x;
+        const double pass_y   = pass.receiverPoint().y() - passer_y;
+
+        const double pass_length_squared = pass_x * pass_x + pass_y * pass_y;
+        const double inv_pass_length_squared =
+            pass_length_squared > 0 ? 1 / pass_length_squared : 0;
+        const double reaction_time_s = enemy_reaction_time.toSeconds();
+
+        // Ball travel time to the receiver point, and the scale to get the ball
+        // travel time to a point a fraction of the way along the pass
+        const double ball_time_to_receive_point = pass.estimatePassDuration().toSeconds();
+        const double ball_time_scale = pass.speed() == 0 ? 0 : ball_time_to_receive_point;
+        const double ball_time_offset =
+            pass.speed() == 0 ? std::numeric_limits<int>::max() : 0;
+
+        const double* positions_x = enemy_team.positionsX();
+        const double* positions_y = enemy_team.positionsY();
+        const size_t num_enemies  = enemy_team.size();
+
+        double min_robot_ball_time_diff     = std::numeric_limits<double>::max();
+        double sum_squared_dist_to_receiver = 0;
+        for (size_t i = 0; i < num_enemies; i++)
+        {
+            const double robot_x = positions_x[i] - passer_x;
+            const double robot_y = positions_y[i] - passer_y;
+
+            // The closest point on the pass to the robot, as a fraction of the
+            // way along the pass
+            const double closest_fraction = std::clamp(
+                (robot_x * pass_x + robot_y * pass_y) * inv_pass_length_squared, 0.0,
+                1.0);
+            const double to_closest_x  = closest_fraction * pass_x - robot_x;
+            const double to_closest_y  = closest_fraction * pass_y - robot_y;
+            const double to_receiver_x = pass_x - robot_x;
+            const double to_receiver_y = pass_y - robot_y;
+
+            const double squared_dist_to_receiver =
+                to_receiver_x * to_receiver_x + to_receiver_y * to_receiver_y;
+
+            const double robot_ball_time_diff_at_closest_pass_point =
+                enemyTimeToTravel(std::sqrt(to_closest_x * to_closest_x +
+                                            to_closest_y * to_closest_y)) +
+                reaction_time_s - (closest_fraction * ball_time_scale + ball_time_offset);
+            const double robot_ball_time_diff_at_pass_receive_point =
+                enemyTimeToTravel(std::sqrt(squared_dist_to_receiver)) + reaction_time_s -
+                ball_time_to_receive_point;
+
+            min_robot_ball_time_diff =
+                std::min(min_robot_ball_time_diff,
+                         std::min(robot_ball_time_diff_at_closest_pass_point,
+                                  robot_ball_time_diff_at_pass_receive_point));
+            sum_squared_dist_to_receiver += squared_dist_to_receiver;
+        }
+
+        return EnemyPassRisks{min_robot_ball_time_diff, sum_squared_dist_to_receiver};
+    }
+
+    /**
+     * Converts the smallest robot/ball time difference over all enemies to an
+     * intercept risk. See calculateInterceptRisk for details.
+     *
+     * @param enemy_team The snapshot of the enemy team
+     * @param risks The enemy risks calculated for the enemy team
+     *
+     * @return the intercept risk of the pass
+     */
+    double interceptRiskFromEnemyPassRisks(const EnemyTeamSnapshot& enemy_team,
+                                           const EnemyPassRisks& risks)
+    {
+        if (enemy_team.empty())
+        {
+            return 0;
+        }
+        return 1 - sigmoid(risks.min_robot_ball_time_diff, 0, 1);
+    }
+
+    /**
+     * Converts the sum of squared distances to the receiver point to a proximity
+     * risk. See calculateProximityRisk for details.
+     *
+     * @param enemy_team The snapshot of the enemy team
+     * @param risks The enemy risks calculated for the enemy team
+     * @param enemy_proximity_importance essentially a scaling factor for the result
+     *
+     * @return the proximity risk of the receiver point
+     */
+    double proximityRiskFromEnemyPassRisks(const EnemyTeamSnapshot& enemy_team,
+                                           const EnemyPassRisks& risks,
+                                           double enemy_proximity_importance)
+    {
+        if (enemy_team.empty())
+        {
+            return 0;
+        }
+        // The product of importance * e^(-dist^2) over every enemy
+        return std::pow(enemy_proximity_importance,
+                        static_cast<double>(enemy_team.size())) *
+               std::exp(-risks.sum_squared_dist_to_receiver);
+    }
+
+    /**
+     * Calculates the static position quality for a given position on a given field.
+     * See getStaticPositionQuality for details.
+     *
+     * @param field The field on which to calculate the static position quality
+     * @param static_position_quality_region The region of the field that gets a high
+     *                                       static position quality
+     * @param friendly_goal_weight How heavily positions near the friendly goal are
+     *                             penalized
+     * @param position The position on the field at which to calculate the quality
+     *
+     * @return the static position quality of the given position
+     */
+    double staticPositionQuality(const Field& field,
+                                 const Rectangle& static_position_quality_region,
+                                 double friendly_goal_weight, const Point& position)
+    {
+        // This constant is used to determine how steep the sigmoid slopes below are
+        static const double sig_width = 0.1;
+
+        double on_field_quality =
+            rectangleSigmoid(static_position_quality_region, position, sig_width);
+
+        // Add a negative weight for positions closer to our goal
+        Vector vec_to_friendly_goal =
+            Vector(field.friendlyGoalCenter().x() - position.x(),
+                   field.friendlyGoalCenter().y() - position.y());
+        double distance_to_friendly_goal = vec_to_friendly_goal.length();
+        double near_friendly_goal_quality =
+            (1 - std::exp(-friendly_goal_weight *
+                          (std::pow(5, -2 + distance_to_friendly_goal))));
+
+        // Add a strong negative weight for positions within the enemy defense area, as
+        // we cannot pass there
+        double in_enemy_defense_area_quality =
+            1 - rectangleSigmoid(field.enemyDefenseArea(), position, sig_width);
+
+        return on_field_quality * near_friendly_goal_quality *
+               in_enemy_defense_area_quality;
+    }
+
+    /**
+     * Rates the given pass based on the probability of scoring once we receive it.
+     * See ratePassShootScore for details.
+     *
+     * @param field The field we are playing on
+     * @param enemy_team The enemy team
+     * @param pass The pass to rate
+     * @param ideal_max_rotation_to_shoot_degrees The largest rotation the receiver
+     *                                            should need to shoot after receiving
+     *
+     * @return the shoot score of the pass
+     */
+    double shootScore(const Field& field, const Team& enemy_team, const Pass& pass,
+                      double ideal_max_rotation_to_shoot_degrees)
+    {
+        // Figure out the range of angles for which we have an open shot to the goal after
+        // receiving the pass
+        auto shot_opt = calcBestShotOnGoal(
+            Segment(field.enemyGoalpostPos(), field.enemyGoalpostNeg()),
+            pass.receiverPoint(), enemy_team.getAllRobots(), TeamType::ENEMY);
+
+        Angle open_angle_to_goal = Angle::zero();
+        Point shot_target        = field.enemyGoalCenter();
+        if (shot_opt && shot_opt.value().getOpenAngle().abs() > Angle::fromDegrees(0))
+        {
+            open_angle_to_goal = shot_opt.value().getOpenAngle();
+        }
+
+        // Figure out what the maximum open angle of the goal could be from the receiver
+        // pos.
+        Angle goal_angle = acuteAngle(field.enemyGoalpostNeg(), pass.receiverPoint(),
+                                      field.enemyGoalpostPos())
+                               .abs();
+        double net_percent_open = 0;
+        if (goal_angle > Angle::zero())
+        {
+            net_percent_open = open_angle_to_goal.toDegrees() / goal_angle.toDegrees();
+        }
+
+        // Create the shoot score by creating a sigmoid that goes to a large value as
+        // the section of net we're shooting on approaches 100% (ie. completely open)
+        double shot_openness_score = sigmoid(net_percent_open, 0.45, 0.95);
+
+        // Prefer angles where the robot does not have to turn much after receiving the
+        // pass to take the shot (or equivalently the shot deflection angle)
+        //
+        // Receiver robots on the friendly side, almost always, need to rotate a full 180
+        // degrees to shoot on net. So we relax that requirement for both receiver and
+        // ball locations on the friendly side
+        //
+        // TODO (#1987) This creates a very steep slope, find a better way to do this
+        if (pass.receiverPoint().x() < 0 || pass.passerPoint().x() < 0)
+        {
+            ideal_max_rotation_to_shoot_degrees = 180;
+        }
+        Angle rotation_to_shot_target_after_pass = pass.receiverOrientation().minDiff(
+            (shot_target - pass.receiverPoint()).orientation());
+        double required_rotation_for_shot_score =
+            1 - sigmoid(rotation_to_shot_target_after_pass.abs().toDegrees(),
+                        ideal_max_rotation_to_shoot_degrees, 4);
+
+        return shot_openness_score * required_rotation_for_shot_score;
+    }
+
+    /**
+     * Calculates the probability of a friendly robot receiving the given pass. See
+     * ratePassFriendlyCapability for details.
+     *
+     * @param friendly_team The team of robots that might receive the given pass
+     * @param pass The pass we want a robot to receive
+     *
+     * @return the probability of a friendly robot receiving the given pass
+     */
+    double friendlyCapability(const Team& friendly_team, const Pass& pass)
+    {
+        // We need at least one robot to pass to
+        if (friendly_team.getAllRobots().empty())
+        {
+            return 0;
+        }
+
+        // Special case where pass speed is 0
+        if (pass.speed() == 0)
+        {
+            return 0;
+        }
+
+        // Get the robot that is closest to where the pass would be received. We only
+        // keep a reference to it, as copying a Robot allocates memory.
+        const Robot* best_receiver_ptr = &friendly_team.getAllRobots()[0];
+        for (const Robot& robot : friendly_team.getAllRobots())
+        {
+            double distance = (robot.position() - pass.receiverPoint()).length();
+            double curr_best_distance =
+                (best_receiver_ptr->position() - pass.receiverPoint()).length();
+            if (distance < curr_best_distance)
+            {
+                best_receiver_ptr = &robot;
+            }
+        }
+        const Robot& best_receiver = *best_receiver_ptr;
+
+        // Figure out what time the robot would have to receive the ball at
+        Duration ball_travel_time = Duration::fromSeconds(
+            (pass.receiverPoint() - pass.passerPoint()).length() / pass.speed());
+        Timestamp receive_time = best_receiver.timestamp() + ball_travel_time;
+
+        // Figure out how long it would take our robot to get there
+        Duration min_robot_travel_time = getTimeToPositionForRobot(
+            best_receiver.position(), pass.receiverPoint(),
+            best_receiver.robotConstants().robot_max_speed_m_per_s,
+            best_receiver.robotConstants().robot_max_acceleration_m_per_s_2);
+        Timestamp earliest_time_to_receive_point =
+            best_receiver.timestamp() + min_robot_travel_time;
+
+        // Figure out what angle the robot would have to be at to receive the ball
+        Angle receive_angle =
+            (pass.passerPoint() - best_receiver.position()).orientation();
+        Duration time_to_receive_angle = getTimeToOrientationForRobot(
+            best_receiver.orientation(), receive_angle,
+            best_receiver.robotConstants().robot_max_ang_speed_rad_per_s,
+            best_receiver.robotConstants().robot_max_ang_acceleration_rad_per_s_2);
+        Timestamp earliest_time_to_receive_angle =
+            best_receiver.timestamp() + time_to_receive_angle;
+
+        // Figure out if rotation or moving will take us longer
+        Timestamp latest_time_to_reciever_state =
+            std::max(earliest_time_to_receive_angle, earliest_time_to_receive_point);
+
+        // Create a sigmoid that goes to 0 as the time required to get to the reception
+        // point exceeds the time we would need to get there by
+        double sigmoid_width                  = 0.4;
+        double time_to_receiver_state_slack_s = 0.25;
+
+        return sigmoid(
+            receive_time.toSeconds(),
+            latest_time_to_reciever_state.toSeconds() + time_to_receiver_state_slack_s,
+            sigmoid_width);
+    }
+}  // namespace
+
 double ratePass(const World& world, const Pass& pass, const Rectangle& zone,
                 std::shared_ptr<const PassingConfig> passing_config)
 {
-    double static_pass_quality =
-        getStaticPositionQuality(world.field(), pass.receiverPoint(), passing_config);
+    return ratePass(PassRatingContext(world, passing_config), pass, zone);
+}
+
+double ratePass(const PassRatingContext& context, const Pass& pass, const Rectangle& zone)
+{
+    const World& world = context.world();
+
+    double static_pass_quality = staticPositionQuality(
+        world.field(), context.staticPositionQualityRegion(),
+        context.staticFieldPositionQualityFriendlyGoalDistanceWeight(),
+        pass.receiverPoint());
 
-    double friendly_pass_rating =
-        ratePassFriendlyCapability(world.friendlyTeam(), pass, passing_config);
+    double friendly_pass_rating = friendlyCapability(world.friendlyTeam(), pass);
 
-    double enemy_pass_rating = ratePassEnemyRisk(
-        world.enemyTeam(), pass,
-        Duration::fromSeconds(passing_config->getEnemyReactionTime()->value()),
-        passing_config->getEnemyProximityImportance()->value());
+    double enemy_pass_rating =
+        ratePassEnemyRisk(context.enemyTeamSnapshot(), pass, context.enemyReactionTime(),
+                          context.enemyProximityImportance());
 
-    double shoot_pass_rating =
-        ratePassShootScore(world.field(), world.enemyTeam(), pass, passing_config);
+    double shoot_pass_rating = shootScore(world.field(), world.enemyTeam(), pass,
+                                          context.idealMaxRotationToShootDegrees());
 
     double in_region_quality = rectangleSigmoid(zone, pass.receiverPoint(), 0.2);
 
     // Place strict limits on the ball speed
-    double min_pass_speed     = passing_config->getMinPassSpeedMPerS()->value();
-    double max_pass_speed     = passing_config->getMaxPassSpeedMPerS()->value();
+    double min_pass_speed     = context.minPassSpeedMPerS();
+    double max_pass_speed     = context.maxPassSpeedMPerS();
     double pass_speed_quality = sigmoid(pass.speed(), min_pass_speed, 0.2) *
                                 (1 - sigmoid(pass.speed(), max_pass_speed, 0.2));
 
@@ -43,40 +398,47 @@ double ratePass(const World& world, const Pass& pass, const Rectangle& zone,
 double rateZone(const Field& field, const Team& enemy_team, const Rectangle& zone,
                 const Point& ball_position,
                 std::shared_ptr<const PassingConfig> passing_config)
+{
+    return rateZone(field, enemy_team, zone, ball_position, passing_config->snapshot());
+}
+
+double rateZone(const Field& field, const Team& enemy_team, const Rectangle& zone,
+                const Point& ball_position, const PassingConfig::Snapshot& passing_config)
 {
     // TODO (#2021) improve and implement tests
     // Zones with their centers in bad positions are not good
-    double static_pass_quality =
-        getStaticPositionQuality(field, zone.centre(), passing_config);
+    double static_pass_quality = staticPositionQuality(
+        field, getStaticPositionQualityRegion(field, passing_config),
+        passing_config.static_field_position_quality_friendly_goal_distance_weight,
+        zone.centre());
 
     // Rate zones that are up the field higher to encourage progress up the field
     double pass_up_field_rating = zone.centre().x() / field.xLength();
 
-    auto enemy_reaction_time =
-        Duration::fromSeconds(passing_config->getEnemyReactionTime()->value());
-    double enemy_proximity_importance =
-        passing_config->getEnemyProximityImportance()->value();
+    auto enemy_reaction_time = Duration::fromSeconds(passing_config.enemy_reaction_time);
+    double enemy_proximity_importance = passing_config.enemy_proximity_importance;
+    double max_pass_speed_m_per_s     = passing_config.max_pass_speed_m_per_s;
 
+    EnemyTeamSnapshot enemy_team_snapshot(enemy_team);
     double enemy_risk_rating =
-        (ratePassEnemyRisk(enemy_team,
-                           Pass(ball_position, zone.negXNegYCorner(),
-                                passing_config->getMaxPassSpeedMPerS()->value()),
-                           enemy_reaction_time, enemy_proximity_importance) +
-         ratePassEnemyRisk(enemy_team,
-                           Pass(ball_position, zone.negXPosYCorner(),
-                                passing_config->getMaxPassSpeedMPerS()->value()),
-                           enemy_reaction_time, enemy_proximity_importance) +
-         ratePassEnemyRisk(enemy_team,
-                           Pass(ball_position, zone.posXNegYCorner(),
-                                passing_config->getMaxPassSpeedMPerS()->value()),
-                           enemy_reaction_time, enemy_proximity_importance) +
-         ratePassEnemyRisk(enemy_team,
-                           Pass(ball_position, zone.posXPosYCorner(),
-                                passing_config->getMaxPassSpeedMPerS()->value()),
-                           enemy_reaction_time, enemy_proximity_importance) +
-         ratePassEnemyRisk(enemy_team,
-                           Pass(ball_position, zone.centre(),
-                                passing_config->getMaxPassSpeedMPerS()->value()),
+        (ratePassEnemyRisk(
+             enemy_team_snapshot,
+             Pass(ball_position, zone.negXNegYCorner(), max_pass_speed_m_per_s),
+             enemy_reaction_time, enemy_proximity_importance) +
+         ratePassEnemyRisk(
+             enemy_team_snapshot,
+             Pass(ball_position, zone.negXPosYCorner(), max_pass_speed_m_per_s),
+             enemy_reaction_time, enemy_proximity_importance) +
+         ratePassEnemyRisk(
+             enemy_team_snapshot,
+             Pass(ball_position, zone.posXNegYCorner(), max_pass_speed_m_per_s),
+             enemy_reaction_time, enemy_proximity_importance) +
+         ratePassEnemyRisk(
+             enemy_team_snapshot,
+             Pass(ball_position, zone.posXPosYCorner(), max_pass_speed_m_per_s),
+             enemy_reaction_time, enemy_proximity_importance) +
+         ratePassEnemyRisk(enemy_team_snapshot,
+                           Pass(ball_position, zone.centre(), max_pass_speed_m_per_s),
                            enemy_reaction_time, enemy_proximity_importance)) /
         5.0;
 
@@ -86,64 +448,26 @@ double rateZone(const Field& field, const Team& enemy_team, const Rectangle& zon
 double ratePassShootScore(const Field& field, const Team& enemy_team, const Pass& pass,
                           std::shared_ptr<const PassingConfig> passing_config)
 {
-    double ideal_max_rotation_to_shoot_degrees =
-        passing_config->getIdealMaxRotationToShootDegrees()->value();
-
-    // Figure out the range of angles for which we have an open shot to the goal after
-    // receiving the pass
-    auto shot_opt = calcBestShotOnGoal(
-        Segment(field.enemyGoalpostPos(), field.enemyGoalpostNeg()), pass.receiverPoint(),
-        enemy_team.getAllRobots(), TeamType::ENEMY);
-
-    Angle open_angle_to_goal = Angle::zero();
-    Point shot_target        = field.enemyGoalCenter();
-    if (shot_opt && shot_opt.value().getOpenAngle().abs() > Angle::fromDegrees(0))
-    {
-        open_angle_to_goal = shot_opt.value().getOpenAngle();
-    }
-
-    // Figure out what the maximum open angle of the goal could be from the receiver pos.
-    Angle goal_angle = acuteAngle(field.enemyGoalpostNeg(), pass.receiverPoint(),
-                                  field.enemyGoalpostPos())
-                           .abs();
-    double net_percent_open = 0;
-    if (goal_angle > Angle::zero())
-    {
-        net_percent_open = open_angle_to_goal.toDegrees() / goal_angle.toDegrees();
-    }
-
-    // Create the shoot score by creating a sigmoid that goes to a large value as
-    // the section of net we're shooting on approaches 100% (ie. completely open)
-    double shot_openness_score = sigmoid(net_percent_open, 0.45, 0.95);
-
-    // Prefer angles where the robot does not have to turn much after receiving the
-    // pass to take the shot (or equivalently the shot deflection angle)
-    //
-    // Receiver robots on the friendly side, almost always, need to rotate a full 180
-    // degrees to shoot on net. So we relax that requirement for both receiver and ball
-    // locations on the friendly side
-    //
-    // TODO (#1987) This creates a very steep slope, find a better way to do this
-    if (pass.receiverPoint().x() < 0 || pass.passerPoint().x() < 0)
-    {
-        ideal_max_rotation_to_shoot_degrees = 180;
-    }
-    Angle rotation_to_shot_target_after_pass = pass.receiverOrientation().minDiff(
-        (shot_target - pass.receiverPoint()).orientation());
-    double required_rotation_for_shot_score =
-        1 - sigmoid(rotation_to_shot_target_after_pass.abs().toDegrees(),
-                    ideal_max_rotation_to_shoot_degrees, 4);
-
-    return shot_openness_score * required_rotation_for_shot_score;
+    return shootScore(field, enemy_team, pass,
+                      passing_config->getIdealMaxRotationToShootDegrees()->value());
 }
 
 double ratePassEnemyRisk(const Team& enemy_team, const Pass& pass,
                          const Duration& enemy_reaction_time,
                          double enemy_proximity_importance)
 {
-    double enemy_receiver_proximity_risk = calculateProximityRisk(
-        pass.receiverPoint(), enemy_team, enemy_proximity_importance);
-    double intercept_risk = calculateInterceptRisk(enemy_team, pass, enemy_reaction_time);
+    return ratePassEnemyRisk(EnemyTeamSnapshot(enemy_team), pass, enemy_reaction_time,
+                             enemy_proximity_importance);
+}
+
+double ratePassEnemyRisk(const EnemyTeamSnapshot& enemy_team, const Pass& pass,
+                         const Duration& enemy_reaction_time,
+                         double enemy_proximity_importance)
+{
+    EnemyPassRisks risks = calculateEnemyPassRisks(enemy_team, pass, enemy_reaction_time);
+    double enemy_receiver_proximity_risk =
+        proximityRiskFromEnemyPassRisks(enemy_team, risks, enemy_proximity_importance);
+    double intercept_risk = interceptRiskFromEnemyPassRisks(enemy_team, risks);
 
     // We want to rate a pass more highly if it is lower risk, so subtract from 1
     return 1 - std::max(intercept_risk, enemy_receiver_proximity_risk);
@@ -152,18 +476,18 @@ double ratePassEnemyRisk(const Team& enemy_team, const Pass& pass,
 double calculateInterceptRisk(const Team& enemy_team, const Pass& pass,
                               const Duration& enemy_reaction_time)
 {
-    // Return the highest risk for all the enemy robots, if there are any
-    const std::vector<Robot>& enemy_robots = enemy_team.getAllRobots();
-    if (enemy_robots.empty())
-    {
-        return 0;
-    }
-    std::vector<double> enemy_intercept_risks(enemy_robots.size());
-    std::transform(enemy_robots.begin(), enemy_robots.end(),
-                   enemy_intercept_risks.begin(), [&](Robot robot) {
-                       return calculateInterceptRisk(robot, pass, enemy_reaction_time);
-                   });
-    return *std::max_element(enemy_intercept_risks.begin(), enemy_intercept_risks.end());
+    return calculateInterceptRisk(EnemyTeamSnapshot(enemy_team), pass,
+                                  enemy_reaction_time);
+}
+
+double calculateInterceptRisk(const EnemyTeamSnapshot& enemy_team, const Pass& pass,
+                              const Duration& enemy_reaction_time)
+{
+    // Return the highest risk for all the enemy robots, if there are any. The risk
+    // decreases as the time difference increases, so the highest risk comes from
+    // the smallest time difference.
+    return interceptRiskFromEnemyPassRisks(
+        enemy_team, calculateEnemyPassRisks(enemy_team, pass, enemy_reaction_time));
 }
 
 double calculateInterceptRisk(const Robot& enemy_robot, const Pass& pass,
@@ -223,124 +547,64 @@ double calculateInterceptRisk(const Robot& enemy_robot, const Pass& pass,
     return 1 - sigmoid(min_time_diff, 0, 1);
 }
 
-double ratePassFriendlyCapability(Team friendly_team, const Pass& pass,
+double ratePassFriendlyCapability(const Team& friendly_team, const Pass& pass,
                                   std::shared_ptr<const PassingConfig> passing_config)
 {
-    // We need at least one robot to pass to
-    if (friendly_team.getAllRobots().empty())
-    {
-        return 0;
-    }
-
-    // Special case where pass speed is 0
-    if (pass.speed() == 0)
-    {
-        return 0;
-    }
-
-    // Get the robot that is closest to where the pass would be received
-    Robot best_receiver = friendly_team.getAllRobots()[0];
-    for (const Robot& robot : friendly_team.getAllRobots())
-    {
-        double distance = (robot.position() - pass.receiverPoint()).length();
-        double curr_best_distance =
-            (best_receiver.position() - pass.receiverPoint()).length();
-        if (distance < curr_best_distance)
-        {
-            best_receiver = robot;
-        }
-    }
-
-    // Figure out what time the robot would have to receive the ball at
-    Duration ball_travel_time = Duration::fromSeconds(
-        (pass.receiverPoint() - pass.passerPoint()).length() / pass.speed());
-    Timestamp receive_time = best_receiver.timestamp() + ball_travel_time;
-
-    // Figure out how long it would take our robot to get there
-    Duration min_robot_travel_time = getTimeToPositionForRobot(
-        best_receiver.position(), pass.receiverPoint(),
-        best_receiver.robotConstants().robot_max_speed_m_per_s,
-        best_receiver.robotConstants().robot_max_acceleration_m_per_s_2);
-    Timestamp earliest_time_to_receive_point =
-        best_receiver.timestamp() + min_robot_travel_time;
-
-    // Figure out what angle the robot would have to be at to receive the ball
-    Angle receive_angle = (pass.passerPoint() - best_receiver.position()).orientation();
-    Duration time_to_receive_angle = getTimeToOrientationForRobot(
-        best_receiver.orientation(), receive_angle,
-        best_receiver.robotConstants().robot_max_ang_speed_rad_per_s,
-        best_receiver.robotConstants().robot_max_ang_acceleration_rad_per_s_2);
-    Timestamp earliest_time_to_receive_angle =
-        best_receiver.timestamp() + time_to_receive_angle;
-
-    // Figure out if rotation or moving will take us longer
-    Timestamp latest_time_to_reciever_state =
-        std::max(earliest_time_to_receive_angle, earliest_time_to_receive_point);
-
-    // Create a sigmoid that goes to 0 as the time required to get to the reception
-    // point exceeds the time we would need to get there by
-    double sigmoid_width                  = 0.4;
-    double time_to_receiver_state_slack_s = 0.25;
-
-    return sigmoid(
-        receive_time.toSeconds(),
-        latest_time_to_reciever_state.toSeconds() + time_to_receiver_state_slack_s,
-        sigmoid_width);
+    return friendlyCapability(friendly_team, pass);
 }
 
 double getStaticPositionQuality(const Field& field, const Point& position,
                                 std::shared_ptr<const PassingConfig> passing_config)
 {
-    // This constant is used to determine how steep the sigmoid slopes below are
-    static const double sig_width = 0.1;
+    return staticPositionQuality(
+        field, getStaticPositionQualityRegion(field, passing_config),
+        passing_config->getStaticFieldPositionQualityFriendlyGoalDistanceWeight()
+            ->value(),
+        position);
+}
 
+Rectangle getStaticPositionQualityRegion(
+    const Field& field, std::shared_ptr<const PassingConfig> passing_config)
+{
+    return getStaticPositionQualityRegion(field, passing_config->snapshot());
+}
+
+Rectangle getStaticPositionQualityRegion(const Field& field,
+                                         const PassingConfig::Snapshot& passing_config)
+{
     // The offset from the sides of the field for the center of the sigmoid functions
-    double x_offset = passing_config->getStaticFieldPositionQualityXOffset()->value();
-    double y_offset = passing_config->getStaticFieldPositionQualityYOffset()->value();
-    double friendly_goal_weight =
-        passing_config->getStaticFieldPositionQualityFriendlyGoalDistanceWeight()
-            ->value();
+    double x_offset = passing_config.static_field_position_quality_x_offset;
+    double y_offset = passing_config.static_field_position_quality_y_offset;
 
     // Make a slightly smaller field, and positive weight values in this reduced field
     double half_field_length = field.xLength() / 2;
     double half_field_width  = field.yLength() / 2;
-    Rectangle reduced_size_field(
-        Point(-half_field_length + x_offset, -half_field_width + y_offset),
-        Point(half_field_length - x_offset, half_field_width - y_offset));
-    double on_field_quality = rectangleSigmoid(reduced_size_field, position, sig_width);
-
-    // Add a negative weight for positions closer to our goal
-    Vector vec_to_friendly_goal = Vector(field.friendlyGoalCenter().x() - position.x(),
-                                         field.friendlyGoalCenter().y() - position.y());
-    double distance_to_friendly_goal = vec_to_friendly_goal.length();
-    double near_friendly_goal_quality =
-        (1 -
-         std::exp(-friendly_goal_weight * (std::pow(5, -2 + distance_to_friendly_goal))));
-
-    // Add a strong negative weight for positions within the enemy defense area, as we
-    // cannot pass there
-    double in_enemy_defense_area_quality =
-        1 - rectangleSigmoid(field.enemyDefenseArea(), position, sig_width);
-
-    return on_field_quality * near_friendly_goal_quality * in_enemy_defense_area_quality;
+    return Rectangle(Point(-half_field_length + x_offset, -half_field_width + y_offset),
+                     Point(half_field_length - x_offset, half_field_width - y_offset));
 }
 
 double calculateProximityRisk(const Point& point, const Team& enemy_team,
                               double enemy_proximity_importance)
+{
+    return calculateProximityRisk(point, EnemyTeamSnapshot(enemy_team),
+                                  enemy_proximity_importance);
+}
+
+double calculateProximityRisk(const Point& point, const EnemyTeamSnapshot& enemy_team,
+                              double enemy_proximity_importance)
 {
     // Calculate a risk score based on the distance of the enemy robots from the receive
     // point, based on an exponential function of the distance of each robot from the
     // receiver point
-    auto enemy_robots                 = enemy_team.getAllRobots();
-    double point_enemy_proximity_risk = 1;
-    for (const Robot& enemy : enemy_team.getAllRobots())
-    {
-        double dist = (point - enemy.position()).length();
-        point_enemy_proximity_risk *= enemy_proximity_importance * std::exp(-dist * dist);
-    }
-    if (enemy_robots.empty())
+    const double* positions_x = enemy_team.positionsX();
+    const double* positions_y = enemy_team.positionsY();
+
+    EnemyPassRisks risks = {std::numeric_limits<double>::max(), 0};
+    for (size_t i = 0; i < enemy_team.size(); i++)
     {
-        point_enemy_proximity_risk = 0;
+        const double dx = point.x() - positions_x[i];
+        const double dy = point.y() - positions_y[i];
+        risks.sum_squared_dist_to_receiver += dx * dx + dy * dy;
     }
-    return point_enemy_proximity_risk;
+    return proximityRiskFromEnemyPassRisks(enemy_team, risks, enemy_proximity_importance);
 }
@@ -3,7 +3,9 @@
 #include <functional>
 
 #include "shared/parameter/cpp_dynamic_parameters.h"
+#include "software/ai/passing/enemy_team_snapshot.h"
 #include "software/ai/passing/pass.h"
+#include "software/ai/passing/pass_rating_context.h"
 #include "software/math/math_functions.h"
 #include "software/util/make_enum/make_enum.h"
 #include "software/world/field.h"
@@ -24,6 +26,23 @@
 double ratePass(const World& world, const Pass& pass, const Rectangle& zone,
                 std::shared_ptr<const PassingConfig> passing_config);
 
+/**
+ * Calculate the quality of a given pass
+ *
+ * This is the same as the function above, but reuses a context created from the
+ * world, so that rating many passes on the same world does not allocate any memory
+ * or copy anything out of the world.
+ *
+ * @param context The context of the world in which to rate the pass
+ * @param pass The pass to rate
+ * @param zone The zone this pass is constrained to
+ *
+ * @return A value in [0,1] representing the quality of the pass, with 1 being an
+ *         ideal pass, and 0 being the worst pass possible
+ */
+double ratePass(const PassRatingContext& context, const Pass& pass,
+                const Rectangle& zone);
+
 /**
  * Calculate the quality of a given zone
  *
@@ -40,6 +59,25 @@ double rateZone(const Field& field, const Team& enemy_team, const Rectangle& zon
                 const Point& ball_position,
                 std::shared_ptr<const PassingConfig> passing_config);
 
+/**
+ * Calculate the quality of a given zone
+ *
+ * This is the same as the function above, but reads the passing config from a
+ * snapshot, so that rating many zones does not read the config over and over again.
+ *
+ * @param field The field on which to rate the zone
+ * @param enemy_team The enemy team
+ * @param zone The zone to rate
+ * @param ball_position The position of the ball
+ * @param passing_config A snapshot of the passing config used for tuning
+ *
+ * @return A value in [0,1] representing the quality of the zone, with 1 being a
+ *         great zone to send a cherry picker to, and 0 being a zone to avoid.
+ */
+double rateZone(const Field& field, const Team& enemy_team, const Rectangle& zone,
+                const Point& ball_position,
+                const PassingConfig::Snapshot& passing_config);
+
 /**
  * Rate pass based on the probability of scoring once we receive the pass
  *
@@ -70,6 +108,27 @@ double ratePassEnemyRisk(const Team& enemy_team, const Pass& pass,
                          const Duration& enemy_reaction_time,
                          double enemy_proximity_importance);
 
+/**
+ * Calculates the risk of an enemy robot interfering with a given pass
+ *
+ * Both the intercept risk and the receiver proximity risk are calculated for every
+ * enemy in a single pass over the snapshot.
+ *
+ * @param enemy_team A snapshot of the team of enemy robots
+ * @param pass The pass to rate
+ * @param enemy_reaction_time How long we think the enemy will take to react to the
+ *                            pass
+ * @param enemy_proximity_importance How heavily we weigh an enemy robot being near
+ *                                   the pass receiver
+ * @return A value in [0,1] indicating the quality of the pass based on the risk
+ *         that an enemy interfere with it, with 1 indicating the pass is guaranteed
+ *         to run without interference, and 0 indicating that the pass will certainly
+ *         be interfered with (and so is very poor)
+ */
+double ratePassEnemyRisk(const EnemyTeamSnapshot& enemy_team, const Pass& pass,
+                         const Duration& enemy_reaction_time,
+                         double enemy_proximity_importance);
+
 /**
  * Calculates the likelihood that the given pass will be intercepted
  *
@@ -84,6 +143,22 @@ double ratePassEnemyRisk(const Team& enemy_team, const Pass& pass,
 double calculateInterceptRisk(const Team& enemy_team, const Pass& pass,
                               const Duration& enemy_reaction_time);
 
+/**
+ * Calculates the likelihood that the given pass will be intercepted
+ *
+ * @param enemy_team A snapshot of the team of robots that we're worried about
+ *                   intercepting our pass
+ * @param pass The pass we want to get the intercept probability for
+ * @param enemy_reaction_time How long we think the enemy will take to react to the
+ *                            pass
+ * @return A value in [0,1] indicating the probability that the given pass will be
+ *         intercepted by a robot on the given team, with 1 indicating the pass is
+ *         guaranteed to be intercepted, and 0 indicating it's impossible for the
+ *         pass to be intercepted
+ */
+double calculateInterceptRisk(const EnemyTeamSnapshot& enemy_team, const Pass& pass,
+                              const Duration& enemy_reaction_time);
+
 /**
  * Calculates the likelihood that the given pass will be intercepted by a given robot
  *
@@ -113,7 +188,7 @@ double calculateInterceptRisk(const Robot& enemy_robot, const Pass& pass,
  *         friendly team to receive the given pass, with 1 being very likely, 0
  *         being impossible
  */
-double ratePassFriendlyCapability(Team friendly_team, const Pass& pass,
+double ratePassFriendlyCapability(const Team& friendly_team, const Pass& pass,
                                   std::shared_ptr<const PassingConfig> passing_config);
 
 /**
@@ -133,6 +208,30 @@ double ratePassFriendlyCapability(Team friendly_team, const Pass& pass,
 double getStaticPositionQuality(const Field& field, const Point& position,
                                 std::shared_ptr<const PassingConfig> passing_config);
 
+/**
+ * Gets the region of the given field that gets a high static position quality. This
+ * is the field shrunk by the static field position quality offsets.
+ *
+ * @param field The field on which to calculate the static position quality
+ * @param passing_config The passing config used for tuning
+ *
+ * @return the region of the field that gets a high static position quality
+ */
+Rectangle getStaticPositionQualityRegion(
+    const Field& field, std::shared_ptr<const PassingConfig> passing_config);
+
+/**
+ * Gets the region of the given field that gets a high static position quality. This
+ * is the field shrunk by the static field position quality offsets.
+ *
+ * @param field The field on which to calculate the static position quality
+ * @param passing_config A snapshot of the passing config used for tuning
+ *
+ * @return the region of the field that gets a high static position quality
+ */
+Rectangle getStaticPositionQualityRegion(const Field& field,
+                                         const PassingConfig::Snapshot& passing_config);
+
 /**
  * Returns a function that increases as the point approaches enemy robots.
  *
@@ -143,3 +242,14 @@ double getStaticPositionQuality(const Field& field, const Point& position,
  */
 double calculateProximityRisk(const Point& point, const Team& enemy_team,
                               double enemy_proximity_importance);
+
+/**
+ * Returns a function that increases as the point approaches enemy robots.
+ *
+ * @param point a Point
+ * @param enemy_team a snapshot of the enemy team
+ * @param enemy_proximity_importance essentially a scaling factor for the result
+ * @return a measure of how close the point is to one or more enemy robots
+ */
+double calculateProximityRisk(const Point& point, const EnemyTeamSnapshot& enemy_team,
+                              double enemy_proximity_importance);
@@ -0,0 +1,143 @@
+#include <gtest/gtest.h>
+
+#include <cstdlib>
+#include <new>
+
+#include "software/ai/passing/cost_function.h"
+#include "software/test_util/test_util.h"
+
+// These tests replace the global allocation functions to count the heap allocations
+// made by the thread running the test, so they live in their own test binary
+
+namespace
+{
+    // Only allocations made by this thread while counting is enabled are counted,
+    // so allocations made by other threads (ex. the logger) don't affect the tests
+    thread_local bool count_allocations = false;
+    thread_local size_t num_allocations = 0;
+
+    /**
+     * Counts the heap allocations made by the current thread while it is in scope
+     */
+    class ScopedAllocationCounter
+    {
+       public:
+        ScopedAllocationCounter()
+        {
+            num_allocations   = 0;
+            count_allocations = true;
+        }
+
+        ~ScopedAllocationCounter()
+        {
+            count_allocations = false;
+        }
+
+        /**
+         * Gets the number of heap allocations made since this counter was created
+         *
+         * @return the number of heap allocations made since this counter was created
+         */
+        size_t numAllocations() const
+        {
+            return num_allocations;
+        }
+    };
+}  // namespace
+
+void* operator new(std::size_t size)
+{
+    if (count_allocations)
+    {
+        num_allocations++;
+    }
+    if (void* ptr = std::malloc(size == 0 ? 1 : size))
+    {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t size) noexcept
+{
+    std::free(ptr);
+}
+
+class CostFunctionAllocationTest : public testing::Test
+{
+   protected:
+    CostFunctionAllocationTest()
+        : passing_config(std::make_shared<const PassingConfig>()),
+          world(::TestUtil::createBlankTestingWorldDivB()),
+          entire_field(world.field().fieldLines())
+    {
+        world = ::TestUtil::setFriendlyRobotPositions(
+            world,
+            {Point(-4, 0), Point(-3, 1), Point(-3, -1), Point(-1, 2), Point(-1, -2),
+             Point(1, 0)},
+            Timestamp::fromSeconds(0));
+        world = ::TestUtil::setEnemyRobotPositions(
+            world,
+            {Point(4, 0), Point(3, 1), Point(3, -1), Point(1, 2), Point(1, -2),
+             Point(0.5, 0.5)},
+            Timestamp::fromSeconds(0));
+        world =
+            ::TestUtil::setBallPosition(world, Point(1.1, 0), Timestamp::fromSeconds(0));
+    }
+
+    std::shared_ptr<const PassingConfig> passing_config;
+    World world;
+    Rectangle entire_field;
+};
+
+TEST_F(CostFunctionAllocationTest, rate_pass_with_context_does_not_allocate)
+{
+    PassRatingContext context(world, passing_config);
+    std::vector<Pass> passes = {
+        Pass(world.ball().position(), Point(3, 2), 4),
+        Pass(world.ball().position(), Point(-2, -1), 3),
+        Pass(world.ball().position(), Point(4, 0.2), 5.5),
+        Pass(world.ball().position(), Point(0, 0), 0),
+    };
+
+    // Warm up, so that anything initialized on first use is not counted
+    for (const Pass& pass : passes)
+    {
+        ratePass(context, pass, entire_field);
+    }
+
+    ScopedAllocationCounter allocation_counter;
+    double total_rating = 0;
+    for (const Pass& pass : passes)
+    {
+        total_rating += ratePass(context, pass, entire_field);
+    }
+
+    EXPECT_EQ(0, allocation_counter.numAllocations());
+    EXPECT_GT(total_rating, 0);
+}
+
+TEST_F(CostFunctionAllocationTest, rate_pass_with_context_gives_same_rating_as_world)
+{
+    PassRatingContext context(world, passing_config);
+    Pass pass(world.ball().position(), Point(3, 2), 4);
+
+    EXPECT_DOUBLE_EQ(ratePass(world, pass, entire_field, passing_config),
+                     ratePass(context, pass, entire_field));
+}
+
+TEST_F(CostFunctionAllocationTest, rate_pass_friendly_capability_does_not_allocate)
+{
+    Pass pass(world.ball().position(), Point(-1, 1.5), 3);
+    ratePassFriendlyCapability(world.friendlyTeam(), pass, passing_config);
+
+    ScopedAllocationCounter allocation_counter;
+    ratePassFriendlyCapability(world.friendlyTeam(), pass, passing_config);
+
+    EXPECT_EQ(0, allocation_counter.numAllocations());
+}
@@ -115,6 +115,91 @@ TEST_F(PassingEvaluationTest, DISABLED_ratePass_speed_test)
               << std::endl;
 }
 
+// This test is disabled to speed up CI, it can be enabled by removing "DISABLED_" from
+// the test name
+TEST_F(PassingEvaluationTest, DISABLED_ratePassEnemyRisk_enemy_team_snapshot_speed_test)
+{
+    // This test does not assert anything. Rather, it compares the time taken to
+    // evaluate the enemy risk of a pass one robot at a time against evaluating it
+    // on a packed snapshot of the enemy team
+
+    const int num_passes_to_gen = 100000;
+
+    Team enemy_team(Duration::fromSeconds(10));
+    std::mt19937 random_num_gen;
+    std::uniform_real_distribution x_distribution(-4.5, 4.5);
+    std::uniform_real_distribution y_distribution(-3.0, 3.0);
+    std::vector<Robot> enemy_robots;
+    for (unsigned int id = 0; id < 11; id++)
+    {
+        enemy_robots.emplace_back(
+            id, Point(x_distribution(random_num_gen), y_distribution(random_num_gen)),
+            Vector(0, 0), Angle::zero(), AngularVelocity::zero(),
+            Timestamp::fromSeconds(0));
+    }
+    enemy_team.updateRobots(enemy_robots);
+
+    std::vector<Pass> passes;
+    for (int i = 0; i < num_passes_to_gen; i++)
+    {
+        passes.emplace_back(
+            Point(x_distribution(random_num_gen), y_distribution(random_num_gen)),
+            Point(x_distribution(random_num_gen), y_distribution(random_num_gen)),
+            avg_desired_pass_speed);
+    }
+
+    Duration enemy_reaction_time =
+        Duration::fromSeconds(passing_config->getEnemyReactionTime()->value());
+    double enemy_proximity_importance =
+        passing_config->getEnemyProximityImportance()->value();
+
+    // Evaluate each robot separately, copying the robots like the cost function
+    // did before the enemy team snapshot was introduced
+    double per_robot_total = 0;
+    auto start_time        = std::chrono::system_clock::now();
+    for (const Pass& pass : passes)
+    {
+        std::vector<double> enemy_intercept_risks(enemy_team.getAllRobots().size());
+        std::transform(enemy_team.getAllRobots().begin(), enemy_team.getAllRobots().end(),
+                       enemy_intercept_risks.begin(), [&](Robot robot) {
+                           return calculateInterceptRisk(robot, pass,
+                                                         enemy_reaction_time);
+                       });
+        double proximity_risk = 1;
+        for (const Robot& enemy : enemy_team.getAllRobots())
+        {
+            double dist = (pass.receiverPoint() - enemy.position()).length();
+            proximity_risk *= enemy_proximity_importance * std::exp(-dist * dist);
+        }
+        per_robot_total += 1 - std::max(*std::max_element(enemy_intercept_risks.begin(),
+                                                          enemy_intercept_risks.end()),
+                                        proximity_risk);
+    }
+    double per_robot_duration_ms = ::TestUtil::millisecondsSince(start_time);
+
+    double snapshot_total = 0;
+    start_time            = std::chrono::system_clock::now();
+    EnemyTeamSnapshot enemy_team_snapshot(enemy_team);
+    for (const Pass& pass : passes)
+    {
+        snapshot_total += ratePassEnemyRisk(
+            enemy_team_snapshot, pass, enemy_reaction_time, enemy_proximity_importance);
+    }
+    double snapshot_duration_ms = ::TestUtil::millisecondsSince(start_time);
+
+    std::cout << "Per robot: took " << per_robot_duration_ms
+              << "ms to run, average time of "
+              << per_robot_duration_ms / static_cast<double>(num_passes_to_gen) << "ms"
+              << std::endl;
+    std::cout << "Enemy team snapshot: took " << snapshot_duration_ms
+              << "ms to run, average time of "
+              << snapshot_duration_ms / static_cast<double>(num_passes_to_gen) << "ms"
+              << std::endl;
+    std::cout << "Average difference in rating: "
+              << std::abs(per_robot_total - snapshot_total) / num_passes_to_gen
+              << std::endl;
+}
+
 TEST_F(PassingEvaluationTest, ratePass_enemy_directly_on_pass_trajectory)
 {
     // A pass from halfway up the +y side of the field to the origin.
@@ -658,6 +743,55 @@ TEST_F(PassingEvaluationTest,
     EXPECT_GE(1, intercept_risk);
 }
 
+TEST_F(PassingEvaluationTest,
+       calculateInterceptRisk_for_team_snapshot_matches_highest_risk_robot)
+{
+    // The risk calculated on a snapshot of the whole team at once should match the
+    // highest risk of any of the robots calculated one at a time
+    std::mt19937 random_num_gen(7);
+    std::uniform_real_distribution x_distribution(-4.5, 4.5);
+    std::uniform_real_distribution y_distribution(-3.0, 3.0);
+    std::uniform_real_distribution speed_distribution(0.5, 6.0);
+
+    Duration enemy_reaction_time =
+        Duration::fromSeconds(passing_config->getEnemyReactionTime()->value());
+
+    for (int i = 0; i < 100; i++)
+    {
+        std::vector<Robot> enemy_robots;
+        for (unsigned int id = 0; id < 6; id++)
+        {
+            enemy_robots.emplace_back(
+                id, Point(x_distribution(random_num_gen), y_distribution(random_num_gen)),
+                Vector(0, 0), Angle::zero(), AngularVelocity::zero(),
+                Timestamp::fromSeconds(0));
+        }
+        Team enemy_team(enemy_robots, Duration::fromSeconds(10));
+        Pass pass(Point(x_distribution(random_num_gen), y_distribution(random_num_gen)),
+                  Point(x_distribution(random_num_gen), y_distribution(random_num_gen)),
+                  speed_distribution(random_num_gen));
+
+        double highest_robot_risk = 0;
+        double proximity_risk     = 1;
+        for (const Robot& robot : enemy_robots)
+        {
+            highest_robot_risk =
+                std::max(highest_robot_risk,
+                         calculateInterceptRisk(robot, pass, enemy_reaction_time));
+            double dist = (pass.receiverPoint() - robot.position()).length();
+            proximity_risk *= 0.5 * std::exp(-dist * dist);
+        }
+
+        EnemyTeamSnapshot enemy_team_snapshot(enemy_team);
+        EXPECT_NEAR(
+            highest_robot_risk,
+            calculateInterceptRisk(enemy_team_snapshot, pass, enemy_reaction_time), 1e-9);
+        EXPECT_NEAR(
+            proximity_risk,
+            calculateProximityRisk(pass.receiverPoint(), enemy_team_snapshot, 0.5), 1e-9);
+    }
+}
+
 TEST_F(PassingEvaluationTest, calculateInterceptRisk_for_robot_sitting_on_pass_trajectory)
 {
     // Test calculating the intercept risk for a robot that is located directly
@@ -0,0 +1,33 @@
+#include "software/ai/passing/enemy_team_snapshot.h"
+
+EnemyTeamSnapshot::EnemyTeamSnapshot(const Team& enemy_team)
+{
+    const std::vector<Robot>& enemy_robots = enemy_team.getAllRobots();
+    positions_x.reserve(enemy_robots.size());
+    positions_y.reserve(enemy_robots.size());
+    for (const Robot& robot : enemy_robots)
+    {
+        positions_x.emplace_back(robot.position().x());
+        positions_y.emplace_back(robot.position().y());
+    }
+}
+
+size_t EnemyTeamSnapshot::size() const
+{
+    return positions_x.size();
+}
+
+bool EnemyTeamSnapshot::empty() const
+{
+    return positions_x.empty();
+}
+
+const double* EnemyTeamSnapshot::positionsX() const
+{
+    return positions_x.data();
+}
+
+const double* EnemyTeamSnapshot::positionsY() const
+{
+    return positions_y.data();
+}
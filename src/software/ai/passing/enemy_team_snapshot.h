@@ -0,0 +1,65 @@
+#pragma once
+
+#include <vector>
+
+#include "software/geom/point.h"
+#include "software/world/team.h"
+
+/**
+ * A packed, read-only copy of the positions of the robots on the enemy team, for
+ * use in the passing cost functions.
+ *
+ * The positions are stored as a structure of arrays (one contiguous array per
+ * coordinate) rather than as a vector of Robots, so the cost functions can evaluate
+ * every enemy in a single tight loop that the compiler can vectorize, without
+ * copying any Robots or allocating any memory.
+ *
+ * A snapshot should be created once per World and then reused for every pass that
+ * is rated on that World.
+ */
+class EnemyTeamSnapshot
+{
+   public:
+    EnemyTeamSnapshot() = delete;
+
+    /**
+     * Creates a snapshot of the current positions of the robots on the given team
+     *
+     * @param enemy_team The team to take a snapshot of
+     */
+    explicit EnemyTeamSnapshot(const Team& enemy_team);
+
+    /**
+     * Gets the number of robots in this snapshot
+     *
+     * @return the number of robots in this snapshot
+     */
+    size_t size() const;
+
+    /**
+     * Returns true if there are no robots in this snapshot, false otherwise
+     *
+     * @return true if there are no robots in this snapshot, false otherwise
+     */
+    bool empty() const;
+
+    /**
+     * Gets the x coordinates of the robots in this snapshot, indexed the same as
+     * positionsY()
+     *
+     * @return the x coordinates of the robots in this snapshot
+     */
+    const double* positionsX() const;
+
+    /**
+     * Gets the y coordinates of the robots in this snapshot, indexed the same as
+     * positionsX()
+     *
+     * @return the y coordinates of the robots in this snapshot
+     */
+    const double* positionsY() const;
+
+   private:
+    std::vector<double> positions_x;
+    std::vector<double> positions_y;
+};
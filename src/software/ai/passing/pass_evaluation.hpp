@@ -159,14 +159,16 @@ std::vector<ZoneEnum> PassEvaluation<ZoneEnum>::rankZonesForReceiving(
 {
     std::vector<ZoneEnum> cherry_pick_zones = pitch_division_->getAllZoneIds();
 
-    std::sort(cherry_pick_zones.begin(), cherry_pick_zones.end(),
-              [this, &world, &pass_position](const ZoneEnum& z1, const ZoneEnum& z2) {
-                  return rateZone(world.field(), world.enemyTeam(),
-                                  pitch_division_->getZone(z1), pass_position,
-                                  passing_config_) >
-                         rateZone(world.field(), world.enemyTeam(),
-                                  pitch_division_->getZone(z2), pass_position,
-                                  passing_config_);
-              });
+    // Every comparison rates two zones, so the config is only read once for the sort
+    const PassingConfig::Snapshot passing_config = passing_config_->snapshot();
+    std::sort(
+        cherry_pick_zones.begin(), cherry_pick_zones.end(),
+        [this, &world, &pass_position, &passing_config](const ZoneEnum& z1,
+                                                        const ZoneEnum& z2) {
+            return rateZone(world.field(), world.enemyTeam(),
+                            pitch_division_->getZone(z1), pass_position, passing_config) >
+                   rateZone(world.field(), world.enemyTeam(),
+                            pitch_division_->getZone(z2), pass_position, passing_config);
+        });
     return cherry_pick_zones;
 }
@@ -4,6 +4,7 @@
 #include <chrono>
 #include <mutex>
 #include <numeric>
+#include <optional>
 #include <random>
 #include <thread>
 
@@ -11,9 +12,12 @@
 #include "software/ai/passing/cost_function.h"
 #include "software/ai/passing/pass.h"
 #include "software/ai/passing/pass_evaluation.hpp"
+#include "software/ai/passing/pass_rating_context.h"
 #include "software/ai/passing/pass_with_rating.h"
+#include "software/multithreading/thread_pool.h"
 #include "software/optimization/gradient_descent_optimizer.hpp"
 #include "software/time/timestamp.h"
+#include "software/util/latency_profiler/latency_profiler.h"
 #include "software/world/world.h"
 
 // The random seed to initialize the random number generator
@@ -38,7 +42,13 @@ class PassGenerator
      * The PassGenerator will use this pitch division to guide initial random samples
      * in each zone after the pitch has been divided.
      *
+     * The zones of the pitch division are evaluated independently, and are spread
+     * across `num_pass_generator_threads` threads (including the calling thread)
+     * from the given passing config. The generated passes do not depend on the number
+     * of threads used.
+     *
      * @param pitch_division The pitch division to use when looking for passes
+     * @param passing_config The passing config used for tuning
      */
     explicit PassGenerator(
         std::shared_ptr<const FieldPitchDivision<ZoneEnum>> pitch_division,
@@ -82,19 +92,27 @@ class PassGenerator
      * Randomly samples a receive point across every zone and assigns a random
      * speed to each pass.
      *
+     * The random samples are all drawn on the calling thread so that they are
+     * the same regardless of how many threads are used to rate them.
+     *
+     * @param world The world
+     * @param context The context to rate passes on the world with
      * @returns a mapping of the Zone Id to the sampled pass
      */
-    ZonePassMap<ZoneEnum> samplePasses(const World& world);
+    ZonePassMap<ZoneEnum> samplePasses(const World& world,
+                                       const PassRatingContext& context);
 
     /**
      * Given a map of passes, runs a gradient descent optimizer to find
      * better passes.
      *
      * @param The world
+     * @param context The context to rate passes on the world with
      * @param The passes to be optimized mapped to the zone
      * @returns a mapping of the Zone id to the optimized pass
      */
     ZonePassMap<ZoneEnum> optimizePasses(const World& world,
+                                         const PassRatingContext& context,
                                          const ZonePassMap<ZoneEnum>& initial_passes);
 
     /**
@@ -102,10 +120,25 @@ class PassGenerator
      * w/ the higher score in current_best_passes_;
      *
      * @param The world
+     * @param context The context to rate passes on the world with
      * @param optimized_passes The optimized_passes to update our internal cached
      * passes with.
      */
-    void updatePasses(const World& world, const ZonePassMap<ZoneEnum>& optimized_passes);
+    void updatePasses(const World& world, const PassRatingContext& context,
+                      const ZonePassMap<ZoneEnum>& optimized_passes);
+
+    /**
+     * Calls the given function once for every zone in the pitch division, spread
+     * across the thread pool, and collects the results into a ZonePassMap.
+     *
+     * @param zone_function The function to call for each zone. It is called
+     *                      concurrently from multiple threads, so it must only read
+     *                      shared state.
+     *
+     * @returns a mapping of the Zone id to the pass returned for that zone
+     */
+    ZonePassMap<ZoneEnum> forEachZone(
+        const std::function<PassWithRating(ZoneEnum)>& zone_function);
 
     // All the passes that we are currently trying to optimize in gradient descent
     ZonePassMap<ZoneEnum> current_best_passes_;
@@ -121,6 +154,10 @@ class PassGenerator
 
     // A random number generator for use across the class
     std::mt19937 random_num_gen_;
+
+    // The threads used to evaluate the zones in parallel. This is a shared_ptr
+    // so that the PassGenerator can still be copied.
+    std::shared_ptr<ThreadPool> thread_pool_;
 };
 template <class ZoneEnum>
 PassGenerator<ZoneEnum>::PassGenerator(
@@ -129,7 +166,10 @@ PassGenerator<ZoneEnum>::PassGenerator(
     : optimizer_(optimizer_param_weights),
       pitch_division_(pitch_division),
       passing_config_(passing_config),
-      random_num_gen_(PASS_GENERATOR_SEED)
+      random_num_gen_(PASS_GENERATOR_SEED),
+      // The calling thread also evaluates zones, so it counts as one of the threads
+      thread_pool_(std::make_shared<ThreadPool>(
+          passing_config->getNumPassGeneratorThreads()->value() - 1))
 {
 }
 
@@ -137,29 +177,35 @@ template <class ZoneEnum>
 PassEvaluation<ZoneEnum> PassGenerator<ZoneEnum>::generatePassEvaluation(
     const World& world)
 {
-    auto generated_passes = samplePasses(world);
+    ScopedLatencyTimer latency_timer(LatencyStage::PASS_GENERATION);
+
+    // Every pass is rated on the same world, so we only gather what the cost function
+    // needs from it once
+    PassRatingContext context(world, passing_config_);
+
+    auto generated_passes = samplePasses(world, context);
     if (current_best_passes_.empty())
     {
         current_best_passes_ = generated_passes;
     }
-    auto optimized_passes = optimizePasses(world, generated_passes);
+    auto optimized_passes = optimizePasses(world, context, generated_passes);
 
-    updatePasses(world, optimized_passes);
+    updatePasses(world, context, optimized_passes);
 
     return PassEvaluation<ZoneEnum>(pitch_division_, current_best_passes_,
                                     passing_config_, world.getMostRecentTimestamp());
 }
 
 template <class ZoneEnum>
-ZonePassMap<ZoneEnum> PassGenerator<ZoneEnum>::samplePasses(const World& world)
+ZonePassMap<ZoneEnum> PassGenerator<ZoneEnum>::samplePasses(
+    const World& world, const PassRatingContext& context)
 {
     std::uniform_real_distribution speed_distribution(
         passing_config_->getMinPassSpeedMPerS()->value(),
         passing_config_->getMaxPassSpeedMPerS()->value());
 
-    ZonePassMap<ZoneEnum> passes;
-
     // Randomly sample a pass in each zone
+    std::unordered_map<ZoneEnum, Pass> sampled_passes;
     for (ZoneEnum zone_id : pitch_division_->getAllZoneIds())
     {
         auto zone = pitch_division_->getZone(zone_id);
@@ -167,69 +213,96 @@ ZonePassMap<ZoneEnum> PassGenerator<ZoneEnum>::samplePasses(const World& world)
         std::uniform_real_distribution x_distribution(zone.xMin(), zone.xMax());
         std::uniform_real_distribution y_distribution(zone.yMin(), zone.yMax());
 
-        auto pass =
-            Pass(world.ball().position(),
-                 Point(x_distribution(random_num_gen_), y_distribution(random_num_gen_)),
-                 speed_distribution(random_num_gen_));
-
-        passes.emplace(
-            zone_id,
-            PassWithRating{pass, ratePass(world, pass, pitch_division_->getZone(zone_id),
-                                          passing_config_)});
+        sampled_passes.emplace(zone_id, Pass(world.ball().position(),
+                                             Point(x_distribution(random_num_gen_),
+                                                   y_distribution(random_num_gen_)),
+                                             speed_distribution(random_num_gen_)));
     }
 
-    return passes;
+    return forEachZone([this, &context, &sampled_passes](ZoneEnum zone_id) {
+        const Pass& pass = sampled_passes.at(zone_id);
+        return PassWithRating{pass,
+                              ratePass(context, pass, pitch_division_->getZone(zone_id))};
+    });
 }
 
 template <class ZoneEnum>
 ZonePassMap<ZoneEnum> PassGenerator<ZoneEnum>::optimizePasses(
-    const World& world, const ZonePassMap<ZoneEnum>& generated_passes)
+    const World& world, const PassRatingContext& context,
+    const ZonePassMap<ZoneEnum>& generated_passes)
 {
     // Run gradient descent to optimize the passes to for the requested number
     // of iterations
-    ZonePassMap<ZoneEnum> optimized_passes;
-
-    for (ZoneEnum zone_id : pitch_division_->getAllZoneIds())
-    {
-        // The objective function we minimize in gradient descent to improve each pass
-        // that we're optimizing
-        const auto objective_function =
-            [this, &world,
-             zone_id](const std::array<double, NUM_PARAMS_TO_OPTIMIZE>& pass_array) {
-                return ratePass(world,
-                                Pass::fromPassArray(world.ball().position(), pass_array),
-                                pitch_division_->getZone(zone_id), passing_config_);
-            };
-
-        auto pass_array = optimizer_.maximize(
-            objective_function, generated_passes.at(zone_id).pass.toPassArray(),
-            passing_config_->getNumberOfGradientDescentStepsPerIter()->value());
-
-        auto new_pass = Pass::fromPassArray(world.ball().position(), pass_array);
-        auto score =
-            ratePass(world, new_pass, pitch_division_->getZone(zone_id), passing_config_);
-
-        optimized_passes.emplace(zone_id, PassWithRating{new_pass, score});
-    }
-
-    return optimized_passes;
+    unsigned int num_gradient_descent_steps =
+        passing_config_->getNumberOfGradientDescentStepsPerIter()->value();
+
+    return forEachZone([this, &world, &context, &generated_passes,
+                        num_gradient_descent_steps](ZoneEnum zone_id) {
+        const Rectangle& zone    = pitch_division_->getZone(zone_id);
+        const Point passer_point = world.ball().position();
+
+        // The objective function we maximize in gradient descent to improve each pass
+        // that we're optimizing. It rates every pass the optimizer needs for one
+        // gradient step in a single call, so the zone lookup is shared between them.
+        const auto batched_objective_function = [&context, &zone,
+                                                 &passer_point](const auto& pass_arrays) {
+            std::array<double, NUM_PARAMS_TO_OPTIMIZE + 1> ratings;
+            for (size_t i = 0; i < pass_arrays.size(); i++)
+            {
+                ratings[i] = ratePass(
+                    context, Pass::fromPassArray(passer_point, pass_arrays[i]), zone);
+            }
+            return ratings;
+        };
+
+        auto pass_array = optimizer_.maximizeBatched(
+            batched_objective_function, generated_passes.at(zone_id).pass.toPassArray(),
+            num_gradient_descent_steps);
+
+        auto new_pass = Pass::fromPassArray(passer_point, pass_array);
+        auto score    = ratePass(context, new_pass, zone);
+
+        return PassWithRating{new_pass, score};
+    });
 }
 
 template <class ZoneEnum>
 void PassGenerator<ZoneEnum>::updatePasses(const World& world,
+                                           const PassRatingContext& context,
                                            const ZonePassMap<ZoneEnum>& optimized_passes)
 {
-    for (ZoneEnum zone_id : pitch_division_->getAllZoneIds())
-    {
+    current_best_passes_ = forEachZone([this, &world, &context,
+                                        &optimized_passes](ZoneEnum zone_id) {
         // update the passer point of the current best pass
-        current_best_passes_.at(zone_id).pass = Pass::fromPassArray(
-            world.ball().position(), current_best_passes_.at(zone_id).pass.toPassArray());
+        PassWithRating current_best_pass = current_best_passes_.at(zone_id);
+        current_best_pass.pass           = Pass::fromPassArray(
+            world.ball().position(), current_best_pass.pass.toPassArray());
 
-        if (ratePass(world, current_best_passes_.at(zone_id).pass,
-                     pitch_division_->getZone(zone_id),
-                     passing_config_) < optimized_passes.at(zone_id).rating)
+        if (ratePass(context, current_best_pass.pass, pitch_division_->getZone(zone_id)) <
+            optimized_passes.at(zone_id).rating)
         {
-            current_best_passes_.at(zone_id) = optimized_passes.at(zone_id);
+            return optimized_passes.at(zone_id);
         }
+        return current_best_pass;
+    });
+}
+
+template <class ZoneEnum>
+ZonePassMap<ZoneEnum> PassGenerator<ZoneEnum>::forEachZone(
+    const std::function<PassWithRating(ZoneEnum)>& zone_function)
+{
+    const std::vector<ZoneEnum>& zone_ids = pitch_division_->getAllZoneIds();
+
+    // Each zone writes to its own slot, so no synchronization is needed between the
+    // threads. The slots are empty until the zone's result is filled in.
+    std::vector<std::optional<PassWithRating>> zone_results(zone_ids.size());
+    thread_pool_->parallelFor(
+        zone_ids.size(), [&](size_t i) { zone_results[i] = zone_function(zone_ids[i]); });
+
+    ZonePassMap<ZoneEnum> passes;
+    for (size_t i = 0; i < zone_ids.size(); i++)
+    {
+        passes.emplace(zone_ids[i], zone_results[i].value());
     }
+    return passes;
 }
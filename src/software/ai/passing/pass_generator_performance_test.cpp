@@ -0,0 +1,131 @@
+#include <gtest/gtest.h>
+
+#include <functional>
+#include <iostream>
+
+#include "software/ai/passing/cost_function.h"
+#include "software/ai/passing/eighteen_zone_pitch_division.h"
+#include "software/ai/passing/pass_generator.hpp"
+#include "software/optimization/gradient_descent_optimizer.hpp"
+#include "software/test_util/test_util.h"
+#include "software/world/world.h"
+
+namespace
+{
+    World createDivisionBWorld()
+    {
+        World world = ::TestUtil::createBlankTestingWorldDivB();
+        world       = ::TestUtil::setFriendlyRobotPositions(
+            world,
+            {Point(-4, 0), Point(-3, 1), Point(-3, -1), Point(-1, 2), Point(-1, -2),
+             Point(1, 0)},
+            Timestamp::fromSeconds(0));
+        world = ::TestUtil::setEnemyRobotPositions(
+            world,
+            {Point(4, 0), Point(3, 1), Point(3, -1), Point(1, 2), Point(1, -2),
+             Point(0.5, 0.5)},
+            Timestamp::fromSeconds(0));
+        return ::TestUtil::setBallPosition(world, Point(1.1, 0),
+                                           Timestamp::fromSeconds(0));
+    }
+}  // namespace
+
+class PassGeneratorPerformanceTest : public testing::TestWithParam<int>
+{
+   protected:
+    static constexpr unsigned int NUM_ITERATIONS = 100;
+};
+
+// This test is disabled to speed up CI, it can be enabled by removing "DISABLED_" from
+// the test name
+TEST_P(PassGeneratorPerformanceTest, DISABLED_pass_generator_performance)
+{
+    int num_threads     = GetParam();
+    auto passing_config = std::make_shared<PassingConfig>();
+    passing_config->getMutableNumPassGeneratorThreads()->setValue(num_threads);
+
+    World world = createDivisionBWorld();
+    PassGenerator<EighteenZoneId> pass_generator(
+        std::make_shared<const EighteenZonePitchDivision>(world.field()), passing_config);
+
+    // Warm up the thread pool and the cached passes before timing
+    pass_generator.generatePassEvaluation(world);
+
+    auto start_time = std::chrono::system_clock::now();
+    for (unsigned int i = 0; i < NUM_ITERATIONS; i++)
+    {
+        pass_generator.generatePassEvaluation(world);
+    }
+    double duration_ms = ::TestUtil::millisecondsSince(start_time);
+    double avg_ms      = duration_ms / static_cast<double>(NUM_ITERATIONS);
+
+    std::cout << "# threads = " << num_threads << " | # iterations = " << NUM_ITERATIONS
+              << std::endl;
+    std::cout << "Total time = " << duration_ms
+              << "ms | Average time per tick = " << avg_ms << "ms" << std::endl
+              << std::endl;
+}
+
+INSTANTIATE_TEST_CASE_P(All, PassGeneratorPerformanceTest,
+                        ::testing::Values(1, 2, 4, 6, 9, 18));
+
+// This test is disabled to speed up CI, it can be enabled by removing "DISABLED_" from
+// the test name
+TEST(PassOptimizationPerformanceTest, DISABLED_gradient_descent_on_pass_cost_function)
+{
+    // Compares the gradient descent iterations per second on the pass cost function
+    // when the objective is wrapped in a std::function (as it used to be), passed as
+    // a lambda, and batched
+    const unsigned int NUM_RUNS  = 200;
+    const unsigned int NUM_STEPS = 5;
+
+    auto passing_config = std::make_shared<const PassingConfig>();
+    World world         = createDivisionBWorld();
+    PassRatingContext context(world, passing_config);
+    Rectangle zone     = world.field().fieldLines();
+    Point passer_point = world.ball().position();
+    Pass initial_pass  = Pass(passer_point, Point(2, 1), 4);
+    // The same weights as the PassGenerator uses
+    GradientDescentOptimizer<NUM_PARAMS_TO_OPTIMIZE> optimizer({0.1, 0.1, 0.01});
+
+    const auto objective_function =
+        [&](const std::array<double, NUM_PARAMS_TO_OPTIMIZE>& pass_array) {
+            return ratePass(context, Pass::fromPassArray(passer_point, pass_array), zone);
+        };
+    const std::function<double(std::array<double, NUM_PARAMS_TO_OPTIMIZE>)>
+        std_function_objective_function   = objective_function;
+    const auto batched_objective_function = [&](const auto& pass_arrays) {
+        std::array<double, NUM_PARAMS_TO_OPTIMIZE + 1> ratings;
+        for (size_t i = 0; i < pass_arrays.size(); i++)
+        {
+            ratings[i] = objective_function(pass_arrays[i]);
+        }
+        return ratings;
+    };
+
+    auto time_optimization = [&](const std::string& name, auto optimize) {
+        auto start_time = std::chrono::system_clock::now();
+        for (unsigned int i = 0; i < NUM_RUNS; i++)
+        {
+            optimize(initial_pass.toPassArray());
+        }
+        double duration_ms = ::TestUtil::millisecondsSince(start_time);
+        double iterations_per_second =
+            static_cast<double>(NUM_RUNS * NUM_STEPS) / (duration_ms / 1000.0);
+
+        std::cout << name << ": total time = " << duration_ms
+                  << "ms | iterations per second = " << iterations_per_second
+                  << std::endl;
+    };
+
+    time_optimization("std::function", [&](const auto& pass_array) {
+        return optimizer.maximize(std_function_objective_function, pass_array, NUM_STEPS);
+    });
+    time_optimization("lambda", [&](const auto& pass_array) {
+        return optimizer.maximize(objective_function, pass_array, NUM_STEPS);
+    });
+    time_optimization("batched", [&](const auto& pass_array) {
+        return optimizer.maximizeBatched(batched_objective_function, pass_array,
+                                         NUM_STEPS);
+    });
+}
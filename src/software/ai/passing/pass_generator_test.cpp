@@ -216,3 +216,34 @@ TEST_F(PassGeneratorTest, test_passer_point_changes_are_respected)
     EXPECT_GT((converged_pass.receiverPoint() - neg_y_friendly.position()).length(),
               (converged_pass.receiverPoint() - pos_y_friendly.position()).length());
 }
+
+TEST_F(PassGeneratorTest, test_passes_do_not_depend_on_number_of_threads)
+{
+    // Test that spreading the zones across multiple threads generates exactly the
+    // same passes as evaluating them all on one thread
+    world = ::TestUtil::setFriendlyRobotPositions(
+        world, {Point(-2, 0), Point(1, 2), Point(1, -2), Point(3, 0)},
+        Timestamp::fromSeconds(0));
+    world = ::TestUtil::setEnemyRobotPositions(
+        world, {Point(2, 1), Point(2, -1), Point(0, 0), Point(4, 0)},
+        Timestamp::fromSeconds(0));
+    world = ::TestUtil::setBallPosition(world, Point(-1.9, 0), Timestamp::fromSeconds(0));
+
+    auto multithreaded_passing_config = std::make_shared<PassingConfig>();
+    multithreaded_passing_config->getMutableNumPassGeneratorThreads()->setValue(4);
+    auto multithreaded_pass_generator = std::make_shared<PassGenerator<EighteenZoneId>>(
+        pitch_division, multithreaded_passing_config);
+
+    for (int i = 0; i < 10; i++)
+    {
+        auto pass_eval = pass_generator->generatePassEvaluation(world);
+        auto multithreaded_pass_eval =
+            multithreaded_pass_generator->generatePassEvaluation(world);
+
+        for (EighteenZoneId zone_id : pitch_division->getAllZoneIds())
+        {
+            EXPECT_EQ(pass_eval.getBestPassInZones({zone_id}),
+                      multithreaded_pass_eval.getBestPassInZones({zone_id}));
+        }
+    }
+}
@@ -0,0 +1,67 @@
+#include "software/ai/passing/pass_rating_context.h"
+
+#include "software/ai/passing/cost_function.h"
+
+PassRatingContext::PassRatingContext(const World& world,
+                                     std::shared_ptr<const PassingConfig> passing_config)
+    : world_(world),
+      enemy_team_snapshot_(world.enemyTeam()),
+      static_position_quality_region_(
+          getStaticPositionQualityRegion(world.field(), passing_config)),
+      static_field_position_quality_friendly_goal_distance_weight_(
+          passing_config->getStaticFieldPositionQualityFriendlyGoalDistanceWeight()
+              ->value()),
+      ideal_max_rotation_to_shoot_degrees_(
+          passing_config->getIdealMaxRotationToShootDegrees()->value()),
+      min_pass_speed_m_per_s_(passing_config->getMinPassSpeedMPerS()->value()),
+      max_pass_speed_m_per_s_(passing_config->getMaxPassSpeedMPerS()->value()),
+      enemy_reaction_time_(
+          Duration::fromSeconds(passing_config->getEnemyReactionTime()->value())),
+      enemy_proximity_importance_(passing_config->getEnemyProximityImportance()->value())
+{
+}
+
+const World& PassRatingContext::world() const
+{
+    return world_;
+}
+
+const EnemyTeamSnapshot& PassRatingContext::enemyTeamSnapshot() const
+{
+    return enemy_team_snapshot_;
+}
+
+const Rectangle& PassRatingContext::staticPositionQualityRegion() const
+{
+    return static_position_quality_region_;
+}
+
+double PassRatingContext::staticFieldPositionQualityFriendlyGoalDistanceWeight() const
+{
+    return static_field_position_quality_friendly_goal_distance_weight_;
+}
+
+double PassRatingContext::idealMaxRotationToShootDegrees() const
+{
+    return ideal_max_rotation_to_shoot_degrees_;
+}
+
+double PassRatingContext::minPassSpeedMPerS() const
+{
+    return min_pass_speed_m_per_s_;
+}
+
+double PassRatingContext::maxPassSpeedMPerS() const
+{
+    return max_pass_speed_m_per_s_;
+}
+
+const Duration& PassRatingContext::enemyReactionTime() const
+{
+    return enemy_reaction_time_;
+}
+
+double PassRatingContext::enemyProximityImportance() const
+{
+    return enemy_proximity_importance_;
+}
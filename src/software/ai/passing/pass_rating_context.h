@@ -0,0 +1,117 @@
+#pragma once
+
+#include <memory>
+
+#include "shared/parameter/cpp_dynamic_parameters.h"
+#include "software/ai/passing/enemy_team_snapshot.h"
+#include "software/geom/rectangle.h"
+#include "software/time/duration.h"
+#include "software/world/world.h"
+
+/**
+ * Everything the pass cost functions need to rate passes on one World, gathered once
+ * so that rating each pass does not allocate memory or copy anything out of the
+ * World.
+ *
+ * The context borrows the World it is created from rather than copying it, so the
+ * World must outlive the context. The passing config is read once when the context
+ * is created, so changes to the config only take effect in contexts created after
+ * the change.
+ *
+ * A context is never modified after it is created, so it can be shared between
+ * threads that rate passes in parallel.
+ */
+class PassRatingContext
+{
+   public:
+    PassRatingContext() = delete;
+
+    /**
+     * Creates a context for rating passes on the given world
+     *
+     * @param world The world passes will be rated in. This is borrowed, not copied,
+     *              and so must outlive this context.
+     * @param passing_config The passing config used for tuning
+     */
+    explicit PassRatingContext(const World& world,
+                               std::shared_ptr<const PassingConfig> passing_config);
+
+    /**
+     * Gets the world passes are rated in
+     *
+     * @return the world passes are rated in
+     */
+    const World& world() const;
+
+    /**
+     * Gets the snapshot of the enemy team of the world
+     *
+     * @return the snapshot of the enemy team of the world
+     */
+    const EnemyTeamSnapshot& enemyTeamSnapshot() const;
+
+    /**
+     * Gets the region of the field that gets a high static position quality
+     *
+     * @return the region of the field that gets a high static position quality
+     */
+    const Rectangle& staticPositionQualityRegion() const;
+
+    /**
+     * Gets the weight that being close to the friendly goal has on the static
+     * position quality
+     *
+     * @return the weight of the distance to the friendly goal
+     */
+    double staticFieldPositionQualityFriendlyGoalDistanceWeight() const;
+
+    /**
+     * Gets the maximum angle a receiver can rotate to shoot after receiving a pass
+     * that we think would likely still result in a goal. This is a soft limit.
+     *
+     * @return the ideal maximum rotation to shoot, in degrees
+     */
+    double idealMaxRotationToShootDegrees() const;
+
+    /**
+     * Gets the minimum speed a pass can be made at
+     *
+     * @return the minimum pass speed, in m/s
+     */
+    double minPassSpeedMPerS() const;
+
+    /**
+     * Gets the maximum speed a pass can be made at
+     *
+     * @return the maximum pass speed, in m/s
+     */
+    double maxPassSpeedMPerS() const;
+
+    /**
+     * Gets how long we think enemy robots take to recognize a pass and start moving
+     * to intercept it
+     *
+     * @return the reaction time of enemy robots
+     */
+    const Duration& enemyReactionTime() const;
+
+    /**
+     * Gets how heavily an enemy robot being near the receiver is weighed in the enemy
+     * risk of a pass
+     *
+     * @return the importance of enemy proximity to the receiver
+     */
+    double enemyProximityImportance() const;
+
+   private:
+    const World& world_;
+    EnemyTeamSnapshot enemy_team_snapshot_;
+    Rectangle static_position_quality_region_;
+
+    double static_field_position_quality_friendly_goal_distance_weight_;
+    double ideal_max_rotation_to_shoot_degrees_;
+    double min_pass_speed_m_per_s_;
+    double max_pass_speed_m_per_s_;
+    Duration enemy_reaction_time_;
+    double enemy_proximity_importance_;
+};
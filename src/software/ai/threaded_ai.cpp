@@ -2,16 +2,20 @@
 
 #include <boost/bind.hpp>
 
+#include "proto/message_translation/tbots_protobuf.h"
 #include "shared/parameter/cpp_dynamic_parameters.h"
 #include "software/ai/hl/stp/play/assigned_tactics_play.h"
 #include "software/ai/hl/stp/play/play_factory.h"
 #include "software/ai/hl/stp/tactic/tactic_factory.h"
 #include "software/gui/drawing/navigator.h"
+#include "software/util/latency_profiler/latency_profiler.h"
 
-ThreadedAI::ThreadedAI(std::shared_ptr<const AiConfig> ai_config)
-    // Disabling warnings on log buffer full, since buffer size is 1 and we always want AI
-    // to use the latest World
-    : FirstInFirstOutThreadedObserver<World>(DEFAULT_BUFFER_SIZE, false),
+ThreadedAI::ThreadedAI(std::shared_ptr<const AiConfig> ai_config,
+                       ThreadedObserverPolicy world_policy)
+    // Disabling warnings on log buffer full, since we only need the AI to use the
+    // latest World
+    : ConfigurableThreadedObserver<WorldPtr>(world_policy, DEFAULT_BUFFER_SIZE, false,
+                                             true),
       ai(ai_config),
       ai_config(ai_config),
       control_config(ai_config->getAiControlConfig())
@@ -43,22 +47,40 @@ void ThreadedAI::overrideTactics(
     ai.overridePlay(std::move(play));
 }
 
-void ThreadedAI::onValueReceived(World world)
+void ThreadedAI::onValueReceived(WorldPtr world)
 {
-    runAIAndSendPrimitives(world);
+    runAIAndSendPrimitives(*world);
     drawAI();
 }
 
 void ThreadedAI::runAIAndSendPrimitives(const World& world)
 {
+    TbotsProto::LatencyTrace latency_trace = world.getLatencyTrace();
+    bool is_traced                         = latency_trace.has_world_sent_time();
+    if (is_traced)
+    {
+        *(latency_trace.mutable_ai_start_time()) = *createCurrentTimestamp();
+        LatencyProfiler::record(LatencyStage::AI_QUEUE, latency_trace.world_sent_time(),
+                                latency_trace.ai_start_time());
+        LatencyProfiler::setNumDroppedValues(LatencyStage::AI_QUEUE,
+                                             getNumDroppedValues());
+    }
+
     std::scoped_lock lock(ai_mutex);
     if (control_config->getRunAi()->value())
     {
         auto new_primitives = ai.getPrimitives(world);
+        if (is_traced)
+        {
+            *(latency_trace.mutable_primitive_set_sent_time()) =
+                *createCurrentTimestamp();
+            *(new_primitives->mutable_latency_trace()) = latency_trace;
+        }
 
         TbotsProto::PlayInfo play_info_msg = ai.getPlayInfo();
 
-        LOG(VISUALIZE) << play_info_msg;
+        sendVisualization(play_info_msg);
+        LatencyProfiler::visualizeLatencyProfile();
 
         Subject<TbotsProto::PlayInfo>::sendValueToObservers(play_info_msg);
 
@@ -8,7 +8,7 @@
 #include "proto/tbots_software_msgs.pb.h"
 #include "software/ai/ai.h"
 #include "software/gui/drawing/draw_functions.h"
-#include "software/multithreading/first_in_first_out_threaded_observer.h"
+#include "software/multithreading/configurable_threaded_observer.h"
 #include "software/multithreading/subject.hpp"
 #include "software/world/world.h"
 
@@ -17,7 +17,7 @@
  * objects, passing them to the `AI`, getting the primitives to send to the
  * robots based on the World state, and sending them out.
  */
-class ThreadedAI : public FirstInFirstOutThreadedObserver<World>,
+class ThreadedAI : public ConfigurableThreadedObserver<WorldPtr>,
                    public Subject<TbotsProto::PrimitiveSet>,
                    public Subject<AIDrawFunction>,
                    public Subject<TbotsProto::PlayInfo>
@@ -29,8 +29,13 @@ class ThreadedAI : public FirstInFirstOutThreadedObserver<World>,
      * Create an AI with the given config
      *
      * @param ai_config The AI configuration
+     * @param world_policy The order to run the AI on received Worlds in. By default the
+     * AI only runs on the most recent World, so it never falls behind when a tick takes
+     * longer than a vision frame.
      */
-    explicit ThreadedAI(std::shared_ptr<const AiConfig> ai_config);
+    explicit ThreadedAI(
+        std::shared_ptr<const AiConfig> ai_config,
+        ThreadedObserverPolicy world_policy = ThreadedObserverPolicy::LATEST_VALUE);
 
     /**
      * Override the AI play
@@ -48,7 +53,7 @@ class ThreadedAI : public FirstInFirstOutThreadedObserver<World>,
         TbotsProto::AssignedTacticPlayControlParams assigned_tactic_play_control_params);
 
    private:
-    void onValueReceived(World world) override;
+    void onValueReceived(WorldPtr world) override;
 
     /**
      * Get primitives for the new world from the AI and pass them to observers
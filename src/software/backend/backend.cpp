@@ -1,6 +1,7 @@
 #include "software/backend/backend.h"
 
 #include "proto/message_translation/tbots_protobuf.h"
+#include "software/util/latency_profiler/latency_profiler.h"
 
 void Backend::receiveRobotStatus(TbotsProto::RobotStatus msg)
 {
@@ -12,9 +13,26 @@ void Backend::receiveRobotStatus(TbotsProto::RobotStatus msg)
 
 void Backend::receiveSSLWrapperPacket(SSLProto::SSL_WrapperPacket msg)
 {
+    ScopedLatencyTimer latency_timer(LatencyStage::VISION_RECEIVE);
+
     SensorProto sensor_msg;
     *(sensor_msg.mutable_ssl_vision_msg())        = msg;
     *(sensor_msg.mutable_backend_received_time()) = *createCurrentTimestamp();
+
+    TbotsProto::LatencyTrace* latency_trace = sensor_msg.mutable_latency_trace();
+    *(latency_trace->mutable_backend_received_time()) =
+        sensor_msg.backend_received_time();
+    if (msg.has_detection())
+    {
+        latency_trace->mutable_vision_capture_time()->set_epoch_timestamp_seconds(
+            msg.detection().t_capture());
+        latency_trace->mutable_vision_sent_time()->set_epoch_timestamp_seconds(
+            msg.detection().t_sent());
+        LatencyProfiler::record(LatencyStage::VISION_PROCESSING,
+                                latency_trace->vision_capture_time(),
+                                latency_trace->vision_sent_time());
+    }
+
     Subject<SensorProto>::sendValueToObservers(sensor_msg);
 }
 
@@ -25,3 +43,20 @@ void Backend::receiveSSLReferee(SSLProto::Referee msg)
     *(sensor_msg.mutable_backend_received_time()) = *createCurrentTimestamp();
     Subject<SensorProto>::sendValueToObservers(sensor_msg);
 }
+
+void Backend::recordPrimitiveSetLatency(TbotsProto::PrimitiveSet& primitives)
+{
+    auto received_time                            = createCurrentTimestamp();
+    const TbotsProto::LatencyTrace& latency_trace = primitives.latency_trace();
+    LatencyProfiler::record(LatencyStage::PRIMITIVE_QUEUE,
+                            latency_trace.primitive_set_sent_time(), *received_time);
+    LatencyProfiler::record(LatencyStage::END_TO_END,
+                            latency_trace.backend_received_time(), *received_time);
+    LatencyProfiler::setNumDroppedValues(
+        LatencyStage::PRIMITIVE_QUEUE,
+        FirstInFirstOutThreadedObserver<TbotsProto::PrimitiveSet>::getNumDroppedValues());
+
+    // The trace is only used by full_system, so we don't waste bandwidth sending it to
+    // the robots
+    primitives.clear_latency_trace();
+}
@@ -15,7 +15,7 @@
  * "Subject". Please see the implementation of those classes for details.
  */
 class Backend : public Subject<SensorProto>,
-                public FirstInFirstOutThreadedObserver<World>,
+                public FirstInFirstOutThreadedObserver<WorldPtr>,
                 public FirstInFirstOutThreadedObserver<TbotsProto::PrimitiveSet>
 {
    public:
@@ -32,4 +32,13 @@ class Backend : public Subject<SensorProto>,
     void receiveRobotStatus(TbotsProto::RobotStatus msg);
     void receiveSSLWrapperPacket(SSLProto::SSL_WrapperPacket msg);
     void receiveSSLReferee(SSLProto::Referee msg);
+
+   protected:
+    /**
+     * Records the latency of the vision frame the given primitives were made from, and
+     * clears their LatencyTrace so that it isn't sent to the robots
+     *
+     * @param primitives The primitives received from the AI
+     */
+    void recordPrimitiveSetLatency(TbotsProto::PrimitiveSet& primitives);
 };
@@ -1,19 +1,116 @@
 #include "replay_backend.h"
 
+#include <unistd.h>
+
 #include <cstdlib>
+#include <filesystem>
 
+#include "proto/logging/indexed_proto_log_writer.h"
+#include "proto/logging/proto_log_converter.h"
+#include "proto/message_translation/tbots_protobuf.h"
 #include "software/util/generic_factory/generic_factory.h"
 
 ReplayBackend::ReplayBackend(std::shared_ptr<const BackendConfig> config)
-    : replay_reader(
-          config->getFullSystemMainCommandLineArgs()->getReplayInputDir()->value()),
-      pull_from_replay_thread(
-          boost::bind(&ReplayBackend::continuouslyPullFromReplayFiles, this))
+    : in_destructor(false),
+      lock_step(config->getFullSystemMainCommandLineArgs()->getReplayMode()->value() ==
+                "lockstep"),
+      replay_engine(createReplayEngine(config)),
+      pull_from_replay_thread()
+{
+    double replay_start_seconds =
+        config->getFullSystemMainCommandLineArgs()->getReplayStartSeconds()->value();
+    if (replay_start_seconds > 0)
+    {
+        replay_engine->seek(replay_engine->getStartTime() +
+                            Duration::fromSeconds(replay_start_seconds));
+    }
+
+    pull_from_replay_thread =
+        std::thread(boost::bind(&ReplayBackend::continuouslyPullFromReplayFiles, this));
+}
+
+ReplayBackend::~ReplayBackend()
 {
+    in_destructor = true;
+    replay_engine->stop();
+    if (pull_from_replay_thread.joinable())
+    {
+        pull_from_replay_thread.join();
+    }
+}
+
+std::unique_ptr<ReplayEngine> ReplayBackend::createReplayEngine(
+    std::shared_ptr<const BackendConfig> config)
+{
+    auto args = config->getFullSystemMainCommandLineArgs();
+
+    ReplayMode replay_mode = ReplayMode::REAL_TIME;
+    if (args->getReplayMode()->value() == "speed_multiplier")
+    {
+        replay_mode = ReplayMode::SPEED_MULTIPLIER;
+    }
+    else if (args->getReplayMode()->value() == "lockstep")
+    {
+        replay_mode = ReplayMode::LOCK_STEP;
+    }
+
+    return std::make_unique<ReplayEngine>(
+        openReplayLog(args->getReplayInputDir()->value()), replay_mode,
+        args->getReplaySpeedMultiplier()->value(), [this](const SensorProto& sensor_msg) {
+            if (!sensor_msg.has_latency_trace())
+            {
+                this->sendValueToObservers(sensor_msg);
+                return;
+            }
+
+            // The logged trace is of the run that was recorded, so we start a new one
+            // to trace this run
+            SensorProto replayed_sensor_msg = sensor_msg;
+            TbotsProto::LatencyTrace latency_trace;
+            *(latency_trace.mutable_vision_capture_time()) =
+                sensor_msg.latency_trace().vision_capture_time();
+            *(latency_trace.mutable_vision_sent_time()) =
+                sensor_msg.latency_trace().vision_sent_time();
+            *(latency_trace.mutable_backend_received_time()) = *createCurrentTimestamp();
+            *(replayed_sensor_msg.mutable_latency_trace())   = latency_trace;
+            this->sendValueToObservers(replayed_sensor_msg);
+        });
+}
+
+std::shared_ptr<const IndexedProtoLogReader> ReplayBackend::openReplayLog(
+    const std::string& replay_input_path)
+{
+    namespace fs = std::filesystem;
+
+    if (!fs::is_directory(replay_input_path))
+    {
+        return std::make_shared<const IndexedProtoLogReader>(replay_input_path);
+    }
+
+    fs::path converted_log_path =
+        fs::temp_directory_path() / ("replay_" + std::to_string(getpid()) + ".tbotslog");
+    fs::remove(converted_log_path);
+    LOG(INFO) << "Converting " << replay_input_path << " to an indexed proto log at "
+              << converted_log_path.string();
+    {
+        IndexedProtoLogWriter log_writer(converted_log_path);
+        convertProtoLogToIndexedProtoLog(replay_input_path, log_writer);
+    }
+
+    auto log_reader = std::make_shared<const IndexedProtoLogReader>(converted_log_path);
+    // the log stays mapped after it is removed, so it is cleaned up when we exit
+    fs::remove(converted_log_path);
+    return log_reader;
 }
 
 void ReplayBackend::onValueReceived(TbotsProto::PrimitiveSet primitives)
 {
+    recordPrimitiveSetLatency(primitives);
+
+    // the AI has finished processing the last SensorProto, so the next one can be
+    // replayed in lock step
+    replay_engine->onSensorMsgProcessed();
+
     // update the time when the backend received the last primitive message. this is
     // used to check when we should exit.
     std::scoped_lock lock(last_primitive_received_time_mutex);
@@ -21,36 +118,25 @@ void ReplayBackend::onValueReceived(TbotsProto::PrimitiveSet primitives)
 }
 
 // do nothing
-void ReplayBackend::onValueReceived(World world) {}
+void ReplayBackend::onValueReceived(WorldPtr world) {}
 
 void ReplayBackend::continuouslyPullFromReplayFiles()
 {
-    while (auto sensor_msg_or_null = replay_reader.getNextMsg<SensorProto>())
-    {
-        auto this_msg_received_time = std::chrono::duration<double>(
-            sensor_msg_or_null->backend_received_time().epoch_timestamp_seconds());
+    auto replay_start_time   = std::chrono::steady_clock::now();
+    size_t num_msgs_replayed = replay_engine->replay();
+    LOG(INFO) << "Replayed " << num_msgs_replayed << " SensorProtos in "
+              << std::chrono::duration<double>(std::chrono::steady_clock::now() -
+                                               replay_start_time)
+                     .count()
+              << " seconds";
 
-        if (last_msg_received_time && last_msg_replayed_time)
-        {
-            // replicate the timing of messages by sleeping until a time such that
-            // the *total* time between the last message sent and the current message sent
-            // is equal to the duration between the last message's backend_received_time
-            // and the current message's backend_received_time
-            auto time_between_last_and_cur_msg =
-                (this_msg_received_time - *last_msg_received_time);
-            if (time_between_last_and_cur_msg > std::chrono::duration<double>(0))
-            {
-                std::this_thread::sleep_until(
-                    *last_msg_replayed_time +
-                    (this_msg_received_time - *last_msg_received_time));
-            }
-        }
-        this->sendValueToObservers(*sensor_msg_or_null);
-        last_msg_replayed_time = std::chrono::steady_clock::now();
-        last_msg_received_time = this_msg_received_time;
+    if (in_destructor)
+    {
+        return;
     }
 
-    bool exit = false;
+    // in lock step, the last SensorProto was already processed when the replay returns
+    bool exit = lock_step;
     while (!exit)
     {
         // wait until it has been LAST_PRIMITIVE_TO_SHUTDOWN_DURATION since the last
@@ -63,7 +149,6 @@ void ReplayBackend::continuouslyPullFromReplayFiles()
                 std::chrono::steady_clock::now() - *last_primitive_received_time >=
                     LAST_PRIMITIVE_TO_SHUTDOWN_DURATION)
             {
-                LOG(INFO) << "Reached end of replay, exiting";
                 exit = true;
             }
         }
@@ -71,6 +156,7 @@ void ReplayBackend::continuouslyPullFromReplayFiles()
         // condition again
         std::this_thread::sleep_for(CHECK_LAST_PRIMITIVE_TIME_DURATION);
     }
+    LOG(INFO) << "Reached end of replay, exiting";
     std::exit(0);
 }
 
@@ -1,9 +1,12 @@
 #pragma once
-#include "proto/logging/proto_log_reader.h"
+#include <atomic>
+
+#include "proto/logging/indexed_proto_log_reader.h"
 #include "proto/robot_status_msg.pb.h"
 #include "proto/tbots_software_msgs.pb.h"
 #include "shared/parameter/cpp_dynamic_parameters.h"
 #include "software/backend/backend.h"
+#include "software/backend/replay_engine.h"
 #include "software/backend/ssl_proto_client.h"
 #include "software/networking/threaded_proto_udp_listener.hpp"
 #include "software/networking/threaded_proto_udp_sender.hpp"
@@ -13,23 +16,47 @@ class ReplayBackend : public Backend
    public:
     explicit ReplayBackend(std::shared_ptr<const BackendConfig> config);
 
+    ~ReplayBackend() override;
+
    private:
     void onValueReceived(TbotsProto::PrimitiveSet primitives) override;
-    void onValueReceived(World world) override;
+    void onValueReceived(WorldPtr world) override;
     void continuouslyPullFromReplayFiles();
 
+    /**
+     * Opens the log to replay. ProtoLogger directories of SensorProto chunks are
+     * converted to a temporary indexed proto log first, since only indexed proto logs
+     * can be seeked.
+     *
+     * @param replay_input_path The indexed proto log or ProtoLogger directory to replay
+     *
+     * @return the log to replay
+     */
+    static std::shared_ptr<const IndexedProtoLogReader> openReplayLog(
+        const std::string& replay_input_path);
+
+    /**
+     * Creates the ReplayEngine with the replay mode and speed from the command line
+     * arguments
+     *
+     * @param config The BackendConfig containing the command line arguments
+     *
+     * @return the ReplayEngine
+     */
+    std::unique_ptr<ReplayEngine> createReplayEngine(
+        std::shared_ptr<const BackendConfig> config);
+
     static constexpr std::chrono::duration<double> CHECK_LAST_PRIMITIVE_TIME_DURATION =
         std::chrono::duration<double>(0.1);
     static constexpr std::chrono::duration<double> LAST_PRIMITIVE_TO_SHUTDOWN_DURATION =
         std::chrono::duration<double>(1.0);
 
-    ProtoLogReader replay_reader;
+    std::atomic_bool in_destructor;
+    bool lock_step;
+    std::unique_ptr<ReplayEngine> replay_engine;
     // a thread that continuously pulls from replay data files and emits them to the
     // observers of this class
     std::thread pull_from_replay_thread;
-    std::optional<std::chrono::duration<double>> last_msg_received_time;
-    std::optional<std::chrono::time_point<std::chrono::steady_clock>>
-        last_msg_replayed_time;
 
     std::optional<std::chrono::time_point<std::chrono::steady_clock>>
         last_primitive_received_time;
@@ -0,0 +1,123 @@
+#include "software/backend/replay_engine.h"
+
+ReplayEngine::ReplayEngine(std::shared_ptr<const IndexedProtoLogReader> log_reader,
+                           ReplayMode replay_mode, double speed_multiplier,
+                           std::function<void(const SensorProto&)> send_sensor_msg,
+                           Duration lock_step_timeout)
+    : log_reader(log_reader),
+      replay_mode(replay_mode),
+      speed_multiplier(replay_mode == ReplayMode::REAL_TIME ? 1.0 : speed_multiplier),
+      send_sensor_msg(send_sensor_msg),
+      lock_step_timeout(lock_step_timeout.toSeconds()),
+      replay_mutex(),
+      replay_cv(),
+      next_msg_idx(0),
+      replay_anchor_time(std::nullopt),
+      replay_anchor_log_time_s(0),
+      msg_processed(false),
+      stopped(false)
+{
+    if (!(this->speed_multiplier > 0))
+    {
+        throw std::invalid_argument("The replay speed multiplier must be positive");
+    }
+}
+
+size_t ReplayEngine::replay()
+{
+    const size_t num_msgs    = log_reader->numMsgs<SensorProto>();
+    size_t num_msgs_replayed = 0;
+
+    std::unique_lock<std::mutex> lock(replay_mutex);
+    while (!stopped && next_msg_idx < num_msgs)
+    {
+        const size_t msg_idx = next_msg_idx;
+        const double msg_time_s =
+            log_reader->getMsgTimestamp<SensorProto>(msg_idx).toSeconds();
+
+        if (replay_mode != ReplayMode::LOCK_STEP)
+        {
+            if (!replay_anchor_time)
+            {
+                replay_anchor_time       = std::chrono::steady_clock::now();
+                replay_anchor_log_time_s = msg_time_s;
+            }
+            auto replay_time =
+                *replay_anchor_time +
+                std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                    std::chrono::duration<double>(
+                        (msg_time_s - replay_anchor_log_time_s) / speed_multiplier));
+
+            // a seek or stop while waiting changes which SensorProto is replayed next
+            if (replay_cv.wait_until(lock, replay_time, [&] {
+                    return stopped || next_msg_idx != msg_idx || !replay_anchor_time;
+                }))
+            {
+                continue;
+            }
+        }
+
+        next_msg_idx++;
+        msg_processed = false;
+        lock.unlock();
+        send_sensor_msg(log_reader->getMsg<SensorProto>(msg_idx));
+        num_msgs_replayed++;
+        lock.lock();
+
+        if (replay_mode == ReplayMode::LOCK_STEP)
+        {
+            replay_cv.wait_for(lock, lock_step_timeout, [&] {
+                return stopped || msg_processed || next_msg_idx != msg_idx + 1;
+            });
+        }
+    }
+    return num_msgs_replayed;
+}
+
+void ReplayEngine::seek(const Timestamp& timestamp)
+{
+    {
+        std::scoped_lock lock(replay_mutex);
+        next_msg_idx = log_reader->findMsgIdx<SensorProto>(timestamp);
+        // the timing restarts from the SensorProto that was seeked to
+        replay_anchor_time = std::nullopt;
+    }
+    replay_cv.notify_all();
+}
+
+void ReplayEngine::onSensorMsgProcessed()
+{
+    {
+        std::scoped_lock lock(replay_mutex);
+        msg_processed = true;
+    }
+    replay_cv.notify_all();
+}
+
+void ReplayEngine::stop()
+{
+    {
+        std::scoped_lock lock(replay_mutex);
+        stopped = true;
+    }
+    replay_cv.notify_all();
+}
+
+Timestamp ReplayEngine::getStartTime() const
+{
+    if (log_reader->numMsgs<SensorProto>() == 0)
+    {
+        return Timestamp();
+    }
+    return log_reader->getMsgTimestamp<SensorProto>(0);
+}
+
+Timestamp ReplayEngine::getEndTime() const
+{
+    if (log_reader->numMsgs<SensorProto>() == 0)
+    {
+        return Timestamp();
+    }
+    return log_reader->getMsgTimestamp<SensorProto>(log_reader->numMsgs<SensorProto>() -
+                                                    1);
+}
@@ -0,0 +1,118 @@
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+
+#include "proto/logging/indexed_proto_log_reader.h"
+#include "proto/sensor_msg.pb.h"
+#include "software/time/duration.h"
+#include "software/time/timestamp.h"
+
+/**
+ * How the ReplayEngine paces the SensorProtos it replays
+ */
+enum class ReplayMode
+{
+    // Replay the SensorProtos with the timing they were logged with
+    REAL_TIME,
+    // Replay the SensorProtos with the timing they were logged with, sped up by a fixed
+    // multiplier
+    SPEED_MULTIPLIER,
+    // Replay every SensorProto as soon as the previous one was processed, which is
+    // signalled with ReplayEngine::onSensorMsgProcessed
+    LOCK_STEP
+};
+
+/**
+ * Replays the SensorProtos of an indexed proto log. The replay can be paced in real time,
+ * sped up, or run in lock step with the system under test, and can seek to any time in
+ * the log while it is replaying.
+ */
+class ReplayEngine
+{
+   public:
+    /**
+     * Creates a ReplayEngine that starts at the first SensorProto of the log
+     *
+     * @param log_reader The log to replay
+     * @param replay_mode How to pace the replayed SensorProtos
+     * @param speed_multiplier How much faster than real time to replay in
+     * SPEED_MULTIPLIER mode, must be positive
+     * @param send_sensor_msg Sends a replayed SensorProto to the system under test
+     * @param lock_step_timeout How long to wait in LOCK_STEP mode for a SensorProto to be
+     * processed before replaying the next one anyway, so that the replay doesn't stall on
+     * SensorProtos that don't produce a result
+     *
+     * @throws std::invalid_argument if the speed multiplier is not positive
+     */
+    explicit ReplayEngine(
+        std::shared_ptr<const IndexedProtoLogReader> log_reader, ReplayMode replay_mode,
+        double speed_multiplier, std::function<void(const SensorProto&)> send_sensor_msg,
+        Duration lock_step_timeout = Duration::fromSeconds(DEFAULT_LOCK_STEP_TIMEOUT_S));
+
+    /**
+     * Replays SensorProtos from the current position in the log until the end of the log
+     * is reached or the replay is stopped. This blocks, and SensorProtos are sent from
+     * the calling thread.
+     *
+     * @return the number of SensorProtos that were replayed
+     */
+    size_t replay();
+
+    /**
+     * Moves the replay to the first SensorProto at or after the given time. This can be
+     * called from any thread, including while replaying.
+     *
+     * @param timestamp The time in the log to seek to
+     */
+    void seek(const Timestamp& timestamp);
+
+    /**
+     * Signals that the last replayed SensorProto was processed, so that the next one is
+     * replayed in LOCK_STEP mode. This can be called from any thread.
+     */
+    void onSensorMsgProcessed();
+
+    /**
+     * Stops replaying. This can be called from any thread.
+     */
+    void stop();
+
+    /**
+     * Gets the time of the first SensorProto in the log
+     *
+     * @return the time of the first SensorProto in the log
+     */
+    Timestamp getStartTime() const;
+
+    /**
+     * Gets the time of the last SensorProto in the log
+     *
+     * @return the time of the last SensorProto in the log
+     */
+    Timestamp getEndTime() const;
+
+    static constexpr double DEFAULT_LOCK_STEP_TIMEOUT_S = 0.5;
+
+   private:
+    std::shared_ptr<const IndexedProtoLogReader> log_reader;
+    const ReplayMode replay_mode;
+    const double speed_multiplier;
+    std::function<void(const SensorProto&)> send_sensor_msg;
+    const std::chrono::duration<double> lock_step_timeout;
+
+    std::mutex replay_mutex;
+    std::condition_variable replay_cv;
+    size_t next_msg_idx;
+    // The wall clock time the SensorProto at replay_anchor_log_time is replayed at. The
+    // timing of the other SensorProtos is relative to it, so that sleeping late does not
+    // add up over the replay
+    std::optional<std::chrono::steady_clock::time_point> replay_anchor_time;
+    double replay_anchor_log_time_s;
+    bool msg_processed;
+    bool stopped;
+};
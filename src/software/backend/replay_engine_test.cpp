@@ -0,0 +1,175 @@
+#include "software/backend/replay_engine.h"
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <thread>
+
+#include "proto/logging/indexed_proto_log_writer.h"
+
+namespace fs = std::filesystem;
+
+class ReplayEngineTest : public ::testing::Test
+{
+   protected:
+    void SetUp() override
+    {
+        log_path = fs::current_path() /
+                   (std::string(
+                        ::testing::UnitTest::GetInstance()->current_test_info()->name()) +
+                    ".tbotslog");
+        fs::remove(log_path);
+
+        // 20 SensorProtos logged 0.1 seconds apart
+        {
+            IndexedProtoLogWriter writer(log_path);
+            for (unsigned int i = 0; i < NUM_SENSOR_MSGS; i++)
+            {
+                SensorProto sensor_msg;
+                sensor_msg.add_robot_status_msgs()->set_robot_id(i);
+                writer.writeMsg(sensor_msg, Timestamp::fromSeconds(100 + 0.1 * i));
+            }
+        }
+        log_reader = std::make_shared<const IndexedProtoLogReader>(log_path);
+        fs::remove(log_path);
+    }
+
+    std::function<void(const SensorProto&)> recordSensorMsgs()
+    {
+        return [this](const SensorProto& sensor_msg) {
+            replayed_robot_ids.emplace_back(sensor_msg.robot_status_msgs(0).robot_id());
+        };
+    }
+
+    static constexpr unsigned int NUM_SENSOR_MSGS = 20;
+
+    fs::path log_path;
+    std::shared_ptr<const IndexedProtoLogReader> log_reader;
+    std::vector<unsigned int> replayed_robot_ids;
+};
+
+TEST_F(ReplayEngineTest, test_speed_multiplier_replays_faster_than_real_time)
+{
+    ReplayEngine replay_engine(log_reader, ReplayMode::SPEED_MULTIPLIER, 10,
+                               recordSensorMsgs());
+
+    auto start_time = std::chrono::steady_clock::now();
+    EXPECT_EQ(NUM_SENSOR_MSGS, replay_engine.replay());
+    double replay_duration_s =
+        std::chrono::duration<double>(std::chrono::steady_clock::now() - start_time)
+            .count();
+
+    // the log is 1.9 seconds long
+    EXPECT_GE(replay_duration_s, 0.18);
+    EXPECT_LT(replay_duration_s, 1.0);
+    ASSERT_EQ(NUM_SENSOR_MSGS, replayed_robot_ids.size());
+    for (unsigned int i = 0; i < NUM_SENSOR_MSGS; i++)
+    {
+        EXPECT_EQ(i, replayed_robot_ids[i]);
+    }
+}
+
+TEST_F(ReplayEngineTest, test_real_time_ignores_speed_multiplier)
+{
+    ReplayEngine replay_engine(log_reader, ReplayMode::REAL_TIME, 100,
+                               recordSensorMsgs());
+    replay_engine.seek(Timestamp::fromSeconds(101.45));
+
+    auto start_time = std::chrono::steady_clock::now();
+    EXPECT_EQ(5, replay_engine.replay());
+    double replay_duration_s =
+        std::chrono::duration<double>(std::chrono::steady_clock::now() - start_time)
+            .count();
+
+    EXPECT_GE(replay_duration_s, 0.39);
+    EXPECT_EQ(std::vector<unsigned int>({15, 16, 17, 18, 19}), replayed_robot_ids);
+}
+
+TEST_F(ReplayEngineTest, test_lock_step_waits_for_sensor_msgs_to_be_processed)
+{
+    std::optional<ReplayEngine> replay_engine;
+    std::vector<std::thread> processing_threads;
+    replay_engine.emplace(
+        log_reader, ReplayMode::LOCK_STEP, 1,
+        [&](const SensorProto& sensor_msg) {
+            replayed_robot_ids.emplace_back(sensor_msg.robot_status_msgs(0).robot_id());
+            // the SensorProto is processed in another thread, like the AI does
+            processing_threads.emplace_back([&]() {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                replay_engine->onSensorMsgProcessed();
+            });
+        },
+        Duration::fromSeconds(10));
+
+    auto start_time = std::chrono::steady_clock::now();
+    EXPECT_EQ(NUM_SENSOR_MSGS, replay_engine->replay());
+    double replay_duration_s =
+        std::chrono::duration<double>(std::chrono::steady_clock::now() - start_time)
+            .count();
+    for (std::thread& processing_thread : processing_threads)
+    {
+        processing_thread.join();
+    }
+
+    // replaying is paced by processing, not by the 1.9 seconds of the log
+    EXPECT_LT(replay_duration_s, 1.0);
+    EXPECT_EQ(NUM_SENSOR_MSGS, replayed_robot_ids.size());
+}
+
+TEST_F(ReplayEngineTest, test_lock_step_times_out_when_sensor_msgs_are_not_processed)
+{
+    ReplayEngine replay_engine(log_reader, ReplayMode::LOCK_STEP, 1, recordSensorMsgs(),
+                               Duration::fromSeconds(0.01));
+    replay_engine.seek(Timestamp::fromSeconds(101.65));
+    EXPECT_EQ(3, replay_engine.replay());
+    EXPECT_EQ(std::vector<unsigned int>({17, 18, 19}), replayed_robot_ids);
+}
+
+TEST_F(ReplayEngineTest, test_seek_while_replaying)
+{
+    std::optional<ReplayEngine> replay_engine;
+    replay_engine.emplace(
+        log_reader, ReplayMode::REAL_TIME, 1, [&](const SensorProto& sensor_msg) {
+            unsigned int robot_id = sensor_msg.robot_status_msgs(0).robot_id();
+            replayed_robot_ids.emplace_back(robot_id);
+            // skip ahead after the first SensorProto
+            if (robot_id == 0)
+            {
+                replay_engine->seek(Timestamp::fromSeconds(101.75));
+            }
+        });
+
+    auto start_time = std::chrono::steady_clock::now();
+    EXPECT_EQ(3, replay_engine->replay());
+    double replay_duration_s =
+        std::chrono::duration<double>(std::chrono::steady_clock::now() - start_time)
+            .count();
+
+    EXPECT_EQ(std::vector<unsigned int>({0, 18, 19}), replayed_robot_ids);
+    EXPECT_LT(replay_duration_s, 1.0);
+}
+
+TEST_F(ReplayEngineTest, test_stop_while_replaying)
+{
+    ReplayEngine replay_engine(log_reader, ReplayMode::REAL_TIME, 1, recordSensorMsgs());
+    std::thread stop_thread([&]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        replay_engine.stop();
+    });
+    EXPECT_LT(replay_engine.replay(), NUM_SENSOR_MSGS);
+    stop_thread.join();
+}
+
+TEST_F(ReplayEngineTest, test_start_and_end_time)
+{
+    ReplayEngine replay_engine(log_reader, ReplayMode::REAL_TIME, 1, recordSensorMsgs());
+    EXPECT_EQ(Timestamp::fromSeconds(100), replay_engine.getStartTime());
+    EXPECT_EQ(Timestamp::fromSeconds(101.9), replay_engine.getEndTime());
+}
+
+TEST_F(ReplayEngineTest, test_speed_multiplier_must_be_positive)
+{
+    EXPECT_THROW(
+        ReplayEngine(log_reader, ReplayMode::SPEED_MULTIPLIER, 0, recordSensorMsgs()),
+        std::invalid_argument);
+}
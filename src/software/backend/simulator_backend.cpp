@@ -9,6 +9,7 @@
 #include "software/constants.h"
 #include "software/logger/logger.h"
 #include "software/util/generic_factory/generic_factory.h"
+#include "software/util/latency_profiler/latency_profiler.h"
 
 SimulatorBackend::SimulatorBackend(std::shared_ptr<const BackendConfig> config)
     : network_config(config->getSimulatorBackendConfig()->getNetworkConfig()),
@@ -32,6 +33,9 @@ SimulatorBackend::SimulatorBackend(std::shared_ptr<const BackendConfig> config)
 
 void SimulatorBackend::onValueReceived(TbotsProto::PrimitiveSet primitives)
 {
+    ScopedLatencyTimer latency_timer(LatencyStage::PRIMITIVE_SEND);
+    recordPrimitiveSetLatency(primitives);
+
     primitive_output->sendProto(primitives);
 
     if (sensor_fusion_config->getOverrideGameControllerDefendingSide()->value())
@@ -47,10 +51,10 @@ void SimulatorBackend::onValueReceived(TbotsProto::PrimitiveSet primitives)
     }
 }
 
-void SimulatorBackend::onValueReceived(World world)
+void SimulatorBackend::onValueReceived(WorldPtr world)
 {
-    vision_output->sendProto(*createVision(world));
-    LOG(VISUALIZE) << *createWorld(world);
+    vision_output->sendProto(*createVision(*world));
+    sendVisualization(*createWorld(*world));
 }
 
 void SimulatorBackend::receiveRobotLogs(TbotsProto::RobotLog log)
@@ -18,7 +18,7 @@ class SimulatorBackend : public Backend
 
    private:
     void onValueReceived(TbotsProto::PrimitiveSet primitives) override;
-    void onValueReceived(World world) override;
+    void onValueReceived(WorldPtr world) override;
 
     /**
      * Joins the specified multicast group on the vision_output, primitive_output
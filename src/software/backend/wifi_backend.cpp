@@ -11,6 +11,7 @@
 #include "software/estop/threaded_estop_reader.h"
 #include "software/logger/logger.h"
 #include "software/util/generic_factory/generic_factory.h"
+#include "software/util/latency_profiler/latency_profiler.h"
 
 
 WifiBackend::WifiBackend(std::shared_ptr<const BackendConfig> config)
@@ -19,7 +20,8 @@ WifiBackend::WifiBackend(std::shared_ptr<const BackendConfig> config)
       arduino_config(config->getWifiBackendConfig()->getArduinoConfig()),
       ssl_proto_client(boost::bind(&Backend::receiveSSLWrapperPacket, this, _1),
                        boost::bind(&Backend::receiveSSLReferee, this, _1),
-                       network_config->getSslCommunicationConfig())
+                       network_config->getSslCommunicationConfig()),
+      robot_primitive_sequence_numbers()
 {
     std::string network_interface = this->network_config->getNetworkInterface()->value();
     int channel                   = this->network_config->getChannel()->value();
@@ -43,6 +45,9 @@ WifiBackend::WifiBackend(std::shared_ptr<const BackendConfig> config)
 
 void WifiBackend::onValueReceived(TbotsProto::PrimitiveSet primitives)
 {
+    ScopedLatencyTimer latency_timer(LatencyStage::PRIMITIVE_SEND);
+    recordPrimitiveSetLatency(primitives);
+
     // check if estop has been set
     if (estop_reader != nullptr && !estop_reader->isEstopPlay())
     {
@@ -55,8 +60,14 @@ void WifiBackend::onValueReceived(TbotsProto::PrimitiveSet primitives)
         }
     }
 
-    primitive_output->sendProto(primitives);
-
+    if (network_config->getSendPrimitivesPerRobot()->value())
+    {
+        sendRobotPrimitives(primitives);
+    }
+    else
+    {
+        primitive_output->sendProto(primitives);
+    }
 
     if (sensor_fusion_config->getOverrideGameControllerDefendingSide()->value())
     {
@@ -71,10 +82,32 @@ void WifiBackend::onValueReceived(TbotsProto::PrimitiveSet primitives)
     }
 }
 
-void WifiBackend::onValueReceived(World world)
+void WifiBackend::onValueReceived(WorldPtr world)
+{
+    vision_output->sendProto(*createVision(*world));
+    sendVisualization(*createWorld(*world));
+}
+
+void WifiBackend::sendRobotPrimitives(TbotsProto::PrimitiveSet& primitives)
 {
-    vision_output->sendProto(*createVision(world));
-    LOG(VISUALIZE) << *createWorld(world);
+    *robot_primitive.mutable_time_sent() = primitives.time_sent();
+    robot_primitive.set_stay_away_from_ball(primitives.stay_away_from_ball());
+
+    for (auto& [robot_id, primitive] : *primitives.mutable_robot_primitives())
+    {
+        if (robot_id >= MAX_ROBOT_IDS)
+        {
+            LOG(WARNING) << "Not sending a primitive to robot " << robot_id
+                         << ", robot ids must be less than " << MAX_ROBOT_IDS;
+            continue;
+        }
+
+        robot_primitive.set_sequence_number(++robot_primitive_sequence_numbers[robot_id]);
+        robot_primitive.mutable_primitive()->Swap(&primitive);
+        robot_primitive_output->sendProto(
+            robot_primitive,
+            static_cast<unsigned short>(ROBOT_PRIMITIVE_PORT_BASE + robot_id));
+    }
 }
 
 void WifiBackend::receiveRobotLogs(TbotsProto::RobotLog log)
@@ -95,6 +128,10 @@ void WifiBackend::joinMulticastChannel(int channel, const std::string& interface
         std::string(ROBOT_MULTICAST_CHANNELS[channel]) + "%" + interface, PRIMITIVE_PORT,
         true));
 
+    robot_primitive_output.reset(new ThreadedProtoUdpSender<TbotsProto::RobotPrimitive>(
+        std::string(ROBOT_MULTICAST_CHANNELS[channel]) + "%" + interface,
+        ROBOT_PRIMITIVE_PORT_BASE, true));
+
     robot_status_input.reset(new ThreadedProtoUdpListener<TbotsProto::RobotStatus>(
         std::string(ROBOT_MULTICAST_CHANNELS[channel]) + "%" + interface,
         ROBOT_STATUS_PORT, boost::bind(&Backend::receiveRobotStatus, this, _1), true));
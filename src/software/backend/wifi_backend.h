@@ -1,9 +1,12 @@
 #pragma once
 
+#include <array>
+
 #include "proto/defending_side_msg.pb.h"
 #include "proto/robot_log_msg.pb.h"
 #include "proto/robot_status_msg.pb.h"
 #include "proto/tbots_software_msgs.pb.h"
+#include "shared/constants.h"
 #include "shared/parameter/cpp_dynamic_parameters.h"
 #include "software/backend/backend.h"
 #include "software/backend/ssl_proto_client.h"
@@ -19,7 +22,7 @@ class WifiBackend : public Backend
 
    private:
     void onValueReceived(TbotsProto::PrimitiveSet primitives) override;
-    void onValueReceived(World world) override;
+    void onValueReceived(WorldPtr world) override;
 
     /**
      * Joins the specified multicast group on the vision_output, primitive_output
@@ -36,6 +39,15 @@ class WifiBackend : public Backend
      */
     void joinMulticastChannel(int channel, const std::string& interface);
 
+    /**
+     * Sends every robot its own primitive from the PrimitiveSet as a RobotPrimitive on
+     * the port that robot listens on, so robots don't receive the primitives of every
+     * other robot. The primitives are moved out of the PrimitiveSet.
+     *
+     * @param primitives The PrimitiveSet to send the primitives of
+     */
+    void sendRobotPrimitives(TbotsProto::PrimitiveSet& primitives);
+
 
     /**
      * Callback for the RobotLog listener
@@ -54,10 +66,19 @@ class WifiBackend : public Backend
     // ProtoMulticast** to communicate with robots
     std::unique_ptr<ThreadedProtoUdpSender<TbotsProto::Vision>> vision_output;
     std::unique_ptr<ThreadedProtoUdpSender<TbotsProto::PrimitiveSet>> primitive_output;
+    std::unique_ptr<ThreadedProtoUdpSender<TbotsProto::RobotPrimitive>>
+        robot_primitive_output;
     std::unique_ptr<ThreadedProtoUdpListener<TbotsProto::RobotStatus>> robot_status_input;
     std::unique_ptr<ThreadedProtoUdpListener<TbotsProto::RobotLog>> robot_log_input;
     std::unique_ptr<ThreadedProtoUdpSender<DefendingSideProto>> defending_side_output;
 
 
     std::unique_ptr<ThreadedEstopReader> estop_reader;
+
+    // The sequence number of the last RobotPrimitive sent to each robot, indexed by
+    // robot id
+    std::array<uint64_t, MAX_ROBOT_IDS> robot_primitive_sequence_numbers;
+
+    // Reused for every RobotPrimitive sent, to avoid reallocating it
+    TbotsProto::RobotPrimitive robot_primitive;
 };
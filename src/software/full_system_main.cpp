@@ -1,3 +1,5 @@
+#include <signal.h>
+
 #include <boost/program_options.hpp>
 #include <chrono>
 #include <filesystem>
@@ -17,6 +19,7 @@
 #include "software/multithreading/observer_subject_adapter.hpp"
 #include "software/sensor_fusion/threaded_sensor_fusion.h"
 #include "software/util/generic_factory/generic_factory.h"
+#include "software/util/latency_profiler/latency_profiler.h"
 
 // clang-format off
 std::string BANNER =
@@ -41,6 +44,18 @@ int main(int argc, char** argv)
     auto args           = std::make_shared<FullSystemMainCommandLineArgs>(arduino_config);
     bool help_requested = args->loadFromCommandLineArguments(argc, argv);
 
+    // In headless mode we wait for SIGINT or SIGTERM so that we can shut down cleanly.
+    // They have to be blocked before any threads are created, since new threads
+    // inherit the signal mask and the signals could otherwise be handled by any thread
+    sigset_t termination_signals;
+    sigemptyset(&termination_signals);
+    sigaddset(&termination_signals, SIGINT);
+    sigaddset(&termination_signals, SIGTERM);
+    if (!help_requested && args->getHeadless()->value())
+    {
+        pthread_sigmask(SIG_BLOCK, &termination_signals, nullptr);
+    }
+
     LoggerSingleton::initializeLogger(args->getLoggingDir()->value());
 
     if (!help_requested)
@@ -103,15 +118,15 @@ int main(int argc, char** argv)
 
         // Connect observers
         ai->Subject<TbotsProto::PrimitiveSet>::registerObserver(backend);
-        sensor_fusion->Subject<World>::registerObserver(ai);
-        sensor_fusion->Subject<World>::registerObserver(backend);
+        sensor_fusion->Subject<WorldPtr>::registerObserver(ai);
+        sensor_fusion->Subject<WorldPtr>::registerObserver(backend);
         backend->Subject<SensorProto>::registerObserver(sensor_fusion);
         if (!args->getHeadless()->value())
         {
             visualizer =
                 std::make_shared<ThreadedFullSystemGUI>(mutable_thunderbots_config);
 
-            sensor_fusion->Subject<World>::registerObserver(visualizer);
+            sensor_fusion->Subject<WorldPtr>::registerObserver(visualizer);
             ai->Subject<TbotsProto::PrimitiveSet>::registerObserver(visualizer);
             ai->Subject<AIDrawFunction>::registerObserver(visualizer);
             ai->Subject<TbotsProto::PlayInfo>::registerObserver(visualizer);
@@ -164,15 +179,15 @@ int main(int argc, char** argv)
                 friendly_colour_yellow ? TeamColour::YELLOW : TeamColour::BLUE;
 
             auto world_to_ssl_wrapper_conversion_fn =
-                [friendly_team_colour](const World& world) {
-                    return *createSSLWrapperPacket(world, friendly_team_colour);
+                [friendly_team_colour](const WorldPtr& world) {
+                    return *createSSLWrapperPacket(*world, friendly_team_colour);
                 };
 
             auto vision_logger =
                 std::make_shared<ProtoLogger<SSLProto::SSL_WrapperPacket>>(
                     proto_log_output_dir / "SensorFusion_SSL_WrapperPacket");
             auto world_to_vision_adapter = std::make_shared<
-                ObserverSubjectAdapter<World, SSLProto::SSL_WrapperPacket>>(
+                ObserverSubjectAdapter<WorldPtr, SSLProto::SSL_WrapperPacket>>(
                 world_to_ssl_wrapper_conversion_fn);
             sensor_fusion->registerObserver(world_to_vision_adapter);
             world_to_vision_adapter->registerObserver(vision_logger);
@@ -198,11 +213,17 @@ int main(int argc, char** argv)
         }
         else
         {
-            // This blocks forever without using the CPU
-            std::promise<void>().get_future().wait();
+            // This blocks until we're told to terminate without using the CPU
+            int received_signal = 0;
+            sigwait(&termination_signals, &received_signal);
+            LOG(INFO) << "Received signal " << received_signal << ", shutting down";
         }
 
         save_protolog_chunks_fn();
+        LatencyProfiler::writeLatencyProfileToFile(
+            (std::filesystem::path(args->getLoggingDir()->value()) /
+             "latency_profile.pbtxt")
+                .string());
     }
 
     return 0;
@@ -1,4 +1,4 @@
-#include <vector>
+#include <boost/container/small_vector.hpp>
 
 #include "software/geom/angle_segment.h"
 
@@ -70,7 +70,12 @@ class AngleMap
      */
     AngleSegment getBiggestViableAngleSegment();
 
+    // The number of occupied AngleSegments this map can hold without allocating
+    // memory. This covers every robot on the field in a normal game.
+    static constexpr size_t NUM_INLINE_ANGLE_SEGMENTS = 16;
+
    private:
     AngleSegment angle_seg;
-    std::vector<AngleSegment> taken_angle_segments;
+    boost::container::small_vector<AngleSegment, NUM_INLINE_ANGLE_SEGMENTS>
+        taken_angle_segments;
 };
@@ -4,8 +4,6 @@ Point::Point() : x_(0.0), y_(0.0) {}
 
 Point::Point(double x, double y) : x_(x), y_(y) {}
 
-Point::Point(const Point &p) : x_(p.x()), y_(p.y()) {}
-
 Point::Point(const Vector &v) : x_(v.x()), y_(v.y()) {}
 
 double Point::x() const
@@ -49,13 +47,6 @@ Point Point::rotate(const Angle &rot) const
     return Point(x_ * rot.cos() - y_ * rot.sin(), x_ * rot.sin() + y_ * rot.cos());
 }
 
-Point &Point::operator=(const Point &q)
-{
-    x_ = q.x();
-    y_ = q.y();
-    return *this;
-}
-
 Point operator+(const Point &p, const Vector &v)
 {
     return Point(p.x() + v.x(), p.y() + v.y());
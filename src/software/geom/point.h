@@ -30,7 +30,7 @@ class Point final
      *
      * @param the Point to duplicate
      */
-    Point(const Point &p);
+    Point(const Point &p) = default;
 
     /**
      * Creates a new Point from a Vector
@@ -106,7 +106,7 @@ class Point final
      *
      * @return this Point
      */
-    Point &operator=(const Point &other);
+    Point &operator=(const Point &other) = default;
 
    private:
     /**
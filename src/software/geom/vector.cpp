@@ -11,8 +11,6 @@ Vector::Vector() : x_(0.0), y_(0.0) {}
 
 Vector::Vector(double x, double y) : x_(x), y_(y) {}
 
-Vector::Vector(const Vector &v) : x_(v.x()), y_(v.y()) {}
-
 double Vector::x() const
 {
     return x_;
@@ -92,13 +90,6 @@ double Vector::determinant(const Vector &other) const
     return x_ * other.y() - y_ * other.x();
 }
 
-Vector &Vector::operator=(const Vector &q)
-{
-    x_ = q.x();
-    y_ = q.y();
-    return *this;
-}
-
 Angle Vector::orientation() const
 {
     return Angle::fromRadians(std::atan2(y_, x_));
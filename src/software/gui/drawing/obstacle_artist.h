@@ -42,7 +42,7 @@ class ObstacleArtist : public ObstacleVisitor
     void visit(const GeomObstacle<Rectangle>& geom_obstacle) override;
 
     /**
-     * Log the obstacle protobuf to the VISUALIZE log level and clear it
+     * Send the obstacle protobuf to be visualized and clear it
      */
     void visualize();
 
@@ -46,3 +46,11 @@ WorldDrawFunction getDrawWorldFunction(const World& world,
     };
     return WorldDrawFunction(draw_function);
 }
+
+WorldDrawFunction getDrawWorldFunction(WorldPtr world, TeamColour friendly_team_colour)
+{
+    auto draw_function = [world, friendly_team_colour](QGraphicsScene* scene) {
+        drawWorld(scene, *world, friendly_team_colour);
+    };
+    return WorldDrawFunction(draw_function);
+}
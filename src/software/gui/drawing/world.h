@@ -32,3 +32,15 @@ void drawWorld(QGraphicsScene* scene, const World& world,
  */
 WorldDrawFunction getDrawWorldFunction(const World& world,
                                        TeamColour friendly_team_colour);
+
+/**
+ * Returns a function that represents how to draw the provided world. The returned
+ * function shares the world instead of holding a copy of it, so the function is cheap
+ * to copy.
+ *
+ * @param world The world to create a DrawFunctionWrapper for
+ * @param friendly_team_colour The colour of the friendly team
+ *
+ * @return A function that represents how to draw the provided world.
+ */
+WorldDrawFunction getDrawWorldFunction(WorldPtr world, TeamColour friendly_team_colour);
@@ -11,10 +11,16 @@
 
 ThreadedFullSystemGUI::ThreadedFullSystemGUI(
     std::shared_ptr<ThunderbotsConfig> mutable_thunderbots_config)
-    : FirstInFirstOutThreadedObserver<World>(),
-      FirstInFirstOutThreadedObserver<AIDrawFunction>(),
-      FirstInFirstOutThreadedObserver<TbotsProto::PlayInfo>(),
-      FirstInFirstOutThreadedObserver<SensorProto>(),
+    // Only the most recent World, AI and PlayInfo are drawn, but every SensorProto is
+    // shown so that no robot status is missed
+    : ConfigurableThreadedObserver<WorldPtr>(ThreadedObserverPolicy::LATEST_VALUE),
+      ConfigurableThreadedObserver<AIDrawFunction>(ThreadedObserverPolicy::LATEST_VALUE),
+      ConfigurableThreadedObserver<TbotsProto::PlayInfo>(
+          ThreadedObserverPolicy::LATEST_VALUE),
+      ConfigurableThreadedObserver<SensorProto>(
+          ThreadedObserverPolicy::FIRST_IN_FIRST_OUT),
+      ConfigurableThreadedObserver<TbotsProto::PrimitiveSet>(
+          ThreadedObserverPolicy::LATEST_VALUE),
       termination_promise_ptr(std::make_shared<std::promise<void>>()),
       world_draw_functions_buffer(std::make_shared<ThreadSafeBuffer<WorldDrawFunction>>(
           WORLD_DRAW_FUNCTIONS_BUFFER_SIZE, false)),
@@ -88,7 +94,7 @@ void ThreadedFullSystemGUI::createAndRunFullSystemGUI()
     termination_promise_ptr->set_value();
 }
 
-void ThreadedFullSystemGUI::onValueReceived(World world)
+void ThreadedFullSystemGUI::onValueReceived(WorldPtr world)
 {
     auto friendly_team_colour = mutable_thunderbots_config->getSensorFusionConfig()
                                         ->getFriendlyColorYellow()
@@ -101,17 +107,17 @@ void ThreadedFullSystemGUI::onValueReceived(World world)
     if (remaining_attempts_to_set_view_area > 0)
     {
         remaining_attempts_to_set_view_area--;
-        view_area_buffer->push(world.field().fieldBoundary());
+        view_area_buffer->push(world->field().fieldBoundary());
     }
 
-    LOG(VISUALIZE) << *createNamedValue(
+    sendVisualization(*createNamedValue(
         "World Hz",
         static_cast<float>(
-            FirstInFirstOutThreadedObserver<World>::getDataReceivedPerSecond()));
+            ConfigurableThreadedObserver<WorldPtr>::getDataReceivedPerSecond())));
 
 
     worlds_received_per_second_buffer->push(
-        FirstInFirstOutThreadedObserver<World>::getDataReceivedPerSecond());
+        ConfigurableThreadedObserver<WorldPtr>::getDataReceivedPerSecond());
 }
 
 void ThreadedFullSystemGUI::onValueReceived(AIDrawFunction draw_function)
@@ -131,13 +137,13 @@ void ThreadedFullSystemGUI::onValueReceived(SensorProto sensor_msg)
 
 void ThreadedFullSystemGUI::onValueReceived(TbotsProto::PrimitiveSet primitive_msg)
 {
-    LOG(VISUALIZE) << *createNamedValue(
+    sendVisualization(*createNamedValue(
         "Primitive Hz",
-        static_cast<float>(FirstInFirstOutThreadedObserver<
-                           TbotsProto::PrimitiveSet>::getDataReceivedPerSecond()));
+        static_cast<float>(ConfigurableThreadedObserver<
+                           TbotsProto::PrimitiveSet>::getDataReceivedPerSecond())));
 
     primitives_sent_per_second_buffer->push(
-        FirstInFirstOutThreadedObserver<
+        ConfigurableThreadedObserver<
             TbotsProto::PrimitiveSet>::getDataReceivedPerSecond());
 }
 
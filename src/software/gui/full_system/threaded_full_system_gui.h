@@ -12,7 +12,7 @@
 #include "software/geom/rectangle.h"
 #include "software/gui/drawing/draw_functions.h"
 #include "software/gui/full_system/widgets/full_system_gui.h"
-#include "software/multithreading/first_in_first_out_threaded_observer.h"
+#include "software/multithreading/configurable_threaded_observer.h"
 #include "software/multithreading/thread_safe_buffer.hpp"
 #include "software/world/world.h"
 
@@ -21,11 +21,11 @@
  * visualizing information about our AI, and allowing users to control it.
  */
 class ThreadedFullSystemGUI
-    : public FirstInFirstOutThreadedObserver<World>,
-      public FirstInFirstOutThreadedObserver<AIDrawFunction>,
-      public FirstInFirstOutThreadedObserver<TbotsProto::PlayInfo>,
-      public FirstInFirstOutThreadedObserver<SensorProto>,
-      public FirstInFirstOutThreadedObserver<TbotsProto::PrimitiveSet>
+    : public ConfigurableThreadedObserver<WorldPtr>,
+      public ConfigurableThreadedObserver<AIDrawFunction>,
+      public ConfigurableThreadedObserver<TbotsProto::PlayInfo>,
+      public ConfigurableThreadedObserver<SensorProto>,
+      public ConfigurableThreadedObserver<TbotsProto::PrimitiveSet>
 {
    public:
     explicit ThreadedFullSystemGUI(
@@ -33,7 +33,7 @@ class ThreadedFullSystemGUI
 
     ~ThreadedFullSystemGUI() override;
 
-    void onValueReceived(World world) override;
+    void onValueReceived(WorldPtr world) override;
     void onValueReceived(AIDrawFunction draw_function) override;
     void onValueReceived(TbotsProto::PlayInfo play_info_msg) override;
     void onValueReceived(SensorProto sensor_msg) override;
@@ -1,5 +1,7 @@
 #include "software/jetson_nano/services/network.h"
 
+#include <utility>
+
 #include "software/networking/threaded_proto_udp_listener.hpp"
 #include "software/networking/threaded_proto_udp_sender.hpp"
 
@@ -8,7 +10,13 @@
 NetworkService::NetworkService(const std::string& ip_address,
                                unsigned short vision_listener_port,
                                unsigned short primitive_listener_port,
+                               unsigned short robot_primitive_listener_port,
                                unsigned short robot_status_sender_port, bool multicast)
+    : last_primitive_set_time_sent(0),
+      last_vision_time_sent(0),
+      last_robot_primitive_sequence_number(0),
+      last_robot_primitive_time_sent(0),
+      in_destructor(false)
 {
     sender = std::make_unique<ThreadedProtoUdpSender<TbotsProto::RobotStatus>>(
         ip_address, robot_status_sender_port, multicast);
@@ -19,6 +27,19 @@ NetworkService::NetworkService(const std::string& ip_address,
     listener_vision = std::make_unique<ThreadedProtoUdpListener<TbotsProto::Vision>>(
         ip_address, vision_listener_port,
         boost::bind(&NetworkService::visionCallback, this, _1), multicast);
+    listener_robot_primitive =
+        std::make_unique<ThreadedProtoUdpListener<TbotsProto::RobotPrimitive>>(
+            ip_address, robot_primitive_listener_port,
+            boost::bind(&NetworkService::robotPrimitiveCallback, this, _1), multicast);
+    robot_status_sender_thread = std::thread([this]() { sendRobotStatuses(); });
+}
+
+NetworkService::~NetworkService()
+{
+    in_destructor = true;
+    // Wake up the status sender thread so it sees that it should stop
+    robot_status_mailbox.publish();
+    robot_status_sender_thread.join();
 }
 
 void NetworkService::start()
@@ -26,28 +47,79 @@ void NetworkService::start()
     // TODO (#2436) remove
 }
 
-std::tuple<TbotsProto::PrimitiveSet, TbotsProto::Vision> NetworkService::poll(
-    const TbotsProto::RobotStatus& robot_status)
+void NetworkService::sendRobotStatus(const TbotsProto::RobotStatus& robot_status)
 {
-    std::scoped_lock lock{primitive_set_mutex, vision_mutex};
-    sender->sendProto(robot_status);
-    return std::tuple<TbotsProto::PrimitiveSet, TbotsProto::Vision>{primitive_set_msg,
-                                                                    vision_msg};
+    // Copying into the reused buffer doesn't reallocate the fields of the robot status
+    robot_status_mailbox.getWriteBuffer().CopyFrom(robot_status);
+    robot_status_mailbox.publish();
 }
 
+TbotsProto::PrimitiveSet* NetworkService::getNewPrimitiveSet()
+{
+    return primitive_set_mailbox.readNewValue();
+}
+
+TbotsProto::Vision* NetworkService::getNewVision()
+{
+    return vision_mailbox.readNewValue();
+}
+
+TbotsProto::RobotPrimitive* NetworkService::getNewRobotPrimitive()
+{
+    return robot_primitive_mailbox.readNewValue();
+}
 
 void NetworkService::stop()
 {
     // TODO (#2436) remove
 }
 
-void NetworkService::primitiveSetCallback(TbotsProto::PrimitiveSet input)
+void NetworkService::primitiveSetCallback(TbotsProto::PrimitiveSet& input)
+{
+    if (input.time_sent().epoch_timestamp_seconds() <= last_primitive_set_time_sent)
+    {
+        return;
+    }
+
+    last_primitive_set_time_sent = input.time_sent().epoch_timestamp_seconds();
+    primitive_set_mailbox.write(std::move(input));
+}
+
+void NetworkService::visionCallback(TbotsProto::Vision& input)
 {
-    std::scoped_lock<std::mutex> lock(primitive_set_mutex);
-    primitive_set_msg = input;
+    if (input.time_sent().epoch_timestamp_seconds() <= last_vision_time_sent)
+    {
+        return;
+    }
+
+    last_vision_time_sent = input.time_sent().epoch_timestamp_seconds();
+    vision_mailbox.write(std::move(input));
 }
-void NetworkService::visionCallback(TbotsProto::Vision input)
+
+void NetworkService::robotPrimitiveCallback(TbotsProto::RobotPrimitive& input)
+{
+    // A lower sequence number is only accepted if the primitive was sent later, which
+    // happens when the AI is restarted and its sequence numbers start over
+    if (input.sequence_number() <= last_robot_primitive_sequence_number &&
+        input.time_sent().epoch_timestamp_seconds() <= last_robot_primitive_time_sent)
+    {
+        return;
+    }
+
+    last_robot_primitive_sequence_number = input.sequence_number();
+    last_robot_primitive_time_sent       = input.time_sent().epoch_timestamp_seconds();
+    robot_primitive_mailbox.write(std::move(input));
+}
+
+void NetworkService::sendRobotStatuses()
 {
-    std::scoped_lock<std::mutex> lock(vision_mutex);
-    vision_msg = input;
+    while (!in_destructor)
+    {
+        TbotsProto::RobotStatus* robot_status = robot_status_mailbox.waitForNewValue(
+            Duration::fromMilliseconds(ROBOT_STATUS_WAIT_TIME_MS));
+        if (robot_status != nullptr && !in_destructor)
+        {
+            sender->sendProto(*robot_status);
+        }
+    }
 }
@@ -1,11 +1,13 @@
 #pragma once
 
-#include <mutex>
+#include <atomic>
+#include <thread>
 
 #include "proto/robot_status_msg.pb.h"
 #include "proto/tbots_software_msgs.pb.h"
 #include "shared/robot_constants.h"
 #include "software/jetson_nano/services/service.h"
+#include "software/multithreading/lock_free_mailbox.hpp"
 #include "software/networking/threaded_proto_udp_listener.hpp"
 #include "software/networking/threaded_proto_udp_sender.hpp"
 
@@ -19,12 +21,15 @@ class NetworkService : public Service
      * @param ip_address The IP Address the service should connect to
      * @param vision_listener_port The port to listen for vision protos
      * @param primitive_listener_port The port to listen for primitive protos
+     * @param robot_primitive_listener_port The port to listen for the RobotPrimitive of
+     * this robot
      * @param robot_status_sender_port The port to send robot status
      * @param multicast  If true, then the provided IP address is a multicast address and
      * we should join the group
      */
     NetworkService(const std::string& ip_address, unsigned short vision_listener_port,
                    unsigned short primitive_listener_port,
+                   unsigned short robot_primitive_listener_port,
                    unsigned short robot_status_sender_port, bool multicast);
 
     /**
@@ -38,29 +43,85 @@ class NetworkService : public Service
     void stop() override;
 
     /**
-     * When the network service is polled, it sends the robot_status and returns
-     * a tuple of the most recent PrimitiveSet and Vision
+     * Sends the robot status in the background. This only copies the robot status and
+     * never waits for the network, so it can be called from the real-time loop. If the
+     * previous robot status wasn't sent yet, it is replaced by this one.
      *
-     * @returns a tuple of the stored primitive_set and vision
+     * @param robot_status The robot status to send
      */
-    std::tuple<TbotsProto::PrimitiveSet, TbotsProto::Vision> poll(
-        const TbotsProto::RobotStatus& robot_status);
+    void sendRobotStatus(const TbotsProto::RobotStatus& robot_status);
+
+    /**
+     * Gets the newest PrimitiveSet if one was received since the last call. This never
+     * waits for the listener threads.
+     *
+     * @returns the newest PrimitiveSet, or nullptr if none was received since the last
+     * call. The PrimitiveSet is valid and may be modified until the next call.
+     */
+    TbotsProto::PrimitiveSet* getNewPrimitiveSet();
+
+    /**
+     * Gets the newest Vision if one was received since the last call. This never
+     * waits for the listener threads.
+     *
+     * @returns the newest Vision, or nullptr if none was received since the last call.
+     * The Vision is valid and may be modified until the next call.
+     */
+    TbotsProto::Vision* getNewVision();
+
+    /**
+     * Gets the newest RobotPrimitive for this robot if one was received since the last
+     * call. This never waits for the listener threads.
+     *
+     * @returns the newest RobotPrimitive, or nullptr if none was received since the last
+     * call. The RobotPrimitive is valid and may be modified until the next call.
+     */
+    TbotsProto::RobotPrimitive* getNewRobotPrimitive();
+
+    ~NetworkService();
 
    private:
-    // Variables
-    TbotsProto::PrimitiveSet primitive_set_msg;
-    TbotsProto::Vision vision_msg;
+    // Functions to callback primitiveSet and vision and stores them in a variable
+    void primitiveSetCallback(TbotsProto::PrimitiveSet& input);
+    void visionCallback(TbotsProto::Vision& input);
 
-    std::mutex primitive_set_mutex;
-    std::mutex vision_mutex;
+    // Moves a RobotPrimitive into robot_primitive_mailbox, unless it arrived late or out
+    // of order
+    void robotPrimitiveCallback(TbotsProto::RobotPrimitive& input);
+
+    // Sends every robot status written to robot_status_mailbox, until the service is
+    // destroyed
+    void sendRobotStatuses();
+
+    // The newest messages, handed from the listener threads to the real-time loop and
+    // from the real-time loop to the status sender thread without either waiting on
+    // the other. These are declared before the threads that use them so they outlive
+    // the threads.
+    LockFreeMailbox<TbotsProto::PrimitiveSet> primitive_set_mailbox;
+    LockFreeMailbox<TbotsProto::Vision> vision_mailbox;
+    LockFreeMailbox<TbotsProto::RobotPrimitive> robot_primitive_mailbox;
+    LockFreeMailbox<TbotsProto::RobotStatus> robot_status_mailbox;
+
+    // The send time of the last accepted PrimitiveSet and Vision, only used by their
+    // listener threads
+    double last_primitive_set_time_sent;
+    double last_vision_time_sent;
+    // The sequence number and send time of the last accepted RobotPrimitive, only used
+    // by its listener thread
+    uint64_t last_robot_primitive_sequence_number;
+    double last_robot_primitive_time_sent;
 
     std::unique_ptr<ThreadedProtoUdpSender<TbotsProto::RobotStatus>> sender;
     std::unique_ptr<ThreadedProtoUdpListener<TbotsProto::PrimitiveSet>>
         listener_primitive_set;
     std::unique_ptr<ThreadedProtoUdpListener<TbotsProto::Vision>> listener_vision;
+    std::unique_ptr<ThreadedProtoUdpListener<TbotsProto::RobotPrimitive>>
+        listener_robot_primitive;
 
+    std::atomic<bool> in_destructor;
+    std::thread robot_status_sender_thread;
 
-    // Functions to callback primitiveSet and vision and stores them in a variable
-    void primitiveSetCallback(TbotsProto::PrimitiveSet input);
-    void visionCallback(TbotsProto::Vision input);
+    // How long the status sender thread waits for a robot status before checking if
+    // the service is being destroyed
+    static constexpr double ROBOT_STATUS_WAIT_TIME_MS = 100;
 };
@@ -0,0 +1,420 @@
+#include "software/jetson_nano/services/network.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "proto/message_translation/tbots_protobuf.h"
+#include "proto/primitive/primitive_msg_factory.h"
+#include "shared/2021_robot_constants.h"
+#include "shared/constants.h"
+#include "software/networking/threaded_proto_udp_listener.hpp"
+#include "software/networking/threaded_proto_udp_sender.hpp"
+#include "software/test_util/test_util.h"
+
+class NetworkServiceTest : public ::testing::Test
+{
+   protected:
+    NetworkServiceTest()
+        : robot_constants(create2021RobotConstants()),
+          network_service(
+              LOCALHOST, TEST_VISION_PORT, TEST_PRIMITIVE_PORT,
+              static_cast<unsigned short>(TEST_ROBOT_PRIMITIVE_PORT_BASE + ROBOT_ID),
+              TEST_ROBOT_STATUS_PORT, false),
+          robot_primitive_sender(LOCALHOST, TEST_ROBOT_PRIMITIVE_PORT_BASE, false)
+    {
+    }
+
+    /**
+     * Creates a RobotPrimitive with a MovePrimitive
+     *
+     * @param sequence_number The sequence number of the RobotPrimitive
+     * @param time_sent_seconds The epoch timestamp the RobotPrimitive was sent at
+     *
+     * @return the RobotPrimitive
+     */
+    TbotsProto::RobotPrimitive createRobotPrimitive(uint64_t sequence_number,
+                                                    double time_sent_seconds)
+    {
+        TbotsProto::RobotPrimitive robot_primitive;
+        robot_primitive.set_sequence_number(sequence_number);
+        robot_primitive.mutable_time_sent()->set_epoch_timestamp_seconds(
+            time_sent_seconds);
+        *robot_primitive.mutable_primitive() = *createMovePrimitive(
+            Point(1, 2), 1, Angle::half(), TbotsProto::DribblerMode::OFF,
+            {AutoChipOrKickMode::OFF, 0}, TbotsProto::MaxAllowedSpeedMode::PHYSICAL_LIMIT,
+            0.0, robot_constants);
+        return robot_primitive;
+    }
+
+    /**
+     * Waits for the network service to receive a RobotPrimitive
+     *
+     * @param timeout How long to wait for
+     *
+     * @return the RobotPrimitive, or nullptr if none was received before the timeout
+     */
+    TbotsProto::RobotPrimitive* waitForRobotPrimitive(std::chrono::milliseconds timeout)
+    {
+        auto start_time = std::chrono::steady_clock::now();
+        while (std::chrono::steady_clock::now() - start_time < timeout)
+        {
+            TbotsProto::RobotPrimitive* robot_primitive =
+                network_service.getNewRobotPrimitive();
+            if (robot_primitive != nullptr)
+            {
+                return robot_primitive;
+            }
+            std::this_thread::yield();
+        }
+        return nullptr;
+    }
+
+    /**
+     * Gets the given percentile of the given durations
+     *
+     * @param durations The durations, which are sorted by this function
+     * @param percentile The percentile to get, from 0 to 100
+     *
+     * @return the percentile of the durations in microseconds
+     */
+    static double percentileMicroseconds(std::vector<std::chrono::nanoseconds>& durations,
+                                         double percentile)
+    {
+        std::sort(durations.begin(), durations.end());
+        size_t index =
+            std::min(durations.size() - 1,
+                     static_cast<size_t>(percentile / 100.0 *
+                                         static_cast<double>(durations.size())));
+        return static_cast<double>(durations[index].count()) / 1000.0;
+    }
+
+    static constexpr const char* LOCALHOST                         = "127.0.0.1";
+    static constexpr unsigned short TEST_VISION_PORT               = 43069;
+    static constexpr unsigned short TEST_PRIMITIVE_PORT            = 43070;
+    static constexpr unsigned short TEST_ROBOT_STATUS_PORT         = 43071;
+    static constexpr unsigned short TEST_ROBOT_PRIMITIVE_PORT_BASE = 43080;
+    // The robot id of the network service, this is the last robot in a full team so
+    // its primitive is sent last
+    static constexpr unsigned int ROBOT_ID   = 10;
+    static constexpr unsigned int NUM_ROBOTS = 11;
+
+    RobotConstants_t robot_constants;
+    NetworkService network_service;
+    ThreadedProtoUdpSender<TbotsProto::RobotPrimitive> robot_primitive_sender;
+};
+
+TEST_F(NetworkServiceTest, get_new_robot_primitive_only_returns_a_robot_primitive_once)
+{
+    robot_primitive_sender.sendProto(
+        createRobotPrimitive(1, 1.0),
+        static_cast<unsigned short>(TEST_ROBOT_PRIMITIVE_PORT_BASE + ROBOT_ID));
+
+    TbotsProto::RobotPrimitive* robot_primitive =
+        waitForRobotPrimitive(std::chrono::milliseconds(1000));
+    ASSERT_NE(nullptr, robot_primitive);
+    EXPECT_EQ(1u, robot_primitive->sequence_number());
+    EXPECT_TRUE(robot_primitive->primitive().has_move());
+
+    EXPECT_EQ(nullptr, network_service.getNewRobotPrimitive());
+}
+
+TEST_F(NetworkServiceTest, robot_primitive_for_another_robot_is_not_received)
+{
+    robot_primitive_sender.sendProto(
+        createRobotPrimitive(1, 1.0),
+        static_cast<unsigned short>(TEST_ROBOT_PRIMITIVE_PORT_BASE + ROBOT_ID - 1));
+
+    EXPECT_EQ(nullptr, waitForRobotPrimitive(std::chrono::milliseconds(100)));
+}
+
+TEST_F(NetworkServiceTest, robot_primitive_that_arrives_out_of_order_is_discarded)
+{
+    robot_primitive_sender.sendProto(
+        createRobotPrimitive(2, 2.0),
+        static_cast<unsigned short>(TEST_ROBOT_PRIMITIVE_PORT_BASE + ROBOT_ID));
+    ASSERT_NE(nullptr, waitForRobotPrimitive(std::chrono::milliseconds(1000)));
+
+    robot_primitive_sender.sendProto(
+        createRobotPrimitive(1, 1.0),
+        static_cast<unsigned short>(TEST_ROBOT_PRIMITIVE_PORT_BASE + ROBOT_ID));
+    EXPECT_EQ(nullptr, waitForRobotPrimitive(std::chrono::milliseconds(100)));
+}
+
+TEST_F(NetworkServiceTest, robot_primitive_from_a_restarted_ai_is_received)
+{
+    robot_primitive_sender.sendProto(
+        createRobotPrimitive(100, 1.0),
+        static_cast<unsigned short>(TEST_ROBOT_PRIMITIVE_PORT_BASE + ROBOT_ID));
+    ASSERT_NE(nullptr, waitForRobotPrimitive(std::chrono::milliseconds(1000)));
+
+    // A restarted AI starts counting from 1 again, but sends newer primitives
+    robot_primitive_sender.sendProto(
+        createRobotPrimitive(1, 2.0),
+        static_cast<unsigned short>(TEST_ROBOT_PRIMITIVE_PORT_BASE + ROBOT_ID));
+    TbotsProto::RobotPrimitive* robot_primitive =
+        waitForRobotPrimitive(std::chrono::milliseconds(1000));
+    ASSERT_NE(nullptr, robot_primitive);
+    EXPECT_EQ(1u, robot_primitive->sequence_number());
+}
+
+TEST_F(NetworkServiceTest, primitive_set_that_arrives_out_of_order_is_discarded)
+{
+    ThreadedProtoUdpSender<TbotsProto::PrimitiveSet> primitive_set_sender(
+        LOCALHOST, TEST_PRIMITIVE_PORT, false);
+    TbotsProto::PrimitiveSet primitive_set;
+
+    primitive_set.mutable_time_sent()->set_epoch_timestamp_seconds(2.0);
+    primitive_set_sender.sendProto(primitive_set);
+    primitive_set.mutable_time_sent()->set_epoch_timestamp_seconds(1.0);
+    primitive_set_sender.sendProto(primitive_set);
+
+    TbotsProto::PrimitiveSet* new_primitive_set = nullptr;
+    auto start_time                             = std::chrono::steady_clock::now();
+    while (new_primitive_set == nullptr &&
+           std::chrono::steady_clock::now() - start_time < std::chrono::seconds(1))
+    {
+        new_primitive_set = network_service.getNewPrimitiveSet();
+    }
+    ASSERT_NE(nullptr, new_primitive_set);
+    EXPECT_EQ(2.0, new_primitive_set->time_sent().epoch_timestamp_seconds());
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    EXPECT_EQ(nullptr, network_service.getNewPrimitiveSet());
+}
+
+TEST_F(NetworkServiceTest, robot_status_is_sent_in_the_background)
+{
+    std::atomic<bool> robot_status_received(false);
+    ThreadedProtoUdpListener<TbotsProto::RobotStatus> robot_status_listener(
+        LOCALHOST, TEST_ROBOT_STATUS_PORT,
+        [&robot_status_received](TbotsProto::RobotStatus& robot_status) {
+            if (robot_status.robot_id() == ROBOT_ID)
+            {
+                robot_status_received = true;
+            }
+        },
+        false);
+
+    TbotsProto::RobotStatus robot_status;
+    robot_status.set_robot_id(ROBOT_ID);
+    auto start_time = std::chrono::steady_clock::now();
+    while (!robot_status_received &&
+           std::chrono::steady_clock::now() - start_time < std::chrono::seconds(1))
+    {
+        network_service.sendRobotStatus(robot_status);
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+
+    EXPECT_TRUE(robot_status_received);
+}
+
+// This test is disabled to speed up CI, it can be enabled by removing "DISABLED_" from
+// the test name
+TEST_F(NetworkServiceTest,
+       DISABLED_send_primitive_set_compared_to_sending_robot_primitives)
+{
+    const unsigned int NUM_ITERATIONS = 10000;
+
+    // A full team of robots, like the AI sends every tick
+    TbotsProto::PrimitiveSet primitive_set;
+    for (unsigned int robot_id = 0; robot_id < NUM_ROBOTS; robot_id++)
+    {
+        (*primitive_set.mutable_robot_primitives())[robot_id] = *createMovePrimitive(
+            Point(robot_id, 2), 1, Angle::half(), TbotsProto::DribblerMode::MAX_FORCE,
+            {AutoChipOrKickMode::AUTOKICK, 3},
+            TbotsProto::MaxAllowedSpeedMode::PHYSICAL_LIMIT, 0.0, robot_constants);
+    }
+    TbotsProto::RobotPrimitive robot_primitive;
+    *robot_primitive.mutable_primitive() = primitive_set.robot_primitives().at(ROBOT_ID);
+    robot_primitive.set_sequence_number(NUM_ITERATIONS);
+    robot_primitive.mutable_time_sent()->set_epoch_timestamp_seconds(NUM_ITERATIONS);
+
+    std::cout << "PrimitiveSet: " << primitive_set.ByteSizeLong()
+              << " bytes received by every robot" << std::endl;
+    std::cout << "RobotPrimitive: " << robot_primitive.ByteSizeLong()
+              << " bytes received by every robot" << std::endl;
+
+    // Every primitive is waited for before sending the next one, so this is the time
+    // from the AI sending the primitives of a tick to the last robot in the team being
+    // able to start its primitive
+    ThreadedProtoUdpSender<TbotsProto::PrimitiveSet> primitive_set_sender(
+        LOCALHOST, TEST_PRIMITIVE_PORT, false);
+    TbotsProto::Primitive primitive;
+    auto start_time = std::chrono::system_clock::now();
+    for (unsigned int i = 1; i <= NUM_ITERATIONS; i++)
+    {
+        primitive_set.mutable_time_sent()->set_epoch_timestamp_seconds(i);
+        primitive_set_sender.sendProto(primitive_set);
+
+        TbotsProto::PrimitiveSet* new_primitive_set;
+        do
+        {
+            new_primitive_set = network_service.getNewPrimitiveSet();
+        } while (new_primitive_set == nullptr);
+        primitive.Swap(&new_primitive_set->mutable_robot_primitives()->at(ROBOT_ID));
+    }
+    double duration_ms = ::TestUtil::millisecondsSince(start_time);
+    std::cout << "PrimitiveSet: " << duration_ms * 1000.0 / NUM_ITERATIONS
+              << "us from sending to the last robot having its primitive" << std::endl;
+
+    start_time = std::chrono::system_clock::now();
+    for (unsigned int i = 1; i <= NUM_ITERATIONS; i++)
+    {
+        robot_primitive.mutable_time_sent()->set_epoch_timestamp_seconds(NUM_ITERATIONS +
+                                                                         i);
+        for (unsigned int robot_id = 0; robot_id < NUM_ROBOTS; robot_id++)
+        {
+            robot_primitive.set_sequence_number(NUM_ITERATIONS + i);
+            robot_primitive_sender.sendProto(
+                robot_primitive,
+                static_cast<unsigned short>(TEST_ROBOT_PRIMITIVE_PORT_BASE + robot_id));
+        }
+
+        TbotsProto::RobotPrimitive* new_robot_primitive;
+        do
+        {
+            new_robot_primitive = network_service.getNewRobotPrimitive();
+        } while (new_robot_primitive == nullptr);
+        primitive.Swap(new_robot_primitive->mutable_primitive());
+    }
+    duration_ms = ::TestUtil::millisecondsSince(start_time);
+    std::cout << "RobotPrimitive: " << duration_ms * 1000.0 / NUM_ITERATIONS
+              << "us from sending to the last robot having its primitive" << std::endl;
+}
+
+// This test is disabled to speed up CI, it can be enabled by removing "DISABLED_" from
+// the test name
+TEST_F(NetworkServiceTest, DISABLED_loop_jitter_while_flooded_with_packets)
+{
+    const unsigned int NUM_ITERATIONS = 2000;
+    const long LOOP_PERIOD_NS         = static_cast<long>(NANOSECONDS_PER_SECOND) / 1000;
+
+    TbotsProto::PrimitiveSet primitive_set;
+    for (unsigned int robot_id = 0; robot_id < NUM_ROBOTS; robot_id++)
+    {
+        (*primitive_set.mutable_robot_primitives())[robot_id] = *createMovePrimitive(
+            Point(robot_id, 2), 1, Angle::half(), TbotsProto::DribblerMode::MAX_FORCE,
+            {AutoChipOrKickMode::AUTOKICK, 3},
+            TbotsProto::MaxAllowedSpeedMode::PHYSICAL_LIMIT, 0.0, robot_constants);
+    }
+    TbotsProto::Vision vision;
+    for (unsigned int robot_id = 0; robot_id < NUM_ROBOTS; robot_id++)
+    {
+        (*vision.mutable_robot_states())[robot_id] = *createRobotStateProto(RobotState(
+            Point(robot_id, 2), Vector(), Angle::half(), AngularVelocity::zero()));
+    }
+    TbotsProto::RobotStatus robot_status;
+    robot_status.set_robot_id(ROBOT_ID);
+
+    // Runs a stand-in for the Thunderloop at 1kHz, and prints the distribution of how
+    // late the loop wakes up and of how long it takes to exchange messages with the
+    // network service
+    auto run_loop = [&](const std::string& name) {
+        std::vector<std::chrono::nanoseconds> wake_up_latencies;
+        std::vector<std::chrono::nanoseconds> poll_durations;
+        unsigned int num_new_messages = 0;
+        TbotsProto::Primitive primitive;
+        TbotsProto::RobotState robot_state;
+
+        struct timespec next_shot;
+        clock_gettime(CLOCK_MONOTONIC, &next_shot);
+        for (unsigned int i = 0; i < NUM_ITERATIONS; i++)
+        {
+            next_shot.tv_nsec += LOOP_PERIOD_NS;
+            while (next_shot.tv_nsec >= static_cast<long>(NANOSECONDS_PER_SECOND))
+            {
+                next_shot.tv_nsec -= static_cast<long>(NANOSECONDS_PER_SECOND);
+                next_shot.tv_sec++;
+            }
+            clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &next_shot, NULL);
+
+            struct timespec wake_up_time;
+            clock_gettime(CLOCK_MONOTONIC, &wake_up_time);
+            wake_up_latencies.emplace_back((wake_up_time.tv_sec - next_shot.tv_sec) *
+                                               static_cast<long>(NANOSECONDS_PER_SECOND) +
+                                           (wake_up_time.tv_nsec - next_shot.tv_nsec));
+
+            auto poll_start_time = std::chrono::steady_clock::now();
+            network_service.sendRobotStatus(robot_status);
+            if (TbotsProto::PrimitiveSet* new_primitive_set =
+                    network_service.getNewPrimitiveSet())
+            {
+                primitive.Swap(
+                    &new_primitive_set->mutable_robot_primitives()->at(ROBOT_ID));
+                num_new_messages++;
+            }
+            if (TbotsProto::RobotPrimitive* new_robot_primitive =
+                    network_service.getNewRobotPrimitive())
+            {
+                primitive.Swap(new_robot_primitive->mutable_primitive());
+                num_new_messages++;
+            }
+            if (TbotsProto::Vision* new_vision = network_service.getNewVision())
+            {
+                robot_state.Swap(&new_vision->mutable_robot_states()->at(ROBOT_ID));
+                num_new_messages++;
+            }
+            poll_durations.emplace_back(std::chrono::steady_clock::now() -
+                                        poll_start_time);
+        }
+
+        std::cout << name << ": " << num_new_messages << " new messages" << std::endl
+                  << "  wake up latency: p50 "
+                  << percentileMicroseconds(wake_up_latencies, 50) << "us, p99 "
+                  << percentileMicroseconds(wake_up_latencies, 99) << "us, max "
+                  << percentileMicroseconds(wake_up_latencies, 100) << "us" << std::endl
+                  << "  poll duration: p50 " << percentileMicroseconds(poll_durations, 50)
+                  << "us, p99 " << percentileMicroseconds(poll_durations, 99)
+                  << "us, max " << percentileMicroseconds(poll_durations, 100) << "us"
+                  << std::endl;
+    };
+
+    run_loop("Idle network");
+
+    // Stand-ins for the AI, that send every message as fast as they can
+    std::atomic<bool> flooding(true);
+    std::vector<std::thread> flood_threads;
+    flood_threads.emplace_back([&]() {
+        ThreadedProtoUdpSender<TbotsProto::PrimitiveSet> sender(
+            LOCALHOST, TEST_PRIMITIVE_PORT, false);
+        TbotsProto::PrimitiveSet message = primitive_set;
+        for (unsigned int i = 1; flooding; i++)
+        {
+            message.mutable_time_sent()->set_epoch_timestamp_seconds(i);
+            sender.sendProto(message);
+        }
+    });
+    flood_threads.emplace_back([&]() {
+        ThreadedProtoUdpSender<TbotsProto::Vision> sender(LOCALHOST, TEST_VISION_PORT,
+                                                          false);
+        TbotsProto::Vision message = vision;
+        for (unsigned int i = 1; flooding; i++)
+        {
+            message.mutable_time_sent()->set_epoch_timestamp_seconds(i);
+            sender.sendProto(message);
+        }
+    });
+    flood_threads.emplace_back([&]() {
+        TbotsProto::RobotPrimitive message;
+        *message.mutable_primitive() = primitive_set.robot_primitives().at(ROBOT_ID);
+        for (unsigned int i = 1; flooding; i++)
+        {
+            message.set_sequence_number(i);
+            robot_primitive_sender.sendProto(
+                message,
+                static_cast<unsigned short>(TEST_ROBOT_PRIMITIVE_PORT_BASE + ROBOT_ID));
+        }
+    });
+
+    run_loop("Flooded network");
+
+    flooding = false;
+    for (std::thread& flood_thread : flood_threads)
+    {
+        flood_thread.join();
+    }
+}
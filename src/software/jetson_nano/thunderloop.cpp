@@ -19,6 +19,10 @@ extern int clock_nanosleep(clockid_t __clock_id, int __flags,
 
 Thunderloop::Thunderloop(const RobotConstants_t& robot_constants,
                          const WheelConstants_t& wheel_consants, const int loop_hz)
+    // The timing of the loop is summarized once a second
+    : thunderloop_telemetry_(
+          static_cast<uint64_t>(NANOSECONDS_PER_SECOND / static_cast<double>(loop_hz)),
+          static_cast<unsigned int>(loop_hz))
 {
     robot_id_        = 0;
     channel_id_      = 0;
@@ -29,7 +33,9 @@ Thunderloop::Thunderloop(const RobotConstants_t& robot_constants,
     motor_service_   = std::make_unique<MotorService>(robot_constants, wheel_consants);
     network_service_ = std::make_unique<NetworkService>(
         std::string(ROBOT_MULTICAST_CHANNELS[channel_id_]) + "%" + "eth0", VISION_PORT,
-        PRIMITIVE_PORT, ROBOT_STATUS_PORT, true);
+        PRIMITIVE_PORT,
+        static_cast<unsigned short>(ROBOT_PRIMITIVE_PORT_BASE + robot_id_),
+        ROBOT_STATUS_PORT, true);
     redis_client_ = std::make_unique<RedisClient>(REDIS_DEFAULT_HOST, REDIS_DEFAULT_PORT);
 }
 
@@ -46,12 +52,17 @@ void Thunderloop::runLoop()
 {
     // Timing
     struct timespec next_shot;
+    struct timespec wake_up_time;
+    struct timespec wake_up_latency;
     struct timespec poll_time;
     struct timespec iteration_time;
 
-    // Input buffer
-    TbotsProto::PrimitiveSet new_primitive_set;
-    TbotsProto::Vision new_vision;
+    // The newest messages from the network service, or nullptr if there is no new
+    // message. These are owned by the network service and are only valid for one
+    // iteration.
+    TbotsProto::PrimitiveSet* new_primitive_set;
+    TbotsProto::RobotPrimitive* new_robot_primitive;
+    TbotsProto::Vision* new_vision;
 
     // Loop interval
     int interval =
@@ -74,54 +85,63 @@ void Thunderloop::runLoop()
             clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &next_shot, NULL);
             ScopedTimespecTimer iteration_timer(&iteration_time);
 
-            // Poll network service and grab most recent messages
+            clock_gettime(CLOCK_MONOTONIC, &wake_up_time);
+            ScopedTimespecTimer::timespecDiff(&wake_up_time, &next_shot,
+                                              &wake_up_latency);
+            thunderloop_telemetry_.startIteration(timespecToNanoseconds(wake_up_latency));
+
+            // Poll network service and grab the messages received since the last
+            // iteration. This never waits for the network.
             {
                 ScopedTimespecTimer timer(&poll_time);
-                auto result       = network_service_->poll(robot_status_);
-                new_primitive_set = std::get<0>(result);
-                new_vision        = std::get<1>(result);
+                network_service_->sendRobotStatus(robot_status_);
+                new_primitive_set   = network_service_->getNewPrimitiveSet();
+                new_robot_primitive = network_service_->getNewRobotPrimitive();
+                new_vision          = network_service_->getNewVision();
             }
 
             thunderloop_status_.set_network_service_poll_time_ns(
-                static_cast<unsigned long>(poll_time.tv_nsec));
+                timespecToNanoseconds(poll_time));
+            thunderloop_telemetry_.recordStage(ThunderloopStage::NETWORK_SERVICE_POLL,
+                                               timespecToNanoseconds(poll_time));
+
+            bool new_primitive_received = false;
 
-            // If the primitive msg is new, update the internal buffer
-            // and start the new primitive.
-            if (new_primitive_set.time_sent().epoch_timestamp_seconds() >
-                primitive_set_.time_sent().epoch_timestamp_seconds())
+            // The network service only hands over messages that are newer than the
+            // previous ones, so the primitive is taken without copying it
+            if (new_robot_primitive != nullptr)
             {
-                // Save new primitive set
-                primitive_set_ = new_primitive_set;
+                primitive_.Swap(new_robot_primitive->mutable_primitive());
+                new_primitive_received = true;
+            }
+            // If we have a primitive for "this" robot, lets start it
+            else if (new_primitive_set != nullptr &&
+                     new_primitive_set->robot_primitives().count(robot_id_) != 0)
+            {
+                primitive_.Swap(
+                    &new_primitive_set->mutable_robot_primitives()->at(robot_id_));
+                new_primitive_received = true;
+            }
 
-                // If we have a primitive for "this" robot, lets start it
-                if (new_primitive_set.robot_primitives().count(robot_id_) != 0)
+            // Start the new primitive
+            if (new_primitive_received)
+            {
                 {
-                    primitive_ =
-                        new_primitive_set.mutable_robot_primitives()->at(robot_id_);
-
-                    // Start new primitive
-                    {
-                        ScopedTimespecTimer timer(&poll_time);
-                        primitive_executor_.startPrimitive(robot_constants_, primitive_);
-                    }
-
-                    thunderloop_status_.set_primitive_executor_start_time_ns(
-                        static_cast<unsigned long>(poll_time.tv_nsec));
+                    ScopedTimespecTimer timer(&poll_time);
+                    primitive_executor_.startPrimitive(robot_constants_, primitive_);
                 }
+
+                thunderloop_status_.set_primitive_executor_start_time_ns(
+                    timespecToNanoseconds(poll_time));
+                thunderloop_telemetry_.recordStage(
+                    ThunderloopStage::PRIMITIVE_EXECUTOR_START,
+                    timespecToNanoseconds(poll_time));
             }
 
-            // If the vision msg is new, update the internal buffer
-            if (new_vision.time_sent().epoch_timestamp_seconds() >
-                vision_.time_sent().epoch_timestamp_seconds())
+            // If there is a detection for "this" robot, lets update it
+            if (new_vision != nullptr && new_vision->robot_states().count(robot_id_) != 0)
             {
-                // Cache vision
-                vision_ = new_vision;
-
-                // If there is a detection for "this" robot, lets update it
-                if (new_vision.robot_states().count(robot_id_) != 0)
-                {
-                    robot_state_ = new_vision.mutable_robot_states()->at(robot_id_);
-                }
+                robot_state_.Swap(&new_vision->mutable_robot_states()->at(robot_id_));
             }
 
             // TODO (#2333) poll redis service
@@ -132,7 +152,9 @@ void Thunderloop::runLoop()
                     *primitive_executor_.stepPrimitive(createRobotState(robot_state_));
             }
             thunderloop_status_.set_primitive_executor_step_time_ns(
-                static_cast<unsigned long>(poll_time.tv_nsec));
+                timespecToNanoseconds(poll_time));
+            thunderloop_telemetry_.recordStage(ThunderloopStage::PRIMITIVE_EXECUTOR_STEP,
+                                               timespecToNanoseconds(poll_time));
 
             // Run the motor service with the direct_control_ msg
             {
@@ -140,25 +162,28 @@ void Thunderloop::runLoop()
                 drive_units_status_ = *motor_service_->poll(direct_control_);
             }
             thunderloop_status_.set_motor_service_poll_time_ns(
-                static_cast<unsigned long>(poll_time.tv_nsec));
-
-            *(robot_status_.mutable_thunderloop_status()) = thunderloop_status_;
+                timespecToNanoseconds(poll_time));
+            thunderloop_telemetry_.recordStage(ThunderloopStage::MOTOR_SERVICE_POLL,
+                                               timespecToNanoseconds(poll_time));
 
             robot_status_.mutable_power_status()->set_capacitor_voltage(200);
         }
 
-        auto loop_duration =
-            iteration_time.tv_sec * static_cast<int>(NANOSECONDS_PER_SECOND) +
-            iteration_time.tv_nsec;
+        uint64_t loop_duration = timespecToNanoseconds(iteration_time);
         thunderloop_status_.set_iteration_time_ns(loop_duration);
 
-        // Make sure the iteration can fit inside the period of the loop
-        CHECK(loop_duration * static_cast<int>(SECONDS_PER_NANOSECOND) <=
-              (1.0 / loop_hz_))
-            << "Loop takes longer than 1/loop_hz_ seconds";
+        // Overruns are counted instead of stopping the loop, so that we can see how
+        // often the iteration doesn't fit inside the period of the loop
+        thunderloop_telemetry_.endIteration(loop_duration);
+        thunderloop_telemetry_.updateThunderloopStatus(thunderloop_status_);
 
-        // Calculate next shot taking into account how long this iteration took
-        next_shot.tv_nsec += interval - loop_duration;
+        // The status is sent at the start of the next iteration, so it includes the
+        // timing of this whole iteration and the latest summary
+        *(robot_status_.mutable_thunderloop_status()) = thunderloop_status_;
+
+        // Calculate next shot. The sleep is until an absolute time, so this already
+        // takes into account how long this iteration took.
+        next_shot.tv_nsec += interval;
         timespecNorm(next_shot);
     }
 }
@@ -171,3 +196,14 @@ void Thunderloop::timespecNorm(struct timespec& ts)
         ts.tv_sec++;
     }
 }
+
+uint64_t Thunderloop::timespecToNanoseconds(const struct timespec& ts)
+{
+    if (ts.tv_sec < 0)
+    {
+        return 0;
+    }
+    return static_cast<uint64_t>(ts.tv_sec) *
+               static_cast<uint64_t>(NANOSECONDS_PER_SECOND) +
+           static_cast<uint64_t>(ts.tv_nsec);
+}
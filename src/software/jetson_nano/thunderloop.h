@@ -10,6 +10,7 @@
 #include "software/jetson_nano/redis/redis_client.h"
 #include "software/jetson_nano/services/motor.h"
 #include "software/jetson_nano/services/network.h"
+#include "software/jetson_nano/thunderloop_telemetry.h"
 #include "software/logger/logger.h"
 #include "software/world/robot_state.h"
 
@@ -71,12 +72,22 @@ class Thunderloop
      */
     void timespecNorm(struct timespec& ts);
 
+    /**
+     * Converts a timespec to nanoseconds
+     *
+     * @param ts timespec to convert
+     *
+     * @return the nanoseconds in the timespec, or 0 if it is negative
+     */
+    static uint64_t timespecToNanoseconds(const struct timespec& ts);
+
     // Primitive Executor
     PrimitiveExecutor primitive_executor_;
 
+    // Records the timing of the loop into thunderloop_status_
+    ThunderloopTelemetry thunderloop_telemetry_;
+
     // Input Msg Buffers
-    TbotsProto::PrimitiveSet primitive_set_;
-    TbotsProto::Vision vision_;
     TbotsProto::RobotState robot_state_;
     TbotsProto::Primitive primitive_;
     TbotsProto::DirectControlPrimitive direct_control_;
@@ -0,0 +1,207 @@
+#include "software/jetson_nano/thunderloop_telemetry.h"
+
+#include <algorithm>
+
+ThunderloopTelemetry::ThunderloopTelemetry(uint64_t loop_period_ns,
+                                           unsigned int summary_period_iterations)
+    : loop_period_ns(loop_period_ns),
+      summary_period_iterations(std::max(summary_period_iterations, 1u)),
+      wake_up_latency_histogram(),
+      stage_histograms(),
+      iteration_histogram(),
+      num_iterations(0),
+      num_iterations_in_summary(0),
+      num_overruns_in_summary(0),
+      total_num_overruns(0),
+      summary_ready(false),
+      num_summaries(0),
+      num_statuses_with_summary(0),
+      recent_iterations(),
+      slowest_iteration_trace(),
+      slowest_iteration_trace_length(0),
+      slowest_iteration_duration_ns(0)
+{
+}
+
+void ThunderloopTelemetry::startIteration(uint64_t wake_up_latency_ns)
+{
+    IterationTrace& trace    = recent_iterations[num_iterations % TRACE_LENGTH];
+    trace.iteration          = num_iterations;
+    trace.wake_up_latency_ns = wake_up_latency_ns;
+    trace.stage_durations_ns.fill(0);
+    trace.iteration_duration_ns = 0;
+
+    wake_up_latency_histogram.recordMicroseconds(wake_up_latency_ns / 1000);
+}
+
+void ThunderloopTelemetry::recordStage(ThunderloopStage stage, uint64_t duration_ns)
+{
+    IterationTrace& trace = recent_iterations[num_iterations % TRACE_LENGTH];
+    trace.stage_durations_ns[static_cast<size_t>(stage)] = duration_ns;
+
+    stage_histograms[static_cast<size_t>(stage)].recordMicroseconds(duration_ns / 1000);
+}
+
+void ThunderloopTelemetry::endIteration(uint64_t iteration_duration_ns)
+{
+    IterationTrace& trace       = recent_iterations[num_iterations % TRACE_LENGTH];
+    trace.iteration_duration_ns = iteration_duration_ns;
+
+    iteration_histogram.recordMicroseconds(iteration_duration_ns / 1000);
+
+    // The iteration ended after the next iteration was meant to start
+    if (trace.wake_up_latency_ns + iteration_duration_ns > loop_period_ns)
+    {
+        num_overruns_in_summary++;
+        total_num_overruns++;
+    }
+
+    if (iteration_duration_ns >= slowest_iteration_duration_ns)
+    {
+        // Keep the iterations leading up to the slowest iteration, so we can see if it
+        // was caused by the iterations before it (ex. catching up after an overrun)
+        slowest_iteration_duration_ns = iteration_duration_ns;
+        slowest_iteration_trace_length =
+            static_cast<size_t>(std::min<uint64_t>(num_iterations + 1, TRACE_LENGTH));
+        for (size_t i = 0; i < slowest_iteration_trace_length; i++)
+        {
+            uint64_t iteration = num_iterations + 1 - slowest_iteration_trace_length + i;
+            slowest_iteration_trace[i] = recent_iterations[iteration % TRACE_LENGTH];
+        }
+    }
+
+    num_iterations++;
+    num_iterations_in_summary++;
+    if (num_iterations_in_summary >= summary_period_iterations)
+    {
+        summary_ready = true;
+    }
+}
+
+bool ThunderloopTelemetry::updateThunderloopStatus(
+    TbotsProto::ThunderloopStatus& thunderloop_status)
+{
+    if (!summary_ready)
+    {
+        if (num_statuses_with_summary < NUM_STATUSES_PER_SUMMARY)
+        {
+            num_statuses_with_summary++;
+        }
+        else
+        {
+            clearSummary(thunderloop_status);
+        }
+        return false;
+    }
+
+    summarizeHistogram(wake_up_latency_histogram,
+                       *thunderloop_status.mutable_wake_up_latency());
+    for (size_t i = 0; i < NUM_THUNDERLOOP_STAGES; i++)
+    {
+        ThunderloopStage stage = static_cast<ThunderloopStage>(i);
+        summarizeHistogram(stage_histograms[i],
+                           getMutableStageSummary(stage, thunderloop_status));
+    }
+    summarizeHistogram(iteration_histogram, *thunderloop_status.mutable_iteration());
+    thunderloop_status.set_num_iterations(num_iterations_in_summary);
+    thunderloop_status.set_num_overruns(num_overruns_in_summary);
+    thunderloop_status.set_total_num_overruns(total_num_overruns);
+    num_summaries++;
+    thunderloop_status.set_summary_index(num_summaries);
+
+    // Reuse the traces that are already in the proto so that they aren't reallocated
+    while (static_cast<size_t>(thunderloop_status.slowest_iteration_trace_size()) >
+           slowest_iteration_trace_length)
+    {
+        thunderloop_status.mutable_slowest_iteration_trace()->RemoveLast();
+    }
+    for (size_t i = 0; i < slowest_iteration_trace_length; i++)
+    {
+        TbotsProto::LoopIterationTrace* trace_proto =
+            i < static_cast<size_t>(thunderloop_status.slowest_iteration_trace_size())
+                ? thunderloop_status.mutable_slowest_iteration_trace(static_cast<int>(i))
+                : thunderloop_status.add_slowest_iteration_trace();
+        writeIterationTrace(slowest_iteration_trace[i], *trace_proto);
+    }
+
+    wake_up_latency_histogram.reset();
+    for (LatencyHistogram& histogram : stage_histograms)
+    {
+        histogram.reset();
+    }
+    iteration_histogram.reset();
+    num_iterations_in_summary      = 0;
+    num_overruns_in_summary        = 0;
+    slowest_iteration_trace_length = 0;
+    slowest_iteration_duration_ns  = 0;
+    summary_ready                  = false;
+    num_statuses_with_summary      = 1;
+
+    return true;
+}
+
+uint64_t ThunderloopTelemetry::getTotalNumOverruns() const
+{
+    return total_num_overruns;
+}
+
+void ThunderloopTelemetry::clearSummary(TbotsProto::ThunderloopStatus& thunderloop_status)
+{
+    thunderloop_status.clear_wake_up_latency();
+    thunderloop_status.clear_network_service_poll();
+    thunderloop_status.clear_primitive_executor_start();
+    thunderloop_status.clear_primitive_executor_step();
+    thunderloop_status.clear_motor_service_poll();
+    thunderloop_status.clear_iteration();
+    thunderloop_status.clear_num_iterations();
+    thunderloop_status.clear_num_overruns();
+    thunderloop_status.clear_summary_index();
+    // Clearing the repeated field keeps the cleared traces around to be reused by the
+    // next summary
+    thunderloop_status.mutable_slowest_iteration_trace()->Clear();
+}
+
+void ThunderloopTelemetry::summarizeHistogram(const LatencyHistogram& histogram,
+                                              TbotsProto::LoopTimingSummary& summary)
+{
+    summary.set_p50_us(histogram.percentileMicroseconds(50));
+    summary.set_p99_us(histogram.percentileMicroseconds(99));
+    summary.set_max_us(histogram.maxMicroseconds());
+}
+
+TbotsProto::LoopTimingSummary& ThunderloopTelemetry::getMutableStageSummary(
+    ThunderloopStage stage, TbotsProto::ThunderloopStatus& thunderloop_status)
+{
+    switch (stage)
+    {
+        case ThunderloopStage::NETWORK_SERVICE_POLL:
+            return *thunderloop_status.mutable_network_service_poll();
+        case ThunderloopStage::PRIMITIVE_EXECUTOR_START:
+            return *thunderloop_status.mutable_primitive_executor_start();
+        case ThunderloopStage::PRIMITIVE_EXECUTOR_STEP:
+            return *thunderloop_status.mutable_primitive_executor_step();
+        case ThunderloopStage::MOTOR_SERVICE_POLL:
+            return *thunderloop_status.mutable_motor_service_poll();
+    }
+    return *thunderloop_status.mutable_network_service_poll();
+}
+
+void ThunderloopTelemetry::writeIterationTrace(
+    const IterationTrace& trace, TbotsProto::LoopIterationTrace& trace_proto)
+{
+    trace_proto.set_iteration(trace.iteration);
+    trace_proto.set_wake_up_latency_ns(trace.wake_up_latency_ns);
+    trace_proto.set_network_service_poll_time_ns(
+        trace.stage_durations_ns[static_cast<size_t>(
+            ThunderloopStage::NETWORK_SERVICE_POLL)]);
+    trace_proto.set_primitive_executor_start_time_ns(
+        trace.stage_durations_ns[static_cast<size_t>(
+            ThunderloopStage::PRIMITIVE_EXECUTOR_START)]);
+    trace_proto.set_primitive_executor_step_time_ns(
+        trace.stage_durations_ns[static_cast<size_t>(
+            ThunderloopStage::PRIMITIVE_EXECUTOR_STEP)]);
+    trace_proto.set_motor_service_poll_time_ns(
+        trace.stage_durations_ns[static_cast<size_t>(
+            ThunderloopStage::MOTOR_SERVICE_POLL)]);
+    trace_proto.set_iteration_time_ns(trace.iteration_duration_ns);
+}
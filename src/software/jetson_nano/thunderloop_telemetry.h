@@ -0,0 +1,192 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+#include "proto/robot_status_msg.pb.h"
+#include "software/util/latency_profiler/latency_histogram.h"
+
+// The stages of an iteration of the Thunderloop that are timed. This isn't a MAKE_ENUM
+// because the number of stages is needed at compile time to size the buffers of the
+// ThunderloopTelemetry.
+enum class ThunderloopStage
+{
+    // Exchanging messages with the NetworkService
+    NETWORK_SERVICE_POLL,
+    // Starting a new primitive
+    PRIMITIVE_EXECUTOR_START,
+    // Stepping the current primitive
+    PRIMITIVE_EXECUTOR_STEP,
+    // Exchanging targets and feedback with the motor board over SPI
+    MOTOR_SERVICE_POLL
+};
+
+static constexpr size_t NUM_THUNDERLOOP_STAGES =
+    static_cast<size_t>(ThunderloopStage::MOTOR_SERVICE_POLL) + 1;
+
+/**
+ * Records the timing of every iteration of the Thunderloop, so that we can see how
+ * much of the loop period is used and which stage is responsible when an iteration
+ * misses its deadline.
+ *
+ * The wake up latency, the duration of every ThunderloopStage and the duration of the
+ * whole iteration are recorded into histograms. Every summary_period_iterations
+ * iterations, the distributions, the number of overruns and a trace of the iterations
+ * leading up to the slowest iteration are summarized into the ThunderloopStatus and the
+ * histograms are cleared. Recording never allocates, so it can be used in the loop.
+ *
+ * Each iteration is recorded with:
+ *
+ * ```
+ * telemetry.startIteration(wake_up_latency_ns);
+ * telemetry.recordStage(ThunderloopStage::NETWORK_SERVICE_POLL, poll_time_ns);
+ * ...
+ * telemetry.endIteration(iteration_time_ns);
+ * telemetry.updateThunderloopStatus(thunderloop_status);
+ * ```
+ */
+class ThunderloopTelemetry
+{
+   public:
+    /**
+     * Creates a new ThunderloopTelemetry
+     *
+     * @param loop_period_ns The period the loop runs at. An iteration is an overrun if
+     * it ends more than a period after it was meant to start.
+     * @param summary_period_iterations The number of iterations to summarize together
+     */
+    explicit ThunderloopTelemetry(uint64_t loop_period_ns,
+                                  unsigned int summary_period_iterations);
+
+    /**
+     * Starts recording an iteration
+     *
+     * @param wake_up_latency_ns How long after the time it was meant to start at the
+     * iteration started
+     */
+    void startIteration(uint64_t wake_up_latency_ns);
+
+    /**
+     * Records the duration of a stage of the current iteration
+     *
+     * @param stage The stage
+     * @param duration_ns The duration of the stage
+     */
+    void recordStage(ThunderloopStage stage, uint64_t duration_ns);
+
+    /**
+     * Finishes recording the current iteration
+     *
+     * @param iteration_duration_ns The duration of the iteration, from waking up to
+     * the end of the last stage
+     */
+    void endIteration(uint64_t iteration_duration_ns);
+
+    /**
+     * Writes the summary of the last summary_period_iterations iterations into the
+     * given ThunderloopStatus, if a summary was completed since the last call.
+     *
+     * A summary is kept in the ThunderloopStatus for NUM_STATUSES_PER_SUMMARY
+     * iterations and then cleared, so that it is still received if some of the
+     * statuses are dropped. Every summary has a new summary_index, so the receiver
+     * can ignore summaries it has already received and notice lost summaries. This
+     * should be called every iteration, after endIteration.
+     *
+     * @param thunderloop_status The ThunderloopStatus to write the summary into
+     *
+     * @return whether a new summary was written
+     */
+    bool updateThunderloopStatus(TbotsProto::ThunderloopStatus& thunderloop_status);
+
+    /**
+     * Gets the number of iterations that ended after the next iteration was meant to
+     * start, since the loop started
+     *
+     * @return the total number of overruns
+     */
+    uint64_t getTotalNumOverruns() const;
+
+    // The number of iterations kept in the trace of the slowest iteration
+    static constexpr size_t TRACE_LENGTH = 8;
+
+    // The number of consecutive statuses a summary is sent in
+    static constexpr unsigned int NUM_STATUSES_PER_SUMMARY = 20;
+
+   private:
+    /**
+     * The timing of a single iteration
+     */
+    struct IterationTrace
+    {
+        uint64_t iteration;
+        uint64_t wake_up_latency_ns;
+        std::array<uint64_t, NUM_THUNDERLOOP_STAGES> stage_durations_ns;
+        uint64_t iteration_duration_ns;
+    };
+
+    /**
+     * Clears the summary from a ThunderloopStatus. The total number of overruns and
+     * the durations of the stages of the most recent iteration are kept.
+     *
+     * @param thunderloop_status The ThunderloopStatus to clear the summary from
+     */
+    static void clearSummary(TbotsProto::ThunderloopStatus& thunderloop_status);
+
+    /**
+     * Writes the distribution of a histogram into a LoopTimingSummary
+     *
+     * @param histogram The histogram to summarize
+     * @param summary The summary to write to
+     */
+    static void summarizeHistogram(const LatencyHistogram& histogram,
+                                   TbotsProto::LoopTimingSummary& summary);
+
+    /**
+     * Gets the summary of a stage in a ThunderloopStatus
+     *
+     * @param stage The stage
+     * @param thunderloop_status The ThunderloopStatus
+     *
+     * @return the summary of the stage
+     */
+    static TbotsProto::LoopTimingSummary& getMutableStageSummary(
+        ThunderloopStage stage, TbotsProto::ThunderloopStatus& thunderloop_status);
+
+    /**
+     * Writes an IterationTrace into a LoopIterationTrace proto
+     *
+     * @param trace The trace of the iteration
+     * @param trace_proto The proto to write to
+     */
+    static void writeIterationTrace(const IterationTrace& trace,
+                                    TbotsProto::LoopIterationTrace& trace_proto);
+
+    const uint64_t loop_period_ns;
+    const unsigned int summary_period_iterations;
+
+    LatencyHistogram wake_up_latency_histogram;
+    std::array<LatencyHistogram, NUM_THUNDERLOOP_STAGES> stage_histograms;
+    LatencyHistogram iteration_histogram;
+
+    // The number of iterations recorded since the loop started
+    uint64_t num_iterations;
+    uint64_t num_iterations_in_summary;
+    uint64_t num_overruns_in_summary;
+    uint64_t total_num_overruns;
+    bool summary_ready;
+
+    // The number of summaries written since the loop started
+    uint64_t num_summaries;
+    // The number of statuses the latest summary has been written into
+    unsigned int num_statuses_with_summary;
+
+    // The most recent iterations, the current iteration is at
+    // recent_iterations[num_iterations % TRACE_LENGTH]
+    std::array<IterationTrace, TRACE_LENGTH> recent_iterations;
+
+    // The iterations leading up to and including the slowest iteration of the summary,
+    // oldest first
+    std::array<IterationTrace, TRACE_LENGTH> slowest_iteration_trace;
+    size_t slowest_iteration_trace_length;
+    uint64_t slowest_iteration_duration_ns;
+};
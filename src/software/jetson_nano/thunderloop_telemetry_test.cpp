@@ -0,0 +1,236 @@
+#include "software/jetson_nano/thunderloop_telemetry.h"
+
+#include <gtest/gtest.h>
+
+class ThunderloopTelemetryTest : public ::testing::Test
+{
+   protected:
+    ThunderloopTelemetryTest() : telemetry(LOOP_PERIOD_NS, SUMMARY_PERIOD_ITERATIONS) {}
+
+    /**
+     * Records an iteration where every stage takes the given amount of time
+     *
+     * @param wake_up_latency_ns The wake up latency of the iteration
+     * @param stage_duration_ns The duration of each stage
+     */
+    void recordIteration(uint64_t wake_up_latency_ns, uint64_t stage_duration_ns)
+    {
+        telemetry.startIteration(wake_up_latency_ns);
+        for (size_t i = 0; i < NUM_THUNDERLOOP_STAGES; i++)
+        {
+            telemetry.recordStage(static_cast<ThunderloopStage>(i), stage_duration_ns);
+        }
+        telemetry.endIteration(stage_duration_ns * NUM_THUNDERLOOP_STAGES);
+    }
+
+    static constexpr uint64_t LOOP_PERIOD_NS                = 5000000;
+    static constexpr unsigned int SUMMARY_PERIOD_ITERATIONS = 100;
+
+    ThunderloopTelemetry telemetry;
+    TbotsProto::ThunderloopStatus thunderloop_status;
+};
+
+TEST_F(ThunderloopTelemetryTest, no_summary_before_summary_period)
+{
+    for (unsigned int i = 0; i < SUMMARY_PERIOD_ITERATIONS - 1; i++)
+    {
+        recordIteration(10000, 100000);
+        EXPECT_FALSE(telemetry.updateThunderloopStatus(thunderloop_status));
+    }
+
+    EXPECT_FALSE(thunderloop_status.has_iteration());
+    EXPECT_EQ(0u, thunderloop_status.num_iterations());
+}
+
+TEST_F(ThunderloopTelemetryTest, summary_of_timing_distributions)
+{
+    // 90 fast iterations and 10 slow iterations
+    for (unsigned int i = 0; i < SUMMARY_PERIOD_ITERATIONS; i++)
+    {
+        if (i % 10 == 0)
+        {
+            recordIteration(50000, 1000000);
+        }
+        else
+        {
+            recordIteration(10000, 100000);
+        }
+    }
+
+    ASSERT_TRUE(telemetry.updateThunderloopStatus(thunderloop_status));
+    EXPECT_EQ(100u, thunderloop_status.num_iterations());
+
+    EXPECT_EQ(10u, thunderloop_status.wake_up_latency().p50_us());
+    EXPECT_EQ(50u, thunderloop_status.wake_up_latency().p99_us());
+    EXPECT_EQ(50u, thunderloop_status.wake_up_latency().max_us());
+
+    for (const TbotsProto::LoopTimingSummary& stage_summary :
+         {thunderloop_status.network_service_poll(),
+          thunderloop_status.primitive_executor_start(),
+          thunderloop_status.primitive_executor_step(),
+          thunderloop_status.motor_service_poll()})
+    {
+        EXPECT_EQ(100u, stage_summary.p50_us());
+        EXPECT_EQ(1000u, stage_summary.p99_us());
+        EXPECT_EQ(1000u, stage_summary.max_us());
+    }
+
+    // Percentiles are only as precise as the buckets of the histogram
+    EXPECT_NEAR(400.0, static_cast<double>(thunderloop_status.iteration().p50_us()),
+                400 * 0.01);
+    EXPECT_EQ(4000u, thunderloop_status.iteration().max_us());
+
+    // The next summary is only written after another summary period
+    EXPECT_FALSE(telemetry.updateThunderloopStatus(thunderloop_status));
+}
+
+TEST_F(ThunderloopTelemetryTest, count_overruns)
+{
+    for (unsigned int i = 0; i < SUMMARY_PERIOD_ITERATIONS; i++)
+    {
+        if (i < 3)
+        {
+            // Ends after the period
+            recordIteration(0, 1500000);
+        }
+        else if (i < 5)
+        {
+            // Fits in the period, but the late wake up makes it end after the period
+            recordIteration(2000000, 1000000);
+        }
+        else
+        {
+            recordIteration(10000, 100000);
+        }
+    }
+
+    ASSERT_TRUE(telemetry.updateThunderloopStatus(thunderloop_status));
+    EXPECT_EQ(5u, thunderloop_status.num_overruns());
+    EXPECT_EQ(5u, thunderloop_status.total_num_overruns());
+
+    for (unsigned int i = 0; i < SUMMARY_PERIOD_ITERATIONS; i++)
+    {
+        recordIteration(0, i == 0 ? 1500000 : 100000);
+    }
+
+    ASSERT_TRUE(telemetry.updateThunderloopStatus(thunderloop_status));
+    EXPECT_EQ(1u, thunderloop_status.num_overruns());
+    EXPECT_EQ(6u, thunderloop_status.total_num_overruns());
+    EXPECT_EQ(6u, telemetry.getTotalNumOverruns());
+}
+
+TEST_F(ThunderloopTelemetryTest, trace_of_iterations_leading_up_to_slowest_iteration)
+{
+    for (unsigned int i = 0; i < SUMMARY_PERIOD_ITERATIONS; i++)
+    {
+        recordIteration(i, i == 42 ? 2000000 : 100000 + i);
+    }
+
+    ASSERT_TRUE(telemetry.updateThunderloopStatus(thunderloop_status));
+    ASSERT_EQ(static_cast<int>(ThunderloopTelemetry::TRACE_LENGTH),
+              thunderloop_status.slowest_iteration_trace_size());
+
+    // The trace is oldest first and ends with the slowest iteration
+    for (int i = 0; i < thunderloop_status.slowest_iteration_trace_size(); i++)
+    {
+        const TbotsProto::LoopIterationTrace& trace =
+            thunderloop_status.slowest_iteration_trace(i);
+        uint64_t iteration =
+            42 - ThunderloopTelemetry::TRACE_LENGTH + 1 + static_cast<uint64_t>(i);
+        uint64_t stage_duration_ns = iteration == 42 ? 2000000 : 100000 + iteration;
+
+        EXPECT_EQ(iteration, trace.iteration());
+        EXPECT_EQ(iteration, trace.wake_up_latency_ns());
+        EXPECT_EQ(stage_duration_ns, trace.network_service_poll_time_ns());
+        EXPECT_EQ(stage_duration_ns, trace.primitive_executor_start_time_ns());
+        EXPECT_EQ(stage_duration_ns, trace.primitive_executor_step_time_ns());
+        EXPECT_EQ(stage_duration_ns, trace.motor_service_poll_time_ns());
+        EXPECT_EQ(stage_duration_ns * NUM_THUNDERLOOP_STAGES, trace.iteration_time_ns());
+    }
+}
+
+TEST_F(ThunderloopTelemetryTest, trace_is_shorter_than_trace_length_at_start_of_loop)
+{
+    for (unsigned int i = 0; i < SUMMARY_PERIOD_ITERATIONS; i++)
+    {
+        recordIteration(0, i == 2 ? 2000000 : 100000);
+    }
+
+    ASSERT_TRUE(telemetry.updateThunderloopStatus(thunderloop_status));
+    ASSERT_EQ(3, thunderloop_status.slowest_iteration_trace_size());
+    EXPECT_EQ(0u, thunderloop_status.slowest_iteration_trace(0).iteration());
+    EXPECT_EQ(2u, thunderloop_status.slowest_iteration_trace(2).iteration());
+}
+
+TEST_F(ThunderloopTelemetryTest, each_summary_only_includes_its_own_iterations)
+{
+    for (unsigned int i = 0; i < SUMMARY_PERIOD_ITERATIONS; i++)
+    {
+        recordIteration(0, i == 50 ? 2000000 : 100000);
+    }
+    ASSERT_TRUE(telemetry.updateThunderloopStatus(thunderloop_status));
+    EXPECT_EQ(8000u, thunderloop_status.iteration().max_us());
+
+    for (unsigned int i = 0; i < SUMMARY_PERIOD_ITERATIONS; i++)
+    {
+        recordIteration(0, i == 70 ? 200000 : 100000);
+    }
+    ASSERT_TRUE(telemetry.updateThunderloopStatus(thunderloop_status));
+
+    EXPECT_EQ(100u, thunderloop_status.num_iterations());
+    EXPECT_EQ(800u, thunderloop_status.iteration().max_us());
+    ASSERT_EQ(static_cast<int>(ThunderloopTelemetry::TRACE_LENGTH),
+              thunderloop_status.slowest_iteration_trace_size());
+    EXPECT_EQ(170u, thunderloop_status
+                        .slowest_iteration_trace(
+                            static_cast<int>(ThunderloopTelemetry::TRACE_LENGTH - 1))
+                        .iteration());
+}
+
+TEST_F(ThunderloopTelemetryTest, summary_is_sent_in_several_statuses_then_cleared)
+{
+    for (unsigned int i = 0; i < SUMMARY_PERIOD_ITERATIONS; i++)
+    {
+        recordIteration(0, i == 95 ? 2000000 : 100000);
+        telemetry.updateThunderloopStatus(thunderloop_status);
+    }
+
+    // The summary is in the status of the iteration that completed it and the
+    // iterations after it
+    for (unsigned int i = 1; i < ThunderloopTelemetry::NUM_STATUSES_PER_SUMMARY; i++)
+    {
+        recordIteration(0, 100000);
+        EXPECT_FALSE(telemetry.updateThunderloopStatus(thunderloop_status));
+    }
+    EXPECT_TRUE(thunderloop_status.has_iteration());
+    EXPECT_EQ(1u, thunderloop_status.num_overruns());
+    EXPECT_EQ(1u, thunderloop_status.summary_index());
+
+    recordIteration(0, 100000);
+    EXPECT_FALSE(telemetry.updateThunderloopStatus(thunderloop_status));
+
+    EXPECT_FALSE(thunderloop_status.has_wake_up_latency());
+    EXPECT_FALSE(thunderloop_status.has_network_service_poll());
+    EXPECT_FALSE(thunderloop_status.has_primitive_executor_start());
+    EXPECT_FALSE(thunderloop_status.has_primitive_executor_step());
+    EXPECT_FALSE(thunderloop_status.has_motor_service_poll());
+    EXPECT_FALSE(thunderloop_status.has_iteration());
+    EXPECT_EQ(0u, thunderloop_status.num_iterations());
+    EXPECT_EQ(0u, thunderloop_status.num_overruns());
+    EXPECT_EQ(0, thunderloop_status.slowest_iteration_trace_size());
+    EXPECT_EQ(0u, thunderloop_status.summary_index());
+    EXPECT_EQ(1u, thunderloop_status.total_num_overruns());
+}
+
+TEST_F(ThunderloopTelemetryTest, every_summary_has_a_new_summary_index)
+{
+    for (uint64_t summary_index = 1; summary_index <= 3; summary_index++)
+    {
+        for (unsigned int i = 0; i < SUMMARY_PERIOD_ITERATIONS; i++)
+        {
+            recordIteration(0, 100000);
+            telemetry.updateThunderloopStatus(thunderloop_status);
+        }
+        EXPECT_EQ(summary_index, thunderloop_status.summary_index());
+    }
+}
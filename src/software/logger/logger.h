@@ -12,6 +12,7 @@
 #include "software/logger/csv_sink.h"
 #include "software/logger/custom_logging_levels.h"
 #include "software/logger/protobuf_sink.h"
+#include "software/logger/visualization_sender.h"
 
 // This undefines LOG macro defined by g3log
 #undef LOG
@@ -93,7 +94,12 @@ class LoggerSingleton
                 level_filter),
             &LogRotateWithFilter::save);
 
-        // Sink for visualization
+        // Protobufs sent with sendVisualization go straight to Thunderscope without
+        // going through g3log
+        initializeVisualizationSender(UNIX_BASE_PATH + "protobuf",
+                                      visualization_max_send_rates_hz);
+
+        // Sink for sending logs to Thunderscope
         auto visualization_handle = logWorker->addSink(std::make_unique<ProtobufSink>(),
                                                        &ProtobufSink::sendProtobuf);
 
@@ -101,6 +107,14 @@ class LoggerSingleton
         g3::initializeLogging(logWorker.get());
     }
 
+    // Protobufs that are visualized every tick are only sent as often as Thunderscope
+    // can show them
+    const std::map<std::string, double> visualization_max_send_rates_hz = {
+        {"TbotsProto.PathVisualization", 30.0},
+        {"TbotsProto.Obstacles", 30.0},
+        {"TbotsProto.PlayInfo", 10.0},
+    };
+
     // levels is this vector are filtered out of the filtered log rotate sink
     std::vector<LEVELS> level_filter = {DEBUG, INFO, ROBOT_STATUS};
     const std::string filter_suffix  = "_filtered";
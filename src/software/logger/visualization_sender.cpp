@@ -0,0 +1,206 @@
+#include "software/logger/visualization_sender.h"
+
+#include <boost/asio.hpp>
+#include <utility>
+
+#include "software/networking/unix_sender.h"
+
+namespace
+{
+    /**
+     * Appends a big-endian unsigned 32 bit integer to the string
+     *
+     * @param value The value to append
+     * @param str The string to append to
+     */
+    void appendUint32(uint32_t value, std::string& str)
+    {
+        str.push_back(static_cast<char>((value >> 24) & 0xFF));
+        str.push_back(static_cast<char>((value >> 16) & 0xFF));
+        str.push_back(static_cast<char>((value >> 8) & 0xFF));
+        str.push_back(static_cast<char>(value & 0xFF));
+    }
+
+    // The UnixSender needs the io_service it was created with to outlive it
+    struct UnixDatagramSender
+    {
+        explicit UnixDatagramSender(const std::string& unix_socket_path)
+            : io_service(), unix_sender(io_service, unix_socket_path)
+        {
+        }
+
+        boost::asio::io_service io_service;
+        UnixSender unix_sender;
+    };
+
+    std::atomic<VisualizationSender*> global_visualization_sender(nullptr);
+}  // namespace
+
+VisualizationSender::VisualizationSender(
+    const std::string& unix_socket_path,
+    const std::map<std::string, double>& max_send_rates_hz, size_t max_buffered_frames)
+    : VisualizationSender(
+          [sender = std::make_shared<UnixDatagramSender>(unix_socket_path)](
+              const std::string& datagram) { sender->unix_sender.sendString(datagram); },
+          max_send_rates_hz, max_buffered_frames)
+{
+}
+
+VisualizationSender::VisualizationSender(
+    std::function<void(const std::string&)> send_datagram,
+    const std::map<std::string, double>& max_send_rates_hz, size_t max_buffered_frames)
+    : send_datagram(std::move(send_datagram)),
+      rate_limits(),
+      max_buffered_frames(std::max<size_t>(max_buffered_frames, 1)),
+      frames_mutex(),
+      frames_available(),
+      frames(),
+      num_dropped_frames(0),
+      in_destructor(false)
+{
+    const auto now = std::chrono::steady_clock::now();
+    for (const auto& [type_name, max_send_rate_hz] : max_send_rates_hz)
+    {
+        if (max_send_rate_hz <= 0)
+        {
+            continue;
+        }
+        RateLimit& rate_limit = rate_limits[type_name];
+        rate_limit.min_period =
+            std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                std::chrono::duration<double>(1.0 / max_send_rate_hz));
+        // Let the first protobuf of every type through
+        rate_limit.last_send_time =
+            (now - rate_limit.min_period).time_since_epoch().count();
+    }
+
+    send_thread = std::thread(&VisualizationSender::sendFrames, this);
+}
+
+VisualizationSender::~VisualizationSender()
+{
+    {
+        std::scoped_lock lock(frames_mutex);
+        in_destructor = true;
+    }
+    frames_available.notify_all();
+    send_thread.join();
+}
+
+void VisualizationSender::send(const google::protobuf::Message& message)
+{
+    if (!rate_limits.empty() && !claimSendTime(message.GetTypeName()))
+    {
+        return;
+    }
+
+    std::string frame;
+    appendFrame(message, frame);
+    if (frame.size() > MAX_DATAGRAM_SIZE_BYTES)
+    {
+        num_dropped_frames++;
+        return;
+    }
+
+    {
+        std::scoped_lock lock(frames_mutex);
+        if (frames.size() >= max_buffered_frames)
+        {
+            frames.pop_front();
+            num_dropped_frames++;
+        }
+        frames.emplace_back(std::move(frame));
+    }
+    frames_available.notify_one();
+}
+
+size_t VisualizationSender::numDroppedFrames() const
+{
+    return num_dropped_frames;
+}
+
+void VisualizationSender::appendFrame(const google::protobuf::Message& message,
+                                      std::string& frame)
+{
+    const std::string& type_name = message.GetTypeName();
+    const size_t message_size    = message.ByteSizeLong();
+
+    frame.reserve(frame.size() + 2 * sizeof(uint32_t) + type_name.size() + message_size);
+    appendUint32(static_cast<uint32_t>(type_name.size()), frame);
+    frame.append(type_name);
+    appendUint32(static_cast<uint32_t>(message_size), frame);
+    message.AppendToString(&frame);
+}
+
+bool VisualizationSender::claimSendTime(const std::string& type_name)
+{
+    auto rate_limit_iter = rate_limits.find(type_name);
+    if (rate_limit_iter == rate_limits.end())
+    {
+        return true;
+    }
+    RateLimit& rate_limit = rate_limit_iter->second;
+
+    auto now            = std::chrono::steady_clock::now().time_since_epoch().count();
+    auto last_send_time = rate_limit.last_send_time.load(std::memory_order_relaxed);
+    if (now - last_send_time < rate_limit.min_period.count())
+    {
+        return false;
+    }
+    // Only one of the threads sending this type at the same time gets to send it
+    return rate_limit.last_send_time.compare_exchange_strong(last_send_time, now,
+                                                             std::memory_order_relaxed);
+}
+
+void VisualizationSender::sendFrames()
+{
+    std::deque<std::string> frames_to_send;
+    std::string datagram;
+    datagram.reserve(MAX_DATAGRAM_SIZE_BYTES);
+
+    while (true)
+    {
+        {
+            std::unique_lock lock(frames_mutex);
+            frames_available.wait(lock,
+                                  [this]() { return in_destructor || !frames.empty(); });
+            if (in_destructor)
+            {
+                return;
+            }
+            // Take every buffered frame at once so that senders only wait for the lock
+            // while the frames are swapped out
+            std::swap(frames, frames_to_send);
+        }
+
+        for (const std::string& frame : frames_to_send)
+        {
+            if (!datagram.empty() &&
+                datagram.size() + frame.size() > MAX_DATAGRAM_SIZE_BYTES)
+            {
+                send_datagram(datagram);
+                datagram.clear();
+            }
+            datagram.append(frame);
+        }
+        send_datagram(datagram);
+        datagram.clear();
+        frames_to_send.clear();
+    }
+}
+
+void initializeVisualizationSender(const std::string& unix_socket_path,
+                                   const std::map<std::string, double>& max_send_rates_hz)
+{
+    static VisualizationSender visualization_sender(unix_socket_path, max_send_rates_hz);
+    global_visualization_sender = &visualization_sender;
+}
+
+void sendVisualization(const google::protobuf::Message& message)
+{
+    VisualizationSender* visualization_sender = global_visualization_sender;
+    if (visualization_sender)
+    {
+        visualization_sender->send(message);
+    }
+}
@@ -0,0 +1,153 @@
+#pragma once
+
+#include <google/protobuf/message.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+
+/**
+ * Sends protobufs to Thunderscope over a binary channel
+ *
+ * Every protobuf is serialized on the calling thread into a frame that holds the
+ * length-prefixed type name and the length-prefixed serialized message. Frames are
+ * buffered and sent by a background thread, which packs as many frames as fit into
+ * every datagram. Callers never wait for the receiver: when the buffer is full the
+ * oldest frame is dropped to make room for the new one. Frames that don't fit in a
+ * single datagram are dropped, since the receiver would truncate them.
+ *
+ * Protobuf types that are sent every tick can be rate limited, so that messages of
+ * that type are dropped before they are serialized if one was sent too recently.
+ *
+ * Frame format, with lengths as big-endian unsigned 32 bit integers:
+ *     [type name length][type name][serialized message length][serialized message]
+ */
+class VisualizationSender
+{
+   public:
+    /**
+     * Creates a VisualizationSender that sends datagrams over the unix socket path
+     *
+     * @param unix_socket_path The path to the unix socket to send datagrams to
+     * @param max_send_rates_hz The maximum rate each protobuf type can be sent at, keyed
+     * by the full protobuf type name. Types that aren't in the map aren't rate limited
+     * @param max_buffered_frames The maximum number of frames waiting to be sent
+     */
+    explicit VisualizationSender(
+        const std::string& unix_socket_path,
+        const std::map<std::string, double>& max_send_rates_hz = {},
+        size_t max_buffered_frames = DEFAULT_MAX_BUFFERED_FRAMES);
+
+    /**
+     * Creates a VisualizationSender that sends datagrams with the given function
+     *
+     * @param send_datagram Sends a datagram, called from the background thread
+     * @param max_send_rates_hz The maximum rate each protobuf type can be sent at, keyed
+     * by the full protobuf type name. Types that aren't in the map aren't rate limited
+     * @param max_buffered_frames The maximum number of frames waiting to be sent
+     */
+    explicit VisualizationSender(
+        std::function<void(const std::string&)> send_datagram,
+        const std::map<std::string, double>& max_send_rates_hz = {},
+        size_t max_buffered_frames = DEFAULT_MAX_BUFFERED_FRAMES);
+
+    ~VisualizationSender();
+
+    // Copying this class is not permitted
+    VisualizationSender(const VisualizationSender&) = delete;
+
+    /**
+     * Serializes the protobuf and buffers it to be sent, unless a protobuf of the same
+     * type was sent too recently. This never blocks on the receiver.
+     *
+     * @param message The protobuf to send
+     */
+    void send(const google::protobuf::Message& message);
+
+    /**
+     * Gets the number of frames that were dropped because the buffer was full or they
+     * were larger than MAX_DATAGRAM_SIZE_BYTES
+     *
+     * @return the number of dropped frames
+     */
+    size_t numDroppedFrames() const;
+
+    /**
+     * Appends a frame for the protobuf to the given string
+     *
+     * @param message The protobuf to create a frame for
+     * @param frame The string to append the frame to
+     */
+    static void appendFrame(const google::protobuf::Message& message, std::string& frame);
+
+    static constexpr size_t DEFAULT_MAX_BUFFERED_FRAMES = 256;
+
+    // Frames are packed into datagrams up to this size. This must match the
+    // max_packet_size of the ThreadedUnixListener that receives the datagrams, which
+    // truncates anything larger, so frames larger than this are dropped
+    static constexpr size_t MAX_DATAGRAM_SIZE_BYTES = 65536;
+
+   private:
+    struct RateLimit
+    {
+        std::chrono::steady_clock::duration min_period;
+        std::atomic<std::chrono::steady_clock::rep> last_send_time;
+    };
+
+    /**
+     * Checks whether a protobuf of the given type can be sent now, and records that it
+     * was sent if so
+     *
+     * @param type_name The full protobuf type name
+     *
+     * @return true if the protobuf should be sent, false if it should be dropped
+     */
+    bool claimSendTime(const std::string& type_name);
+
+    /**
+     * Sends buffered frames until the destructor is called
+     */
+    void sendFrames();
+
+    std::function<void(const std::string&)> send_datagram;
+
+    // The rate limits are created in the constructor, so the map itself is only read
+    std::unordered_map<std::string, RateLimit> rate_limits;
+
+    const size_t max_buffered_frames;
+    std::mutex frames_mutex;
+    std::condition_variable frames_available;
+    std::deque<std::string> frames;
+    std::atomic<size_t> num_dropped_frames;
+
+    bool in_destructor;
+    std::thread send_thread;
+};
+
+/**
+ * Creates the VisualizationSender that sendVisualization sends protobufs with. This
+ * should only be called once at the start of a program.
+ *
+ * @param unix_socket_path The path to the unix socket to send datagrams to
+ * @param max_send_rates_hz The maximum rate each protobuf type can be sent at
+ */
+void initializeVisualizationSender(
+    const std::string& unix_socket_path,
+    const std::map<std::string, double>& max_send_rates_hz);
+
+/**
+ * Sends the protobuf to Thunderscope to be visualized. Does nothing if
+ * initializeVisualizationSender hasn't been called.
+ *
+ * @param message The protobuf to visualize
+ */
+void sendVisualization(const google::protobuf::Message& message);
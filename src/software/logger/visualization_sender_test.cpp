@@ -0,0 +1,268 @@
+#include "software/logger/visualization_sender.h"
+
+#include <google/protobuf/any.pb.h>
+#include <gtest/gtest.h>
+
+#include <future>
+#include <iostream>
+#include <thread>
+
+#include "base64.h"
+#include "proto/visualization.pb.h"
+
+/**
+ * Records every datagram sent by a VisualizationSender and splits them into frames
+ */
+class DatagramRecorder
+{
+   public:
+    void recordDatagram(const std::string& datagram)
+    {
+        {
+            std::scoped_lock lock(datagrams_mutex);
+            datagrams.emplace_back(datagram);
+        }
+        datagram_received.notify_all();
+    }
+
+    /**
+     * Waits until the given number of frames have been sent, and returns the
+     * NamedValues in them
+     *
+     * @param num_frames The number of frames to wait for
+     *
+     * @return The NamedValues in the frames that were sent, in the order they were sent
+     */
+    std::vector<TbotsProto::NamedValue> waitForNamedValues(size_t num_frames)
+    {
+        std::unique_lock lock(datagrams_mutex);
+        std::vector<TbotsProto::NamedValue> named_values;
+        datagram_received.wait_for(lock, std::chrono::seconds(5), [&]() {
+            named_values = parseNamedValues();
+            return named_values.size() >= num_frames;
+        });
+        return named_values;
+    }
+
+    size_t numDatagrams()
+    {
+        std::scoped_lock lock(datagrams_mutex);
+        return datagrams.size();
+    }
+
+   private:
+    std::vector<TbotsProto::NamedValue> parseNamedValues() const
+    {
+        std::vector<TbotsProto::NamedValue> named_values;
+        for (const std::string& datagram : datagrams)
+        {
+            size_t offset = 0;
+            while (offset < datagram.size())
+            {
+                uint32_t type_name_length = readUint32(datagram, offset);
+                std::string type_name     = datagram.substr(offset + 4, type_name_length);
+                offset += 4 + type_name_length;
+                EXPECT_EQ("TbotsProto.NamedValue", type_name);
+
+                uint32_t message_length = readUint32(datagram, offset);
+                TbotsProto::NamedValue named_value;
+                EXPECT_TRUE(named_value.ParseFromString(
+                    datagram.substr(offset + 4, message_length)));
+                offset += 4 + message_length;
+                named_values.emplace_back(named_value);
+            }
+        }
+        return named_values;
+    }
+
+    static uint32_t readUint32(const std::string& str, size_t offset)
+    {
+        uint32_t value = 0;
+        for (size_t i = 0; i < 4; i++)
+        {
+            value = (value << 8) | static_cast<uint8_t>(str[offset + i]);
+        }
+        return value;
+    }
+
+    std::mutex datagrams_mutex;
+    std::condition_variable datagram_received;
+    std::vector<std::string> datagrams;
+};
+
+TbotsProto::NamedValue createNamedValueProto(const std::string& name, float value)
+{
+    TbotsProto::NamedValue named_value;
+    named_value.set_name(name);
+    named_value.set_value(value);
+    return named_value;
+}
+
+TEST(VisualizationSenderTest, frames_are_length_prefixed_and_sent_in_order)
+{
+    DatagramRecorder recorder;
+    VisualizationSender sender(
+        [&](const std::string& datagram) { recorder.recordDatagram(datagram); });
+
+    for (int i = 0; i < 10; i++)
+    {
+        sender.send(
+            createNamedValueProto("value " + std::to_string(i), static_cast<float>(i)));
+    }
+
+    std::vector<TbotsProto::NamedValue> named_values = recorder.waitForNamedValues(10);
+    ASSERT_EQ(10, named_values.size());
+    for (int i = 0; i < 10; i++)
+    {
+        EXPECT_EQ("value " + std::to_string(i), named_values[i].name());
+        EXPECT_EQ(i, named_values[i].value());
+    }
+    EXPECT_EQ(0, sender.numDroppedFrames());
+}
+
+TEST(VisualizationSenderTest, rate_limited_types_are_dropped_when_sent_too_often)
+{
+    DatagramRecorder recorder;
+    VisualizationSender sender(
+        [&](const std::string& datagram) { recorder.recordDatagram(datagram); },
+        {{"TbotsProto.NamedValue", 10.0}});
+
+    // Only one NamedValue is sent every 100ms
+    sender.send(createNamedValueProto("first", 1));
+    sender.send(createNamedValueProto("second", 2));
+    std::this_thread::sleep_for(std::chrono::milliseconds(150));
+    sender.send(createNamedValueProto("third", 3));
+
+    std::vector<TbotsProto::NamedValue> named_values = recorder.waitForNamedValues(2);
+    ASSERT_EQ(2, named_values.size());
+    EXPECT_EQ("first", named_values[0].name());
+    EXPECT_EQ("third", named_values[1].name());
+}
+
+TEST(VisualizationSenderTest, oldest_frames_are_dropped_when_receiver_is_slow)
+{
+    DatagramRecorder recorder;
+    std::promise<void> send_started;
+    std::promise<void> send_released;
+    std::shared_future<void> release = send_released.get_future().share();
+    bool first_datagram              = true;
+
+    VisualizationSender sender(
+        [&](const std::string& datagram) {
+            if (first_datagram)
+            {
+                first_datagram = false;
+                send_started.set_value();
+                release.wait();
+            }
+            recorder.recordDatagram(datagram);
+        },
+        {}, 2);
+
+    // Block the send thread on the first frame, so the next frames are buffered
+    sender.send(createNamedValueProto("0", 0));
+    send_started.get_future().wait();
+
+    // The buffer only holds 2 frames, so the oldest frames are dropped and sending
+    // never waits for the receiver
+    for (int i = 1; i <= 4; i++)
+    {
+        sender.send(createNamedValueProto(std::to_string(i), static_cast<float>(i)));
+    }
+    EXPECT_EQ(2, sender.numDroppedFrames());
+    send_released.set_value();
+
+    std::vector<TbotsProto::NamedValue> named_values = recorder.waitForNamedValues(3);
+    ASSERT_EQ(3, named_values.size());
+    EXPECT_EQ("0", named_values[0].name());
+    EXPECT_EQ("3", named_values[1].name());
+    EXPECT_EQ("4", named_values[2].name());
+
+    // The buffered frames are packed into a single datagram
+    EXPECT_EQ(2, recorder.numDatagrams());
+}
+
+TEST(VisualizationSenderTest, frames_larger_than_a_datagram_are_dropped)
+{
+    DatagramRecorder recorder;
+    VisualizationSender sender(
+        [&](const std::string& datagram) { recorder.recordDatagram(datagram); });
+
+    sender.send(createNamedValueProto(
+        std::string(VisualizationSender::MAX_DATAGRAM_SIZE_BYTES, 'a'), 0));
+    sender.send(createNamedValueProto("small", 1));
+
+    std::vector<TbotsProto::NamedValue> named_values = recorder.waitForNamedValues(1);
+    ASSERT_EQ(1, named_values.size());
+    EXPECT_EQ("small", named_values[0].name());
+    EXPECT_EQ(1, sender.numDroppedFrames());
+}
+
+// This test is disabled to speed up CI, it can be enabled by removing "DISABLED_" from
+// the test name
+TEST(VisualizationSenderTest, DISABLED_path_visualization_send_latency)
+{
+    // The paths of a full team, like the Navigator visualizes every tick
+    TbotsProto::PathVisualization path_visualization;
+    for (int robot_id = 0; robot_id < 11; robot_id++)
+    {
+        TbotsProto::Path* path = path_visualization.add_path();
+        for (int i = 0; i < 10; i++)
+        {
+            TbotsProto::Point* point = path->add_point();
+            point->set_x_meters(-4.5 + 0.9 * i);
+            point->set_y_meters(0.25 * robot_id - 1.5);
+        }
+    }
+
+    const int num_sends = 100000;
+
+    // The message that used to be logged at the VISUALIZE level, before g3log formats
+    // and dispatches it
+    auto start_time = std::chrono::steady_clock::now();
+    for (int i = 0; i < num_sends; i++)
+    {
+        google::protobuf::Any any;
+        any.PackFrom(path_visualization);
+        std::string serialized_any;
+        any.SerializeToString(&serialized_any);
+        std::ostringstream log_message;
+        log_message << path_visualization.GetTypeName() << "!!!"
+                    << base64_encode(serialized_any);
+        ASSERT_FALSE(log_message.str().empty());
+    }
+    double base64_us = std::chrono::duration<double, std::micro>(
+                           std::chrono::steady_clock::now() - start_time)
+                           .count() /
+                       num_sends;
+
+    VisualizationSender sender([](const std::string&) {},
+                               {{"TbotsProto.PathVisualization", 30.0}});
+
+    start_time = std::chrono::steady_clock::now();
+    for (int i = 0; i < num_sends; i++)
+    {
+        sender.send(path_visualization);
+    }
+    double rate_limited_us = std::chrono::duration<double, std::micro>(
+                                 std::chrono::steady_clock::now() - start_time)
+                                 .count() /
+                             num_sends;
+
+    VisualizationSender unlimited_sender([](const std::string&) {});
+
+    start_time = std::chrono::steady_clock::now();
+    for (int i = 0; i < num_sends; i++)
+    {
+        unlimited_sender.send(path_visualization);
+    }
+    double unlimited_us = std::chrono::duration<double, std::micro>(
+                              std::chrono::steady_clock::now() - start_time)
+                              .count() /
+                          num_sends;
+
+    std::cout << "Any + base64 message: " << base64_us << " us per send" << std::endl;
+    std::cout << "VisualizationSender: " << unlimited_us << " us per send" << std::endl;
+    std::cout << "VisualizationSender rate limited to 30 Hz: " << rate_limited_us
+              << " us per send" << std::endl;
+}
@@ -0,0 +1,99 @@
+#pragma once
+
+#include <optional>
+
+#include "software/multithreading/threaded_observer.hpp"
+#include "software/util/make_enum/make_enum.h"
+
+// The order a ConfigurableThreadedObserver hands received values to `onValueReceived`
+// in, when they are received faster than they are handled
+MAKE_ENUM(ThreadedObserverPolicy,
+          // Every value, least recently received first
+          FIRST_IN_FIRST_OUT,
+          // The most recently received value first
+          LAST_IN_FIRST_OUT,
+          // Only the most recently received value. Values are kept in a single slot
+          // mailbox, so a received value replaces (is coalesced into) any value that
+          // hasn't been handled yet.
+          LATEST_VALUE);
+
+/**
+ * The general usage of this class should be to extend it, then override
+ * `onValueReceived` with whatever custom functionality should occur when a new value
+ * is received. Unlike the FirstInFirstOutThreadedObserver and
+ * LastInFirstOutThreadedObserver, the order values are handled in is chosen when the
+ * observer is created, so the same class can use a different policy for every edge
+ * it's connected with.
+ *
+ * A consumer that is slower than the values it receives, like the AI, should use
+ * ThreadedObserverPolicy::LATEST_VALUE so that it always runs on the freshest value
+ * instead of falling further and further behind. The number of values that were
+ * coalesced is getNumDroppedValues().
+ *
+ * @tparam T The type of object this class is observing
+ */
+template <typename T>
+class ConfigurableThreadedObserver : public ThreadedObserver<T>
+{
+   public:
+    ConfigurableThreadedObserver() = delete;
+
+    /**
+     * Creates a new ConfigurableThreadedObserver
+     *
+     * @param policy the order to handle received values in
+     * @param buffer_size size of the buffer, this is ignored for
+     * ThreadedObserverPolicy::LATEST_VALUE which always has a buffer of one value
+     * @param log_buffer_full whether or not to log when the buffer is full, this is
+     * ignored for ThreadedObserverPolicy::LATEST_VALUE since coalescing values is
+     * expected
+     * @param use_lock_free_buffer whether to buffer values in a LockFreeRingBuffer
+     */
+    explicit ConfigurableThreadedObserver(
+        ThreadedObserverPolicy policy,
+        size_t buffer_size   = Observer<T>::DEFAULT_BUFFER_SIZE,
+        bool log_buffer_full = true, bool use_lock_free_buffer = false);
+
+    /**
+     * Gets the order received values are handled in
+     *
+     * @return the policy of this observer
+     */
+    ThreadedObserverPolicy getPolicy() const;
+
+   private:
+    std::optional<T> getNextValue(const Duration& max_wait_time) final override;
+
+    const ThreadedObserverPolicy policy;
+};
+
+template <typename T>
+ConfigurableThreadedObserver<T>::ConfigurableThreadedObserver(
+    ThreadedObserverPolicy policy, size_t buffer_size, bool log_buffer_full,
+    bool use_lock_free_buffer)
+    // The single slot mailbox is a lock free buffer of one value, so pushing to it
+    // never waits for the consumer
+    : ThreadedObserver<T>(
+          policy == ThreadedObserverPolicy::LATEST_VALUE ? 1 : buffer_size,
+          policy == ThreadedObserverPolicy::LATEST_VALUE ? false : log_buffer_full,
+          policy == ThreadedObserverPolicy::LATEST_VALUE ? true : use_lock_free_buffer),
+      policy(policy)
+{
+}
+
+template <typename T>
+ThreadedObserverPolicy ConfigurableThreadedObserver<T>::getPolicy() const
+{
+    return policy;
+}
+
+template <typename T>
+std::optional<T> ConfigurableThreadedObserver<T>::getNextValue(
+    const Duration& max_wait_time)
+{
+    if (policy == ThreadedObserverPolicy::FIRST_IN_FIRST_OUT)
+    {
+        return this->popLeastRecentlyReceivedValue(max_wait_time);
+    }
+    return this->popMostRecentlyReceivedValue(max_wait_time);
+}
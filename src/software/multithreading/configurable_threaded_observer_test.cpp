@@ -0,0 +1,109 @@
+#include "software/multithreading/configurable_threaded_observer.h"
+
+#include <gtest/gtest.h>
+
+#include <thread>
+
+using namespace std::chrono_literals;
+
+class TestConfigurableThreadedObserver : public ConfigurableThreadedObserver<int>
+{
+   public:
+    explicit TestConfigurableThreadedObserver(ThreadedObserverPolicy policy)
+        : ConfigurableThreadedObserver(policy, 10)
+    {
+    }
+
+    std::vector<int> received_values;
+
+   private:
+    void onValueReceived(int i) override
+    {
+        received_values.emplace_back(i);
+        // sleep for a while to ensure that values are received faster than they are
+        // handled
+        std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    }
+};
+
+TEST(ConfigurableThreadedObserver, getPolicy)
+{
+    for (ThreadedObserverPolicy policy : allValuesThreadedObserverPolicy())
+    {
+        TestConfigurableThreadedObserver test_threaded_observer(policy);
+        EXPECT_EQ(policy, test_threaded_observer.getPolicy());
+    }
+}
+
+TEST(ConfigurableThreadedObserver, first_in_first_out_receives_every_value_in_order)
+{
+    TestConfigurableThreadedObserver test_threaded_observer(
+        ThreadedObserverPolicy::FIRST_IN_FIRST_OUT);
+    std::vector<int> test_values{1, 2, 3, 4, 5};
+
+    for (auto num : test_values)
+    {
+        test_threaded_observer.receiveValue(num);
+    }
+
+    std::this_thread::sleep_for(3s);
+
+    EXPECT_EQ(test_values, test_threaded_observer.received_values);
+    EXPECT_EQ(0, test_threaded_observer.getNumDroppedValues());
+}
+
+TEST(ConfigurableThreadedObserver, last_in_first_out_receives_most_recent_value_first)
+{
+    TestConfigurableThreadedObserver test_threaded_observer(
+        ThreadedObserverPolicy::LAST_IN_FIRST_OUT);
+
+    // Wait for the first value to be handled before the rest are received
+    test_threaded_observer.receiveValue(1);
+    std::this_thread::sleep_for(50ms);
+    for (int num : {2, 3, 4, 5})
+    {
+        test_threaded_observer.receiveValue(num);
+    }
+
+    std::this_thread::sleep_for(3s);
+
+    EXPECT_EQ(std::vector<int>({1, 5, 4, 3, 2}), test_threaded_observer.received_values);
+}
+
+TEST(ConfigurableThreadedObserver, latest_value_coalesces_values_for_slow_consumer)
+{
+    TestConfigurableThreadedObserver test_threaded_observer(
+        ThreadedObserverPolicy::LATEST_VALUE);
+
+    // Wait for the first value to be handled before the rest are received
+    test_threaded_observer.receiveValue(1);
+    std::this_thread::sleep_for(50ms);
+    for (int num : {2, 3, 4, 5})
+    {
+        test_threaded_observer.receiveValue(num);
+    }
+
+    std::this_thread::sleep_for(3s);
+
+    // 2, 3 and 4 were replaced in the mailbox before the consumer was ready for them
+    EXPECT_EQ(std::vector<int>({1, 5}), test_threaded_observer.received_values);
+    EXPECT_EQ(3, test_threaded_observer.getNumDroppedValues());
+}
+
+TEST(ConfigurableThreadedObserver, latest_value_receives_every_value_from_slow_producer)
+{
+    TestConfigurableThreadedObserver test_threaded_observer(
+        ThreadedObserverPolicy::LATEST_VALUE);
+    std::vector<int> test_values{1, 2, 3};
+
+    for (auto num : test_values)
+    {
+        test_threaded_observer.receiveValue(num);
+        std::this_thread::sleep_for(300ms);
+    }
+
+    std::this_thread::sleep_for(1s);
+
+    EXPECT_EQ(test_values, test_threaded_observer.received_values);
+    EXPECT_EQ(0, test_threaded_observer.getNumDroppedValues());
+}
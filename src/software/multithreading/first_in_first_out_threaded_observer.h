@@ -23,10 +23,12 @@ class FirstInFirstOutThreadedObserver : public ThreadedObserver<T>
      *
      * @param buffer_size size of the buffer
      * @param log_buffer_full whether or not to log when the buffer is full
+     * @param use_lock_free_buffer whether to buffer values in a LockFreeRingBuffer
      */
     explicit FirstInFirstOutThreadedObserver<T>(size_t buffer_size,
-                                                bool log_buffer_full = true)
-        : ThreadedObserver<T>(buffer_size, log_buffer_full){};
+                                                bool log_buffer_full      = true,
+                                                bool use_lock_free_buffer = false)
+        : ThreadedObserver<T>(buffer_size, log_buffer_full, use_lock_free_buffer){};
     std::optional<T> getNextValue(const Duration& max_wait_time) final override;
 };
 
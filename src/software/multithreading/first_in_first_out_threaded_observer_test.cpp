@@ -21,7 +21,10 @@ class TestThreadedObserver : public FirstInFirstOutThreadedObserver<int>
 class TestVectorThreadedObserver : public FirstInFirstOutThreadedObserver<int>
 {
    public:
-    TestVectorThreadedObserver() : FirstInFirstOutThreadedObserver(10) {}
+    explicit TestVectorThreadedObserver(bool use_lock_free_buffer = false)
+        : FirstInFirstOutThreadedObserver(10, true, use_lock_free_buffer)
+    {
+    }
 
     std::vector<int> received_values;
 
@@ -62,6 +65,21 @@ TEST(FirstInFirstOutThreadedObserver, receiveMultipleValuesInOrder)
     EXPECT_EQ(test_vector_threaded_observer.received_values, test_values);
 }
 
+TEST(FirstInFirstOutThreadedObserver, receiveMultipleValuesInOrderWithLockFreeBuffer)
+{
+    TestVectorThreadedObserver test_vector_threaded_observer(true);
+    std::vector<int> test_values{1, 2, 3, 4, 5};
+
+    for (auto num : test_values)
+    {
+        test_vector_threaded_observer.receiveValue(num);
+    }
+
+    std::this_thread::sleep_for(5s);
+
+    EXPECT_EQ(test_vector_threaded_observer.received_values, test_values);
+}
+
 TEST(FirstInFirstOutThreadedObserver, destructor)
 {
     // Because the destructor has to manage the internal thread to make sure it
@@ -74,3 +92,20 @@ TEST(FirstInFirstOutThreadedObserver, destructor)
 
     test_threaded_observer.reset();
 }
+
+TEST(FirstInFirstOutThreadedObserver, destructor_wakes_up_waiting_thread)
+{
+    for (bool use_lock_free_buffer : {false, true})
+    {
+        auto test_threaded_observer =
+            std::make_shared<TestVectorThreadedObserver>(use_lock_free_buffer);
+
+        // Let the thread start waiting for a value
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+        // The destructor shouldn't have to wait for the thread to time out
+        auto start_time = std::chrono::steady_clock::now();
+        test_threaded_observer.reset();
+        EXPECT_LT(std::chrono::steady_clock::now() - start_time, std::chrono::seconds(1));
+    }
+}
@@ -14,8 +14,16 @@ class LastInFirstOutThreadedObserver : public ThreadedObserver<T>
 {
    public:
     LastInFirstOutThreadedObserver() : ThreadedObserver<T>(){};
-    explicit LastInFirstOutThreadedObserver<T>(size_t buffer_size)
-        : ThreadedObserver<T>(buffer_size){};
+
+    /**
+     * Creates a new LastInFirstOutThreadedObserver
+     *
+     * @param buffer_size size of the buffer
+     * @param use_lock_free_buffer whether to buffer values in a LockFreeRingBuffer
+     */
+    explicit LastInFirstOutThreadedObserver<T>(size_t buffer_size,
+                                               bool use_lock_free_buffer = false)
+        : ThreadedObserver<T>(buffer_size, true, use_lock_free_buffer){};
     std::optional<T> getNextValue(const Duration& max_wait_time) final;
 };
 
@@ -21,7 +21,10 @@ class TestThreadedObserver : public LastInFirstOutThreadedObserver<int>
 class TestVectorThreadedObserver : public LastInFirstOutThreadedObserver<int>
 {
    public:
-    TestVectorThreadedObserver() : LastInFirstOutThreadedObserver(10) {}
+    explicit TestVectorThreadedObserver(bool use_lock_free_buffer = false)
+        : LastInFirstOutThreadedObserver(10, use_lock_free_buffer)
+    {
+    }
 
     std::vector<int> received_values;
 
@@ -63,6 +66,22 @@ TEST(LastInFirstOutThreadedObserver, receiveMultipleValuesInOrder)
     EXPECT_EQ(test_vector_threaded_observer.received_values, expected_values);
 }
 
+TEST(LastInFirstOutThreadedObserver, receiveMultipleValuesInOrderWithLockFreeBuffer)
+{
+    TestVectorThreadedObserver test_vector_threaded_observer(true);
+    std::vector<int> test_values{1, 2, 3, 4, 5};
+    std::vector<int> expected_values(test_values.rbegin(), test_values.rend());
+
+    for (auto num : test_values)
+    {
+        test_vector_threaded_observer.receiveValue(num);
+    }
+
+    std::this_thread::sleep_for(5s);
+
+    EXPECT_EQ(test_vector_threaded_observer.received_values, expected_values);
+}
+
 TEST(LastInFirstOutThreadedObserver, destructor)
 {
     // Because the destructor has to manage the internal thread to make sure it
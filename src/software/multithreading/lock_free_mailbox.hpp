@@ -0,0 +1,257 @@
+#pragma once
+
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <climits>
+#include <cstdint>
+#include <ctime>
+#include <utility>
+
+#include "software/time/duration.h"
+
+/**
+ * A mailbox that holds the most recently written value, for one thread to hand values
+ * to another without either thread ever waiting on the other.
+ *
+ * This is a double buffer with a spare buffer in the middle: the writer fills its own
+ * buffer and publishes it by atomically exchanging it with the middle buffer, and the
+ * reader takes a published value by atomically exchanging its own buffer with the
+ * middle buffer. Neither side ever copies the value of the other or waits for it to
+ * finish, so this is safe to use from a real-time loop. A value that is written before
+ * the previous one was read replaces it.
+ *
+ * The buffers are reused, so filling the write buffer in place avoids reallocating
+ * values with dynamically allocated members (ex. protobufs).
+ *
+ * Only one thread may write values at a time, and only one thread may read values at a
+ * time.
+ *
+ * @tparam T The type of the value in the mailbox
+ */
+template <typename T>
+class LockFreeMailbox
+{
+   public:
+    LockFreeMailbox();
+
+    // Copying this class is not permitted
+    LockFreeMailbox(const LockFreeMailbox&) = delete;
+
+    /**
+     * Gets the buffer the next value is written into. The buffer holds an old value,
+     * and must be filled in completely before it is published.
+     *
+     * @return the write buffer
+     */
+    T& getWriteBuffer();
+
+    /**
+     * Publishes the write buffer as the newest value of the mailbox, replacing the
+     * previous value if it wasn't read yet. This never waits for the reader.
+     */
+    void publish();
+
+    /**
+     * Writes a value to the mailbox and publishes it
+     *
+     * @param value The value to write
+     */
+    void write(const T& value);
+
+    /**
+     * Writes a value to the mailbox without copying it, and publishes it
+     *
+     * @param value The value to move into the mailbox
+     */
+    void write(T&& value);
+
+    /**
+     * Reads the newest value if there is one that hasn't been read yet. This never
+     * waits for the writer.
+     *
+     * @return a pointer to the newest value, or nullptr if no value was published
+     * since the last read. The value is owned by the reader until the next read, and
+     * may be modified or moved out of.
+     */
+    T* readNewValue();
+
+    /**
+     * Reads the newest value, waiting for a value to be published if there is none
+     * that hasn't been read yet. This must not be used by a thread that can't block.
+     *
+     * If there is no new value, this function will *block* until:
+     * - a value is published
+     * - the given amount of time is exceeded
+     * - the destructor of this class is called
+     *
+     * @param max_wait_time The maximum duration to wait for a new value before
+     *                      returning
+     *
+     * @return a pointer to the newest value, or nullptr if none was published
+     */
+    T* waitForNewValue(Duration max_wait_time);
+
+    /**
+     * Gets the number of values that were replaced by a newer value before they were
+     * read
+     *
+     * @return the number of dropped values
+     */
+    uint64_t getNumDroppedValues() const;
+
+    ~LockFreeMailbox();
+
+   private:
+    struct Buffer
+    {
+        // Aligned so that the reader and writer don't share a cache line
+        alignas(64) T value;
+    };
+
+    // The middle buffer is stored as its index, with NEW_VALUE_FLAG set when it holds
+    // a published value that hasn't been read
+    static constexpr uint8_t BUFFER_INDEX_MASK = 0x3;
+    static constexpr uint8_t NEW_VALUE_FLAG    = 0x4;
+
+    std::array<Buffer, 3> buffers;
+
+    // Only used by the writer
+    uint8_t write_index;
+    // Only used by the reader
+    uint8_t read_index;
+    alignas(64) std::atomic<uint8_t> middle_index;
+
+    // Incremented every time a value is published, this is the futex that threads
+    // waiting for a value sleep on
+    alignas(64) std::atomic<uint32_t> num_publishes;
+    std::atomic<uint32_t> num_waiting_threads;
+
+    std::atomic<uint64_t> num_dropped_values;
+    std::atomic<bool> destructor_called;
+};
+
+template <typename T>
+LockFreeMailbox<T>::LockFreeMailbox()
+    : buffers(),
+      write_index(0),
+      read_index(1),
+      middle_index(2),
+      num_publishes(0),
+      num_waiting_threads(0),
+      num_dropped_values(0),
+      destructor_called(false)
+{
+}
+
+template <typename T>
+T& LockFreeMailbox<T>::getWriteBuffer()
+{
+    return buffers[write_index].value;
+}
+
+template <typename T>
+void LockFreeMailbox<T>::publish()
+{
+    uint8_t previous_middle_index = middle_index.exchange(
+        static_cast<uint8_t>(write_index | NEW_VALUE_FLAG), std::memory_order_acq_rel);
+    write_index = static_cast<uint8_t>(previous_middle_index & BUFFER_INDEX_MASK);
+    if (previous_middle_index & NEW_VALUE_FLAG)
+    {
+        num_dropped_values.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    num_publishes.fetch_add(1);
+    if (num_waiting_threads.load() > 0)
+    {
+        syscall(SYS_futex, reinterpret_cast<uint32_t*>(&num_publishes),
+                FUTEX_WAKE_PRIVATE, INT_MAX, nullptr, nullptr, 0);
+    }
+}
+
+template <typename T>
+void LockFreeMailbox<T>::write(const T& value)
+{
+    getWriteBuffer() = value;
+    publish();
+}
+
+template <typename T>
+void LockFreeMailbox<T>::write(T&& value)
+{
+    getWriteBuffer() = std::move(value);
+    publish();
+}
+
+template <typename T>
+T* LockFreeMailbox<T>::readNewValue()
+{
+    // Only the reader clears the flag, so the middle buffer still holds a new value
+    // when we exchange it below
+    if (!(middle_index.load(std::memory_order_relaxed) & NEW_VALUE_FLAG))
+    {
+        return nullptr;
+    }
+
+    uint8_t previous_middle_index =
+        middle_index.exchange(read_index, std::memory_order_acq_rel);
+    read_index = static_cast<uint8_t>(previous_middle_index & BUFFER_INDEX_MASK);
+    return &buffers[read_index].value;
+}
+
+template <typename T>
+T* LockFreeMailbox<T>::waitForNewValue(Duration max_wait_time)
+{
+    const auto deadline = std::chrono::steady_clock::now() +
+                          std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                              std::chrono::duration<double>(max_wait_time.toSeconds()));
+
+    while (true)
+    {
+        // We read the number of publishes before checking for a value, so if a value
+        // is published after we check the futex wait below returns immediately
+        uint32_t num_publishes_before_read = num_publishes.load();
+
+        T* value = readNewValue();
+        if (value || destructor_called.load())
+        {
+            return value;
+        }
+
+        auto time_remaining = deadline - std::chrono::steady_clock::now();
+        if (time_remaining <= std::chrono::steady_clock::duration::zero())
+        {
+            return nullptr;
+        }
+
+        auto nanoseconds_remaining =
+            std::chrono::duration_cast<std::chrono::nanoseconds>(time_remaining).count();
+        struct timespec timeout;
+        timeout.tv_sec  = static_cast<time_t>(nanoseconds_remaining / 1000000000);
+        timeout.tv_nsec = static_cast<long>(nanoseconds_remaining % 1000000000);
+
+        num_waiting_threads.fetch_add(1);
+        syscall(SYS_futex, reinterpret_cast<uint32_t*>(&num_publishes),
+                FUTEX_WAIT_PRIVATE, num_publishes_before_read, &timeout, nullptr, 0);
+        num_waiting_threads.fetch_sub(1);
+    }
+}
+
+template <typename T>
+uint64_t LockFreeMailbox<T>::getNumDroppedValues() const
+{
+    return num_dropped_values.load(std::memory_order_relaxed);
+}
+
+template <typename T>
+LockFreeMailbox<T>::~LockFreeMailbox()
+{
+    destructor_called.store(true);
+    num_publishes.fetch_add(1);
+    syscall(SYS_futex, reinterpret_cast<uint32_t*>(&num_publishes), FUTEX_WAKE_PRIVATE,
+            INT_MAX, nullptr, nullptr, 0);
+}
@@ -0,0 +1,143 @@
+#include "software/multithreading/lock_free_mailbox.hpp"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <thread>
+#include <vector>
+
+TEST(LockFreeMailboxTest, read_new_value_without_writing)
+{
+    LockFreeMailbox<int> mailbox;
+
+    EXPECT_EQ(nullptr, mailbox.readNewValue());
+}
+
+TEST(LockFreeMailboxTest, read_new_value_only_returns_a_value_once)
+{
+    LockFreeMailbox<int> mailbox;
+
+    mailbox.write(7);
+
+    int* value = mailbox.readNewValue();
+    ASSERT_NE(nullptr, value);
+    EXPECT_EQ(7, *value);
+    EXPECT_EQ(nullptr, mailbox.readNewValue());
+}
+
+TEST(LockFreeMailboxTest, read_new_value_returns_most_recently_written_value)
+{
+    LockFreeMailbox<int> mailbox;
+
+    mailbox.write(7);
+    mailbox.write(8);
+    mailbox.write(9);
+
+    int* value = mailbox.readNewValue();
+    ASSERT_NE(nullptr, value);
+    EXPECT_EQ(9, *value);
+    EXPECT_EQ(2u, mailbox.getNumDroppedValues());
+}
+
+TEST(LockFreeMailboxTest, read_value_is_not_changed_by_writes)
+{
+    LockFreeMailbox<int> mailbox;
+
+    mailbox.write(7);
+    int* value = mailbox.readNewValue();
+    mailbox.write(8);
+    mailbox.write(9);
+
+    ASSERT_NE(nullptr, value);
+    EXPECT_EQ(7, *value);
+}
+
+TEST(LockFreeMailboxTest, fill_write_buffer_in_place)
+{
+    LockFreeMailbox<std::vector<int>> mailbox;
+
+    for (int i = 0; i < 5; i++)
+    {
+        std::vector<int>& write_buffer = mailbox.getWriteBuffer();
+        write_buffer.assign(3, i);
+        mailbox.publish();
+
+        std::vector<int>* value = mailbox.readNewValue();
+        ASSERT_NE(nullptr, value);
+        EXPECT_EQ(std::vector<int>(3, i), *value);
+    }
+}
+
+TEST(LockFreeMailboxTest, write_moves_value_into_mailbox)
+{
+    LockFreeMailbox<std::unique_ptr<int>> mailbox;
+
+    mailbox.write(std::make_unique<int>(7));
+
+    std::unique_ptr<int>* value = mailbox.readNewValue();
+    ASSERT_NE(nullptr, value);
+    ASSERT_NE(nullptr, *value);
+    EXPECT_EQ(7, **value);
+}
+
+TEST(LockFreeMailboxTest, wait_for_new_value_times_out)
+{
+    LockFreeMailbox<int> mailbox;
+
+    auto start_time = std::chrono::steady_clock::now();
+    EXPECT_EQ(nullptr, mailbox.waitForNewValue(Duration::fromMilliseconds(10)));
+    EXPECT_GE(std::chrono::steady_clock::now() - start_time,
+              std::chrono::milliseconds(10));
+}
+
+TEST(LockFreeMailboxTest, wait_for_new_value_wakes_up_when_value_is_written)
+{
+    LockFreeMailbox<int> mailbox;
+
+    std::thread writer([&mailbox]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        mailbox.write(7);
+    });
+
+    int* value = mailbox.waitForNewValue(Duration::fromSeconds(10));
+    ASSERT_NE(nullptr, value);
+    EXPECT_EQ(7, *value);
+
+    writer.join();
+}
+
+TEST(LockFreeMailboxTest, read_values_written_by_another_thread_in_order)
+{
+    const int NUM_VALUES = 100000;
+    LockFreeMailbox<std::vector<int>> mailbox;
+
+    // Every value is a vector of the same number, so a value that was torn by the
+    // reader and writer using the same buffer would have different numbers
+    std::thread writer([&mailbox]() {
+        for (int i = 1; i <= NUM_VALUES; i++)
+        {
+            mailbox.getWriteBuffer().assign(16, i);
+            mailbox.publish();
+        }
+    });
+
+    int last_value = 0;
+    while (last_value < NUM_VALUES)
+    {
+        std::vector<int>* value = mailbox.readNewValue();
+        if (value == nullptr)
+        {
+            continue;
+        }
+
+        ASSERT_EQ(16u, value->size());
+        EXPECT_GT(value->front(), last_value);
+        for (int number : *value)
+        {
+            ASSERT_EQ(value->front(), number);
+        }
+        last_value = value->front();
+    }
+
+    writer.join();
+}
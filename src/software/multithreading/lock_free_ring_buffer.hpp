@@ -0,0 +1,495 @@
+#pragma once
+
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <chrono>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <ctime>
+#include <memory>
+#include <optional>
+#include <thread>
+#include <utility>
+
+#include "software/logger/logger.h"
+#include "software/time/duration.h"
+#include "software/util/typename/typename.h"
+
+/**
+ * This class represents a buffer of objects, with the same semantics as
+ * ThreadSafeBuffer, that does not lock a mutex to push or pop values
+ *
+ * The positions of the least and most recently added values are packed into a single
+ * atomic word, so pushing a value, popping from either end of the buffer, and
+ * overwriting the least recently added value when the buffer is full each claim a
+ * position with one compare-and-swap. Every slot has a sequence number that tells the
+ * thread that claimed a position when the slot is ready to be written or read.
+ *
+ * Threads waiting for a value sleep on a futex that is only woken up when a value is
+ * pushed, stopWaitingForValues is called or the destructor is called, and pushes only
+ * make a system call when there is a thread waiting.
+ *
+ * Any number of threads may push values at the same time, but only one thread may pop
+ * values at a time.
+ *
+ * @tparam T The type of whatever is being buffered
+ */
+template <typename T>
+class LockFreeRingBuffer
+{
+   public:
+    // Force the user to specify a size
+    explicit LockFreeRingBuffer() = delete;
+
+    /**
+     * Creates a new LockFreeRingBuffer
+     *
+     * @param buffer_size size of the buffer
+     * @param log_buffer_full whether or not to log when the buffer is full
+     */
+    explicit LockFreeRingBuffer(std::size_t buffer_size, bool log_buffer_full = true);
+
+    // Copying this class is not permitted
+    LockFreeRingBuffer(const LockFreeRingBuffer&) = delete;
+
+    /**
+     * Removes the value least recently added to the buffer and returns it
+     *
+     * ex. if A,B,C were added to the buffer (in that order), this would return A
+     *
+     * If the buffer is empty, this function will *block* until:
+     * - a value becomes available
+     * - the given amount of time is exceeded
+     * - stopWaitingForValues is called
+     * - the destructor of this class is called
+     *
+     * @param max_wait_time The maximum duration to wait for a new value before
+     *                      returning
+     *
+     * @return The least recently added value to the buffer, or std::nullopt if none is
+     *         available
+     */
+    std::optional<T> popLeastRecentlyAddedValue(
+        Duration max_wait_time = Duration::fromSeconds(0));
+
+    /**
+     * Removes the value most recently added to the buffer and returns it
+     *
+     * ex. if A,B,C were added to the buffer (in that order), this would return C
+     *
+     * If the buffer is empty, this function will *block* until:
+     * - a value becomes available
+     * - the given amount of time is exceeded
+     * - stopWaitingForValues is called
+     * - the destructor of this class is called
+     *
+     * @param max_wait_time The maximum duration to wait for a new value before
+     *                      returning
+     *
+     * @return The most recently added value to the buffer, or std::nullopt if none is
+     *         available
+     */
+    std::optional<T> popMostRecentlyAddedValue(
+        Duration max_wait_time = Duration::fromSeconds(0));
+
+    /**
+     * Push the given value onto the buffer
+     *
+     * If the buffer is already full, this will overwrite the least recently added value
+     *
+     * @param value The value to push onto the buffer
+     */
+    void push(const T& value);
+
+    /**
+     * Push the given value onto the buffer without copying it
+     *
+     * If the buffer is already full, this will overwrite the least recently added value
+     *
+     * @param value The value to move onto the buffer
+     */
+    void push(T&& value);
+
+    /**
+     * Gets the number of values that were dropped because they were overwritten by a
+     * push onto a full buffer before they were popped
+     *
+     * @return the number of dropped values
+     */
+    uint64_t getNumDroppedValues() const;
+
+    /**
+     * Wakes up any thread waiting for a value, and makes pops return immediately
+     * instead of waiting for a value from then on. Values that are already in the
+     * buffer can still be popped.
+     */
+    void stopWaitingForValues();
+
+    ~LockFreeRingBuffer();
+
+   private:
+    struct Slot
+    {
+        // The position this slot is free to be written at, or one more than the
+        // position of the value in this slot once the value has been written
+        std::atomic<uint32_t> sequence;
+        std::optional<T> value;
+    };
+
+    /**
+     * Copies or moves the given value onto the buffer
+     *
+     * @param value The value to push onto the buffer
+     */
+    template <typename ValueType>
+    void pushValue(ValueType&& value);
+
+    /**
+     * Removes the least recently added value from the buffer without blocking
+     *
+     * @return the least recently added value, or std::nullopt if the buffer is empty
+     */
+    std::optional<T> tryPopLeastRecentlyAddedValue();
+
+    /**
+     * Removes the most recently added value from the buffer without blocking
+     *
+     * @return the most recently added value, or std::nullopt if the buffer is empty
+     */
+    std::optional<T> tryPopMostRecentlyAddedValue();
+
+    /**
+     * Calls the given pop function until it returns a value, sleeping until a value is
+     * pushed whenever the buffer is empty
+     *
+     * @param max_wait_time The maximum duration to wait for a new value before
+     *                      returning
+     * @param try_pop Pops a value from the buffer without blocking
+     *
+     * @return The popped value, or std::nullopt if none is available
+     */
+    template <typename TryPopFunction>
+    std::optional<T> waitForValue(Duration max_wait_time, TryPopFunction try_pop);
+
+    /**
+     * Waits for the thread that previously claimed the position of a slot to finish
+     * with the slot. This only ever waits for a thread that is in the middle of
+     * copying a value into or out of the slot.
+     *
+     * @param slot The slot to wait for
+     * @param sequence The sequence number to wait for the slot to have
+     */
+    static void waitForSlotSequence(const Slot& slot, uint32_t sequence);
+
+    static uint64_t packPositions(uint32_t head, uint32_t tail);
+    static uint32_t headPosition(uint64_t positions);
+    static uint32_t tailPosition(uint64_t positions);
+
+    // The smallest number of slots that is a power of two and can hold buffer_size
+    // values. There are always at least two slots so that a free slot never has the
+    // same sequence number as a written one.
+    static std::size_t numSlots(std::size_t buffer_size);
+
+    const uint32_t capacity;
+    const uint32_t slot_index_mask;
+    std::unique_ptr<Slot[]> slots;
+
+    // The position of the least recently added value (the head) in the upper 32 bits,
+    // and the position after the most recently added value (the tail) in the lower 32
+    // bits. Positions only ever increase, except when the most recently added value is
+    // popped, and are wrapped into slots with slot_index_mask.
+    alignas(64) std::atomic<uint64_t> positions;
+
+    // Incremented every time a value is pushed, this is the futex that threads waiting
+    // for a value sleep on
+    alignas(64) std::atomic<uint32_t> num_pushes;
+    std::atomic<uint32_t> num_waiting_threads;
+
+    std::atomic<uint64_t> num_dropped_values;
+
+    bool log_buffer_full;
+    std::atomic<bool> stop_waiting;
+};
+
+template <typename T>
+LockFreeRingBuffer<T>::LockFreeRingBuffer(std::size_t buffer_size, bool log_buffer_full)
+    : capacity(static_cast<uint32_t>(buffer_size)),
+      slot_index_mask(static_cast<uint32_t>(numSlots(buffer_size) - 1)),
+      slots(std::make_unique<Slot[]>(numSlots(buffer_size))),
+      positions(0),
+      num_pushes(0),
+      num_waiting_threads(0),
+      num_dropped_values(0),
+      log_buffer_full(log_buffer_full),
+      stop_waiting(false)
+{
+    for (uint32_t i = 0; i <= slot_index_mask; i++)
+    {
+        slots[i].sequence.store(i, std::memory_order_relaxed);
+    }
+}
+
+template <typename T>
+std::optional<T> LockFreeRingBuffer<T>::popLeastRecentlyAddedValue(Duration max_wait_time)
+{
+    return waitForValue(max_wait_time,
+                        [this]() { return tryPopLeastRecentlyAddedValue(); });
+}
+
+template <typename T>
+std::optional<T> LockFreeRingBuffer<T>::popMostRecentlyAddedValue(Duration max_wait_time)
+{
+    return waitForValue(max_wait_time,
+                        [this]() { return tryPopMostRecentlyAddedValue(); });
+}
+
+template <typename T>
+void LockFreeRingBuffer<T>::push(const T& value)
+{
+    pushValue(value);
+}
+
+template <typename T>
+void LockFreeRingBuffer<T>::push(T&& value)
+{
+    pushValue(std::move(value));
+}
+
+template <typename T>
+template <typename ValueType>
+void LockFreeRingBuffer<T>::pushValue(ValueType&& value)
+{
+    if (capacity == 0)
+    {
+        num_dropped_values.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    bool logged_buffer_full    = false;
+    uint64_t current_positions = positions.load(std::memory_order_acquire);
+    while (true)
+    {
+        uint32_t head = headPosition(current_positions);
+        uint32_t tail = tailPosition(current_positions);
+
+        if (tail - head >= capacity)
+        {
+            if (log_buffer_full && !logged_buffer_full)
+            {
+                LOG(WARNING) << "Pushing to a full LockFreeRingBuffer of type: "
+                             << TYPENAME(T) << std::endl;
+                logged_buffer_full = true;
+            }
+
+            // Overwrite the least recently added value by claiming its position and
+            // freeing its slot for the position a full lap of the slots later
+            if (positions.compare_exchange_weak(current_positions,
+                                                packPositions(head + 1, tail),
+                                                std::memory_order_acq_rel))
+            {
+                num_dropped_values.fetch_add(1, std::memory_order_relaxed);
+                Slot& slot = slots[head & slot_index_mask];
+                waitForSlotSequence(slot, head + 1);
+                slot.value.reset();
+                slot.sequence.store(head + slot_index_mask + 1,
+                                    std::memory_order_release);
+                current_positions = positions.load(std::memory_order_acquire);
+            }
+            continue;
+        }
+
+        if (positions.compare_exchange_weak(current_positions,
+                                            packPositions(head, tail + 1),
+                                            std::memory_order_acq_rel))
+        {
+            Slot& slot = slots[tail & slot_index_mask];
+            waitForSlotSequence(slot, tail);
+            slot.value.emplace(std::forward<ValueType>(value));
+            slot.sequence.store(tail + 1, std::memory_order_release);
+            break;
+        }
+    }
+
+    num_pushes.fetch_add(1);
+    if (num_waiting_threads.load() > 0)
+    {
+        syscall(SYS_futex, reinterpret_cast<uint32_t*>(&num_pushes), FUTEX_WAKE_PRIVATE,
+                INT_MAX, nullptr, nullptr, 0);
+    }
+}
+
+template <typename T>
+uint64_t LockFreeRingBuffer<T>::getNumDroppedValues() const
+{
+    return num_dropped_values.load(std::memory_order_relaxed);
+}
+
+template <typename T>
+std::optional<T> LockFreeRingBuffer<T>::tryPopLeastRecentlyAddedValue()
+{
+    uint64_t current_positions = positions.load(std::memory_order_acquire);
+    while (true)
+    {
+        uint32_t head = headPosition(current_positions);
+        uint32_t tail = tailPosition(current_positions);
+        if (head == tail)
+        {
+            return std::nullopt;
+        }
+
+        if (positions.compare_exchange_weak(current_positions,
+                                            packPositions(head + 1, tail),
+                                            std::memory_order_acq_rel))
+        {
+            Slot& slot = slots[head & slot_index_mask];
+            waitForSlotSequence(slot, head + 1);
+            std::optional<T> result = std::move(slot.value);
+            slot.value.reset();
+            slot.sequence.store(head + slot_index_mask + 1, std::memory_order_release);
+            return result;
+        }
+    }
+}
+
+template <typename T>
+std::optional<T> LockFreeRingBuffer<T>::tryPopMostRecentlyAddedValue()
+{
+    uint64_t current_positions = positions.load(std::memory_order_acquire);
+    while (true)
+    {
+        uint32_t head = headPosition(current_positions);
+        uint32_t tail = tailPosition(current_positions);
+        if (head == tail)
+        {
+            return std::nullopt;
+        }
+
+        // Unlike the least recently added value, a producer could claim the position of
+        // the most recently added value again as soon as it is popped, so we mark the
+        // slot as being read before claiming it. Nothing waits for the marked sequence
+        // number, which is the sequence number the slot would have after being written
+        // a full lap of the slots later.
+        Slot& slot                      = slots[(tail - 1) & slot_index_mask];
+        uint32_t written_sequence       = tail;
+        const uint32_t reading_sequence = tail + slot_index_mask + 1;
+        if (!slot.sequence.compare_exchange_strong(written_sequence, reading_sequence,
+                                                   std::memory_order_acq_rel))
+        {
+            // The value is still being written
+            std::this_thread::yield();
+            current_positions = positions.load(std::memory_order_acquire);
+            continue;
+        }
+
+        if (positions.compare_exchange_strong(current_positions,
+                                              packPositions(head, tail - 1),
+                                              std::memory_order_acq_rel))
+        {
+            std::optional<T> result = std::move(slot.value);
+            slot.value.reset();
+            slot.sequence.store(tail - 1, std::memory_order_release);
+            return result;
+        }
+
+        // The positions changed before we could claim the value, so we let whoever
+        // changed them read the value
+        slot.sequence.store(tail, std::memory_order_release);
+    }
+}
+
+template <typename T>
+template <typename TryPopFunction>
+std::optional<T> LockFreeRingBuffer<T>::waitForValue(Duration max_wait_time,
+                                                     TryPopFunction try_pop)
+{
+    const auto deadline = std::chrono::steady_clock::now() +
+                          std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                              std::chrono::duration<double>(max_wait_time.toSeconds()));
+
+    while (true)
+    {
+        // We read the number of pushes before checking the buffer, so if a value is
+        // pushed after we check the futex wait below returns immediately
+        uint32_t num_pushes_before_pop = num_pushes.load();
+
+        std::optional<T> result = try_pop();
+        if (result || stop_waiting.load())
+        {
+            return result;
+        }
+
+        auto time_remaining = deadline - std::chrono::steady_clock::now();
+        if (time_remaining <= std::chrono::steady_clock::duration::zero())
+        {
+            return std::nullopt;
+        }
+
+        auto nanoseconds_remaining =
+            std::chrono::duration_cast<std::chrono::nanoseconds>(time_remaining).count();
+        struct timespec timeout;
+        timeout.tv_sec  = static_cast<time_t>(nanoseconds_remaining / 1000000000);
+        timeout.tv_nsec = static_cast<long>(nanoseconds_remaining % 1000000000);
+
+        num_waiting_threads.fetch_add(1);
+        syscall(SYS_futex, reinterpret_cast<uint32_t*>(&num_pushes), FUTEX_WAIT_PRIVATE,
+                num_pushes_before_pop, &timeout, nullptr, 0);
+        num_waiting_threads.fetch_sub(1);
+    }
+}
+
+template <typename T>
+void LockFreeRingBuffer<T>::waitForSlotSequence(const Slot& slot, uint32_t sequence)
+{
+    while (slot.sequence.load(std::memory_order_acquire) != sequence)
+    {
+        std::this_thread::yield();
+    }
+}
+
+template <typename T>
+uint64_t LockFreeRingBuffer<T>::packPositions(uint32_t head, uint32_t tail)
+{
+    return (static_cast<uint64_t>(head) << 32) | tail;
+}
+
+template <typename T>
+uint32_t LockFreeRingBuffer<T>::headPosition(uint64_t positions)
+{
+    return static_cast<uint32_t>(positions >> 32);
+}
+
+template <typename T>
+uint32_t LockFreeRingBuffer<T>::tailPosition(uint64_t positions)
+{
+    return static_cast<uint32_t>(positions);
+}
+
+template <typename T>
+std::size_t LockFreeRingBuffer<T>::numSlots(std::size_t buffer_size)
+{
+    std::size_t num_slots = 2;
+    while (num_slots < buffer_size)
+    {
+        num_slots *= 2;
+    }
+    return num_slots;
+}
+
+template <typename T>
+void LockFreeRingBuffer<T>::stopWaitingForValues()
+{
+    stop_waiting.store(true);
+    num_pushes.fetch_add(1);
+    syscall(SYS_futex, reinterpret_cast<uint32_t*>(&num_pushes), FUTEX_WAKE_PRIVATE,
+            INT_MAX, nullptr, nullptr, 0);
+}
+
+template <typename T>
+LockFreeRingBuffer<T>::~LockFreeRingBuffer()
+{
+    stopWaitingForValues();
+}
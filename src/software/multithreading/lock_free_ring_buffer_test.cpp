@@ -0,0 +1,247 @@
+#include "software/multithreading/lock_free_ring_buffer.hpp"
+
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <vector>
+
+TEST(LockFreeRingBufferTest, pullLeastRecentlyAddedValue_single_value_length_one)
+{
+    LockFreeRingBuffer<int> buffer(1);
+
+    buffer.push(7);
+
+    EXPECT_EQ(std::optional<int>(7), buffer.popLeastRecentlyAddedValue());
+    EXPECT_EQ(std::nullopt, buffer.popLeastRecentlyAddedValue());
+}
+
+TEST(LockFreeRingBufferTest, pullLeastRecentlyAddedValue_multiple_values)
+{
+    LockFreeRingBuffer<int> buffer(3);
+
+    buffer.push(7);
+    buffer.push(8);
+    buffer.push(9);
+
+    EXPECT_EQ(7, buffer.popLeastRecentlyAddedValue());
+    EXPECT_EQ(8, buffer.popLeastRecentlyAddedValue());
+    EXPECT_EQ(9, buffer.popLeastRecentlyAddedValue());
+    EXPECT_EQ(std::nullopt, buffer.popLeastRecentlyAddedValue());
+}
+
+TEST(LockFreeRingBufferTest, pullMostRecentlyAddedValue_multiple_values)
+{
+    LockFreeRingBuffer<int> buffer(3);
+
+    buffer.push(7);
+    buffer.push(8);
+    buffer.push(9);
+
+    EXPECT_EQ(9, buffer.popMostRecentlyAddedValue());
+    EXPECT_EQ(8, buffer.popMostRecentlyAddedValue());
+    EXPECT_EQ(7, buffer.popMostRecentlyAddedValue());
+    EXPECT_EQ(std::nullopt, buffer.popMostRecentlyAddedValue());
+}
+
+TEST(LockFreeRingBufferTest, pull_from_both_ends_after_popping_most_recently_added_value)
+{
+    LockFreeRingBuffer<int> buffer(3, false);
+
+    buffer.push(1);
+    buffer.push(2);
+    EXPECT_EQ(2, buffer.popMostRecentlyAddedValue());
+    buffer.push(3);
+    buffer.push(4);
+    buffer.push(5);
+
+    EXPECT_EQ(3, buffer.popLeastRecentlyAddedValue());
+    EXPECT_EQ(5, buffer.popMostRecentlyAddedValue());
+    EXPECT_EQ(4, buffer.popLeastRecentlyAddedValue());
+    EXPECT_EQ(std::nullopt, buffer.popLeastRecentlyAddedValue());
+}
+
+TEST(LockFreeRingBufferTest, push_more_values_then_buffer_can_hold)
+{
+    LockFreeRingBuffer<int> buffer(3, false);
+
+    buffer.push(37);
+    buffer.push(38);
+    buffer.push(39);
+    buffer.push(40);
+
+    // We should have overwritten the least recently added value
+    EXPECT_EQ(38, buffer.popLeastRecentlyAddedValue());
+    EXPECT_EQ(39, buffer.popLeastRecentlyAddedValue());
+    EXPECT_EQ(40, buffer.popLeastRecentlyAddedValue());
+}
+
+TEST(LockFreeRingBufferTest, push_many_more_values_then_buffer_can_hold)
+{
+    // Wrap around the slots many times with a buffer size that is not a power of two
+    LockFreeRingBuffer<int> buffer(5, false);
+
+    for (int i = 0; i < 1000; i++)
+    {
+        buffer.push(i);
+    }
+
+    for (int i = 995; i < 1000; i++)
+    {
+        EXPECT_EQ(i, buffer.popLeastRecentlyAddedValue());
+    }
+    EXPECT_EQ(std::nullopt, buffer.popLeastRecentlyAddedValue());
+}
+
+TEST(LockFreeRingBufferTest, pullLeastRecentlyAddedValue_when_buffer_is_empty)
+{
+    LockFreeRingBuffer<int> buffer(3);
+
+    std::optional<int> result = std::nullopt;
+
+    // This "popLeastRecentlyAddedValue" call should block until something is "pushed"
+    std::thread puller_thread(
+        [&]() { result = buffer.popLeastRecentlyAddedValue(Duration::fromSeconds(10)); });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    buffer.push(84);
+
+    // Wait for the popLeastRecentlyAddedValue to complete
+    puller_thread.join();
+
+    ASSERT_TRUE(result);
+    EXPECT_EQ(84, *result);
+}
+
+TEST(LockFreeRingBufferTest, pullMostRecentlyAddedValue_times_out_when_buffer_is_empty)
+{
+    LockFreeRingBuffer<int> buffer(3);
+
+    auto start_time = std::chrono::steady_clock::now();
+    EXPECT_EQ(std::nullopt, buffer.popMostRecentlyAddedValue(Duration::fromSeconds(0.2)));
+    EXPECT_GE(std::chrono::steady_clock::now() - start_time,
+              std::chrono::milliseconds(200));
+}
+
+TEST(LockFreeRingBufferTest, values_from_multiple_producers_arrive_in_order)
+{
+    const int num_producers           = 4;
+    const int num_values_per_producer = 20000;
+    LockFreeRingBuffer<int> buffer(num_producers * num_values_per_producer);
+
+    std::vector<std::thread> producer_threads;
+    for (int producer = 0; producer < num_producers; producer++)
+    {
+        producer_threads.emplace_back([&buffer, producer]() {
+            for (int i = 0; i < num_values_per_producer; i++)
+            {
+                buffer.push(producer * num_values_per_producer + i);
+            }
+        });
+    }
+
+    // Pop concurrently with the producers, and check that the values from each
+    // producer are received in the order they were pushed
+    std::vector<int> next_value(num_producers, 0);
+    for (int i = 0; i < num_producers * num_values_per_producer; i++)
+    {
+        std::optional<int> value =
+            buffer.popLeastRecentlyAddedValue(Duration::fromSeconds(10));
+        ASSERT_TRUE(value);
+        int producer = *value / num_values_per_producer;
+        EXPECT_EQ(next_value[producer], *value % num_values_per_producer);
+        next_value[producer] = *value % num_values_per_producer + 1;
+    }
+
+    for (std::thread& producer_thread : producer_threads)
+    {
+        producer_thread.join();
+    }
+    EXPECT_EQ(std::nullopt, buffer.popLeastRecentlyAddedValue());
+}
+
+TEST(LockFreeRingBufferTest, full_buffer_with_multiple_producers_keeps_newest_values)
+{
+    const int num_producers           = 4;
+    const int num_values_per_producer = 20000;
+    LockFreeRingBuffer<std::shared_ptr<int>> buffer(1, false);
+
+    std::vector<std::thread> producer_threads;
+    for (int producer = 0; producer < num_producers; producer++)
+    {
+        producer_threads.emplace_back([&buffer]() {
+            for (int i = 0; i < num_values_per_producer; i++)
+            {
+                buffer.push(std::make_shared<int>(i));
+            }
+        });
+    }
+
+    // Popping from both ends while the producers overwrite the only value in the
+    // buffer should never return a value that is being written or destroyed
+    std::thread consumer_thread([&]() {
+        for (int i = 0; i < num_producers * num_values_per_producer / 10; i++)
+        {
+            auto value = (i % 2 == 0) ? buffer.popMostRecentlyAddedValue()
+                                      : buffer.popLeastRecentlyAddedValue();
+            if (value)
+            {
+                ASSERT_TRUE(*value);
+                EXPECT_LT(**value, num_values_per_producer);
+            }
+        }
+    });
+
+    for (std::thread& producer_thread : producer_threads)
+    {
+        producer_thread.join();
+    }
+    consumer_thread.join();
+
+    // The buffer should still only hold the most recently added value
+    buffer.push(std::make_shared<int>(-1));
+    std::optional<std::shared_ptr<int>> last_value = buffer.popLeastRecentlyAddedValue();
+    ASSERT_TRUE(last_value);
+    EXPECT_EQ(-1, **last_value);
+    EXPECT_EQ(std::nullopt, buffer.popLeastRecentlyAddedValue());
+}
+
+TEST(LockFreeRingBufferTest, getNumDroppedValues_counts_overwritten_values)
+{
+    LockFreeRingBuffer<int> buffer(5, false);
+
+    for (int i = 0; i < 1000; i++)
+    {
+        buffer.push(i);
+    }
+    EXPECT_EQ(995, buffer.getNumDroppedValues());
+
+    // Popping values makes room, so nothing else is dropped
+    buffer.popMostRecentlyAddedValue();
+    buffer.push(1000);
+    EXPECT_EQ(995, buffer.getNumDroppedValues());
+}
+
+TEST(LockFreeRingBufferTest, stopWaitingForValues_wakes_up_waiting_pop)
+{
+    LockFreeRingBuffer<int> buffer(3);
+
+    std::optional<int> result = 1;
+    std::thread puller_thread(
+        [&]() { result = buffer.popLeastRecentlyAddedValue(Duration::fromSeconds(60)); });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    auto start_time = std::chrono::steady_clock::now();
+    buffer.stopWaitingForValues();
+    puller_thread.join();
+
+    EXPECT_EQ(std::nullopt, result);
+    EXPECT_LT(std::chrono::steady_clock::now() - start_time, std::chrono::seconds(1));
+
+    // Values can still be popped, but pops don't wait for them
+    buffer.push(7);
+    EXPECT_EQ(std::optional<int>(7),
+              buffer.popMostRecentlyAddedValue(Duration::fromSeconds(60)));
+    start_time = std::chrono::steady_clock::now();
+    EXPECT_EQ(std::nullopt, buffer.popMostRecentlyAddedValue(Duration::fromSeconds(60)));
+    EXPECT_LT(std::chrono::steady_clock::now() - start_time, std::chrono::seconds(1));
+}
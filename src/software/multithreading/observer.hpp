@@ -1,6 +1,9 @@
 #pragma once
 
+#include <memory>
+
 #include "shared/constants.h"
+#include "software/multithreading/lock_free_ring_buffer.hpp"
 #include "software/multithreading/thread_safe_buffer.hpp"
 
 /**
@@ -18,8 +21,12 @@ class Observer
      *
      * @param buffer_size size of the buffer
      * @param log_buffer_full whether or not to log when the buffer is full
+     * @param use_lock_free_buffer whether to buffer values in a LockFreeRingBuffer
+     * instead of a ThreadSafeBuffer. Only one thread may pop values from a
+     * LockFreeRingBuffer, which is always the case for a ThreadedObserver.
      */
-    Observer(size_t buffer_size = DEFAULT_BUFFER_SIZE, bool log_buffer_full = true);
+    Observer(size_t buffer_size = DEFAULT_BUFFER_SIZE, bool log_buffer_full = true,
+             bool use_lock_free_buffer = false);
 
     /**
      * Add the given value to the internal buffer
@@ -35,6 +42,14 @@ class Observer
      */
     virtual double getDataReceivedPerSecond() final;
 
+    /**
+     * Gets the number of received values that were dropped because the buffer was full
+     * and they were overwritten before they could be popped
+     *
+     * @return the number of dropped values
+     */
+    virtual uint64_t getNumDroppedValues() const final;
+
     virtual ~Observer() = default;
 
     static constexpr size_t TIME_BUFFER_SIZE = 5;
@@ -46,6 +61,7 @@ class Observer
      * If no value is available, this will block until:
      * - a value becomes available
      * - the given amount of time is exceeded
+     * - stopWaitingForValues is called
      * - the destructor of this class is called
      *
      * @param max_wait_time The maximum duration to wait for a new value before
@@ -62,6 +78,7 @@ class Observer
      * If no value is available, this will block until:
      * - a value becomes available
      * - the given amount of time is exceeded
+     * - stopWaitingForValues is called
      * - the destructor of this class is called
      *
      * @param max_wait_time The maximum duration to wait for a new value before
@@ -72,17 +89,34 @@ class Observer
      */
     virtual std::optional<T> popLeastRecentlyReceivedValue(Duration max_wait_time) final;
 
+    /**
+     * Wakes up any thread waiting for a value to be received, and makes pops return
+     * immediately instead of waiting for a value from then on
+     */
+    virtual void stopWaitingForValues() final;
+
     static constexpr size_t DEFAULT_BUFFER_SIZE = 1;
 
    private:
-    ThreadSafeBuffer<T> buffer;
+    // Only one of these buffers is created, depending on use_lock_free_buffer
+    std::unique_ptr<ThreadSafeBuffer<T>> buffer;
+    std::unique_ptr<LockFreeRingBuffer<T>> lock_free_buffer;
     boost::circular_buffer<std::chrono::milliseconds> receive_time_buffer;
 };
 
 template <typename T>
-Observer<T>::Observer(size_t buffer_size, bool log_buffer_full)
-    : buffer(buffer_size, log_buffer_full), receive_time_buffer(TIME_BUFFER_SIZE)
+Observer<T>::Observer(size_t buffer_size, bool log_buffer_full, bool use_lock_free_buffer)
+    : receive_time_buffer(TIME_BUFFER_SIZE)
 {
+    if (use_lock_free_buffer)
+    {
+        lock_free_buffer =
+            std::make_unique<LockFreeRingBuffer<T>>(buffer_size, log_buffer_full);
+    }
+    else
+    {
+        buffer = std::make_unique<ThreadSafeBuffer<T>>(buffer_size, log_buffer_full);
+    }
 }
 
 template <typename T>
@@ -90,19 +124,57 @@ void Observer<T>::receiveValue(T val)
 {
     receive_time_buffer.push_back(std::chrono::duration_cast<std::chrono::milliseconds>(
         std::chrono::steady_clock::now().time_since_epoch()));
-    buffer.push(std::move(val));
+    if (lock_free_buffer)
+    {
+        lock_free_buffer->push(std::move(val));
+    }
+    else
+    {
+        buffer->push(std::move(val));
+    }
 }
 
 template <typename T>
 std::optional<T> Observer<T>::popMostRecentlyReceivedValue(Duration max_wait_time)
 {
-    return buffer.popMostRecentlyAddedValue(max_wait_time);
+    if (lock_free_buffer)
+    {
+        return lock_free_buffer->popMostRecentlyAddedValue(max_wait_time);
+    }
+    return buffer->popMostRecentlyAddedValue(max_wait_time);
 }
 
 template <typename T>
 std::optional<T> Observer<T>::popLeastRecentlyReceivedValue(Duration max_wait_time)
 {
-    return buffer.popLeastRecentlyAddedValue(max_wait_time);
+    if (lock_free_buffer)
+    {
+        return lock_free_buffer->popLeastRecentlyAddedValue(max_wait_time);
+    }
+    return buffer->popLeastRecentlyAddedValue(max_wait_time);
+}
+
+template <typename T>
+void Observer<T>::stopWaitingForValues()
+{
+    if (lock_free_buffer)
+    {
+        lock_free_buffer->stopWaitingForValues();
+    }
+    else
+    {
+        buffer->stopWaitingForValues();
+    }
+}
+
+template <typename T>
+uint64_t Observer<T>::getNumDroppedValues() const
+{
+    if (lock_free_buffer)
+    {
+        return lock_free_buffer->getNumDroppedValues();
+    }
+    return buffer->getNumDroppedValues();
 }
 
 template <typename T>
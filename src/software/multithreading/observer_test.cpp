@@ -119,3 +119,16 @@ TEST(Observer, getDataReceivedPerSecond_time_buffer_partially_empty)
     EXPECT_TRUE(TestUtil::testGetDataReceivedPerSecondByFillingBuffer(
         TestObserver(), 10, TestObserver::TIME_BUFFER_SIZE / 2));
 }
+
+TEST(Observer, getNumDroppedValues_with_full_buffer)
+{
+    for (bool use_lock_free_buffer : {false, true})
+    {
+        Observer<int> observer(2, false, use_lock_free_buffer);
+        for (int i = 0; i < 5; i++)
+        {
+            observer.receiveValue(i);
+        }
+        EXPECT_EQ(3, observer.getNumDroppedValues());
+    }
+}
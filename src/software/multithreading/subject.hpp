@@ -32,6 +32,10 @@ class Subject
     /**
      * Sends the given value to all registered observers
      *
+     * The value is copied once for every observer but the last. Large values that are
+     * sent to several observers should be sent as a std::shared_ptr<const T> (ex.
+     * WorldPtr) so that every observer shares the same immutable value instead.
+     *
      * @param val The object to send to observers
      */
     virtual void sendValueToObservers(T val) final;
@@ -50,8 +54,16 @@ void Subject<T>::registerObserver(std::shared_ptr<Observer<T>> observer)
 template <typename T>
 void Subject<T>::sendValueToObservers(T val)
 {
-    for (std::shared_ptr<Observer<T>>& observer : observers)
+    if (observers.empty())
+    {
+        return;
+    }
+
+    // Every observer but the last gets a copy of the value, and the last observer gets
+    // the value itself
+    for (size_t i = 0; i + 1 < observers.size(); i++)
     {
-        observer->receiveValue(val);
+        observers[i]->receiveValue(val);
     }
+    observers.back()->receiveValue(std::move(val));
 }
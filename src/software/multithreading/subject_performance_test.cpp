@@ -0,0 +1,107 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <iostream>
+
+#include "software/multithreading/subject.hpp"
+#include "software/test_util/test_util.h"
+#include "software/world/world.h"
+
+/**
+ * An observer that pops every value it receives, like a threaded observer would
+ */
+template <typename T>
+class PoppingObserver : public Observer<T>
+{
+   public:
+    PoppingObserver() : Observer<T>(1, false) {}
+
+    std::optional<T> popValue()
+    {
+        return this->popLeastRecentlyReceivedValue(Duration::fromSeconds(0));
+    }
+};
+
+template <typename T>
+class PublishingSubject : public Subject<T>
+{
+   public:
+    void publish(T value)
+    {
+        this->sendValueToObservers(std::move(value));
+    }
+};
+
+/**
+ * Publishes a World to the same number of observers as full_system (the AI, the backend
+ * and the visualizer), and prints how long each tick took and how many bytes of World
+ * were copied
+ *
+ * @tparam T The type the World is published as
+ * @param name The name to print the measurements with
+ * @param world The World to publish
+ * @param make_value Creates the value that is published from the World, like
+ * ThreadedSensorFusion does after processing a SensorProto
+ * @param num_world_copies_per_tick The number of times the World is copied each tick
+ */
+template <typename T, typename MakeValueFunction>
+void measureWorldFanOut(const std::string& name, const World& world,
+                        MakeValueFunction make_value,
+                        unsigned int num_world_copies_per_tick)
+{
+    const unsigned int num_observers = 3;
+    const unsigned int num_ticks     = 100000;
+
+    PublishingSubject<T> subject;
+    std::vector<std::shared_ptr<PoppingObserver<T>>> observers;
+    for (unsigned int i = 0; i < num_observers; i++)
+    {
+        observers.emplace_back(std::make_shared<PoppingObserver<T>>());
+        subject.registerObserver(observers.back());
+    }
+
+    auto start_time = std::chrono::system_clock::now();
+    for (unsigned int i = 0; i < num_ticks; i++)
+    {
+        subject.publish(make_value(world));
+        for (auto& observer : observers)
+        {
+            ASSERT_TRUE(observer->popValue());
+        }
+    }
+    double duration_ms = ::TestUtil::millisecondsSince(start_time);
+
+    // The robots are the only part of the World that isn't stored inline
+    size_t world_size_bytes =
+        sizeof(World) + sizeof(Robot) * (world.friendlyTeam().numRobots() +
+                                         world.enemyTeam().numRobots());
+    std::cout << name << ": " << duration_ms * 1000 / num_ticks << " us per tick, "
+              << num_world_copies_per_tick * world_size_bytes
+              << " bytes of World copied per tick" << std::endl;
+}
+
+// This test is disabled to speed up CI, it can be enabled by removing "DISABLED_" from
+// the test name
+TEST(SubjectPerformanceTest, DISABLED_world_fan_out_by_value_and_shared_snapshot)
+{
+    std::vector<Point> robot_positions;
+    for (int i = 0; i < 11; i++)
+    {
+        robot_positions.emplace_back(Point(-4 + 0.7 * i, 0.2 * i - 1));
+    }
+    World world = ::TestUtil::createBlankTestingWorldDivB();
+    world       = ::TestUtil::setFriendlyRobotPositions(world, robot_positions,
+                                                  Timestamp::fromSeconds(0));
+    world       = ::TestUtil::setEnemyRobotPositions(world, robot_positions,
+                                               Timestamp::fromSeconds(0));
+
+    // The World is copied out of SensorFusion, and then copied for every observer but
+    // the last, which gets the World moved into it
+    measureWorldFanOut<World>(
+        "World", world, [](const World& world) { return world; }, 3);
+
+    // The World is copied out of SensorFusion once, and every observer shares it
+    measureWorldFanOut<WorldPtr>(
+        "WorldPtr", world,
+        [](const World& world) { return std::make_shared<const World>(world); }, 1);
+}
@@ -0,0 +1,148 @@
+#include "software/multithreading/thread_pool.h"
+
+#include <atomic>
+#include <exception>
+#include <memory>
+
+namespace
+{
+    /**
+     * The state shared between the caller of `parallelFor` and the workers
+     * helping it. Workers may still hold on to this after `parallelFor` returns
+     * (if every task was claimed before they started), so it is reference counted.
+     */
+    struct ParallelForState
+    {
+        explicit ParallelForState(size_t num_tasks,
+                                  const std::function<void(size_t)>& task)
+            : num_tasks(num_tasks), task(task), next_task(0), num_tasks_done(0)
+        {
+        }
+
+        /**
+         * Claims and runs tasks until there are none left to claim
+         */
+        void runTasks()
+        {
+            for (size_t i = next_task++; i < num_tasks; i = next_task++)
+            {
+                try
+                {
+                    task(i);
+                }
+                catch (...)
+                {
+                    std::scoped_lock lock(mutex);
+                    if (!exception)
+                    {
+                        exception = std::current_exception();
+                    }
+                }
+
+                if (++num_tasks_done == num_tasks)
+                {
+                    std::scoped_lock lock(mutex);
+                    all_tasks_done.notify_all();
+                }
+            }
+        }
+
+        const size_t num_tasks;
+        // Only dereferenced while there are unfinished tasks, during which the
+        // caller of `parallelFor` is guaranteed to keep it alive
+        const std::function<void(size_t)>& task;
+        std::atomic<size_t> next_task;
+        std::atomic<size_t> num_tasks_done;
+
+        std::mutex mutex;
+        std::condition_variable all_tasks_done;
+        std::exception_ptr exception;
+    };
+}  // namespace
+
+ThreadPool::ThreadPool(size_t num_worker_threads) : in_destructor(false)
+{
+    worker_threads.reserve(num_worker_threads);
+    for (size_t i = 0; i < num_worker_threads; i++)
+    {
+        worker_threads.emplace_back(&ThreadPool::runJobsFromQueue, this);
+    }
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::scoped_lock lock(job_queue_mutex);
+        in_destructor = true;
+    }
+    job_available.notify_all();
+
+    // We must wait for the threads to stop, as if we destroy them while they are
+    // still running we will segfault
+    for (std::thread& worker_thread : worker_threads)
+    {
+        worker_thread.join();
+    }
+}
+
+void ThreadPool::parallelFor(size_t num_tasks, const std::function<void(size_t)>& task)
+{
+    if (worker_threads.empty() || num_tasks <= 1)
+    {
+        for (size_t i = 0; i < num_tasks; i++)
+        {
+            task(i);
+        }
+        return;
+    }
+
+    auto state = std::make_shared<ParallelForState>(num_tasks, task);
+
+    // The calling thread runs tasks too, so we only need help with the rest
+    size_t num_helpers = std::min(worker_threads.size(), num_tasks - 1);
+    {
+        std::scoped_lock lock(job_queue_mutex);
+        for (size_t i = 0; i < num_helpers; i++)
+        {
+            job_queue.emplace([state]() { state->runTasks(); });
+        }
+    }
+    job_available.notify_all();
+
+    state->runTasks();
+
+    std::unique_lock lock(state->mutex);
+    state->all_tasks_done.wait(
+        lock, [&state] { return state->num_tasks_done == state->num_tasks; });
+
+    if (state->exception)
+    {
+        std::rethrow_exception(state->exception);
+    }
+}
+
+size_t ThreadPool::numWorkerThreads() const
+{
+    return worker_threads.size();
+}
+
+void ThreadPool::runJobsFromQueue()
+{
+    while (true)
+    {
+        std::function<void()> job;
+        {
+            std::unique_lock lock(job_queue_mutex);
+            job_available.wait(lock,
+                               [this] { return in_destructor || !job_queue.empty(); });
+            if (job_queue.empty())
+            {
+                // We only get here if the destructor has been called
+                return;
+            }
+            job = std::move(job_queue.front());
+            job_queue.pop();
+        }
+        job();
+    }
+}
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+/**
+ * A fixed size pool of worker threads that can be used to split independent pieces
+ * of work across multiple cores.
+ *
+ * The thread calling `parallelFor` also takes part in running the given tasks, so a
+ * ThreadPool with N worker threads will run up to N + 1 tasks at the same time. A
+ * ThreadPool with 0 worker threads runs every task on the calling thread, which makes
+ * it a drop-in replacement for a plain for loop.
+ *
+ * The public API is thread-safe, so a single ThreadPool may be shared between
+ * multiple users.
+ */
+class ThreadPool
+{
+   public:
+    /**
+     * Creates a new ThreadPool
+     *
+     * @param num_worker_threads The number of threads to create in addition to the
+     *                           thread calling `parallelFor`
+     */
+    explicit ThreadPool(size_t num_worker_threads);
+
+    ~ThreadPool();
+
+    // Delete the copy and assignment operators because the worker threads reference
+    // the internal state of this class
+    ThreadPool& operator=(const ThreadPool&) = delete;
+    ThreadPool(const ThreadPool&)            = delete;
+
+    /**
+     * Calls the given task once for every index in [0, num_tasks), spreading the calls
+     * across the worker threads and the calling thread. This function blocks until
+     * every call has returned.
+     *
+     * The order in which the tasks are run is unspecified, so tasks must be
+     * independent of each other. If a task throws, the first exception thrown is
+     * rethrown from this function once all the other tasks have finished.
+     *
+     * @param num_tasks The number of times to call the task
+     * @param task The task to run, called with the index of the task
+     */
+    void parallelFor(size_t num_tasks, const std::function<void(size_t)>& task);
+
+    /**
+     * Gets the number of worker threads in this pool
+     *
+     * @return the number of worker threads in this pool
+     */
+    size_t numWorkerThreads() const;
+
+   private:
+    /**
+     * Runs jobs from the job queue until the destructor of this class is called.
+     * This is intended to be run in a separate thread.
+     */
+    void runJobsFromQueue();
+
+    std::vector<std::thread> worker_threads;
+
+    std::mutex job_queue_mutex;
+    std::condition_variable job_available;
+    std::queue<std::function<void()>> job_queue;
+
+    // This indicates if the destructor of this class has been called
+    bool in_destructor;
+};
@@ -0,0 +1,101 @@
+#include "software/multithreading/thread_pool.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <stdexcept>
+
+TEST(ThreadPoolTest, parallel_for_with_no_worker_threads_runs_every_task_in_order)
+{
+    ThreadPool thread_pool(0);
+    std::vector<size_t> run_order;
+
+    thread_pool.parallelFor(5, [&](size_t i) { run_order.emplace_back(i); });
+
+    EXPECT_EQ(std::vector<size_t>({0, 1, 2, 3, 4}), run_order);
+}
+
+TEST(ThreadPoolTest, parallel_for_with_zero_tasks_does_nothing)
+{
+    ThreadPool thread_pool(4);
+    std::atomic<int> num_calls(0);
+
+    thread_pool.parallelFor(0, [&](size_t i) { num_calls++; });
+
+    EXPECT_EQ(0, num_calls);
+}
+
+TEST(ThreadPoolTest, parallel_for_runs_every_task_exactly_once)
+{
+    ThreadPool thread_pool(4);
+    std::vector<std::atomic<int>> num_calls(100);
+
+    thread_pool.parallelFor(num_calls.size(), [&](size_t i) { num_calls[i]++; });
+
+    for (const auto& calls : num_calls)
+    {
+        EXPECT_EQ(1, calls);
+    }
+}
+
+TEST(ThreadPoolTest, parallel_for_with_fewer_tasks_than_threads)
+{
+    ThreadPool thread_pool(8);
+    std::vector<std::atomic<int>> num_calls(3);
+
+    thread_pool.parallelFor(num_calls.size(), [&](size_t i) { num_calls[i]++; });
+
+    for (const auto& calls : num_calls)
+    {
+        EXPECT_EQ(1, calls);
+    }
+}
+
+TEST(ThreadPoolTest, parallel_for_can_be_called_repeatedly)
+{
+    ThreadPool thread_pool(3);
+    std::atomic<size_t> sum(0);
+
+    for (int i = 0; i < 1000; i++)
+    {
+        thread_pool.parallelFor(10, [&](size_t i) { sum += i; });
+    }
+
+    EXPECT_EQ(1000 * 45, sum);
+}
+
+TEST(ThreadPoolTest, parallel_for_can_be_called_from_multiple_threads)
+{
+    ThreadPool thread_pool(2);
+    std::atomic<size_t> sum(0);
+
+    auto run_parallel_for = [&]() {
+        for (int i = 0; i < 100; i++)
+        {
+            thread_pool.parallelFor(10, [&](size_t i) { sum += i; });
+        }
+    };
+    std::thread thread_1(run_parallel_for);
+    std::thread thread_2(run_parallel_for);
+    thread_1.join();
+    thread_2.join();
+
+    EXPECT_EQ(2 * 100 * 45, sum);
+}
+
+TEST(ThreadPoolTest, parallel_for_rethrows_exception_after_all_tasks_finish)
+{
+    ThreadPool thread_pool(4);
+    std::atomic<int> num_calls(0);
+
+    EXPECT_THROW(thread_pool.parallelFor(20,
+                                         [&](size_t i) {
+                                             num_calls++;
+                                             if (i == 3)
+                                             {
+                                                 throw std::runtime_error("task failed");
+                                             }
+                                         }),
+                 std::runtime_error);
+    EXPECT_EQ(20, num_calls);
+}
@@ -1,8 +1,10 @@
 #pragma once
 
+#include <atomic>
 #include <boost/circular_buffer.hpp>
 #include <condition_variable>
 #include <cstddef>
+#include <cstdint>
 #include <deque>
 #include <mutex>
 #include <optional>
@@ -45,6 +47,7 @@ class ThreadSafeBuffer
      * If the buffer is empty, this function will *block* until:
      * - a value becomes available
      * - the given amount of time is exceeded
+     * - stopWaitingForValues is called
      * - the destructor of this class is called
      *
      * @param max_wait_time The maximum duration to wait for a new value before
@@ -64,6 +67,7 @@ class ThreadSafeBuffer
      * If the buffer is empty, this function will *block* until:
      * - a value becomes available
      * - the given amount of time is exceeded
+     * - stopWaitingForValues is called
      * - the destructor of this class is called
      *
      * @param max_wait_time The maximum duration to wait for a new value before
@@ -84,6 +88,30 @@ class ThreadSafeBuffer
      */
     void push(const T& value);
 
+    /**
+     * Push the given value onto the buffer without copying it
+     *
+     * If the buffer is already full, this will overwrite the least recently added value
+     *
+     * @param value The value to move onto the buffer
+     */
+    void push(T&& value);
+
+    /**
+     * Gets the number of values that were dropped because they were overwritten by a
+     * push onto a full buffer before they were popped
+     *
+     * @return the number of dropped values
+     */
+    uint64_t getNumDroppedValues() const;
+
+    /**
+     * Wakes up any thread waiting for a value, and makes pops return immediately
+     * instead of waiting for a value from then on. Values that are already in the
+     * buffer can still be popped.
+     */
+    void stopWaitingForValues();
+
     ~ThreadSafeBuffer();
 
    private:
@@ -102,14 +130,18 @@ class ThreadSafeBuffer
 
     std::condition_variable received_new_value;
 
-    std::mutex destructor_called_mutex;
+    std::mutex stop_waiting_mutex;
     bool log_buffer_full;
-    bool destructor_called;
+    bool stop_waiting;
+    std::atomic<uint64_t> num_dropped_values;
 };
 
 template <typename T>
 ThreadSafeBuffer<T>::ThreadSafeBuffer(std::size_t buffer_size, bool log_buffer_full)
-    : buffer(buffer_size), log_buffer_full(log_buffer_full), destructor_called(false)
+    : buffer(buffer_size),
+      log_buffer_full(log_buffer_full),
+      stop_waiting(false),
+      num_dropped_values(0)
 {
 }
 
@@ -123,7 +155,7 @@ std::optional<T> ThreadSafeBuffer<T>::popLeastRecentlyAddedValue(Duration max_wa
     std::optional<T> result = std::nullopt;
     if (!buffer.empty())
     {
-        result = buffer.front();
+        result = std::move(buffer.front());
         buffer.pop_front();
     }
     return result;
@@ -139,7 +171,7 @@ std::optional<T> ThreadSafeBuffer<T>::popMostRecentlyAddedValue(Duration max_wai
     std::optional<T> result = std::nullopt;
     if (!buffer.empty())
     {
-        result = buffer.back();
+        result = std::move(buffer.back());
         buffer.pop_back();
     }
     return result;
@@ -149,15 +181,42 @@ template <typename T>
 void ThreadSafeBuffer<T>::push(const T& value)
 {
     std::scoped_lock<std::mutex> buffer_lock(buffer_mutex);
-    if (log_buffer_full && buffer.full())
+    if (buffer.full())
     {
-        LOG(WARNING) << "Pushing to a full ThreadSafeBuffer of type: " << TYPENAME(T)
-                     << std::endl;
+        num_dropped_values.fetch_add(1, std::memory_order_relaxed);
+        if (log_buffer_full)
+        {
+            LOG(WARNING) << "Pushing to a full ThreadSafeBuffer of type: " << TYPENAME(T)
+                         << std::endl;
+        }
     }
     buffer.push_back(value);
     received_new_value.notify_all();
 }
 
+template <typename T>
+void ThreadSafeBuffer<T>::push(T&& value)
+{
+    std::scoped_lock<std::mutex> buffer_lock(buffer_mutex);
+    if (buffer.full())
+    {
+        num_dropped_values.fetch_add(1, std::memory_order_relaxed);
+        if (log_buffer_full)
+        {
+            LOG(WARNING) << "Pushing to a full ThreadSafeBuffer of type: " << TYPENAME(T)
+                         << std::endl;
+        }
+    }
+    buffer.push_back(std::move(value));
+    received_new_value.notify_all();
+}
+
+template <typename T>
+uint64_t ThreadSafeBuffer<T>::getNumDroppedValues() const
+{
+    return num_dropped_values.load(std::memory_order_relaxed);
+}
+
 template <typename T>
 std::unique_lock<std::mutex> ThreadSafeBuffer<T>::waitForBufferToHaveAValue(
     Duration max_wait_time)
@@ -165,8 +224,8 @@ std::unique_lock<std::mutex> ThreadSafeBuffer<T>::waitForBufferToHaveAValue(
     std::unique_lock<std::mutex> buffer_lock(buffer_mutex);
     received_new_value.wait_for(
         buffer_lock, std::chrono::duration<float>(max_wait_time.toSeconds()), [this] {
-            std::scoped_lock destructor_called_lock(destructor_called_mutex);
-            return !buffer.empty() || destructor_called;
+            std::scoped_lock stop_waiting_lock(stop_waiting_mutex);
+            return !buffer.empty() || stop_waiting;
         });
 
     // NOTE: We need to return this in order to prevent it being destructed so
@@ -175,11 +234,17 @@ std::unique_lock<std::mutex> ThreadSafeBuffer<T>::waitForBufferToHaveAValue(
 }
 
 template <typename T>
-ThreadSafeBuffer<T>::~ThreadSafeBuffer()
+void ThreadSafeBuffer<T>::stopWaitingForValues()
 {
-    destructor_called_mutex.lock();
-    destructor_called = true;
-    destructor_called_mutex.unlock();
+    stop_waiting_mutex.lock();
+    stop_waiting = true;
+    stop_waiting_mutex.unlock();
 
     received_new_value.notify_all();
 }
+
+template <typename T>
+ThreadSafeBuffer<T>::~ThreadSafeBuffer()
+{
+    stopWaitingForValues();
+}
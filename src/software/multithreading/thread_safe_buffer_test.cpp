@@ -165,3 +165,46 @@ TEST(ThreadSafeBufferTest, push_more_values_then_buffer_can_hold)
     EXPECT_EQ(39, buffer.popLeastRecentlyAddedValue());
     EXPECT_EQ(40, buffer.popLeastRecentlyAddedValue());
 }
+
+TEST(ThreadSafeBufferTest, getNumDroppedValues_counts_overwritten_values)
+{
+    ThreadSafeBuffer<int> buffer(2, false);
+
+    buffer.push(1);
+    buffer.push(2);
+    EXPECT_EQ(0, buffer.getNumDroppedValues());
+
+    buffer.push(3);
+    buffer.push(4);
+    EXPECT_EQ(2, buffer.getNumDroppedValues());
+
+    // Popping values makes room, so nothing else is dropped
+    buffer.popLeastRecentlyAddedValue();
+    buffer.push(5);
+    EXPECT_EQ(2, buffer.getNumDroppedValues());
+}
+
+TEST(ThreadSafeBufferTest, stopWaitingForValues_wakes_up_waiting_pop)
+{
+    ThreadSafeBuffer<int> buffer(3);
+
+    std::optional<int> result = 1;
+    std::thread puller_thread(
+        [&]() { result = buffer.popLeastRecentlyAddedValue(Duration::fromSeconds(60)); });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    auto start_time = std::chrono::steady_clock::now();
+    buffer.stopWaitingForValues();
+    puller_thread.join();
+
+    EXPECT_EQ(std::nullopt, result);
+    EXPECT_LT(std::chrono::steady_clock::now() - start_time, std::chrono::seconds(1));
+
+    // Values can still be popped, but pops don't wait for them
+    buffer.push(7);
+    EXPECT_EQ(std::optional<int>(7),
+              buffer.popMostRecentlyAddedValue(Duration::fromSeconds(60)));
+    start_time = std::chrono::steady_clock::now();
+    EXPECT_EQ(std::nullopt, buffer.popMostRecentlyAddedValue(Duration::fromSeconds(60)));
+    EXPECT_LT(std::chrono::steady_clock::now() - start_time, std::chrono::seconds(1));
+}
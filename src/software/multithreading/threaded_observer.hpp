@@ -1,5 +1,6 @@
 #pragma once
 
+#include <atomic>
 #include <boost/bind.hpp>
 #include <thread>
 
@@ -22,9 +23,11 @@ class ThreadedObserver : public Observer<T>
      *
      * @param buffer_size size of the buffer
      * @param log_buffer_full whether or not to log when the buffer is full
+     * @param use_lock_free_buffer whether to buffer values in a LockFreeRingBuffer
      */
     explicit ThreadedObserver(size_t buffer_size   = Observer<T>::DEFAULT_BUFFER_SIZE,
-                              bool log_buffer_full = true);
+                              bool log_buffer_full = true,
+                              bool use_lock_free_buffer = false);
 
     ~ThreadedObserver() override;
 
@@ -70,12 +73,11 @@ class ThreadedObserver : public Observer<T>
     virtual std::optional<T> getNextValue(const Duration& max_wait_time);
 
     // This indicates if the destructor of this class has been called
-    std::mutex in_destructor_mutex;
-    bool in_destructor;
+    std::atomic_bool in_destructor;
 
-    // The period for checking whether or not the destructor for this class has
-    // been called
-    const Duration IN_DESTRUCTOR_CHECK_PERIOD;
+    // The longest a single wait for a value lasts. The destructor wakes up the wait,
+    // so this doesn't limit how long the destructor takes.
+    static constexpr double MAX_VALUE_WAIT_TIME_S = 60.0;
 
     // This is the thread that will continuously pull values from the buffer
     // and pass them into the `onValueReceived`
@@ -83,10 +85,10 @@ class ThreadedObserver : public Observer<T>
 };
 
 template <typename T>
-ThreadedObserver<T>::ThreadedObserver(size_t buffer_size, bool log_buffer_full)
-    : Observer<T>(buffer_size, log_buffer_full),
-      in_destructor(false),
-      IN_DESTRUCTOR_CHECK_PERIOD(Duration::fromSeconds(0.1))
+ThreadedObserver<T>::ThreadedObserver(size_t buffer_size, bool log_buffer_full,
+                                      bool use_lock_free_buffer)
+    : Observer<T>(buffer_size, log_buffer_full, use_lock_free_buffer),
+      in_destructor(false)
 {
     pull_from_buffer_thread = std::thread(
         boost::bind(&ThreadedObserver::continuouslyPullValuesFromBuffer, this));
@@ -102,29 +104,25 @@ void ThreadedObserver<T>::onValueReceived(T val)
 template <typename T>
 void ThreadedObserver<T>::continuouslyPullValuesFromBuffer()
 {
-    do
+    while (!in_destructor)
     {
-        in_destructor_mutex.unlock();
-        std::optional<T> new_val;
-
-        new_val = this->getNextValue(IN_DESTRUCTOR_CHECK_PERIOD);
+        std::optional<T> new_val =
+            this->getNextValue(Duration::fromSeconds(MAX_VALUE_WAIT_TIME_S));
 
         if (new_val)
         {
             onValueReceived(*new_val);
         }
-
-        in_destructor_mutex.lock();
-    } while (!in_destructor);
+    }
 }
 
 
 template <typename T>
 ThreadedObserver<T>::~ThreadedObserver()
 {
-    in_destructor_mutex.lock();
     in_destructor = true;
-    in_destructor_mutex.unlock();
+    // Wake up the thread if it is waiting for a value, so it sees that it should stop
+    this->stopWaitingForValues();
 
     // We must wait for the thread to stop, as if we destroy it while it's still
     // running we will segfault
@@ -0,0 +1,156 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "software/multithreading/first_in_first_out_threaded_observer.h"
+#include "software/multithreading/subject.hpp"
+
+struct TimestampedValue
+{
+    std::chrono::steady_clock::time_point sent_time;
+    unsigned int value;
+};
+
+/**
+ * A stage of an observer pipeline, which passes every value it receives to the next
+ * stage on its own thread
+ */
+class ForwardingObserver : public FirstInFirstOutThreadedObserver<TimestampedValue>,
+                           public Subject<TimestampedValue>
+{
+   public:
+    explicit ForwardingObserver(size_t buffer_size, bool use_lock_free_buffer)
+        : FirstInFirstOutThreadedObserver<TimestampedValue>(buffer_size, false,
+                                                            use_lock_free_buffer)
+    {
+    }
+
+   private:
+    void onValueReceived(TimestampedValue value) override
+    {
+        sendValueToObservers(value);
+    }
+};
+
+/**
+ * The last stage of an observer pipeline, which records how long each value took to
+ * get through the pipeline
+ */
+class LatencyRecordingObserver : public FirstInFirstOutThreadedObserver<TimestampedValue>
+{
+   public:
+    explicit LatencyRecordingObserver(size_t buffer_size, bool use_lock_free_buffer)
+        : FirstInFirstOutThreadedObserver<TimestampedValue>(buffer_size, false,
+                                                            use_lock_free_buffer),
+          num_values_received(0)
+    {
+    }
+
+    std::vector<double> getLatenciesMicroseconds()
+    {
+        std::scoped_lock lock(latencies_mutex);
+        return latencies_us;
+    }
+
+    std::atomic<unsigned int> num_values_received;
+
+   private:
+    void onValueReceived(TimestampedValue value) override
+    {
+        double latency_us = std::chrono::duration<double, std::micro>(
+                                std::chrono::steady_clock::now() - value.sent_time)
+                                .count();
+        {
+            std::scoped_lock lock(latencies_mutex);
+            latencies_us.emplace_back(latency_us);
+        }
+        num_values_received++;
+    }
+
+    std::mutex latencies_mutex;
+    std::vector<double> latencies_us;
+};
+
+/**
+ * Sends values through a pipeline of threaded observers and prints the throughput and
+ * latency of the pipeline
+ *
+ * @param use_lock_free_buffer Whether the observers buffer values in a
+ * LockFreeRingBuffer
+ * @param num_values The number of values to send through the pipeline
+ * @param send_period The time between sending values, or zero to send values as fast as
+ * possible
+ */
+void measurePipeline(bool use_lock_free_buffer, unsigned int num_values,
+                     std::chrono::microseconds send_period)
+{
+    // Like the path from sensor fusion to the AI to the backend
+    const unsigned int num_forwarding_stages = 3;
+    const size_t buffer_size                 = num_values;
+
+    std::vector<std::shared_ptr<ForwardingObserver>> stages;
+    for (unsigned int i = 0; i < num_forwarding_stages; i++)
+    {
+        stages.emplace_back(
+            std::make_shared<ForwardingObserver>(buffer_size, use_lock_free_buffer));
+        if (i > 0)
+        {
+            stages[i - 1]->registerObserver(stages[i]);
+        }
+    }
+    auto sink =
+        std::make_shared<LatencyRecordingObserver>(buffer_size, use_lock_free_buffer);
+    stages.back()->registerObserver(sink);
+
+    auto start_time = std::chrono::steady_clock::now();
+    for (unsigned int i = 0; i < num_values; i++)
+    {
+        stages.front()->receiveValue(
+            TimestampedValue{std::chrono::steady_clock::now(), i});
+        if (send_period.count() > 0)
+        {
+            std::this_thread::sleep_for(send_period);
+        }
+    }
+    while (sink->num_values_received < num_values)
+    {
+        std::this_thread::yield();
+    }
+    double duration_s =
+        std::chrono::duration<double>(std::chrono::steady_clock::now() - start_time)
+            .count();
+
+    std::vector<double> latencies_us = sink->getLatenciesMicroseconds();
+    std::sort(latencies_us.begin(), latencies_us.end());
+    std::cout << (use_lock_free_buffer ? "LockFreeRingBuffer" : "ThreadSafeBuffer")
+              << ": " << num_values / duration_s << " values/s, latency p50 "
+              << latencies_us[latencies_us.size() / 2] << " us, p99 "
+              << latencies_us[latencies_us.size() * 99 / 100] << " us, max "
+              << latencies_us.back() << " us" << std::endl;
+}
+
+// This test is disabled to speed up CI, it can be enabled by removing "DISABLED_" from
+// the test name
+TEST(ThreadedObserverPerformanceTest, DISABLED_pipeline_throughput)
+{
+    for (bool use_lock_free_buffer : {false, true})
+    {
+        measurePipeline(use_lock_free_buffer, 200000, std::chrono::microseconds(0));
+    }
+}
+
+// This test is disabled to speed up CI, it can be enabled by removing "DISABLED_" from
+// the test name
+TEST(ThreadedObserverPerformanceTest, DISABLED_pipeline_latency)
+{
+    for (bool use_lock_free_buffer : {false, true})
+    {
+        measurePipeline(use_lock_free_buffer, 5000, std::chrono::microseconds(200));
+    }
+}
@@ -36,6 +36,17 @@ class ProtoUdpSender
      */
     void sendProto(const SendProto& message);
 
+    /**
+     * Sends a protobuf message to the initialized ip address on the given port,
+     * instead of the initialized port. This lets one sender address many receivers
+     * that listen on their own port.
+     * This function returns after the message has been sent.
+     *
+     * @param message The protobuf message to send
+     * @param port The port to send the message to
+     */
+    void sendProto(const SendProto& message, unsigned short port);
+
    private:
     // A UDP socket to send data over
     boost::asio::ip::udp::socket socket_;
@@ -73,6 +84,15 @@ void ProtoUdpSender<SendProto>::sendProto(const SendProto& message)
     socket_.send_to(boost::asio::buffer(data_buffer), receiver_endpoint);
 }
 
+template <class SendProto>
+void ProtoUdpSender<SendProto>::sendProto(const SendProto& message,
+                                          const unsigned short port)
+{
+    message.SerializeToString(&data_buffer);
+    socket_.send_to(boost::asio::buffer(data_buffer),
+                    boost::asio::ip::udp::endpoint(receiver_endpoint.address(), port));
+}
+
 template <class SendProto>
 ProtoUdpSender<SendProto>::~ProtoUdpSender()
 {
@@ -20,11 +20,12 @@ class ThreadedProtoUdpListener
      *  example IPv6: ff02::c3d0:42d2:bb8%wlp4s0 (the interface is specified after %)
      * @param port The port on which to listen for ReceiveProtoT packets
      * @param receive_callback The function to run for every ReceiveProtoT packet received
-     * from the network
+     * from the network. The packet is only valid until the callback returns, but may be
+     * moved out of to keep it without a copy
      * @param multicast If true, joins the multicast group of given ip_address
      */
     ThreadedProtoUdpListener(const std::string& ip_address, unsigned short port,
-                             std::function<void(ReceiveProtoT)> receive_callback,
+                             std::function<void(ReceiveProtoT&)> receive_callback,
                              bool multicast);
 
     /**
@@ -35,10 +36,11 @@ class ThreadedProtoUdpListener
      *
      * @param port The port on which to listen for ReceiveProtoT packets
      * @param receive_callback The function to run for every ReceiveProtoT packet received
-     * from the network
+     * from the network. The packet is only valid until the callback returns, but may be
+     * moved out of to keep it without a copy
      */
     ThreadedProtoUdpListener(unsigned short port,
-                             std::function<void(ReceiveProtoT)> receive_callback);
+                             std::function<void(ReceiveProtoT&)> receive_callback);
 
     ~ThreadedProtoUdpListener();
 
@@ -48,14 +50,14 @@ class ThreadedProtoUdpListener
     // The thread running the io_service in the background. This thread will run for the
     // entire lifetime of the class
     std::thread io_service_thread;
-    std::function<void(ReceiveProtoT)> receive_callback_;
+    std::function<void(ReceiveProtoT&)> receive_callback_;
     ProtoUdpListener<ReceiveProtoT> udp_listener;
 };
 
 template <class ReceiveProtoT>
 ThreadedProtoUdpListener<ReceiveProtoT>::ThreadedProtoUdpListener(
     const std::string& ip_address, const unsigned short port,
-    std::function<void(ReceiveProtoT)> receive_callback, bool multicast)
+    std::function<void(ReceiveProtoT&)> receive_callback, bool multicast)
     : io_service(),
       udp_listener(io_service, ip_address, port, receive_callback, multicast)
 {
@@ -65,7 +67,7 @@ ThreadedProtoUdpListener<ReceiveProtoT>::ThreadedProtoUdpListener(
 
 template <class ReceiveProtoT>
 ThreadedProtoUdpListener<ReceiveProtoT>::ThreadedProtoUdpListener(
-    const unsigned short port, std::function<void(ReceiveProtoT)> receive_callback)
+    const unsigned short port, std::function<void(ReceiveProtoT&)> receive_callback)
     : io_service(), udp_listener(io_service, port, receive_callback)
 {
     // start the thread to run the io_service in the background
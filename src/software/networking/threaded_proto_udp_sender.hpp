@@ -34,6 +34,15 @@ class ThreadedProtoUdpSender
      */
     void sendProto(const SendProto& message);
 
+    /**
+     * Sends a protobuf message to the initialized ip address on the given port
+     * This function returns after the message has been sent.
+     *
+     * @param message The protobuf message to send
+     * @param port The port to send the message to
+     */
+    void sendProto(const SendProto& message, unsigned short port);
+
    private:
     // The io_service that will be used to service all network requests
     boost::asio::io_service io_service;
@@ -73,3 +82,10 @@ void ThreadedProtoUdpSender<SendProtoT>::sendProto(const SendProtoT& message)
 {
     udp_sender.sendProto(message);
 }
+
+template <class SendProtoT>
+void ThreadedProtoUdpSender<SendProtoT>::sendProto(const SendProtoT& message,
+                                                   const unsigned short port)
+{
+    udp_sender.sendProto(message, port);
+}
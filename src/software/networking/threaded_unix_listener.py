@@ -1,8 +1,7 @@
 import socketserver
+import struct
 import time
-import base64
 import os
-from google.protobuf.any_pb2 import Any
 from threading import Thread
 import proto
 import queue
@@ -13,13 +12,16 @@ import os
 
 
 class ThreadedUnixListener:
-    def __init__(self, unix_path, max_buffer_size=3, convert_from_any=True):
+    def __init__(self, unix_path, max_buffer_size=3):
 
         """Receive protobuf over unix sockets and buffers them
 
+        Every datagram holds one or more frames sent by the C++ VisualizationSender,
+        with lengths as big-endian unsigned 32 bit integers:
+            [type name length][type name][serialized message length][serialized message]
+
         :param unix_path: The unix path to receive the new protobuf to plot
         :param max_buffer_size: The size of the buffer
-        :param convert_from_any: Convert from any
 
         """
 
@@ -30,8 +32,11 @@ class ThreadedUnixListener:
             pass
 
         self.server = socketserver.UnixDatagramServer(
-            unix_path, handler_factory(self.__buffer_protobuf, convert_from_any)
+            unix_path, handler_factory(self.__buffer_protobuf)
         )
+        # Frames are packed into datagrams of up to 64 KiB. This must match
+        # VisualizationSender::MAX_DATAGRAM_SIZE_BYTES, which drops larger frames
+        self.server.max_packet_size = 65536
         self.stop = False
 
         self.unix_path = unix_path
@@ -88,31 +93,45 @@ class ThreadedUnixListener:
 
 
 class Session(socketserver.BaseRequestHandler):
-    def __init__(self, handle_callback, convert_from_any, *args, **keys):
+
+    # The length prefixes of the type name and serialized message in every frame
+    LENGTH_PREFIX = struct.Struct(">I")
+
+    # Finding a proto class searches through every proto module, so the classes are
+    # cached by type name
+    proto_classes = dict()
+
+    def __init__(self, handle_callback, *args, **keys):
         self.handle_callback = handle_callback
-        self.convert_from_any = convert_from_any
         super().__init__(*args, **keys)
 
     def handle(self):
-        """Decode the base64 request and unpack from Any if we are receiving
-        an Any protobuf. If not, just unpack directly into the type provided.
+        """Split the datagram into frames and parse the protobuf in every frame
+        into the type named in the frame.
 
-        Then, trigger the handle callback
+        Then, trigger the handle callback for every protobuf
 
         """
-        p = self.request[0]
-        type_name = str(p.split(b"!!!")[0], "utf-8")
-        proto_type = self.find_proto_class(type_name.split(".")[1])
-        msg = proto_type()
-        p = base64.b64decode(p.split(b"!!!")[1])
+        datagram = self.request[0]
+        offset = 0
+
+        while offset < len(datagram):
+            (type_name_length,) = self.LENGTH_PREFIX.unpack_from(datagram, offset)
+            offset += self.LENGTH_PREFIX.size
+            type_name = str(datagram[offset : offset + type_name_length], "utf-8")
+            offset += type_name_length
+
+            (message_length,) = self.LENGTH_PREFIX.unpack_from(datagram, offset)
+            offset += self.LENGTH_PREFIX.size
+            message = datagram[offset : offset + message_length]
+            offset += message_length
 
-        if self.convert_from_any:
-            any_msg = Any.FromString(p)
-            any_msg.Unpack(msg)
-        else:
-            msg = proto_type.FromString(p)
+            if type_name not in self.proto_classes:
+                self.proto_classes[type_name] = self.find_proto_class(
+                    type_name.split(".")[1]
+                )
 
-        self.handle_callback(msg)
+            self.handle_callback(self.proto_classes[type_name].FromString(message))
 
     def find_proto_class(self, proto_class_name):
         """Search through all protobufs and return class of proto_type
@@ -137,17 +156,15 @@ class Session(socketserver.BaseRequestHandler):
                         return handler_class
 
 
-def handler_factory(handle_callback, convert_from_any):
+def handler_factory(handle_callback):
     """To pass in an arbitrary handle callback into the SocketServer,
     we need to create a constructor that can create a Session object with
     appropriate handle function.
 
     :param handle_callback: The callback to run
-    :param convert_from_any: If true, the message needs to be decoded
-                             into Any before into the proto_type
     """
 
     def create_handler(*args, **keys):
-        return Session(handle_callback, convert_from_any, *args, **keys)
+        return Session(handle_callback, *args, **keys)
 
     return create_handler
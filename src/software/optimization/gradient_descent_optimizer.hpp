@@ -10,6 +10,17 @@
  * (see links below for details). It provides functionality for both maximizing
  * and minimizing arbitrary functions. For example usage, please see the tests.
  *
+ * The gradient of the function being optimized can be found in one of three ways:
+ *  - `maximize`/`minimize` approximate it with forward differences, calling a scalar
+ *    objective function NUM_PARAMS + 1 times per iteration
+ *  - `maximizeBatched`/`minimizeBatched` also approximate it with forward
+ *    differences, but call a batched objective function once per iteration with all
+ *    NUM_PARAMS + 1 parameter arrays, so it can share work between them
+ *  - `maximizeWithGradient`/`minimizeWithGradient` call a user supplied function that
+ *    calculates the gradient analytically
+ * All the objective and gradient functions are template parameters rather than
+ * `std::function`s, so that they can be inlined into the optimization loop.
+ *
  * As this class is templated, it is header-only. To split up definition and
  * implementation of functions has been moved to a `.tpp` file that is included at
  * the end of this file.
@@ -37,6 +48,14 @@ class GradientDescentOptimizer
    public:
     using ParamArray = std::array<double, NUM_PARAMS>;
 
+    // The parameter arrays evaluated by a batched objective function in each
+    // iteration. The first is the current parameters, and the one at index i + 1 is
+    // the current parameters with a step taken in the i'th parameter.
+    using BatchedParamArrays = std::array<ParamArray, NUM_PARAMS + 1>;
+
+    // The values of a batched objective function for each of the BatchedParamArrays
+    using BatchedValues = std::array<double, NUM_PARAMS + 1>;
+
     // Almost always good values for the decay rates, taken from:
     // http://ruder.io/optimizing-gradient-descent/index.html#adam
     static constexpr double DEFAULT_PAST_GRADIENT_DECAY_RATE         = 0.9;
@@ -73,6 +92,9 @@ class GradientDescentOptimizer
      * Runs gradient descent, starting from the given initial_value and running for
      * num_iters
      *
+     * @tparam ObjectiveFunction A callable with the signature
+     *                           `double(const ParamArray&)`
+     *
      * @param objective_function The function to maximize
      * @param initial_value The value to start from
      * @param num_iters The number of iterations to run for
@@ -80,8 +102,9 @@ class GradientDescentOptimizer
      * @return The parameters corresponding to the maximum value of the objective
      *         found
      */
-    ParamArray maximize(std::function<double(ParamArray)> objective_function,
-                        ParamArray initial_value, unsigned int num_iters);
+    template <typename ObjectiveFunction>
+    ParamArray maximize(ObjectiveFunction&& objective_function, ParamArray initial_value,
+                        unsigned int num_iters);
 
     /**
      * Attempts to minimize the given objective function
@@ -89,6 +112,9 @@ class GradientDescentOptimizer
      * Runs gradient descent, starting from the given initial_value and running for
      * num_iters
      *
+     * @tparam ObjectiveFunction A callable with the signature
+     *                           `double(const ParamArray&)`
+     *
      * @param objective_function The function to minimize
      * @param initial_value The value to start from
      * @param num_iters The number of iterations to run for
@@ -96,8 +122,97 @@ class GradientDescentOptimizer
      * @return The parameters corresponding to the minimum value of the objective
      *         found
      */
-    ParamArray minimize(std::function<double(ParamArray)> objective_function,
-                        ParamArray initial_value, unsigned int num_iters);
+    template <typename ObjectiveFunction>
+    ParamArray minimize(ObjectiveFunction&& objective_function, ParamArray initial_value,
+                        unsigned int num_iters);
+
+    /**
+     * Attempts to maximize the given batched objective function
+     *
+     * Runs gradient descent, starting from the given initial_value and running for
+     * num_iters. The batched objective function is called once per iteration with
+     * all the parameter arrays needed to approximate the gradient.
+     *
+     * @tparam BatchedObjectiveFunction A callable with the signature
+     *                                  `BatchedValues(const BatchedParamArrays&)`
+     *
+     * @param batched_objective_function The function to maximize, evaluated on every
+     *                                   given parameter array
+     * @param initial_value The value to start from
+     * @param num_iters The number of iterations to run for
+     *
+     * @return The parameters corresponding to the maximum value of the objective
+     *         found
+     */
+    template <typename BatchedObjectiveFunction>
+    ParamArray maximizeBatched(BatchedObjectiveFunction&& batched_objective_function,
+                               ParamArray initial_value, unsigned int num_iters);
+
+    /**
+     * Attempts to minimize the given batched objective function
+     *
+     * Runs gradient descent, starting from the given initial_value and running for
+     * num_iters. The batched objective function is called once per iteration with
+     * all the parameter arrays needed to approximate the gradient.
+     *
+     * @tparam BatchedObjectiveFunction A callable with the signature
+     *                                  `BatchedValues(const BatchedParamArrays&)`
+     *
+     * @param batched_objective_function The function to minimize, evaluated on every
+     *                                   given parameter array
+     * @param initial_value The value to start from
+     * @param num_iters The number of iterations to run for
+     *
+     * @return The parameters corresponding to the minimum value of the objective
+     *         found
+     */
+    template <typename BatchedObjectiveFunction>
+    ParamArray minimizeBatched(BatchedObjectiveFunction&& batched_objective_function,
+                               ParamArray initial_value, unsigned int num_iters);
+
+    /**
+     * Attempts to maximize a function given its analytic gradient
+     *
+     * Runs gradient descent, starting from the given initial_value and running for
+     * num_iters.
+     *
+     * @tparam GradientFunction A callable with the signature
+     *                          `ParamArray(const ParamArray&)`
+     *
+     * @param gradient_function The gradient of the function to maximize, where each
+     *                          "param" is the (unweighted) derivative with respect to
+     *                          the corresponding input param
+     * @param initial_value The value to start from
+     * @param num_iters The number of iterations to run for
+     *
+     * @return The parameters corresponding to the maximum value of the objective
+     *         found
+     */
+    template <typename GradientFunction>
+    ParamArray maximizeWithGradient(GradientFunction&& gradient_function,
+                                    ParamArray initial_value, unsigned int num_iters);
+
+    /**
+     * Attempts to minimize a function given its analytic gradient
+     *
+     * Runs gradient descent, starting from the given initial_value and running for
+     * num_iters.
+     *
+     * @tparam GradientFunction A callable with the signature
+     *                          `ParamArray(const ParamArray&)`
+     *
+     * @param gradient_function The gradient of the function to minimize, where each
+     *                          "param" is the (unweighted) derivative with respect to
+     *                          the corresponding input param
+     * @param initial_value The value to start from
+     * @param num_iters The number of iterations to run for
+     *
+     * @return The parameters corresponding to the minimum value of the objective
+     *         found
+     */
+    template <typename GradientFunction>
+    ParamArray minimizeWithGradient(GradientFunction&& gradient_function,
+                                    ParamArray initial_value, unsigned int num_iters);
 
 
    private:
@@ -107,20 +222,23 @@ class GradientDescentOptimizer
      * Runs gradient descent, starting from the given initial_value and running for
      * num_iters
      *
-     * @param objective_function The function to minimize
+     * @tparam GradientFunction A callable with the signature
+     *                          `ParamArray(const ParamArray&)`, returning the
+     *                          weighted gradient (see approximateGradient)
+     *
+     * @param gradient_function The function to find the gradient with
      * @param initial_value The value to start from
      * @param num_iters The number of iterations to run for
-     * @param gradient_movement_func The function to use on each step along the
-     *                               gradient, either "-" to minimize the given
-     *                               function, or "+" to maximize it
+     * @param gradient_direction The direction to step along the gradient, either -1
+     *                           to minimize the function, or +1 to maximize it
      *
      * @return The parameters corresponding to the minimum or maximum value of the
-     *         objective found, depending on what gradient_movement_func was given
+     *         objective found, depending on what gradient_direction was given
      */
-    ParamArray followGradient(
-        std::function<double(ParamArray)> objective_function, ParamArray initial_value,
-        unsigned int num_iters,
-        std::function<double(double, double)> gradient_movement_func);
+    template <typename GradientFunction>
+    ParamArray followGradient(GradientFunction&& gradient_function,
+                              ParamArray initial_value, unsigned int num_iters,
+                              double gradient_direction);
 
     /**
      * Approximate the gradient of the objective function around a given point
@@ -128,10 +246,25 @@ class GradientDescentOptimizer
      * @param params The params around which we want to approximate the gradient
      * @param objective_function The function to approximate the gradient over
      * @return A ParamArray, where each "param" is the derivative with respect to the
-     *         corresponding input param.
+     *         corresponding input param, scaled by the weight of the param
+     */
+    template <typename ObjectiveFunction>
+    ParamArray approximateGradient(const ParamArray& params,
+                                   ObjectiveFunction& objective_function);
+
+    /**
+     * Approximate the gradient of the batched objective function around a given
+     * point, calling the batched objective function once
+     *
+     * @param params The params around which we want to approximate the gradient
+     * @param batched_objective_function The function to approximate the gradient
+     *                                   over
+     * @return A ParamArray, where each "param" is the derivative with respect to the
+     *         corresponding input param, scaled by the weight of the param
      */
-    ParamArray approximateGradient(ParamArray params,
-                                   std::function<double(ParamArray)> objective_function);
+    template <typename BatchedObjectiveFunction>
+    ParamArray approximateGradientBatched(
+        const ParamArray& params, BatchedObjectiveFunction& batched_objective_function);
 
     // This constant is used to prevent division by 0 in our implementation of Adam
     // (gradient descent)
@@ -172,30 +305,102 @@ GradientDescentOptimizer<NUM_PARAMS>::GradientDescentOptimizer(
 }
 
 template <size_t NUM_PARAMS>
+template <typename ObjectiveFunction>
 std::array<double, NUM_PARAMS> GradientDescentOptimizer<NUM_PARAMS>::maximize(
-    std::function<double(std::array<double, NUM_PARAMS>)> objective_function,
-    std::array<double, NUM_PARAMS> initial_value, unsigned int num_iters)
+    ObjectiveFunction&& objective_function, std::array<double, NUM_PARAMS> initial_value,
+    unsigned int num_iters)
 {
     return followGradient(
-        objective_function, initial_value, num_iters,
-        [](double curr_value, double step) { return curr_value + step; });
+        [this, &objective_function](const std::array<double, NUM_PARAMS>& params) {
+            return approximateGradient(params, objective_function);
+        },
+        initial_value, num_iters, 1);
 }
 
 template <size_t NUM_PARAMS>
+template <typename ObjectiveFunction>
 std::array<double, NUM_PARAMS> GradientDescentOptimizer<NUM_PARAMS>::minimize(
-    std::function<double(std::array<double, NUM_PARAMS>)> objective_function,
+    ObjectiveFunction&& objective_function, std::array<double, NUM_PARAMS> initial_value,
+    unsigned int num_iters)
+{
+    return followGradient(
+        [this, &objective_function](const std::array<double, NUM_PARAMS>& params) {
+            return approximateGradient(params, objective_function);
+        },
+        initial_value, num_iters, -1);
+}
+
+template <size_t NUM_PARAMS>
+template <typename BatchedObjectiveFunction>
+std::array<double, NUM_PARAMS> GradientDescentOptimizer<NUM_PARAMS>::maximizeBatched(
+    BatchedObjectiveFunction&& batched_objective_function,
+    std::array<double, NUM_PARAMS> initial_value, unsigned int num_iters)
+{
+    return followGradient(
+        [this,
+         &batched_objective_function](const std::array<double, NUM_PARAMS>& params) {
+            return approximateGradientBatched(params, batched_objective_function);
+        },
+        initial_value, num_iters, 1);
+}
+
+template <size_t NUM_PARAMS>
+template <typename BatchedObjectiveFunction>
+std::array<double, NUM_PARAMS> GradientDescentOptimizer<NUM_PARAMS>::minimizeBatched(
+    BatchedObjectiveFunction&& batched_objective_function,
     std::array<double, NUM_PARAMS> initial_value, unsigned int num_iters)
 {
     return followGradient(
-        objective_function, initial_value, num_iters,
-        [](double curr_value, double step) { return curr_value - step; });
+        [this,
+         &batched_objective_function](const std::array<double, NUM_PARAMS>& params) {
+            return approximateGradientBatched(params, batched_objective_function);
+        },
+        initial_value, num_iters, -1);
 }
 
 template <size_t NUM_PARAMS>
+template <typename GradientFunction>
+std::array<double, NUM_PARAMS> GradientDescentOptimizer<NUM_PARAMS>::maximizeWithGradient(
+    GradientFunction&& gradient_function, std::array<double, NUM_PARAMS> initial_value,
+    unsigned int num_iters)
+{
+    // Weight the analytic gradient the same way approximateGradient does
+    return followGradient(
+        [this, &gradient_function](const std::array<double, NUM_PARAMS>& params) {
+            ParamArray gradient = gradient_function(params);
+            for (unsigned i = 0; i < NUM_PARAMS; i++)
+            {
+                gradient[i] *= param_weights[i];
+            }
+            return gradient;
+        },
+        initial_value, num_iters, 1);
+}
+
+template <size_t NUM_PARAMS>
+template <typename GradientFunction>
+std::array<double, NUM_PARAMS> GradientDescentOptimizer<NUM_PARAMS>::minimizeWithGradient(
+    GradientFunction&& gradient_function, std::array<double, NUM_PARAMS> initial_value,
+    unsigned int num_iters)
+{
+    // Weight the analytic gradient the same way approximateGradient does
+    return followGradient(
+        [this, &gradient_function](const std::array<double, NUM_PARAMS>& params) {
+            ParamArray gradient = gradient_function(params);
+            for (unsigned i = 0; i < NUM_PARAMS; i++)
+            {
+                gradient[i] *= param_weights[i];
+            }
+            return gradient;
+        },
+        initial_value, num_iters, -1);
+}
+
+template <size_t NUM_PARAMS>
+template <typename GradientFunction>
 std::array<double, NUM_PARAMS> GradientDescentOptimizer<NUM_PARAMS>::followGradient(
-    std::function<double(std::array<double, NUM_PARAMS>)> objective_function,
-    std::array<double, NUM_PARAMS> initial_value, unsigned int num_iters,
-    std::function<double(double, double)> gradient_movement_func)
+    GradientFunction&& gradient_function, std::array<double, NUM_PARAMS> initial_value,
+    unsigned int num_iters, double gradient_direction)
 {
     // Implementation of the "Adam" algorithm. See Javadoc class comment for this
     // class (in the header) for details
@@ -209,7 +414,7 @@ std::array<double, NUM_PARAMS> GradientDescentOptimizer<NUM_PARAMS>::followGradi
 
     for (unsigned iter = 0; iter < num_iters; iter++)
     {
-        ParamArray gradient = approximateGradient(params, objective_function);
+        ParamArray gradient = gradient_function(params);
 
         // Get the squared gradient
         ParamArray squared_gradient = {0};
@@ -242,15 +447,13 @@ std::array<double, NUM_PARAMS> GradientDescentOptimizer<NUM_PARAMS>::followGradi
                 (1 - std::pow(past_squared_gradient_decay_rate, 2));
         }
 
-        // Step each param in the direction of the gradient using the operator
-        // given to this function
+        // Step each param in the direction given to this function along the gradient
         for (unsigned int i = 0; i < NUM_PARAMS; i++)
         {
-            params.at(i) = gradient_movement_func(
-                params.at(i),
-                param_weights.at(i) * bias_corrected_past_gradient_averages.at(i) /
-                    (std::sqrt(bias_corrected_past_squared_gradient_averages.at(i)) +
-                     eps));
+            params.at(i) +=
+                gradient_direction * param_weights.at(i) *
+                bias_corrected_past_gradient_averages.at(i) /
+                (std::sqrt(bias_corrected_past_squared_gradient_averages.at(i)) + eps);
         }
     }
 
@@ -258,9 +461,9 @@ std::array<double, NUM_PARAMS> GradientDescentOptimizer<NUM_PARAMS>::followGradi
 }
 
 template <size_t NUM_PARAMS>
+template <typename ObjectiveFunction>
 std::array<double, NUM_PARAMS> GradientDescentOptimizer<NUM_PARAMS>::approximateGradient(
-    std::array<double, NUM_PARAMS> params,
-    std::function<double(std::array<double, NUM_PARAMS>)> objective_function)
+    const std::array<double, NUM_PARAMS>& params, ObjectiveFunction& objective_function)
 {
     ParamArray gradient        = {0};
     double curr_function_value = objective_function(params);
@@ -276,3 +479,29 @@ std::array<double, NUM_PARAMS> GradientDescentOptimizer<NUM_PARAMS>::approximate
 
     return gradient;
 }
+
+template <size_t NUM_PARAMS>
+template <typename BatchedObjectiveFunction>
+std::array<double, NUM_PARAMS>
+GradientDescentOptimizer<NUM_PARAMS>::approximateGradientBatched(
+    const std::array<double, NUM_PARAMS>& params,
+    BatchedObjectiveFunction& batched_objective_function)
+{
+    BatchedParamArrays batched_params;
+    batched_params.fill(params);
+    for (unsigned i = 0; i < NUM_PARAMS; i++)
+    {
+        batched_params[i + 1][i] += gradient_approx_step_size * param_weights[i];
+    }
+
+    BatchedValues function_values = batched_objective_function(batched_params);
+
+    ParamArray gradient = {0};
+    for (unsigned i = 0; i < NUM_PARAMS; i++)
+    {
+        gradient[i] =
+            (function_values[i + 1] - function_values[0]) / gradient_approx_step_size;
+    }
+
+    return gradient;
+}
@@ -98,3 +98,78 @@ TEST(GradientDescentOptimizer, maximize_sigmoid_performance_test)
     // the "S" in the sigmoid within the given number of iterations
     EXPECT_GE(min.at(0), 3);
 }
+
+TEST(GradientDescentOptimizerTest, minimize_batched_multi_valued_function_with_offsets)
+{
+    GradientDescentOptimizer<2> gradientDescentOptimizer({0.1, 0.05});
+
+    // f = (x+5)^2 + 2*(y-4)^2 + 20, evaluated on every given point
+    unsigned int num_calls = 0;
+    auto batched_f = [&num_calls](const std::array<std::array<double, 2>, 3>& points) {
+        num_calls++;
+        std::array<double, 3> values;
+        for (size_t i = 0; i < points.size(); i++)
+        {
+            values[i] = std::pow(points[i].at(0) + 5, 2) +
+                        2 * std::pow(points[i].at(1) - 4, 2) + 20;
+        }
+        return values;
+    };
+
+    auto min = gradientDescentOptimizer.minimizeBatched(batched_f, {0, 0}, 150);
+
+    EXPECT_NEAR(min.at(0), -5, 0.1);
+    EXPECT_NEAR(min.at(1), 4, 0.1);
+    EXPECT_EQ(150, num_calls);
+}
+
+TEST(GradientDescentOptimizerTest, maximize_batched_gives_same_result_as_maximize)
+{
+    GradientDescentOptimizer<2> gradientDescentOptimizer({0.1, 0.05});
+
+    // f = -(x-1)^2 - 3*(y+2)^2 + x*y
+    auto f = [](const std::array<double, 2>& x) {
+        return -std::pow(x.at(0) - 1, 2) - 3 * std::pow(x.at(1) + 2, 2) +
+               x.at(0) * x.at(1);
+    };
+    auto batched_f = [&f](const std::array<std::array<double, 2>, 3>& points) {
+        return std::array<double, 3>{f(points[0]), f(points[1]), f(points[2])};
+    };
+
+    auto max         = gradientDescentOptimizer.maximize(f, {3, 3}, 50);
+    auto batched_max = gradientDescentOptimizer.maximizeBatched(batched_f, {3, 3}, 50);
+
+    EXPECT_EQ(max, batched_max);
+}
+
+TEST(GradientDescentOptimizerTest, minimize_multi_valued_function_with_gradient)
+{
+    GradientDescentOptimizer<2> gradientDescentOptimizer({0.1, 0.05});
+
+    // f = (x+5)^2 + 2*(y-4)^2 + 20, so df/dx = 2(x+5) and df/dy = 4(y-4)
+    auto gradient_f = [](const std::array<double, 2>& x) {
+        return std::array<double, 2>{2 * (x.at(0) + 5), 4 * (x.at(1) - 4)};
+    };
+
+    auto min = gradientDescentOptimizer.minimizeWithGradient(gradient_f, {0, 0}, 150);
+
+    EXPECT_NEAR(min.at(0), -5, 0.1);
+    EXPECT_NEAR(min.at(1), 4, 0.1);
+}
+
+TEST(GradientDescentOptimizerTest, maximize_sigmoid_with_gradient)
+{
+    GradientDescentOptimizer<1> gradientDescentOptimizer({0.1});
+
+    // f = 1 / (1 + exp(2-2x)), so df/dx = 2f(1-f)
+    auto gradient_f = [](const std::array<double, 1>& x) {
+        double f = 1 / (1 + std::exp(2 - 2 * x[0]));
+        return std::array<double, 1>{2 * f * (1 - f)};
+    };
+
+    auto max = gradientDescentOptimizer.maximizeWithGradient(gradient_f, {0}, 100);
+
+    // We expect that the gradient descent will make it over the
+    // main part of the "S" in the sigmoid
+    EXPECT_GE(max.at(0), 3);
+}
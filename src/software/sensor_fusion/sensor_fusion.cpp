@@ -1,6 +1,7 @@
 #include "software/sensor_fusion/sensor_fusion.h"
 
 #include "software/logger/logger.h"
+#include "software/util/latency_profiler/latency_profiler.h"
 
 SensorFusion::SensorFusion(std::shared_ptr<const SensorFusionConfig> sensor_fusion_config)
     : sensor_fusion_config(sensor_fusion_config),
@@ -48,6 +49,8 @@ std::optional<World> SensorFusion::getWorld() const
 
 void SensorFusion::processSensorProto(const SensorProto &sensor_msg)
 {
+    ScopedLatencyTimer latency_timer(LatencyStage::SENSOR_FUSION);
+
     if (sensor_msg.has_ssl_vision_msg())
     {
         updateWorld(sensor_msg.ssl_vision_msg());
@@ -163,7 +166,7 @@ void SensorFusion::updateWorld(
     for (auto &robot_status_msg : robot_status_msgs)
     {
         int robot_id = robot_status_msg.robot_id();
-        std::set<RobotCapability> unavailableCapabilities;
+        RobotCapabilities unavailableCapabilities;
 
         for (const auto &error_code_msg : robot_status_msg.error_code())
         {
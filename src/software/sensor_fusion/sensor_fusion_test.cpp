@@ -369,12 +369,11 @@ TEST_F(SensorFusionTest, test_making_robot_move_capability_unavailable_from_erro
     std::optional<Robot> robot =
         sensor_fusion.getWorld().value().friendlyTeam().getRobotById(2);
     ASSERT_TRUE(robot);
-    std::set<RobotCapability> robot_unavailable_capabilities =
+    RobotCapabilities robot_unavailable_capabilities =
         robot.value().getUnavailableCapabilities();
     EXPECT_EQ(1, robot_unavailable_capabilities.size());
     bool is_movement_disabled =
-        robot_unavailable_capabilities.find(RobotCapability::Move) !=
-        robot_unavailable_capabilities.end();
+        robot_unavailable_capabilities.contains(RobotCapability::Move);
     ASSERT_TRUE(is_movement_disabled);
 }
 
@@ -391,16 +390,16 @@ TEST_F(SensorFusionTest,
     std::optional<Robot> robot =
         sensor_fusion.getWorld().value().friendlyTeam().getRobotById(2);
     ASSERT_TRUE(robot);
-    std::set<RobotCapability> robot_unavailable_capabilities =
+    RobotCapabilities robot_unavailable_capabilities =
         robot.value().getUnavailableCapabilities();
     EXPECT_EQ(2, robot_unavailable_capabilities.size());
 
-    bool is_kick_disabled = robot_unavailable_capabilities.find(RobotCapability::Kick) !=
-                            robot_unavailable_capabilities.end();
+    bool is_kick_disabled =
+        robot_unavailable_capabilities.contains(RobotCapability::Kick);
     ASSERT_TRUE(is_kick_disabled);
 
-    bool is_chip_disabled = robot_unavailable_capabilities.find(RobotCapability::Chip) !=
-                            robot_unavailable_capabilities.end();
+    bool is_chip_disabled =
+        robot_unavailable_capabilities.contains(RobotCapability::Chip);
     ASSERT_TRUE(is_chip_disabled);
 }
 
@@ -417,13 +416,12 @@ TEST_F(SensorFusionTest,
     std::optional<Robot> robot =
         sensor_fusion.getWorld().value().friendlyTeam().getRobotById(2);
     ASSERT_TRUE(robot);
-    std::set<RobotCapability> robot_unavailable_capabilities =
+    RobotCapabilities robot_unavailable_capabilities =
         robot.value().getUnavailableCapabilities();
     EXPECT_EQ(1, robot_unavailable_capabilities.size());
 
     bool is_dribble_disabled =
-        robot_unavailable_capabilities.find(RobotCapability::Dribble) !=
-        robot_unavailable_capabilities.end();
+        robot_unavailable_capabilities.contains(RobotCapability::Dribble);
     ASSERT_TRUE(is_dribble_disabled);
 }
 
@@ -439,26 +437,24 @@ TEST_F(SensorFusionTest, test_making_all_robot_capabilities_unavailable_from_err
     std::optional<Robot> robot =
         sensor_fusion.getWorld().value().friendlyTeam().getRobotById(2);
     ASSERT_TRUE(robot);
-    std::set<RobotCapability> robot_unavailable_capabilities =
+    RobotCapabilities robot_unavailable_capabilities =
         robot.value().getUnavailableCapabilities();
     EXPECT_EQ(4, robot_unavailable_capabilities.size());
 
     bool is_dribble_disabled =
-        robot_unavailable_capabilities.find(RobotCapability::Dribble) !=
-        robot_unavailable_capabilities.end();
+        robot_unavailable_capabilities.contains(RobotCapability::Dribble);
     ASSERT_TRUE(is_dribble_disabled);
 
-    bool is_kick_disabled = robot_unavailable_capabilities.find(RobotCapability::Kick) !=
-                            robot_unavailable_capabilities.end();
+    bool is_kick_disabled =
+        robot_unavailable_capabilities.contains(RobotCapability::Kick);
     ASSERT_TRUE(is_kick_disabled);
 
-    bool is_chip_disabled = robot_unavailable_capabilities.find(RobotCapability::Chip) !=
-                            robot_unavailable_capabilities.end();
+    bool is_chip_disabled =
+        robot_unavailable_capabilities.contains(RobotCapability::Chip);
     ASSERT_TRUE(is_chip_disabled);
 
     bool is_movement_disabled =
-        robot_unavailable_capabilities.find(RobotCapability::Move) !=
-        robot_unavailable_capabilities.end();
+        robot_unavailable_capabilities.contains(RobotCapability::Move);
     ASSERT_TRUE(is_movement_disabled);
 }
 
@@ -474,7 +470,7 @@ TEST_F(SensorFusionTest, test_emptying_robot_unavailable_capabilities_from_error
     std::optional<Robot> robot =
         sensor_fusion.getWorld().value().friendlyTeam().getRobotById(2);
     ASSERT_TRUE(robot);
-    std::set<RobotCapability> robot_unavailable_capabilities =
+    RobotCapabilities robot_unavailable_capabilities =
         robot.value().getUnavailableCapabilities();
     EXPECT_EQ(0, robot_unavailable_capabilities.size());
 }
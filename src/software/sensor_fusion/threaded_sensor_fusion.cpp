@@ -1,8 +1,13 @@
 #include "software/sensor_fusion/threaded_sensor_fusion.h"
 
+#include "proto/message_translation/tbots_protobuf.h"
+#include "software/util/latency_profiler/latency_profiler.h"
+
 ThreadedSensorFusion::ThreadedSensorFusion(
-    std::shared_ptr<const SensorFusionConfig> sensor_fusion_config)
-    : FirstInFirstOutThreadedObserver<SensorProto>(DIFFERENT_GRSIM_FRAMES_RECEIVED),
+    std::shared_ptr<const SensorFusionConfig> sensor_fusion_config,
+    ThreadedObserverPolicy sensor_msg_policy)
+    : ConfigurableThreadedObserver<SensorProto>(
+          sensor_msg_policy, DIFFERENT_GRSIM_FRAMES_RECEIVED, true, true),
       sensor_fusion(sensor_fusion_config)
 {
     if (!sensor_fusion_config)
@@ -14,10 +19,29 @@ ThreadedSensorFusion::ThreadedSensorFusion(
 
 void ThreadedSensorFusion::onValueReceived(SensorProto sensor_msg)
 {
+    TbotsProto::LatencyTrace latency_trace = sensor_msg.latency_trace();
+    if (sensor_msg.has_latency_trace())
+    {
+        *(latency_trace.mutable_sensor_fusion_start_time()) = *createCurrentTimestamp();
+        LatencyProfiler::record(LatencyStage::SENSOR_FUSION_QUEUE,
+                                latency_trace.backend_received_time(),
+                                latency_trace.sensor_fusion_start_time());
+        LatencyProfiler::setNumDroppedValues(LatencyStage::SENSOR_FUSION_QUEUE,
+                                             getNumDroppedValues());
+    }
+
     sensor_fusion.processSensorProto(sensor_msg);
     std::optional<World> world = sensor_fusion.getWorld();
     if (world)
     {
-        Subject<World>::sendValueToObservers(world.value());
+        // Only Worlds made from a vision frame are traced, so that a frame is only
+        // counted once
+        if (sensor_msg.has_latency_trace())
+        {
+            *(latency_trace.mutable_world_sent_time()) = *createCurrentTimestamp();
+            world->setLatencyTrace(latency_trace);
+        }
+        Subject<WorldPtr>::sendValueToObservers(
+            std::make_shared<const World>(std::move(world.value())));
     }
 }
@@ -2,17 +2,32 @@
 
 #include "proto/sensor_msg.pb.h"
 #include "shared/parameter/cpp_dynamic_parameters.h"
-#include "software/multithreading/first_in_first_out_threaded_observer.h"
+#include "software/multithreading/configurable_threaded_observer.h"
 #include "software/multithreading/subject.hpp"
 #include "software/sensor_fusion/sensor_fusion.h"
 #include "software/world/world.h"
 
-class ThreadedSensorFusion : public Subject<World>,
-                             public FirstInFirstOutThreadedObserver<SensorProto>
+/**
+ * This class wraps a `SensorFusion` object, passing it every SensorProto it receives and
+ * publishing the updated World. Each World is published as a single immutable snapshot
+ * that is shared by all observers, rather than being copied for each of them.
+ */
+class ThreadedSensorFusion : public Subject<WorldPtr>,
+                             public ConfigurableThreadedObserver<SensorProto>
 {
    public:
+    /**
+     * Creates a ThreadedSensorFusion
+     *
+     * @param sensor_fusion_config The SensorFusion configuration
+     * @param sensor_msg_policy The order to process received SensorProtos in. Every
+     * SensorProto has different information (ex. robot statuses, referee commands), so
+     * they are all processed in order by default.
+     */
     explicit ThreadedSensorFusion(
-        std::shared_ptr<const SensorFusionConfig> sensor_fusion_config);
+        std::shared_ptr<const SensorFusionConfig> sensor_fusion_config,
+        ThreadedObserverPolicy sensor_msg_policy =
+            ThreadedObserverPolicy::FIRST_IN_FIRST_OUT);
     virtual ~ThreadedSensorFusion() = default;
 
    private:
@@ -1,8 +1,5 @@
 #include "software/simulated_tests/simulated_er_force_sim_test_fixture.h"
 
-// TODO (#2419): remove this
-#include <fenv.h>
-
 #include <cstdlib>
 #include <filesystem>
 
@@ -16,6 +13,7 @@
 #include "software/test_util/test_util.h"
 
 using namespace TestUtil;
+using namespace SimulatedErForceSimTestUtil;
 
 SimulatedErForceSimTestFixture::SimulatedErForceSimTestFixture()
     : friendly_mutable_thunderbots_config(std::make_shared<ThunderbotsConfig>()),
@@ -43,25 +41,18 @@ void SimulatedErForceSimTestFixture::SetUp()
     enemy_thunderbots_config = std::const_pointer_cast<const ThunderbotsConfig>(
         enemy_mutable_thunderbots_config);
 
-    setCommonConfigs(friendly_mutable_thunderbots_config);
-    setCommonConfigs(enemy_mutable_thunderbots_config);
     // The friendly team defends the negative side of the field
     // and controls the yellow robots
-    friendly_mutable_thunderbots_config->getMutableSensorFusionConfig()
-        ->getMutableFriendlyColorYellow()
-        ->setValue(true);
-    friendly_mutable_thunderbots_config->getMutableSensorFusionConfig()
-        ->getMutableDefendingPositiveSide()
-        ->setValue(false);
-
+    setCommonConfigs(friendly_mutable_thunderbots_config, true);
     // The enemy team defends the positive side of the field
     // and controls the blue robots
-    enemy_mutable_thunderbots_config->getMutableSensorFusionConfig()
-        ->getMutableFriendlyColorYellow()
-        ->setValue(false);
-    enemy_mutable_thunderbots_config->getMutableSensorFusionConfig()
-        ->getMutableDefendingPositiveSide()
-        ->setValue(true);
+    setCommonConfigs(enemy_mutable_thunderbots_config, false);
+    friendly_mutable_thunderbots_config->getMutableAiControlConfig()
+        ->getMutableRunAi()
+        ->setValue(!TbotsGtestMain::stop_ai_on_start);
+    enemy_mutable_thunderbots_config->getMutableAiControlConfig()
+        ->getMutableRunAi()
+        ->setValue(!TbotsGtestMain::stop_ai_on_start);
 
     // reinitializing to prevent the previous test's configs from being reused
     friendly_sensor_fusion =
@@ -75,40 +66,8 @@ void SimulatedErForceSimTestFixture::SetUp()
     setupReplayLogging();
 
     // Reset tick duration trackers
-    total_friendly_tick_duration = 0.0;
-    total_enemy_tick_duration    = 0.0;
-    // all tick times should be greater than 0
-    max_friendly_tick_duration = 0.0;
-    max_enemy_tick_duration    = 0.0;
-    // all tick times should be less than the max value of a double
-    min_friendly_tick_duration = std::numeric_limits<double>::max();
-    min_enemy_tick_duration    = std::numeric_limits<double>::max();
-    friendly_tick_count        = 0;
-    enemy_tick_count           = 0;
-}
-
-void SimulatedErForceSimTestFixture::setCommonConfigs(
-    std::shared_ptr<ThunderbotsConfig> mutable_thunderbots_config)
-{
-    mutable_thunderbots_config->getMutableAiControlConfig()->getMutableRunAi()->setValue(
-        !TbotsGtestMain::stop_ai_on_start);
-
-    mutable_thunderbots_config->getMutableSensorFusionConfig()
-        ->getMutableOverrideGameControllerDefendingSide()
-        ->setValue(true);
-
-    // Experimentally determined restitution value
-    mutable_thunderbots_config->getMutableSimulatorConfig()
-        ->getMutableBallRestitution()
-        ->setValue(0.8);
-    // Measured these values from fig. 9 on page 8 of
-    // https://ssl.robocup.org/wp-content/uploads/2020/03/2020_ETDP_ZJUNlict.pdf
-    mutable_thunderbots_config->getMutableSimulatorConfig()
-        ->getMutableSlidingFrictionAcceleration()
-        ->setValue(6.9);
-    mutable_thunderbots_config->getMutableSimulatorConfig()
-        ->getMutableRollingFrictionAcceleration()
-        ->setValue(0.5);
+    friendly_tick_time_stats = TickTimeStatistics();
+    enemy_tick_time_stats    = TickTimeStatistics();
 }
 
 void SimulatedErForceSimTestFixture::enableVisualizer()
@@ -170,34 +129,21 @@ bool SimulatedErForceSimTestFixture::validateAndCheckCompletion(
     return terminating_function_validators.empty() ? false : validation_successful;
 }
 
-void SimulatedErForceSimTestFixture::updateSensorFusion(
-    std::shared_ptr<ErForceSimulator> simulator)
+void SimulatedErForceSimTestFixture::processSensorMsg(const SensorProto &sensor_msg)
 {
-    // TODO (#2419): remove this to re-enable sigfpe checks
-    fedisableexcept(FE_INVALID | FE_OVERFLOW);
-    auto ssl_wrapper_packets = simulator->getSSLWrapperPackets();
-    // TODO (#2419): remove this to re-enable sigfpe checks
-    feenableexcept(FE_INVALID | FE_OVERFLOW);
+    friendly_sensor_fusion.processSensorProto(sensor_msg);
+    enemy_sensor_fusion.processSensorProto(sensor_msg);
 
-    for (const auto &packet : ssl_wrapper_packets)
+    if (should_log_replay)
     {
-        auto sensor_msg                        = SensorProto();
-        *(sensor_msg.mutable_ssl_vision_msg()) = packet;
+        simulator_sensorproto_logger->onValueReceived(sensor_msg);
+        auto friendly_world_or_null = friendly_sensor_fusion.getWorld();
 
-        friendly_sensor_fusion.processSensorProto(sensor_msg);
-        enemy_sensor_fusion.processSensorProto(sensor_msg);
-
-        if (should_log_replay)
+        if (friendly_world_or_null)
         {
-            simulator_sensorproto_logger->onValueReceived(sensor_msg);
-            auto friendly_world_or_null = friendly_sensor_fusion.getWorld();
-
-            if (friendly_world_or_null)
-            {
-                auto filtered_ssl_wrapper = *createSSLWrapperPacket(
-                    *friendly_sensor_fusion.getWorld(), TeamColour::YELLOW);
-                sensorfusion_wrapper_logger->onValueReceived(filtered_ssl_wrapper);
-            }
+            auto filtered_ssl_wrapper = *createSSLWrapperPacket(
+                *friendly_sensor_fusion.getWorld(), TeamColour::YELLOW);
+            sensorfusion_wrapper_logger->onValueReceived(filtered_ssl_wrapper);
         }
     }
 }
@@ -234,17 +180,11 @@ void SimulatedErForceSimTestFixture::runTest(
         field_type, create2015RobotConstants(), create2015WheelConstants(),
         friendly_thunderbots_config->getSimulatorConfig()));
 
-    // TODO (#2419): remove this to re-enable sigfpe checks
-    fedisableexcept(FE_INVALID | FE_OVERFLOW);
-    simulator->setBallState(ball);
-    // step the simulator to make sure the ball is in position
-    simulator->stepSimulation(simulation_time_step);
-    simulator->setYellowRobots(friendly_robots);
-    simulator->setBlueRobots(enemy_robots);
-    // TODO (#2419): remove this to re-enable sigfpe checks
-    feenableexcept(FE_INVALID | FE_OVERFLOW);
-
-    updateSensorFusion(simulator);
+    setUpSimulator(*simulator, ball, friendly_robots, enemy_robots);
+
+    processSensorMsgs(*simulator, [this](const SensorProto &sensor_msg) {
+        processSensorMsg(sensor_msg);
+    });
     std::shared_ptr<World> friendly_world;
     std::shared_ptr<World> enemy_world;
     CHECK(friendly_sensor_fusion.getWorld().has_value())
@@ -290,9 +230,9 @@ void SimulatedErForceSimTestFixture::runTest(
     std::vector<AggregateFunctions> robots_velocity_stats;
 
     // Tick one frame to aid with visualization
-    bool validation_functions_done = tickTest(
-        simulation_time_step, ai_time_step, friendly_world, enemy_world, simulator,
-        ball_displacement, ball_velocity_diff, robots_displacement, robots_velocity_diff);
+    bool validation_functions_done =
+        tickTest(ai_time_step, friendly_world, enemy_world, simulator, ball_displacement,
+                 ball_velocity_diff, robots_displacement, robots_velocity_diff);
 
     // Initialize Values
     ball_displacement_stats.maximum = ball_displacement;
@@ -311,10 +251,9 @@ void SimulatedErForceSimTestFixture::runTest(
         robots_displacement.clear();
         robots_velocity_diff.clear();
         if (!friendly_thunderbots_config->getAiControlConfig()->getRunAi()->value())
-            validation_functions_done =
-                tickTest(simulation_time_step, ai_time_step, friendly_world, enemy_world,
-                         simulator, ball_displacement, ball_velocity_diff,
-                         robots_displacement, robots_velocity_diff);
+            validation_functions_done = tickTest(
+                ai_time_step, friendly_world, enemy_world, simulator, ball_displacement,
+                ball_velocity_diff, robots_displacement, robots_velocity_diff);
 
         while (simulator->getTimestamp() < timeout_time && !validation_functions_done)
         {
@@ -326,10 +265,9 @@ void SimulatedErForceSimTestFixture::runTest(
                 continue;
             }
 
-            validation_functions_done =
-                tickTest(simulation_time_step, ai_time_step, friendly_world, enemy_world,
-                         simulator, ball_displacement, ball_velocity_diff,
-                         robots_displacement, robots_velocity_diff);
+            validation_functions_done = tickTest(
+                ai_time_step, friendly_world, enemy_world, simulator, ball_displacement,
+                ball_velocity_diff, robots_displacement, robots_velocity_diff);
 
             sum_ball_displacement += ball_displacement;
             sum_ball_velocity += ball_velocity_diff;
@@ -360,7 +298,8 @@ void SimulatedErForceSimTestFixture::runTest(
             }
         }
 
-        auto total_tick_count = friendly_tick_count + enemy_tick_count;
+        auto total_tick_count =
+            friendly_tick_time_stats.tick_count + enemy_tick_time_stats.tick_count;
         // compute the averages
         ball_displacement_stats.average =
             (total_tick_count == 0) ? 0 : sum_ball_displacement / total_tick_count;
@@ -374,10 +313,9 @@ void SimulatedErForceSimTestFixture::runTest(
                                         : sum_robots_displacement[i] / total_tick_count;
             robots_velocity_stats[i].average =
                 (total_tick_count == 0) ? 0 : sum_robots_velocity[i] / total_tick_count;
-            validation_functions_done =
-                tickTest(simulation_time_step, ai_time_step, friendly_world, enemy_world,
-                         simulator, ball_displacement, ball_velocity_diff,
-                         robots_displacement, robots_velocity_diff);
+            validation_functions_done = tickTest(
+                ai_time_step, friendly_world, enemy_world, simulator, ball_displacement,
+                ball_velocity_diff, robots_displacement, robots_velocity_diff);
         }
 
         // Output the statistics for ball and robots
@@ -410,22 +348,14 @@ void SimulatedErForceSimTestFixture::runTest(
                       << std::endl;
         }
 
-        validation_functions_done =
-            tickTest(simulation_time_step, ai_time_step, friendly_world, enemy_world,
-                     simulator, ball_displacement, ball_velocity_diff,
-                     robots_displacement, robots_velocity_diff);
+        validation_functions_done = tickTest(
+            ai_time_step, friendly_world, enemy_world, simulator, ball_displacement,
+            ball_velocity_diff, robots_displacement, robots_velocity_diff);
     }
     // Output the tick duration results
-    if (friendly_tick_count > 0)
+    if (friendly_tick_time_stats.tick_count > 0)
     {
-        double avg_friendly_tick_duration =
-            total_friendly_tick_duration / friendly_tick_count;
-        LOG(INFO) << "max friendly tick duration: " << max_friendly_tick_duration << "ms"
-                  << std::endl;
-        LOG(INFO) << "min friendly tick duration: " << min_friendly_tick_duration << "ms"
-                  << std::endl;
-        LOG(INFO) << "avg friendly tick duration: " << avg_friendly_tick_duration << "ms"
-                  << std::endl;
+        friendly_tick_time_stats.log("friendly");
     }
     else
     {
@@ -433,15 +363,9 @@ void SimulatedErForceSimTestFixture::runTest(
                      << std::endl;
     }
 
-    if (enemy_tick_count > 0)
+    if (enemy_tick_time_stats.tick_count > 0)
     {
-        double avg_enemy_tick_duration = total_enemy_tick_duration / enemy_tick_count;
-        LOG(INFO) << "max enemy tick duration: " << max_enemy_tick_duration << "ms"
-                  << std::endl;
-        LOG(INFO) << "min enemy tick duration: " << min_enemy_tick_duration << "ms"
-                  << std::endl;
-        LOG(INFO) << "avg enemy tick duration: " << avg_enemy_tick_duration << "ms"
-                  << std::endl;
+        enemy_tick_time_stats.log("enemy");
     }
 
 
@@ -462,26 +386,19 @@ void SimulatedErForceSimTestFixture::runTest(
 
 void SimulatedErForceSimTestFixture::registerFriendlyTickTime(double tick_time_ms)
 {
-    total_friendly_tick_duration += tick_time_ms;
-    max_friendly_tick_duration = std::max(max_friendly_tick_duration, tick_time_ms);
-    min_friendly_tick_duration = std::min(min_friendly_tick_duration, tick_time_ms);
-    friendly_tick_count++;
+    friendly_tick_time_stats.registerTickTime(tick_time_ms);
 }
 
 void SimulatedErForceSimTestFixture::registerEnemyTickTime(double tick_time_ms)
 {
-    total_enemy_tick_duration += tick_time_ms;
-    max_enemy_tick_duration = std::max(max_enemy_tick_duration, tick_time_ms);
-    min_enemy_tick_duration = std::min(min_enemy_tick_duration, tick_time_ms);
-    enemy_tick_count++;
+    enemy_tick_time_stats.registerTickTime(tick_time_ms);
 }
 
 bool SimulatedErForceSimTestFixture::tickTest(
-    Duration simulation_time_step, Duration ai_time_step,
-    std::shared_ptr<World> friendly_world, std::shared_ptr<World> enemy_world,
-    std::shared_ptr<ErForceSimulator> simulator, double &ball_displacement,
-    double &ball_velocity_diff, std::vector<double> &robots_displacement,
-    std::vector<double> &robots_velocity_diff)
+    Duration ai_time_step, std::shared_ptr<World> friendly_world,
+    std::shared_ptr<World> enemy_world, std::shared_ptr<ErForceSimulator> simulator,
+    double &ball_displacement, double &ball_velocity_diff,
+    std::vector<double> &robots_displacement, std::vector<double> &robots_velocity_diff)
 {
     /* extract world ball and robot */
     Ball world_ball                          = friendly_world->ball();
@@ -568,15 +485,9 @@ bool SimulatedErForceSimTestFixture::tickTest(
     auto wall_start_time           = std::chrono::steady_clock::now();
     bool validation_functions_done = false;
 
-    for (size_t i = 0; i < CAMERA_FRAMES_PER_AI_TICK; i++)
-    {
-        // TODO (#2419): remove this to re-enable sigfpe checks
-        fedisableexcept(FE_INVALID | FE_OVERFLOW);
-        simulator->stepSimulation(simulation_time_step);
-        // TODO (#2419): remove this to re-enable sigfpe checks
-        feenableexcept(FE_INVALID | FE_OVERFLOW);
-        updateSensorFusion(simulator);
-    }
+    simulateCameraFramesForAiTick(*simulator, [this](const SensorProto &sensor_msg) {
+        processSensorMsg(sensor_msg);
+    });
 
     if (friendly_sensor_fusion.getWorld().has_value() &&
         enemy_sensor_fusion.getWorld().has_value())
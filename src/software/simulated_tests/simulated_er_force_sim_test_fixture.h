@@ -5,6 +5,7 @@
 #include "software/ai/hl/stp/play/halt_play.h"
 #include "software/gui/full_system/threaded_full_system_gui.h"
 #include "software/sensor_fusion/sensor_fusion.h"
+#include "software/simulated_tests/simulated_er_force_sim_test_util.h"
 #include "software/simulated_tests/validation/non_terminating_function_validator.h"
 #include "software/simulated_tests/validation/terminating_function_validator.h"
 #include "software/simulation/er_force_simulator.h"
@@ -106,7 +107,6 @@ class SimulatedErForceSimTestFixture : public ::testing::Test
     /**
      * Runs one tick of the test and checks if the validation function is done
      *
-     * @param simulation_time_step time step for stepping the simulation
      * @param ai_time_step minimum time for one tick of AI
      * @param world the shared_ptr to the world that is updated by this function
      * @param simulator The simulator to tick test on
@@ -118,28 +118,19 @@ class SimulatedErForceSimTestFixture : public ::testing::Test
      * robot in id order
      * @return if validation functions are done
      */
-    bool tickTest(Duration simulation_time_step, Duration ai_time_step,
-                  std::shared_ptr<World> friendly_world,
+    bool tickTest(Duration ai_time_step, std::shared_ptr<World> friendly_world,
                   std::shared_ptr<World> enemy_world,
                   std::shared_ptr<ErForceSimulator> simulator, double &ball_displacement,
                   double &ball_velocity_diff, std::vector<double> &robots_displacement,
                   std::vector<double> &robots_velocity_diff);
 
     /**
-     * Sets configs that are common to the friendly and enemy teams
+     * Updates SensorFusion with a SensorProto from the ErForceSimulator, and logs it if
+     * replay logging is set up
      *
-     * @param mutable_thunderbots_config A mutable thunderbots config
+     * @param sensor_msg The SensorProto to update SensorFusion with
      */
-    static void setCommonConfigs(
-        std::shared_ptr<ThunderbotsConfig> mutable_thunderbots_config);
-
-    /**
-     * A helper function that updates SensorFusion with the latest data from the
-     * ErForceSimulator
-     *
-     * @param simulator The simulator to update sensor fusion with
-     */
-    void updateSensorFusion(std::shared_ptr<ErForceSimulator> simulator);
+    void processSensorMsg(const SensorProto &sensor_msg);
 
     /**
      * Updates primitives in the simulator based on the new world
@@ -222,27 +213,6 @@ class SimulatedErForceSimTestFixture : public ::testing::Test
     bool run_simulation_in_realtime;
 
     // These variables track tick time statistics
-    // Total duration of all ticks registered
-    double total_friendly_tick_duration;
-    double total_enemy_tick_duration;
-    // The max tick duration registered
-    double max_friendly_tick_duration;
-    double max_enemy_tick_duration;
-    // The min tick duration registered
-    double min_friendly_tick_duration;
-    double min_enemy_tick_duration;
-    // Total number of ticks registered
-    unsigned int friendly_tick_count;
-    unsigned int enemy_tick_count;
-
-    // The rate at which camera data will be simulated and given to SensorFusion.
-    // Each sequential "camera frame" will be 1 / SIMULATED_CAMERA_FPS time step
-    // ahead of the previous one
-    static constexpr unsigned int SIMULATED_CAMERA_FPS = 60;
-    // In real-life, the AI typically runs slower than we receive data. In order
-    // to mimic real-life as much as possible, we define approximately how many
-    // camera frames we receive per AI tick. For example, a value of 2 means
-    // that we will simulate 2 time steps (2 camera frames) before we give
-    // the latest data to the AI and run it.
-    static constexpr unsigned int CAMERA_FRAMES_PER_AI_TICK = 2;
+    TickTimeStatistics friendly_tick_time_stats;
+    TickTimeStatistics enemy_tick_time_stats;
 };
@@ -0,0 +1,127 @@
+#include "software/simulated_tests/simulated_er_force_sim_test_util.h"
+
+// TODO (#2419): remove this
+#include <fenv.h>
+
+#include <algorithm>
+
+#include "software/logger/logger.h"
+
+namespace
+{
+    /**
+     * Runs the given function with the floating point exceptions that the
+     * ErForceSimulator raises disabled, and then restores the floating point
+     * exceptions that were enabled before
+     *
+     * TODO (#2419): remove this to re-enable sigfpe checks
+     *
+     * @param function The function to run
+     */
+    void runWithoutSimulatorFloatingPointExceptions(const std::function<void()>& function)
+    {
+        int enabled_fp_exceptions = fedisableexcept(FE_INVALID | FE_OVERFLOW);
+        function();
+        feenableexcept(enabled_fp_exceptions);
+    }
+}  // namespace
+
+void TickTimeStatistics::registerTickTime(double tick_time_ms)
+{
+    total_ms += tick_time_ms;
+    max_ms = std::max(max_ms, tick_time_ms);
+    min_ms = std::min(min_ms, tick_time_ms);
+    tick_count++;
+}
+
+void TickTimeStatistics::merge(const TickTimeStatistics& other)
+{
+    total_ms += other.total_ms;
+    max_ms = std::max(max_ms, other.max_ms);
+    min_ms = std::min(min_ms, other.min_ms);
+    tick_count += other.tick_count;
+}
+
+double TickTimeStatistics::averageMs() const
+{
+    return tick_count == 0 ? 0.0 : total_ms / tick_count;
+}
+
+void TickTimeStatistics::log(const std::string& team_name) const
+{
+    LOG(INFO) << "max " << team_name << " tick duration: " << max_ms << "ms";
+    LOG(INFO) << "min " << team_name << " tick duration: " << min_ms << "ms";
+    LOG(INFO) << "avg " << team_name << " tick duration: " << averageMs() << "ms";
+}
+
+namespace SimulatedErForceSimTestUtil
+{
+    void setCommonConfigs(std::shared_ptr<ThunderbotsConfig> mutable_thunderbots_config,
+                          bool friendly_color_yellow)
+    {
+        auto sensor_fusion_config =
+            mutable_thunderbots_config->getMutableSensorFusionConfig();
+        sensor_fusion_config->getMutableOverrideGameControllerDefendingSide()->setValue(
+            true);
+        sensor_fusion_config->getMutableFriendlyColorYellow()->setValue(
+            friendly_color_yellow);
+        sensor_fusion_config->getMutableDefendingPositiveSide()->setValue(
+            !friendly_color_yellow);
+
+        // Experimentally determined restitution value
+        mutable_thunderbots_config->getMutableSimulatorConfig()
+            ->getMutableBallRestitution()
+            ->setValue(0.8);
+        // Measured these values from fig. 9 on page 8 of
+        // https://ssl.robocup.org/wp-content/uploads/2020/03/2020_ETDP_ZJUNlict.pdf
+        mutable_thunderbots_config->getMutableSimulatorConfig()
+            ->getMutableSlidingFrictionAcceleration()
+            ->setValue(6.9);
+        mutable_thunderbots_config->getMutableSimulatorConfig()
+            ->getMutableRollingFrictionAcceleration()
+            ->setValue(0.5);
+    }
+
+    void setUpSimulator(ErForceSimulator& simulator, const BallState& ball,
+                        const std::vector<RobotStateWithId>& friendly_robots,
+                        const std::vector<RobotStateWithId>& enemy_robots)
+    {
+        runWithoutSimulatorFloatingPointExceptions([&]() {
+            simulator.setBallState(ball);
+            // step the simulator to make sure the ball is in position
+            simulator.stepSimulation(Duration::fromSeconds(1.0 / SIMULATED_CAMERA_FPS));
+            simulator.setYellowRobots(friendly_robots);
+            simulator.setBlueRobots(enemy_robots);
+        });
+    }
+
+    void processSensorMsgs(
+        ErForceSimulator& simulator,
+        const std::function<void(const SensorProto&)>& process_sensor_msg)
+    {
+        std::vector<SSLProto::SSL_WrapperPacket> ssl_wrapper_packets;
+        runWithoutSimulatorFloatingPointExceptions(
+            [&]() { ssl_wrapper_packets = simulator.getSSLWrapperPackets(); });
+
+        for (const auto& packet : ssl_wrapper_packets)
+        {
+            auto sensor_msg                        = SensorProto();
+            *(sensor_msg.mutable_ssl_vision_msg()) = packet;
+            process_sensor_msg(sensor_msg);
+        }
+    }
+
+    void simulateCameraFramesForAiTick(
+        ErForceSimulator& simulator,
+        const std::function<void(const SensorProto&)>& process_sensor_msg)
+    {
+        const Duration simulation_time_step =
+            Duration::fromSeconds(1.0 / SIMULATED_CAMERA_FPS);
+        for (unsigned int i = 0; i < CAMERA_FRAMES_PER_AI_TICK; i++)
+        {
+            runWithoutSimulatorFloatingPointExceptions(
+                [&]() { simulator.stepSimulation(simulation_time_step); });
+            processSensorMsgs(simulator, process_sensor_msg);
+        }
+    }
+}  // namespace SimulatedErForceSimTestUtil
@@ -0,0 +1,122 @@
+#pragma once
+
+#include <functional>
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "proto/sensor_msg.pb.h"
+#include "shared/parameter/cpp_dynamic_parameters.h"
+#include "software/simulation/er_force_simulator.h"
+#include "software/world/ball_state.h"
+#include "software/world/robot_state.h"
+
+/**
+ * Statistics of how long the AI took to tick
+ */
+struct TickTimeStatistics
+{
+    /**
+     * Registers a new tick time
+     *
+     * @param tick_time_ms The tick time in milliseconds
+     */
+    void registerTickTime(double tick_time_ms);
+
+    /**
+     * Adds the tick times registered in other statistics to these statistics
+     *
+     * @param other The statistics to add
+     */
+    void merge(const TickTimeStatistics& other);
+
+    /**
+     * Gets the average tick time
+     *
+     * @return the average tick time in milliseconds, or 0 if no tick times were
+     * registered
+     */
+    double averageMs() const;
+
+    /**
+     * Logs the max, min and average tick time
+     *
+     * @param team_name The name of the team that ticked, ex. "friendly"
+     */
+    void log(const std::string& team_name) const;
+
+    // Total number of ticks registered
+    unsigned int tick_count = 0;
+    // Total duration of all ticks registered
+    double total_ms = 0.0;
+    // The min tick duration registered
+    double min_ms = std::numeric_limits<double>::max();
+    // The max tick duration registered
+    double max_ms = 0.0;
+};
+
+/**
+ * The setup and stepping of an ErForceSimulator that is shared by everything that runs
+ * simulated tests, so that they all simulate a test the same way
+ */
+namespace SimulatedErForceSimTestUtil
+{
+    // The rate at which camera data will be simulated and given to SensorFusion.
+    // Each sequential "camera frame" will be 1 / SIMULATED_CAMERA_FPS time step
+    // ahead of the previous one
+    static constexpr unsigned int SIMULATED_CAMERA_FPS = 60;
+    // In real-life, the AI typically runs slower than we receive data. In order
+    // to mimic real-life as much as possible, we define approximately how many
+    // camera frames we receive per AI tick. For example, a value of 2 means
+    // that we will simulate 2 time steps (2 camera frames) before we give
+    // the latest data to the AI and run it.
+    static constexpr unsigned int CAMERA_FRAMES_PER_AI_TICK = 2;
+
+    /**
+     * Sets the configs of a team that are the same in every simulated test. The team
+     * controlling the yellow robots defends the negative side of the field, and the
+     * team controlling the blue robots defends the positive side.
+     *
+     * @param mutable_thunderbots_config The config of the team
+     * @param friendly_color_yellow Whether the team controls the yellow robots
+     */
+    void setCommonConfigs(std::shared_ptr<ThunderbotsConfig> mutable_thunderbots_config,
+                          bool friendly_color_yellow);
+
+    /**
+     * Places the ball and the robots in the simulator. The simulator is stepped by one
+     * camera frame after placing the ball, to make sure the ball is in position before
+     * the robots are added.
+     *
+     * @param simulator The simulator to set up
+     * @param ball The ball state
+     * @param friendly_robots The yellow robots
+     * @param enemy_robots The blue robots
+     */
+    void setUpSimulator(ErForceSimulator& simulator, const BallState& ball,
+                        const std::vector<RobotStateWithId>& friendly_robots,
+                        const std::vector<RobotStateWithId>& enemy_robots);
+
+    /**
+     * Gets the vision data of the latest camera frame of the simulator and passes it to
+     * the given function, one SensorProto per SSL wrapper packet
+     *
+     * @param simulator The simulator to get the vision data from
+     * @param process_sensor_msg The function to pass every SensorProto to
+     */
+    void processSensorMsgs(
+        ErForceSimulator& simulator,
+        const std::function<void(const SensorProto&)>& process_sensor_msg);
+
+    /**
+     * Simulates the CAMERA_FRAMES_PER_AI_TICK camera frames between two AI ticks, and
+     * passes the vision data of every frame to the given function
+     *
+     * @param simulator The simulator to step
+     * @param process_sensor_msg The function to pass every SensorProto to
+     */
+    void simulateCameraFramesForAiTick(
+        ErForceSimulator& simulator,
+        const std::function<void(const SensorProto&)>& process_sensor_msg);
+}  // namespace SimulatedErForceSimTestUtil
@@ -0,0 +1,313 @@
+#include "software/simulated_tests/simulated_test_batch_runner.h"
+
+#include <atomic>
+
+#include "proto/message_translation/tbots_protobuf.h"
+#include "shared/2015_robot_constants.h"
+#include "software/ai/ai.h"
+#include "software/logger/logger.h"
+#include "software/sensor_fusion/sensor_fusion.h"
+#include "software/simulated_tests/validation/non_terminating_function_validator.h"
+#include "software/simulated_tests/validation/terminating_function_validator.h"
+#include "software/test_util/test_util.h"
+
+double SimulatedTestBatchResult::passRate() const
+{
+    return results.empty()
+               ? 0.0
+               : static_cast<double>(num_passed) / static_cast<double>(results.size());
+}
+
+SimulatedTestBatchRunner::SimulatedTestBatchRunner(unsigned int num_workers)
+    : num_workers(num_workers)
+{
+    if (num_workers == 0)
+    {
+        throw std::invalid_argument(
+            "SimulatedTestBatchRunner needs at least one worker to run scenarios");
+    }
+}
+
+SimulatedTestBatchResult SimulatedTestBatchRunner::runScenarios(
+    const std::vector<SimulatedTestScenario>& scenarios) const
+{
+    auto wall_start_time = std::chrono::system_clock::now();
+
+    SimulatedTestBatchResult batch_result;
+    batch_result.results.resize(scenarios.size());
+
+    // Workers take the next scenario that hasn't been started, so that a few long
+    // scenarios don't hold up the rest of the batch
+    std::atomic<size_t> next_scenario_idx(0);
+    auto run_scenarios = [&]() {
+        for (size_t scenario_idx = next_scenario_idx++; scenario_idx < scenarios.size();
+             scenario_idx        = next_scenario_idx++)
+        {
+            batch_result.results[scenario_idx] = runScenario(scenarios[scenario_idx]);
+        }
+    };
+
+    std::vector<std::thread> workers;
+    size_t num_workers_needed = std::min<size_t>(num_workers, scenarios.size());
+    for (size_t i = 0; i < num_workers_needed; i++)
+    {
+        workers.emplace_back(run_scenarios);
+    }
+    for (std::thread& worker : workers)
+    {
+        worker.join();
+    }
+
+    for (const SimulatedTestResult& result : batch_result.results)
+    {
+        if (result.passed)
+        {
+            batch_result.num_passed++;
+        }
+        else
+        {
+            batch_result.num_failed++;
+        }
+        batch_result.friendly_tick_time_stats.merge(result.friendly_tick_time_stats);
+        batch_result.enemy_tick_time_stats.merge(result.enemy_tick_time_stats);
+    }
+    batch_result.wall_time_ms = ::TestUtil::millisecondsSince(wall_start_time);
+
+    LOG(INFO) << "Ran " << scenarios.size() << " simulated scenarios on " << num_workers
+              << " workers in " << batch_result.wall_time_ms
+              << "ms: " << batch_result.num_passed << " passed, "
+              << batch_result.num_failed << " failed";
+    if (batch_result.friendly_tick_time_stats.tick_count > 0)
+    {
+        batch_result.friendly_tick_time_stats.log("friendly");
+    }
+    if (batch_result.enemy_tick_time_stats.tick_count > 0)
+    {
+        batch_result.enemy_tick_time_stats.log("enemy");
+    }
+    return batch_result;
+}
+
+SimulatedTestBatchResult SimulatedTestBatchRunner::runSeedSweep(
+    const std::function<SimulatedTestScenario(uint32_t seed)>& create_scenario,
+    uint32_t first_seed, unsigned int num_seeds) const
+{
+    std::vector<SimulatedTestScenario> scenarios;
+    scenarios.reserve(num_seeds);
+    for (unsigned int i = 0; i < num_seeds; i++)
+    {
+        uint32_t seed = first_seed + i;
+        scenarios.emplace_back(create_scenario(seed));
+        scenarios.back().seed = seed;
+    }
+    return runScenarios(scenarios);
+}
+
+SimulatedTestResult SimulatedTestBatchRunner::runScenario(
+    const SimulatedTestScenario& scenario)
+{
+    auto wall_start_time = std::chrono::system_clock::now();
+
+    SimulatedTestResult result;
+    result.name = scenario.name;
+    result.seed = scenario.seed;
+    try
+    {
+        simulateScenario(scenario, result);
+    }
+    catch (const std::exception& e)
+    {
+        // one broken scenario shouldn't take down the rest of the batch
+        result.failure_messages.emplace_back(std::string("Exception thrown: ") +
+                                             e.what());
+    }
+    result.passed       = result.failure_messages.empty();
+    result.wall_time_ms = ::TestUtil::millisecondsSince(wall_start_time);
+
+    if (result.passed)
+    {
+        LOG(INFO) << scenario.name << " (seed " << scenario.seed << ") passed";
+    }
+    else
+    {
+        LOG(WARNING) << scenario.name << " (seed " << scenario.seed
+                     << ") failed: " << result.failure_messages.front();
+    }
+    return result;
+}
+
+void SimulatedTestBatchRunner::simulateScenario(const SimulatedTestScenario& scenario,
+                                                SimulatedTestResult& result)
+{
+    // The friendly team defends the negative side of the field and controls the yellow
+    // robots, and the enemy team defends the positive side and controls the blue robots
+    std::shared_ptr<const ThunderbotsConfig> friendly_thunderbots_config =
+        createTeamConfig(true, scenario.friendly_goalie_id, scenario.enemy_goalie_id);
+    std::shared_ptr<const ThunderbotsConfig> enemy_thunderbots_config =
+        createTeamConfig(false, scenario.enemy_goalie_id, scenario.friendly_goalie_id);
+
+    // The simulator is created and destroyed on this thread, since it owns Qt objects
+    auto simulator = std::make_shared<ErForceSimulator>(
+        scenario.field_type, create2015RobotConstants(), create2015WheelConstants(),
+        friendly_thunderbots_config->getSimulatorConfig());
+    simulator->seedRandomNumberGenerator(scenario.seed);
+    if (scenario.realism_config)
+    {
+        simulator->setRealismConfig(*scenario.realism_config);
+    }
+    SimulatedErForceSimTestUtil::setUpSimulator(
+        *simulator, scenario.ball, scenario.friendly_robots, scenario.enemy_robots);
+
+    SensorFusion friendly_sensor_fusion(
+        friendly_thunderbots_config->getSensorFusionConfig());
+    SensorFusion enemy_sensor_fusion(enemy_thunderbots_config->getSensorFusionConfig());
+    auto process_sensor_msg = [&](const SensorProto& sensor_msg) {
+        friendly_sensor_fusion.processSensorProto(sensor_msg);
+        enemy_sensor_fusion.processSensorProto(sensor_msg);
+    };
+
+    SimulatedErForceSimTestUtil::processSensorMsgs(*simulator, process_sensor_msg);
+    if (!friendly_sensor_fusion.getWorld() || !enemy_sensor_fusion.getWorld())
+    {
+        throw std::runtime_error("SensorFusion did not output a valid World");
+    }
+    auto friendly_world = std::make_shared<World>(*friendly_sensor_fusion.getWorld());
+    auto enemy_world    = std::make_shared<World>(*enemy_sensor_fusion.getWorld());
+
+    // The validators are constructed in place because their coroutines are bound to them
+    std::vector<TerminatingFunctionValidator> terminating_function_validators;
+    terminating_function_validators.reserve(
+        scenario.terminating_validation_functions.size());
+    for (const auto& validation_function : scenario.terminating_validation_functions)
+    {
+        terminating_function_validators.emplace_back(validation_function, friendly_world);
+    }
+    std::vector<NonTerminatingFunctionValidator> non_terminating_function_validators;
+    non_terminating_function_validators.reserve(
+        scenario.non_terminating_validation_functions.size());
+    for (const auto& validation_function : scenario.non_terminating_validation_functions)
+    {
+        non_terminating_function_validators.emplace_back(validation_function,
+                                                         friendly_world);
+    }
+
+    auto friendly_ai = std::make_unique<AI>(friendly_thunderbots_config->getAiConfig());
+    if (scenario.create_friendly_play)
+    {
+        friendly_ai->overridePlay(
+            scenario.create_friendly_play(friendly_thunderbots_config->getAiConfig()));
+    }
+    std::unique_ptr<AI> enemy_ai;
+    if (scenario.create_enemy_play)
+    {
+        enemy_ai = std::make_unique<AI>(enemy_thunderbots_config->getAiConfig());
+        enemy_ai->overridePlay(
+            scenario.create_enemy_play(enemy_thunderbots_config->getAiConfig()));
+    }
+
+    GameState game_state;
+    game_state.updateRefereeCommand(scenario.previous_referee_command);
+    game_state.updateRefereeCommand(scenario.current_referee_command);
+
+    const Timestamp start_time     = simulator->getTimestamp();
+    const Timestamp timeout_time   = start_time + scenario.timeout;
+    bool validation_functions_done = false;
+    while (simulator->getTimestamp() < timeout_time && !validation_functions_done)
+    {
+        SimulatedErForceSimTestUtil::simulateCameraFramesForAiTick(*simulator,
+                                                                   process_sensor_msg);
+
+        if (!friendly_sensor_fusion.getWorld() || !enemy_sensor_fusion.getWorld())
+        {
+            LOG(WARNING) << "SensorFusion did not output a valid World";
+            continue;
+        }
+        *friendly_world = *friendly_sensor_fusion.getWorld();
+        *enemy_world    = *enemy_sensor_fusion.getWorld();
+
+        for (auto& function_validator : non_terminating_function_validators)
+        {
+            auto error_message = function_validator.executeAndCheckForFailures();
+            if (error_message)
+            {
+                result.failure_messages.emplace_back(error_message.value());
+            }
+        }
+        if (!result.failure_messages.empty())
+        {
+            // the scenario has already failed, so there's no point in simulating the rest
+            // of it
+            break;
+        }
+
+        validation_functions_done = !terminating_function_validators.empty() &&
+                                    std::all_of(terminating_function_validators.begin(),
+                                                terminating_function_validators.end(),
+                                                [](TerminatingFunctionValidator& fv) {
+                                                    return fv.executeAndCheckForSuccess();
+                                                });
+        if (validation_functions_done)
+        {
+            break;
+        }
+
+        World friendly_world_with_game_state = *friendly_world;
+        friendly_world_with_game_state.updateGameState(game_state);
+        auto start_tick_time = std::chrono::system_clock::now();
+        auto primitive_set_msg =
+            friendly_ai->getPrimitives(friendly_world_with_game_state);
+        result.friendly_tick_time_stats.registerTickTime(
+            ::TestUtil::millisecondsSince(start_tick_time));
+        simulator->setYellowRobotPrimitiveSet(*primitive_set_msg,
+                                              createVision(*friendly_world));
+
+        if (enemy_ai)
+        {
+            World enemy_world_with_game_state = *enemy_world;
+            enemy_world_with_game_state.updateGameState(game_state);
+            start_tick_time   = std::chrono::system_clock::now();
+            primitive_set_msg = enemy_ai->getPrimitives(enemy_world_with_game_state);
+            result.enemy_tick_time_stats.registerTickTime(
+                ::TestUtil::millisecondsSince(start_tick_time));
+            simulator->setBlueRobotPrimitiveSet(*primitive_set_msg,
+                                                createVision(*enemy_world));
+        }
+    }
+    result.simulated_duration = simulator->getTimestamp() - start_time;
+
+    if (result.failure_messages.empty() && !validation_functions_done &&
+        !terminating_function_validators.empty())
+    {
+        std::string failure_message =
+            "Not all validation functions passed within the timeout duration:\n";
+        for (const auto& function_validator : terminating_function_validators)
+        {
+            if (function_validator.currentErrorMessage() != "")
+            {
+                failure_message +=
+                    function_validator.currentErrorMessage() + std::string("\n");
+            }
+        }
+        result.failure_messages.emplace_back(failure_message);
+    }
+}
+
+std::shared_ptr<ThunderbotsConfig> SimulatedTestBatchRunner::createTeamConfig(
+    bool friendly_color_yellow, RobotId goalie_id, RobotId enemy_goalie_id)
+{
+    auto mutable_thunderbots_config = std::make_shared<ThunderbotsConfig>();
+    SimulatedErForceSimTestUtil::setCommonConfigs(mutable_thunderbots_config,
+                                                  friendly_color_yellow);
+
+    mutable_thunderbots_config->getMutableAiControlConfig()->getMutableRunAi()->setValue(
+        true);
+
+    auto sensor_fusion_config =
+        mutable_thunderbots_config->getMutableSensorFusionConfig();
+    sensor_fusion_config->getMutableFriendlyGoalieId()->setValue(
+        static_cast<int>(goalie_id));
+    sensor_fusion_config->getMutableEnemyGoalieId()->setValue(
+        static_cast<int>(enemy_goalie_id));
+
+    return mutable_thunderbots_config;
+}
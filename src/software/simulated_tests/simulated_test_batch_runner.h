@@ -0,0 +1,189 @@
+#pragma once
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "proto/tbots_software_msgs.pb.h"
+#include "software/ai/hl/stp/play/play.h"
+#include "software/simulated_tests/simulated_er_force_sim_test_util.h"
+#include "software/simulated_tests/validation/validation_function.h"
+#include "software/simulation/er_force_simulator.h"
+#include "software/time/duration.h"
+#include "software/world/ball_state.h"
+#include "software/world/game_state.h"
+#include "software/world/robot_state.h"
+
+// Creates the play an AI runs in a scenario from the AI's config
+using PlayCreator = std::function<std::unique_ptr<Play>(std::shared_ptr<const AiConfig>)>;
+
+/**
+ * A simulated play or tactic test that can run headless alongside other scenarios. Tactic
+ * scenarios are run by creating an AssignedTacticsPlay with the tactics to test.
+ *
+ * Everything a scenario creates while it runs belongs to that scenario, so the plays,
+ * tactics and validation functions must not share mutable state with other scenarios.
+ */
+struct SimulatedTestScenario
+{
+    // The name to report the scenario's result with
+    std::string name;
+    TbotsProto::FieldType field_type;
+    BallState ball;
+    std::vector<RobotStateWithId> friendly_robots;
+    std::vector<RobotStateWithId> enemy_robots;
+    // Creates the play the friendly AI runs. If this is empty the friendly AI selects
+    // its plays from the game state, like it does in a match
+    PlayCreator create_friendly_play = nullptr;
+    // Creates the play the enemy AI runs. If this is empty the enemy robots are not
+    // controlled. The enemy AI is given the same referee commands as the friendly AI, so
+    // they should be symmetric, ex. FORCE_START
+    PlayCreator create_enemy_play           = nullptr;
+    RobotId friendly_goalie_id              = 0;
+    RobotId enemy_goalie_id                 = 0;
+    RefereeCommand current_referee_command  = RefereeCommand::FORCE_START;
+    RefereeCommand previous_referee_command = RefereeCommand::STOP;
+    std::vector<ValidationFunction> terminating_validation_functions;
+    std::vector<ValidationFunction> non_terminating_validation_functions;
+    // The maximum duration of simulated time to run the scenario for
+    Duration timeout = Duration::fromSeconds(10);
+    // Seeds the noise of the simulator. This only changes the simulation if the
+    // realism config adds noise
+    uint32_t seed = 0;
+    // Changes how realistic the simulation is, ex. to add vision noise
+    std::optional<RealismConfigErForce> realism_config = std::nullopt;
+};
+
+/**
+ * The result of running a SimulatedTestScenario
+ */
+struct SimulatedTestResult
+{
+    std::string name;
+    uint32_t seed = 0;
+    bool passed   = false;
+    // Why the scenario failed, empty if it passed
+    std::vector<std::string> failure_messages;
+    // How long the scenario ran for in simulated time
+    Duration simulated_duration;
+    // How long the scenario ran for in wall clock time
+    double wall_time_ms = 0.0;
+    TickTimeStatistics friendly_tick_time_stats;
+    TickTimeStatistics enemy_tick_time_stats;
+};
+
+/**
+ * The results of running a batch of SimulatedTestScenarios
+ */
+struct SimulatedTestBatchResult
+{
+    /**
+     * Gets the fraction of scenarios that passed
+     *
+     * @return the fraction of scenarios that passed, or 0 if no scenarios were run
+     */
+    double passRate() const;
+
+    // The result of every scenario, in the order the scenarios were given
+    std::vector<SimulatedTestResult> results;
+    unsigned int num_passed = 0;
+    unsigned int num_failed = 0;
+    // The tick times of every scenario combined
+    TickTimeStatistics friendly_tick_time_stats;
+    TickTimeStatistics enemy_tick_time_stats;
+    // How long the whole batch took to run in wall clock time
+    double wall_time_ms = 0.0;
+};
+
+/**
+ * Runs many independent simulated test scenarios concurrently in one process. Each
+ * scenario runs on a worker thread with its own simulator, SensorFusion, AIs and
+ * validators, as fast as possible and without a visualizer. This makes it practical to
+ * run a whole suite of simulated tests, or the same play hundreds of times with
+ * different starting states or simulator noise:
+ *
+ * ```
+ * SimulatedTestBatchRunner runner;
+ * auto batch_result = runner.runSeedSweep(
+ *     [](uint32_t seed) { return createNoisyShootOrChipScenario(seed); }, 0, 200);
+ * LOG(INFO) << "ShootOrChipPlay scored in " << batch_result.passRate() * 100 << "%";
+ * ```
+ */
+class SimulatedTestBatchRunner
+{
+   public:
+    /**
+     * Creates a SimulatedTestBatchRunner
+     *
+     * @param num_workers The number of scenarios to run at the same time
+     *
+     * @throws std::invalid_argument if num_workers is 0
+     */
+    explicit SimulatedTestBatchRunner(
+        unsigned int num_workers = std::max(std::thread::hardware_concurrency(), 1u));
+
+    /**
+     * Runs the given scenarios across the workers and blocks until all of them are done
+     *
+     * @param scenarios The scenarios to run
+     *
+     * @return the results of the scenarios
+     */
+    SimulatedTestBatchResult runScenarios(
+        const std::vector<SimulatedTestScenario>& scenarios) const;
+
+    /**
+     * Runs a scenario once per seed, for Monte Carlo evaluation of a play. The
+     * scenario created for each seed should differ by the seed, ex. by randomizing the
+     * starting positions of the robots or by adding simulator noise, which is seeded with
+     * the seed
+     *
+     * @param create_scenario Creates the scenario to run for a seed
+     * @param first_seed The first seed to run
+     * @param num_seeds How many seeds to run, starting from the first seed
+     *
+     * @return the results of the scenarios, in seed order
+     */
+    SimulatedTestBatchResult runSeedSweep(
+        const std::function<SimulatedTestScenario(uint32_t seed)>& create_scenario,
+        uint32_t first_seed, unsigned int num_seeds) const;
+
+    /**
+     * Runs a single scenario on the calling thread
+     *
+     * @param scenario The scenario to run
+     *
+     * @return the result of the scenario
+     */
+    static SimulatedTestResult runScenario(const SimulatedTestScenario& scenario);
+
+   private:
+    /**
+     * Simulates a scenario until its validation functions are done, one of them fails,
+     * or it times out, and fills in the result of the scenario
+     *
+     * @param scenario The scenario to simulate
+     * @param result The result to fill in
+     */
+    static void simulateScenario(const SimulatedTestScenario& scenario,
+                                 SimulatedTestResult& result);
+
+    /**
+     * Creates the config of a team
+     *
+     * @param friendly_color_yellow Whether the team controls the yellow robots
+     * @param goalie_id The goalie of the team
+     * @param enemy_goalie_id The goalie of the other team
+     *
+     * @return the config of the team
+     */
+    static std::shared_ptr<ThunderbotsConfig> createTeamConfig(bool friendly_color_yellow,
+                                                               RobotId goalie_id,
+                                                               RobotId enemy_goalie_id);
+
+    const unsigned int num_workers;
+};
@@ -0,0 +1,157 @@
+#include "software/simulated_tests/simulated_test_batch_runner.h"
+
+#include <gtest/gtest.h>
+
+#include "software/ai/hl/stp/play/halt_play.h"
+#include "software/test_util/test_util.h"
+#include "software/time/duration.h"
+#include "software/time/timestamp.h"
+#include "software/world/world.h"
+
+/**
+ * Like the simulated test fixture tests, these tests use validation functions that
+ * assert things about the timestamp of the world, so that they only test the batch
+ * runner and not the AI
+ */
+class SimulatedTestBatchRunnerTest : public ::testing::Test
+{
+   protected:
+    /**
+     * Creates a scenario that passes if the world reaches the given time before the
+     * timeout
+     *
+     * @param name The name of the scenario
+     * @param time_to_reach The time the world has to reach to pass
+     * @param timeout The timeout of the scenario
+     *
+     * @return the scenario
+     */
+    static SimulatedTestScenario createTimestampScenario(const std::string& name,
+                                                         double time_to_reach,
+                                                         double timeout)
+    {
+        return SimulatedTestScenario{
+            .name       = name,
+            .field_type = TbotsProto::FieldType::DIV_B,
+            .ball       = BallState(Point(0, 0), Vector(0, 0)),
+            .friendly_robots =
+                TestUtil::createStationaryRobotStatesWithId({Point(-3, 0)}),
+            .enemy_robots = TestUtil::createStationaryRobotStatesWithId({Point(3, 0)}),
+            .create_friendly_play =
+                [](std::shared_ptr<const AiConfig> ai_config) {
+                    return std::make_unique<HaltPlay>(ai_config);
+                },
+            .terminating_validation_functions =
+                {[time_to_reach](std::shared_ptr<World> world_ptr,
+                                 ValidationCoroutine::push_type& yield) {
+                    while (world_ptr->getMostRecentTimestamp() <
+                           Timestamp::fromSeconds(time_to_reach))
+                    {
+                        yield("Waiting for timestamp of at least " +
+                              std::to_string(time_to_reach) + "s");
+                    }
+                }},
+            .non_terminating_validation_functions = {},
+            .timeout                              = Duration::fromSeconds(timeout)};
+    }
+};
+
+TEST_F(SimulatedTestBatchRunnerTest, test_run_scenarios_aggregates_results_in_order)
+{
+    std::vector<SimulatedTestScenario> scenarios = {
+        createTimestampScenario("passes_first", 0.3, 1.0),
+        createTimestampScenario("times_out", 1.0, 0.3),
+        createTimestampScenario("passes_last", 0.5, 1.0),
+    };
+
+    SimulatedTestBatchRunner runner(2);
+    auto batch_result = runner.runScenarios(scenarios);
+
+    ASSERT_EQ(3, batch_result.results.size());
+    EXPECT_EQ("passes_first", batch_result.results[0].name);
+    EXPECT_TRUE(batch_result.results[0].passed);
+    EXPECT_EQ("times_out", batch_result.results[1].name);
+    EXPECT_FALSE(batch_result.results[1].passed);
+    ASSERT_EQ(1, batch_result.results[1].failure_messages.size());
+    EXPECT_NE(std::string::npos, batch_result.results[1].failure_messages[0].find(
+                                     "Waiting for timestamp of at least 1"));
+    EXPECT_EQ("passes_last", batch_result.results[2].name);
+    EXPECT_TRUE(batch_result.results[2].passed);
+
+    EXPECT_EQ(2, batch_result.num_passed);
+    EXPECT_EQ(1, batch_result.num_failed);
+    EXPECT_DOUBLE_EQ(2.0 / 3.0, batch_result.passRate());
+}
+
+TEST_F(SimulatedTestBatchRunnerTest, test_tick_times_are_combined_across_scenarios)
+{
+    std::vector<SimulatedTestScenario> scenarios = {
+        createTimestampScenario("first", 0.5, 1.0),
+        createTimestampScenario("second", 0.5, 1.0),
+    };
+
+    SimulatedTestBatchRunner runner(2);
+    auto batch_result = runner.runScenarios(scenarios);
+
+    const auto& first_stats  = batch_result.results[0].friendly_tick_time_stats;
+    const auto& second_stats = batch_result.results[1].friendly_tick_time_stats;
+    EXPECT_GT(first_stats.tick_count, 0);
+    EXPECT_EQ(first_stats.tick_count + second_stats.tick_count,
+              batch_result.friendly_tick_time_stats.tick_count);
+    EXPECT_DOUBLE_EQ(first_stats.total_ms + second_stats.total_ms,
+                     batch_result.friendly_tick_time_stats.total_ms);
+    EXPECT_DOUBLE_EQ(std::max(first_stats.max_ms, second_stats.max_ms),
+                     batch_result.friendly_tick_time_stats.max_ms);
+    // no enemy play was set, so the enemy AI never ticked
+    EXPECT_EQ(0, batch_result.enemy_tick_time_stats.tick_count);
+}
+
+TEST_F(SimulatedTestBatchRunnerTest, test_non_terminating_failure_stops_scenario)
+{
+    auto scenario = createTimestampScenario("fails_early", 5.0, 10.0);
+    scenario.non_terminating_validation_functions = {
+        [](std::shared_ptr<World> world_ptr, ValidationCoroutine::push_type& yield) {
+            if (world_ptr->getMostRecentTimestamp() > Timestamp::fromSeconds(0.2))
+            {
+                yield("Too late");
+            }
+        }};
+
+    auto result = SimulatedTestBatchRunner::runScenario(scenario);
+
+    EXPECT_FALSE(result.passed);
+    EXPECT_EQ(std::vector<std::string>({"Too late"}), result.failure_messages);
+    EXPECT_LT(result.simulated_duration.toSeconds(), 1.0);
+}
+
+TEST_F(SimulatedTestBatchRunnerTest, test_seed_sweep_runs_every_seed)
+{
+    std::vector<uint32_t> created_seeds;
+    SimulatedTestBatchRunner runner(3);
+    auto batch_result = runner.runSeedSweep(
+        [&](uint32_t seed) {
+            created_seeds.emplace_back(seed);
+            auto scenario = createTimestampScenario("sweep", 0.2, 1.0);
+            // add vision noise so that every seed simulates differently
+            RealismConfigErForce realism_config;
+            realism_config.set_stddev_ball_p(0.002f);
+            realism_config.set_stddev_robot_p(0.002f);
+            scenario.realism_config = realism_config;
+            return scenario;
+        },
+        10, 5);
+
+    EXPECT_EQ(std::vector<uint32_t>({10, 11, 12, 13, 14}), created_seeds);
+    ASSERT_EQ(5, batch_result.results.size());
+    for (uint32_t i = 0; i < 5; i++)
+    {
+        EXPECT_EQ(10 + i, batch_result.results[i].seed);
+        EXPECT_TRUE(batch_result.results[i].passed);
+    }
+    EXPECT_DOUBLE_EQ(1.0, batch_result.passRate());
+}
+
+TEST_F(SimulatedTestBatchRunnerTest, test_zero_workers_throws)
+{
+    EXPECT_THROW(SimulatedTestBatchRunner(0), std::invalid_argument);
+}
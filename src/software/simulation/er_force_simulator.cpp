@@ -329,3 +329,16 @@ void ErForceSimulator::resetCurrentTime()
 {
     current_time = Timestamp::fromSeconds(0);
 }
+
+void ErForceSimulator::setRealismConfig(const RealismConfigErForce& realism_config)
+{
+    auto simulator_setup_command = std::make_unique<amun::Command>();
+    *(simulator_setup_command->mutable_simulator()->mutable_realism_config()) =
+        realism_config;
+    er_force_sim->handleSimulatorSetupCommand(simulator_setup_command);
+}
+
+void ErForceSimulator::seedRandomNumberGenerator(uint32_t seed)
+{
+    er_force_sim->seedPRGN(seed);
+}
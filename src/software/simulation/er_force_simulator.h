@@ -122,6 +122,22 @@ class ErForceSimulator : public QObject
      */
     void resetCurrentTime();
 
+    /**
+     * Changes how realistic the simulation is, ex. how much noise is added to the
+     * simulated vision. Only the fields that are set in the given config are changed.
+     *
+     * @param realism_config The realism config to apply
+     */
+    void setRealismConfig(const RealismConfigErForce& realism_config);
+
+    /**
+     * Seeds the random number generator used to simulate noise, so that a noisy
+     * simulation can be repeated exactly
+     *
+     * @param seed The seed
+     */
+    void seedRandomNumberGenerator(uint32_t seed);
+
    private:
     /**
      * Sets the primitive being simulated by the robot in simulation
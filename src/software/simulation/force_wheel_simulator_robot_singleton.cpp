@@ -18,7 +18,7 @@ extern "C"
 // We should inject it as a robot or control param instead.
 #define WHEEL_MOTOR_PHASE_RESISTANCE 1.2f  // ohms—EC45 datasheet
 
-std::shared_ptr<ForceWheelSimulatorRobot>
+thread_local std::shared_ptr<ForceWheelSimulatorRobot>
     ForceWheelSimulatorRobotSingleton::force_wheel_simulator_robot = nullptr;
 
 void ForceWheelSimulatorRobotSingleton::setSimulatorRobot(
@@ -5,7 +5,9 @@
 
 /**
  * This class acts as a wrapper around a ForceWheelSimulatorRobot and extends the common
- * functionality provided by the SimulatorRobotSingleton class
+ * functionality provided by the SimulatorRobotSingleton class. Like the
+ * SimulatorRobotSingleton, the robot being controlled is tracked separately for every
+ * thread.
  */
 class ForceWheelSimulatorRobotSingleton : public SimulatorRobotSingleton
 {
@@ -64,6 +66,7 @@ class ForceWheelSimulatorRobotSingleton : public SimulatorRobotSingleton
         return static_cast<RET_VAL>(0);
     }
 
-    // The simulator robot being controlled by this class
-    static std::shared_ptr<ForceWheelSimulatorRobot> force_wheel_simulator_robot;
+    // The simulator robot being controlled by this class on the current thread
+    static thread_local std::shared_ptr<ForceWheelSimulatorRobot>
+        force_wheel_simulator_robot;
 };
@@ -24,7 +24,8 @@ Simulator::Simulator(const Field& field, const RobotConstants_t& robot_constants
       yellow_team_defending_side(FieldSide::NEG_X),
       blue_team_defending_side(FieldSide::NEG_X),
       frame_number(0),
-      physics_time_step(physics_time_step)
+      physics_time_step(physics_time_step),
+      current_firmware_time(Timestamp::fromSeconds(0))
 {
     this->resetCurrentFirmwareTime();
 }
@@ -73,17 +74,7 @@ void Simulator::updateSimulatorRobots(
         // we initialize the logger with the appropriate logging function based
         // on the team color and the robot id to propagate any logs when creating
         // the firmware_robot and firmware_ball
-        if (team_colour == TeamColour::BLUE)
-        {
-            app_logger_init(simulator_robot->getRobotId(),
-                            &ForceWheelSimulatorRobotSingleton::handleBlueRobotLogProto);
-        }
-        else if (team_colour == TeamColour::YELLOW)
-        {
-            app_logger_init(
-                simulator_robot->getRobotId(),
-                &ForceWheelSimulatorRobotSingleton::handleYellowRobotLogProto);
-        }
+        initFirmwareLogger(simulator_robot->getRobotId(), team_colour);
 
         auto firmware_robot = ForceWheelSimulatorRobotSingleton::createFirmwareRobot();
         auto firmware_ball  = SimulatorBallSingleton::createFirmwareBall();
@@ -98,18 +89,32 @@ void Simulator::updateSimulatorRobots(
     }
 }
 
+void Simulator::initFirmwareLogger(RobotId robot_id, TeamColour team_colour)
+{
+    if (team_colour == TeamColour::BLUE)
+    {
+        app_logger_init(robot_id,
+                        &ForceWheelSimulatorRobotSingleton::handleBlueRobotLogProto);
+    }
+    else if (team_colour == TeamColour::YELLOW)
+    {
+        app_logger_init(robot_id,
+                        &ForceWheelSimulatorRobotSingleton::handleYellowRobotLogProto);
+    }
+}
+
 void Simulator::setYellowRobotPrimitive(RobotId id,
                                         const TbotsProto_Primitive& primitive_msg)
 {
     setRobotPrimitive(id, primitive_msg, yellow_simulator_robots, simulator_ball,
-                      yellow_team_defending_side);
+                      yellow_team_defending_side, TeamColour::YELLOW);
 }
 
 void Simulator::setBlueRobotPrimitive(RobotId id,
                                       const TbotsProto_Primitive& primitive_msg)
 {
     setRobotPrimitive(id, primitive_msg, blue_simulator_robots, simulator_ball,
-                      blue_team_defending_side);
+                      blue_team_defending_side, TeamColour::BLUE);
 }
 
 void Simulator::setYellowRobotPrimitiveSet(
@@ -135,8 +140,10 @@ void Simulator::setRobotPrimitive(
     RobotId id, const TbotsProto_Primitive& primitive_msg,
     std::map<std::shared_ptr<PhysicsSimulatorRobot>, std::shared_ptr<FirmwareWorld_t>>&
         simulator_robots,
-    const std::shared_ptr<PhysicsSimulatorBall>& simulator_ball, FieldSide defending_side)
+    const std::shared_ptr<PhysicsSimulatorBall>& simulator_ball, FieldSide defending_side,
+    TeamColour team_colour)
 {
+    setAsFirmwareSimulator();
     SimulatorBallSingleton::setSimulatorBall(simulator_ball, defending_side);
     auto simulator_robots_iter =
         std::find_if(simulator_robots.begin(), simulator_robots.end(),
@@ -148,6 +155,12 @@ void Simulator::setRobotPrimitive(
     {
         auto simulator_robot = (*simulator_robots_iter).first;
         auto firmware_world  = (*simulator_robots_iter).second;
+
+        // The logger is thread local and primitives can be set from a different
+        // thread than the one stepping the simulation, so it has to be initialized
+        // for this robot before the primitive is started
+        initFirmwareLogger(simulator_robot->getRobotId(), team_colour);
+
         ForceWheelSimulatorRobotSingleton::setSimulatorRobot(simulator_robot,
                                                              defending_side);
         ForceWheelSimulatorRobotSingleton::startNewPrimitiveOnCurrentSimulatorRobot(
@@ -193,6 +206,8 @@ void Simulator::stepSimulation(const Duration& time_step)
     // We only need to do this a single time since all robots
     // can see and interact with the same ball
 
+    setAsFirmwareSimulator();
+
     Duration remaining_time = time_step;
     while (remaining_time > Duration::fromSeconds(0))
     {
@@ -203,8 +218,7 @@ void Simulator::stepSimulation(const Duration& time_step)
             auto simulator_robot = iter.first;
             auto firmware_world  = iter.second;
 
-            app_logger_init(simulator_robot->getRobotId(),
-                            &ForceWheelSimulatorRobotSingleton::handleBlueRobotLogProto);
+            initFirmwareLogger(simulator_robot->getRobotId(), TeamColour::BLUE);
 
             ForceWheelSimulatorRobotSingleton::setSimulatorRobot(
                 simulator_robot, blue_team_defending_side);
@@ -219,9 +233,7 @@ void Simulator::stepSimulation(const Duration& time_step)
             auto simulator_robot = iter.first;
             auto firmware_world  = iter.second;
 
-            app_logger_init(
-                simulator_robot->getRobotId(),
-                &ForceWheelSimulatorRobotSingleton::handleYellowRobotLogProto);
+            initFirmwareLogger(simulator_robot->getRobotId(), TeamColour::YELLOW);
 
             ForceWheelSimulatorRobotSingleton::setSimulatorRobot(
                 simulator_robot, yellow_team_defending_side);
@@ -331,9 +343,18 @@ void Simulator::resetCurrentFirmwareTime()
 
 float Simulator::getCurrentFirmwareTimeSeconds()
 {
-    return static_cast<float>(current_firmware_time.toSeconds());
+    if (!firmware_simulator)
+    {
+        return 0.0f;
+    }
+    return static_cast<float>(firmware_simulator->current_firmware_time.toSeconds());
+}
+
+void Simulator::setAsFirmwareSimulator() const
+{
+    firmware_simulator = this;
 }
 
 // We must give this variable a value here, as non-const static variables must be
 // initialized out-of-line
-Timestamp Simulator::current_firmware_time = Timestamp::fromSeconds(0);
+thread_local const Simulator* Simulator::firmware_simulator = nullptr;
@@ -22,6 +22,10 @@ extern "C"
  * The Simulator abstracts away the physics simulation of all objects in the world,
  * as well as the firmware simulation for the robots. This provides a simple interface
  * to setup, run, and query the current state of the simulation.
+ *
+ * Simulators don't share any state, so multiple Simulators can be stepped at the same
+ * time on different threads. A single Simulator must only be used by one thread at a
+ * time.
  */
 class Simulator
 {
@@ -169,20 +173,27 @@ class Simulator
     /**
      * Resets the current firmware time to 0
      */
-    static void resetCurrentFirmwareTime();
+    void resetCurrentFirmwareTime();
 
    private:
     /**
      * Get the current time.
      *
      * This is passed into a `FirmwareWorld`, which requires that it is static (as it
-     * is C code). This will just return `current_firmware_time`, which should be updated
-     * to the actual current time before ticking any firmware.
+     * is C code). This will just return the `current_firmware_time` of the Simulator
+     * running firmware on this thread, which should be updated to the actual current
+     * time before ticking any firmware.
      *
      * @return The value of `current_firmware_time`, in seconds.
      */
     static float getCurrentFirmwareTimeSeconds();
 
+    /**
+     * Makes this the Simulator that the firmware run on this thread gets the current
+     * time from. This must be called before running any firmware.
+     */
+    void setAsFirmwareSimulator() const;
+
     /**
      * Updates the given simulator_robots to contain and control the given physics_robots
      *
@@ -196,6 +207,15 @@ class Simulator
                  std::shared_ptr<FirmwareWorld_t>>& simulator_robots,
         TeamColour team_colour);
 
+    /**
+     * Initializes the logger of the firmware run on this thread, so that the logs of
+     * the firmware are sent as logs of the given robot
+     *
+     * @param robot_id The id of the robot the firmware is run for
+     * @param team_colour The colour of the team the robot is on
+     */
+    static void initFirmwareLogger(RobotId robot_id, TeamColour team_colour);
+
     /**
      * Sets the primitive being simulated by the robot in simulation
      *
@@ -204,13 +224,13 @@ class Simulator
      * @param simulator_robots The robots to set the primitives on
      * @param simulator_ball The simulator ball to use in the primitives
      * @param defending_side The side of the field the robot is defending
+     * @param team_colour The colour of the team the robot is on
      */
-    static void setRobotPrimitive(
-        RobotId id, const TbotsProto_Primitive& primitive_msg,
-        std::map<std::shared_ptr<PhysicsSimulatorRobot>,
-                 std::shared_ptr<FirmwareWorld_t>>& simulator_robots,
-        const std::shared_ptr<PhysicsSimulatorBall>& simulator_ball,
-        FieldSide defending_side);
+    void setRobotPrimitive(RobotId id, const TbotsProto_Primitive& primitive_msg,
+                           std::map<std::shared_ptr<PhysicsSimulatorRobot>,
+                                    std::shared_ptr<FirmwareWorld_t>>& simulator_robots,
+                           const std::shared_ptr<PhysicsSimulatorBall>& simulator_ball,
+                           FieldSide defending_side, TeamColour team_colour);
 
     PhysicsWorld physics_world;
     std::shared_ptr<PhysicsSimulatorBall> simulator_ball;
@@ -233,7 +253,10 @@ class Simulator
     // We reuse the firmware tick rate to mimic real firmware
     static constexpr double DEFAULT_PHYSICS_TIME_STEP_SECONDS = 1.0 / CONTROL_LOOP_HZ;
 
-    // The current time. This is static so that it may be used by the firmware,
-    // and so must be set before each firmware tick
-    static Timestamp current_firmware_time;
+    // The current time of the firmware. This must be set before each firmware tick
+    Timestamp current_firmware_time;
+
+    // The Simulator running firmware on this thread, which the firmware gets the
+    // current time from
+    static thread_local const Simulator* firmware_simulator;
 };
@@ -29,6 +29,9 @@ extern "C"
  * that have been provided to the firmware struct operate on the correct
  * instantiated object. This is our workaround to maintain and simulate multiple
  * "instances" of firmware at once.
+ *
+ * The ball being controlled is tracked separately for every thread, so multiple
+ * Simulators can run their robot firmware at the same time on different threads.
  */
 class SimulatorBallSingleton
 {
@@ -133,7 +136,7 @@ class SimulatorBallSingleton
      */
     static float invertValueToMatchFieldSide(double value);
 
-    // The simulator ball being controlled by this class
-    static std::shared_ptr<SimulatorBall> simulator_ball;
-    static FieldSide field_side_;
+    // The simulator ball being controlled by this class on the current thread
+    static thread_local std::shared_ptr<SimulatorBall> simulator_ball;
+    static thread_local FieldSide field_side_;
 };
@@ -35,6 +35,11 @@ extern "C"
  * that have been provided to the firmware struct operate on the correct
  * instantiated object. This is our workaround to maintain and simulate multiple
  * "instances" of robot firmware at once.
+ *
+ * The robot being controlled is tracked separately for every thread, so every thread
+ * acts as if it had its own instance of this class. This lets multiple Simulators run
+ * their robot firmware at the same time on different threads, as long as a robot is
+ * set on the same thread that then runs its firmware.
  */
 class SimulatorRobotSingleton
 {
@@ -275,7 +280,7 @@ class SimulatorRobotSingleton
     static void handleRobotLogProto(TbotsProto_RobotLog log,
                                     const std::string& robot_colour);
 
-    // The simulator robot being controlled by this class
-    static std::shared_ptr<SimulatorRobot> simulator_robot;
-    static FieldSide field_side_;
+    // The simulator robot being controlled by this class on the current thread
+    static thread_local std::shared_ptr<SimulatorRobot> simulator_robot;
+    static thread_local FieldSide field_side_;
 };
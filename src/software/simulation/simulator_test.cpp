@@ -2,6 +2,9 @@
 
 #include <gtest/gtest.h>
 
+#include <optional>
+#include <thread>
+
 #include "proto/message_translation/primitive_google_to_nanopb_converter.h"
 #include "proto/primitive/primitive_msg_factory.h"
 #include "shared/2015_robot_constants.h"
@@ -624,3 +627,60 @@ TEST_F(SimulatorTest, simulate_multiple_blue_and_yellow_robots_with_primitives)
         Angle::half(), Angle::fromRadians(blue_robot_2->orientation()),
         Angle::fromDegrees(10)));
 }
+
+TEST(SimulatorMultithreadingTest, simulate_multiple_simulators_on_different_threads)
+{
+    // Every simulator moves its robot to a different destination, so robots will end
+    // up in the wrong place if the firmware of one simulator controls the robots of
+    // another
+    const std::vector<Point> destinations = {Point(1, 1), Point(-1, 1), Point(-1, -1),
+                                             Point(1, -1)};
+    std::vector<std::optional<Point>> final_positions(destinations.size());
+
+    std::vector<std::thread> simulator_threads;
+    for (size_t i = 0; i < destinations.size(); i++)
+    {
+        simulator_threads.emplace_back([i, &destinations, &final_positions]() {
+            RobotConstants_t robot_constants = create2015RobotConstants();
+            Simulator simulator(Field::createSSLDivisionBField(), robot_constants,
+                                create2015WheelConstants(),
+                                std::make_shared<const SimulatorConfig>());
+
+            RobotState robot_state(Point(0, 0), Vector(0, 0), Angle::zero(),
+                                   AngularVelocity::zero());
+            simulator.addBlueRobots(
+                {RobotStateWithId{.id = 1, .robot_state = robot_state}});
+            simulator.setBlueRobotPrimitive(
+                1, createNanoPbPrimitive(*createMovePrimitive(
+                       destinations[i], 0.0, Angle::zero(), TbotsProto::DribblerMode::OFF,
+                       {AutoChipOrKickMode::OFF, 0},
+                       TbotsProto::MaxAllowedSpeedMode::PHYSICAL_LIMIT, 0.0,
+                       robot_constants)));
+
+            for (unsigned int step = 0; step < 240; step++)
+            {
+                simulator.stepSimulation(Duration::fromSeconds(1.0 / 60.0));
+            }
+
+            auto ssl_wrapper_packet = simulator.getSSLWrapperPacket();
+            if (ssl_wrapper_packet && ssl_wrapper_packet->has_detection() &&
+                ssl_wrapper_packet->detection().robots_blue_size() == 1)
+            {
+                auto blue_robot    = ssl_wrapper_packet->detection().robots_blue(0);
+                final_positions[i] = Point(blue_robot.x(), blue_robot.y());
+            }
+        });
+    }
+
+    for (std::thread& simulator_thread : simulator_threads)
+    {
+        simulator_thread.join();
+    }
+
+    for (size_t i = 0; i < destinations.size(); i++)
+    {
+        ASSERT_TRUE(final_positions[i]);
+        EXPECT_NEAR(destinations[i].x() * 1000.0, final_positions[i]->x(), 200);
+        EXPECT_NEAR(destinations[i].y() * 1000.0, final_positions[i]->y(), 200);
+    }
+}
@@ -9,9 +9,7 @@ class ProtoReceiver:
     def __init__(self):
         self.proto_map = dict()
         self.proto_receiver = ThreadedUnixListener(
-            constants.UNIX_SOCKET_BASE_PATH + "protobuf",
-            convert_from_any=True,
-            max_buffer_size=3,
+            constants.UNIX_SOCKET_BASE_PATH + "protobuf", max_buffer_size=256,
         )
         self.thread = Thread(target=self.start)
         self.thread.start()
@@ -39,18 +39,18 @@ class Time
      */
     double toMilliseconds() const;
 
+   protected:
     /**
      * Destructor
      *
-     * We declare this virtual because no one should use this class directly, but instead
-     * should use one of it's subclasses.
+     * We declare this protected because no one should use this class directly, but
+     * instead should use one of it's subclasses.
      *
-     * Note however that we give it an implementation, so subclasses will by default not
-     * be abstract.
+     * It is not virtual so that subclasses stay trivially copyable, which is why
+     * subclasses must never be destroyed through a pointer to a Time.
      */
-    virtual ~Time() = 0;
+    ~Time() = default;
 
-   protected:
     /**
      * Constructs a Time value from a value in seconds.
      *
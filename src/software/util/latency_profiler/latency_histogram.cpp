@@ -0,0 +1,153 @@
+#include "software/util/latency_profiler/latency_histogram.h"
+
+#include <algorithm>
+#include <limits>
+
+LatencyHistogram::LatencyHistogram()
+    : bucket_counts(),
+      total_count(0),
+      total_latency_us(0),
+      min_latency_us(std::numeric_limits<uint64_t>::max()),
+      max_latency_us(0)
+{
+    reset();
+}
+
+void LatencyHistogram::record(std::chrono::steady_clock::duration latency)
+{
+    auto latency_us = std::chrono::duration_cast<std::chrono::microseconds>(latency);
+    recordMicroseconds(static_cast<uint64_t>(std::max<int64_t>(latency_us.count(), 0)));
+}
+
+void LatencyHistogram::recordMicroseconds(uint64_t latency_us)
+{
+    latency_us = std::min(latency_us, MAX_TRACKABLE_LATENCY_US);
+
+    bucket_counts[bucketIndex(latency_us)].fetch_add(1, std::memory_order_relaxed);
+    total_count.fetch_add(1, std::memory_order_relaxed);
+    total_latency_us.fetch_add(latency_us, std::memory_order_relaxed);
+
+    uint64_t current_min = min_latency_us.load(std::memory_order_relaxed);
+    while (latency_us < current_min &&
+           !min_latency_us.compare_exchange_weak(current_min, latency_us,
+                                                 std::memory_order_relaxed))
+    {
+    }
+    uint64_t current_max = max_latency_us.load(std::memory_order_relaxed);
+    while (latency_us > current_max &&
+           !max_latency_us.compare_exchange_weak(current_max, latency_us,
+                                                 std::memory_order_relaxed))
+    {
+    }
+}
+
+uint64_t LatencyHistogram::count() const
+{
+    return total_count.load(std::memory_order_relaxed);
+}
+
+uint64_t LatencyHistogram::minMicroseconds() const
+{
+    return count() == 0 ? 0 : min_latency_us.load(std::memory_order_relaxed);
+}
+
+uint64_t LatencyHistogram::maxMicroseconds() const
+{
+    return max_latency_us.load(std::memory_order_relaxed);
+}
+
+double LatencyHistogram::meanMicroseconds() const
+{
+    uint64_t num_latencies = count();
+    if (num_latencies == 0)
+    {
+        return 0.0;
+    }
+    return static_cast<double>(total_latency_us.load(std::memory_order_relaxed)) /
+           static_cast<double>(num_latencies);
+}
+
+uint64_t LatencyHistogram::percentileMicroseconds(double percentile) const
+{
+    uint64_t num_latencies = count();
+    if (num_latencies == 0)
+    {
+        return 0;
+    }
+
+    percentile = std::clamp(percentile, 0.0, 100.0);
+    // Rounded like an HDR histogram, so floating point error in the percentile doesn't
+    // push the rank past a boundary, ex. the 99.9th percentile of 10000 latencies
+    uint64_t rank = std::max<uint64_t>(
+        1, static_cast<uint64_t>(percentile / 100.0 * static_cast<double>(num_latencies) +
+                                 0.5));
+
+    uint64_t cumulative_count = 0;
+    for (size_t i = 0; i < NUM_BUCKETS; i++)
+    {
+        cumulative_count += bucket_counts[i].load(std::memory_order_relaxed);
+        if (cumulative_count >= rank)
+        {
+            // the top of the bucket can be above anything that was actually recorded
+            return std::min(bucketMaxLatency(i), maxMicroseconds());
+        }
+    }
+    // latencies recorded while the buckets were read can make the total count run ahead
+    return maxMicroseconds();
+}
+
+void LatencyHistogram::forEachBucket(
+    const std::function<void(uint64_t max_latency_us, uint64_t count)>& on_bucket) const
+{
+    for (size_t i = 0; i < NUM_BUCKETS; i++)
+    {
+        uint64_t bucket_count = bucket_counts[i].load(std::memory_order_relaxed);
+        if (bucket_count > 0)
+        {
+            on_bucket(bucketMaxLatency(i), bucket_count);
+        }
+    }
+}
+
+void LatencyHistogram::reset()
+{
+    for (std::atomic<uint64_t>& bucket_count : bucket_counts)
+    {
+        bucket_count.store(0, std::memory_order_relaxed);
+    }
+    total_count.store(0, std::memory_order_relaxed);
+    total_latency_us.store(0, std::memory_order_relaxed);
+    min_latency_us.store(std::numeric_limits<uint64_t>::max(), std::memory_order_relaxed);
+    max_latency_us.store(0, std::memory_order_relaxed);
+}
+
+size_t LatencyHistogram::bucketIndex(uint64_t latency_us)
+{
+    if (latency_us < SUB_BUCKET_COUNT)
+    {
+        return static_cast<size_t>(latency_us);
+    }
+
+    // Latencies in [2^magnitude, 2^(magnitude + 1)) are split into SUB_BUCKET_HALF_COUNT
+    // buckets by their most significant bits
+    unsigned int magnitude = 63 - static_cast<unsigned int>(__builtin_clzll(latency_us));
+    unsigned int shift     = magnitude - (SUB_BUCKET_COUNT_MAGNITUDE - 1);
+    uint64_t sub_bucket    = (latency_us >> shift) - SUB_BUCKET_HALF_COUNT;
+    return static_cast<size_t>(
+        SUB_BUCKET_COUNT +
+        (magnitude - SUB_BUCKET_COUNT_MAGNITUDE) * SUB_BUCKET_HALF_COUNT + sub_bucket);
+}
+
+uint64_t LatencyHistogram::bucketMaxLatency(size_t bucket_index)
+{
+    if (bucket_index < SUB_BUCKET_COUNT)
+    {
+        return bucket_index;
+    }
+
+    size_t magnitude_index = (bucket_index - SUB_BUCKET_COUNT) / SUB_BUCKET_HALF_COUNT;
+    uint64_t sub_bucket =
+        SUB_BUCKET_HALF_COUNT + (bucket_index - SUB_BUCKET_COUNT) % SUB_BUCKET_HALF_COUNT;
+    unsigned int shift = static_cast<unsigned int>(magnitude_index) + 1;
+    return ((sub_bucket + 1) << shift) - 1;
+}
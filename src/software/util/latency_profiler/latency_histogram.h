@@ -0,0 +1,138 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+
+/**
+ * A histogram of latencies in the style of an HDR histogram.
+ *
+ * Latencies are recorded in microseconds into log-linear buckets: every power of two
+ * range of latencies is split into SUB_BUCKET_HALF_COUNT buckets of equal width, so
+ * every latency from 1us to over an hour is tracked with at most 1 /
+ * SUB_BUCKET_HALF_COUNT relative error, in a fixed amount of memory. This keeps tail
+ * percentiles like the p99 accurate no matter how long the histogram records for.
+ *
+ * Recording is lock free and only does a few relaxed atomic operations, so it can be
+ * left on in hot paths and called from any thread. Reading the histogram while latencies
+ * are recorded is safe, but may see a recording partially applied.
+ */
+class LatencyHistogram
+{
+   public:
+    LatencyHistogram();
+
+    // The histogram is recorded into by address from many threads, so it can't be copied
+    LatencyHistogram(const LatencyHistogram&) = delete;
+    LatencyHistogram& operator=(const LatencyHistogram&) = delete;
+
+    /**
+     * Records a latency. Latencies longer than MAX_TRACKABLE_LATENCY_US are recorded as
+     * MAX_TRACKABLE_LATENCY_US.
+     *
+     * @param latency The latency to record
+     */
+    void record(std::chrono::steady_clock::duration latency);
+
+    /**
+     * Records a latency in microseconds
+     *
+     * @param latency_us The latency to record in microseconds
+     */
+    void recordMicroseconds(uint64_t latency_us);
+
+    /**
+     * Gets the number of recorded latencies
+     *
+     * @return the number of recorded latencies
+     */
+    uint64_t count() const;
+
+    /**
+     * Gets the shortest recorded latency
+     *
+     * @return the shortest recorded latency in microseconds, or 0 if nothing was recorded
+     */
+    uint64_t minMicroseconds() const;
+
+    /**
+     * Gets the longest recorded latency
+     *
+     * @return the longest recorded latency in microseconds
+     */
+    uint64_t maxMicroseconds() const;
+
+    /**
+     * Gets the mean of the recorded latencies
+     *
+     * @return the mean recorded latency in microseconds, or 0 if nothing was recorded
+     */
+    double meanMicroseconds() const;
+
+    /**
+     * Gets the latency that the given percentage of recorded latencies are at or below.
+     * Like an HDR histogram, this is the highest latency that is in the same bucket as
+     * the percentile, so it is never lower than the exact percentile.
+     *
+     * @param percentile The percentile to get, from 0 to 100
+     *
+     * @return the percentile latency in microseconds, or 0 if nothing was recorded
+     */
+    uint64_t percentileMicroseconds(double percentile) const;
+
+    /**
+     * Calls the given function with every non-empty bucket, in increasing order of
+     * latency
+     *
+     * @param on_bucket Called with the highest latency in the bucket in microseconds, and
+     * the number of latencies recorded in the bucket
+     */
+    void forEachBucket(const std::function<void(uint64_t max_latency_us, uint64_t count)>&
+                           on_bucket) const;
+
+    /**
+     * Clears all recorded latencies
+     */
+    void reset();
+
+    // Latencies below SUB_BUCKET_COUNT microseconds get a bucket each, and every power
+    // of two range above that is split into SUB_BUCKET_HALF_COUNT buckets
+    static constexpr unsigned int SUB_BUCKET_COUNT_MAGNITUDE = 7;
+    static constexpr uint64_t SUB_BUCKET_COUNT      = 1ull << SUB_BUCKET_COUNT_MAGNITUDE;
+    static constexpr uint64_t SUB_BUCKET_HALF_COUNT = SUB_BUCKET_COUNT / 2;
+    // About 71 minutes
+    static constexpr unsigned int MAX_TRACKABLE_LATENCY_MAGNITUDE = 32;
+    static constexpr uint64_t MAX_TRACKABLE_LATENCY_US =
+        (1ull << MAX_TRACKABLE_LATENCY_MAGNITUDE) - 1;
+    static constexpr size_t NUM_BUCKETS =
+        SUB_BUCKET_COUNT +
+        (MAX_TRACKABLE_LATENCY_MAGNITUDE - SUB_BUCKET_COUNT_MAGNITUDE) *
+            SUB_BUCKET_HALF_COUNT;
+
+   private:
+    /**
+     * Gets the index of the bucket a latency is counted in
+     *
+     * @param latency_us The latency in microseconds, at most MAX_TRACKABLE_LATENCY_US
+     *
+     * @return the index of the bucket
+     */
+    static size_t bucketIndex(uint64_t latency_us);
+
+    /**
+     * Gets the highest latency counted in a bucket
+     *
+     * @param bucket_index The index of the bucket
+     *
+     * @return the highest latency in the bucket in microseconds
+     */
+    static uint64_t bucketMaxLatency(size_t bucket_index);
+
+    std::array<std::atomic<uint64_t>, NUM_BUCKETS> bucket_counts;
+    std::atomic<uint64_t> total_count;
+    std::atomic<uint64_t> total_latency_us;
+    std::atomic<uint64_t> min_latency_us;
+    std::atomic<uint64_t> max_latency_us;
+};
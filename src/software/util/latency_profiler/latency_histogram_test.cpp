@@ -0,0 +1,171 @@
+#include "software/util/latency_profiler/latency_histogram.h"
+
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <vector>
+
+TEST(LatencyHistogramTest, test_empty_histogram)
+{
+    LatencyHistogram histogram;
+
+    EXPECT_EQ(0, histogram.count());
+    EXPECT_EQ(0, histogram.minMicroseconds());
+    EXPECT_EQ(0, histogram.maxMicroseconds());
+    EXPECT_EQ(0.0, histogram.meanMicroseconds());
+    EXPECT_EQ(0, histogram.percentileMicroseconds(50));
+}
+
+TEST(LatencyHistogramTest, test_short_latencies_are_exact)
+{
+    LatencyHistogram histogram;
+    for (uint64_t latency_us = 1; latency_us <= 100; latency_us++)
+    {
+        histogram.recordMicroseconds(latency_us);
+    }
+
+    EXPECT_EQ(100, histogram.count());
+    EXPECT_EQ(1, histogram.minMicroseconds());
+    EXPECT_EQ(100, histogram.maxMicroseconds());
+    EXPECT_DOUBLE_EQ(50.5, histogram.meanMicroseconds());
+    EXPECT_EQ(1, histogram.percentileMicroseconds(0));
+    EXPECT_EQ(50, histogram.percentileMicroseconds(50));
+    EXPECT_EQ(90, histogram.percentileMicroseconds(90));
+    EXPECT_EQ(99, histogram.percentileMicroseconds(99));
+    EXPECT_EQ(100, histogram.percentileMicroseconds(100));
+}
+
+TEST(LatencyHistogramTest, test_long_latencies_are_within_relative_error)
+{
+    LatencyHistogram histogram;
+    // 1ms to 100ms
+    for (uint64_t latency_us = 1000; latency_us <= 100000; latency_us += 1000)
+    {
+        histogram.recordMicroseconds(latency_us);
+    }
+
+    const double max_relative_error = 1.0 / LatencyHistogram::SUB_BUCKET_HALF_COUNT;
+    for (double percentile : {10.0, 50.0, 90.0, 99.0})
+    {
+        double exact_latency_us = percentile * 1000;
+        uint64_t latency_us     = histogram.percentileMicroseconds(percentile);
+        EXPECT_GE(latency_us, exact_latency_us) << "percentile " << percentile;
+        EXPECT_LE(latency_us, exact_latency_us * (1 + max_relative_error))
+            << "percentile " << percentile;
+    }
+    EXPECT_EQ(100000, histogram.percentileMicroseconds(100));
+}
+
+TEST(LatencyHistogramTest, test_tail_latency_is_not_hidden_by_many_fast_latencies)
+{
+    LatencyHistogram histogram;
+    for (int i = 0; i < 9990; i++)
+    {
+        histogram.recordMicroseconds(500);
+    }
+    for (int i = 0; i < 10; i++)
+    {
+        histogram.recordMicroseconds(40000);
+    }
+
+    EXPECT_LE(histogram.percentileMicroseconds(99.9), 510);
+    EXPECT_GE(histogram.percentileMicroseconds(99.95), 40000);
+    EXPECT_EQ(40000, histogram.maxMicroseconds());
+}
+
+TEST(LatencyHistogramTest, test_latencies_past_max_trackable_latency_are_clamped)
+{
+    LatencyHistogram histogram;
+    histogram.recordMicroseconds(LatencyHistogram::MAX_TRACKABLE_LATENCY_US * 4);
+    histogram.record(std::chrono::microseconds(-5));
+
+    EXPECT_EQ(2, histogram.count());
+    EXPECT_EQ(0, histogram.minMicroseconds());
+    EXPECT_EQ(LatencyHistogram::MAX_TRACKABLE_LATENCY_US, histogram.maxMicroseconds());
+    EXPECT_EQ(LatencyHistogram::MAX_TRACKABLE_LATENCY_US,
+              histogram.percentileMicroseconds(100));
+}
+
+TEST(LatencyHistogramTest, test_bucket_max_latencies_are_bucket_boundaries)
+{
+    // Record latencies spread over the whole trackable range to find bucket boundaries
+    LatencyHistogram histogram;
+    for (uint64_t latency_us = 0;
+         latency_us <= LatencyHistogram::MAX_TRACKABLE_LATENCY_US;
+         latency_us = latency_us < 1024 ? latency_us + 1 : latency_us * 3 / 2)
+    {
+        histogram.recordMicroseconds(latency_us);
+    }
+    std::vector<uint64_t> bucket_max_latencies;
+    histogram.forEachBucket([&](uint64_t max_latency_us, uint64_t count) {
+        bucket_max_latencies.emplace_back(max_latency_us);
+    });
+
+    // The max latency of a bucket must be in that bucket, and one more than it must be in
+    // the next bucket
+    for (uint64_t max_latency_us : bucket_max_latencies)
+    {
+        LatencyHistogram boundary_histogram;
+        boundary_histogram.recordMicroseconds(max_latency_us);
+        boundary_histogram.recordMicroseconds(max_latency_us + 1);
+
+        std::vector<uint64_t> boundary_bucket_max_latencies;
+        boundary_histogram.forEachBucket([&](uint64_t bucket_max_latency_us, uint64_t) {
+            boundary_bucket_max_latencies.emplace_back(bucket_max_latency_us);
+        });
+        if (max_latency_us < LatencyHistogram::MAX_TRACKABLE_LATENCY_US)
+        {
+            ASSERT_EQ(2, boundary_bucket_max_latencies.size()) << max_latency_us << "us";
+            EXPECT_EQ(max_latency_us, boundary_bucket_max_latencies[0]);
+            EXPECT_GE(boundary_bucket_max_latencies[1], max_latency_us + 1);
+        }
+        else
+        {
+            ASSERT_EQ(1, boundary_bucket_max_latencies.size());
+            EXPECT_EQ(max_latency_us, boundary_bucket_max_latencies[0]);
+        }
+    }
+}
+
+TEST(LatencyHistogramTest, test_reset)
+{
+    LatencyHistogram histogram;
+    histogram.recordMicroseconds(10);
+    histogram.recordMicroseconds(20000);
+    histogram.reset();
+
+    EXPECT_EQ(0, histogram.count());
+    EXPECT_EQ(0, histogram.maxMicroseconds());
+    EXPECT_EQ(0, histogram.percentileMicroseconds(100));
+
+    histogram.recordMicroseconds(30);
+    EXPECT_EQ(30, histogram.minMicroseconds());
+    EXPECT_EQ(30, histogram.maxMicroseconds());
+}
+
+TEST(LatencyHistogramTest, test_concurrent_recording_does_not_lose_latencies)
+{
+    LatencyHistogram histogram;
+    const int num_threads          = 4;
+    const int latencies_per_thread = 10000;
+    std::vector<std::thread> threads;
+    for (int thread_index = 0; thread_index < num_threads; thread_index++)
+    {
+        threads.emplace_back([&histogram, thread_index]() {
+            for (int i = 0; i < latencies_per_thread; i++)
+            {
+                histogram.recordMicroseconds(static_cast<uint64_t>(thread_index + 1) *
+                                             100);
+            }
+        });
+    }
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    EXPECT_EQ(num_threads * latencies_per_thread, histogram.count());
+    EXPECT_EQ(100, histogram.minMicroseconds());
+    EXPECT_EQ(400, histogram.maxMicroseconds());
+    EXPECT_DOUBLE_EQ(250.0, histogram.meanMicroseconds());
+}
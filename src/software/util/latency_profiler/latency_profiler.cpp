@@ -0,0 +1,203 @@
+#include "software/util/latency_profiler/latency_profiler.h"
+
+#include <google/protobuf/text_format.h>
+
+#include <atomic>
+#include <fstream>
+#include <iomanip>
+#include <vector>
+
+#include "software/logger/logger.h"
+
+namespace
+{
+    /**
+     * Gets the histograms of all the stages, indexed by stage
+     *
+     * @return the histograms of all the stages
+     */
+    std::vector<LatencyHistogram>& getHistograms()
+    {
+        static std::vector<LatencyHistogram> histograms(sizeLatencyStage());
+        return histograms;
+    }
+
+    /**
+     * Gets the number of values dropped by the buffer of every stage, indexed by stage
+     *
+     * @return the number of dropped values of every stage
+     */
+    std::vector<std::atomic<uint64_t>>& getNumDroppedValues()
+    {
+        static std::vector<std::atomic<uint64_t>> num_dropped_values(sizeLatencyStage());
+        return num_dropped_values;
+    }
+
+    /**
+     * Converts microseconds to milliseconds
+     *
+     * @param microseconds The microseconds to convert
+     *
+     * @return the milliseconds
+     */
+    double toMilliseconds(double microseconds)
+    {
+        return microseconds / 1000.0;
+    }
+}  // namespace
+
+LatencyHistogram& LatencyProfiler::getHistogram(LatencyStage stage)
+{
+    return getHistograms()[static_cast<size_t>(stage)];
+}
+
+void LatencyProfiler::record(LatencyStage stage,
+                             std::chrono::steady_clock::duration latency)
+{
+    getHistogram(stage).record(latency);
+}
+
+void LatencyProfiler::record(LatencyStage stage, const TbotsProto::Timestamp& start_time,
+                             const TbotsProto::Timestamp& end_time)
+{
+    if (start_time.epoch_timestamp_seconds() == 0 ||
+        end_time.epoch_timestamp_seconds() == 0)
+    {
+        return;
+    }
+
+    record(stage,
+           std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+               std::chrono::duration<double>(end_time.epoch_timestamp_seconds() -
+                                             start_time.epoch_timestamp_seconds())));
+}
+
+void LatencyProfiler::setNumDroppedValues(LatencyStage stage, uint64_t num_dropped_values)
+{
+    getNumDroppedValues()[static_cast<size_t>(stage)].store(num_dropped_values,
+                                                            std::memory_order_relaxed);
+}
+
+TbotsProto::LatencyProfile LatencyProfiler::createLatencyProfile()
+{
+    TbotsProto::LatencyProfile latency_profile;
+
+    const auto now_us = std::chrono::time_point_cast<std::chrono::microseconds>(
+        std::chrono::system_clock::now());
+    latency_profile.mutable_time_created()->set_epoch_timestamp_seconds(
+        static_cast<double>(now_us.time_since_epoch().count()) / 1e6);
+
+    for (LatencyStage stage : allValuesLatencyStage())
+    {
+        const LatencyHistogram& histogram = getHistogram(stage);
+        uint64_t num_dropped_values =
+            getNumDroppedValues()[static_cast<size_t>(stage)].load(
+                std::memory_order_relaxed);
+        if (histogram.count() == 0 && num_dropped_values == 0)
+        {
+            continue;
+        }
+
+        TbotsProto::StageLatency* stage_latency = latency_profile.add_stage_latencies();
+        stage_latency->set_stage(toString(stage));
+        stage_latency->set_count(histogram.count());
+        stage_latency->set_min_ms(
+            toMilliseconds(static_cast<double>(histogram.minMicroseconds())));
+        stage_latency->set_max_ms(
+            toMilliseconds(static_cast<double>(histogram.maxMicroseconds())));
+        stage_latency->set_mean_ms(toMilliseconds(histogram.meanMicroseconds()));
+        stage_latency->set_p50_ms(
+            toMilliseconds(static_cast<double>(histogram.percentileMicroseconds(50))));
+        stage_latency->set_p90_ms(
+            toMilliseconds(static_cast<double>(histogram.percentileMicroseconds(90))));
+        stage_latency->set_p99_ms(
+            toMilliseconds(static_cast<double>(histogram.percentileMicroseconds(99))));
+        stage_latency->set_p999_ms(
+            toMilliseconds(static_cast<double>(histogram.percentileMicroseconds(99.9))));
+        histogram.forEachBucket([stage_latency](uint64_t max_latency_us, uint64_t count) {
+            TbotsProto::LatencyBucket* bucket = stage_latency->add_buckets();
+            bucket->set_max_latency_us(max_latency_us);
+            bucket->set_count(count);
+        });
+        stage_latency->set_dropped_count(num_dropped_values);
+    }
+
+    return latency_profile;
+}
+
+void LatencyProfiler::visualizeLatencyProfile()
+{
+    static std::atomic<std::chrono::steady_clock::rep> last_send_time(
+        (std::chrono::steady_clock::now() - LATENCY_PROFILE_SEND_PERIOD)
+            .time_since_epoch()
+            .count());
+
+    // Only the caller that moves the last send time forward sends, so that the profile
+    // isn't created more often than it is sent
+    auto now       = std::chrono::steady_clock::now().time_since_epoch();
+    auto last_send = last_send_time.load(std::memory_order_relaxed);
+    if (now.count() - last_send <
+            std::chrono::steady_clock::duration(LATENCY_PROFILE_SEND_PERIOD).count() ||
+        !last_send_time.compare_exchange_strong(last_send, now.count(),
+                                                std::memory_order_relaxed))
+    {
+        return;
+    }
+
+    sendVisualization(createLatencyProfile());
+}
+
+void LatencyProfiler::writeLatencyProfileToFile(const std::string& file_path)
+{
+    TbotsProto::LatencyProfile latency_profile = createLatencyProfile();
+
+    std::string latency_profile_text;
+    google::protobuf::TextFormat::PrintToString(latency_profile, &latency_profile_text);
+    std::ofstream latency_profile_file(file_path);
+    latency_profile_file << latency_profile_text;
+    if (!latency_profile_file)
+    {
+        LOG(WARNING) << "Failed to write the latency profile to " << file_path;
+        return;
+    }
+
+    std::ostringstream summary;
+    summary << std::fixed << std::setprecision(3);
+    for (const TbotsProto::StageLatency& stage_latency :
+         latency_profile.stage_latencies())
+    {
+        summary << std::endl
+                << stage_latency.stage() << ": count " << stage_latency.count()
+                << ", p50 " << stage_latency.p50_ms() << "ms, p90 "
+                << stage_latency.p90_ms() << "ms, p99 " << stage_latency.p99_ms()
+                << "ms, p99.9 " << stage_latency.p999_ms() << "ms, max "
+                << stage_latency.max_ms() << "ms";
+        if (stage_latency.dropped_count() > 0)
+        {
+            summary << ", dropped " << stage_latency.dropped_count();
+        }
+    }
+    LOG(INFO) << "Wrote the latency profile to " << file_path << summary.str();
+}
+
+void LatencyProfiler::reset()
+{
+    for (LatencyHistogram& histogram : getHistograms())
+    {
+        histogram.reset();
+    }
+    for (std::atomic<uint64_t>& num_dropped_values : getNumDroppedValues())
+    {
+        num_dropped_values.store(0, std::memory_order_relaxed);
+    }
+}
+
+ScopedLatencyTimer::ScopedLatencyTimer(LatencyStage stage)
+    : stage(stage), start_time(std::chrono::steady_clock::now())
+{
+}
+
+ScopedLatencyTimer::~ScopedLatencyTimer()
+{
+    LatencyProfiler::record(stage, std::chrono::steady_clock::now() - start_time);
+}
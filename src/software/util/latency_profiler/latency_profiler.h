@@ -0,0 +1,151 @@
+#pragma once
+
+#include <chrono>
+#include <string>
+
+#include "proto/latency_profile_msg.pb.h"
+#include "software/util/latency_profiler/latency_histogram.h"
+#include "software/util/make_enum/make_enum.h"
+
+// The stages of the full_system pipeline that are profiled. Stages are timed where they
+// run, so a stage includes the stages it calls, ex. PLAY_UPDATE includes the
+// TACTIC_ASSIGNMENT and PASS_GENERATION done by the play. The *_QUEUE stages are the
+// time a vision frame spends waiting in a buffer between threads, from its LatencyTrace.
+MAKE_ENUM(LatencyStage,
+          // From ssl vision capturing a frame to sending it, in the ssl vision clock
+          VISION_PROCESSING,
+          // Backend handling of a received SSL vision packet
+          VISION_RECEIVE,
+          // From the backend receiving a vision frame to sensor fusion processing it
+          SENSOR_FUSION_QUEUE,
+          // SensorFusion::processSensorProto
+          SENSOR_FUSION,
+          // From sensor fusion sending a World to the AI running on it
+          AI_QUEUE,
+          // A whole AI tick, from World to PrimitiveSet
+          AI_TICK,
+          // Selecting and updating the play, and getting intents from it
+          PLAY_UPDATE,
+          // Assigning robots to the tactics of the play
+          TACTIC_ASSIGNMENT,
+          // PassGenerator::generatePassEvaluation
+          PASS_GENERATION,
+          // Navigator::getAssignedPrimitives
+          NAVIGATOR,
+          // From the AI sending a PrimitiveSet to the backend handling it
+          PRIMITIVE_QUEUE,
+          // Backend handling of a PrimitiveSet from the AI
+          PRIMITIVE_SEND,
+          // From the backend receiving a vision frame to it receiving the PrimitiveSet
+          // made from it
+          END_TO_END);
+
+/**
+ * Records the latency of every LatencyStage of the full_system pipeline into a
+ * LatencyHistogram per stage, for the lifetime of the program. Recording is cheap enough
+ * to always be on, so the tail latencies of real matches can be looked at afterwards.
+ *
+ * Stages are usually timed with a ScopedLatencyTimer:
+ *
+ * ```
+ * void Navigator::getAssignedPrimitives(...)
+ * {
+ *     ScopedLatencyTimer latency_timer(LatencyStage::NAVIGATOR);
+ *     ...
+ * }
+ * ```
+ */
+class LatencyProfiler
+{
+   public:
+    LatencyProfiler() = delete;
+
+    /**
+     * Gets the histogram that the latencies of a stage are recorded in
+     *
+     * @param stage The stage
+     *
+     * @return the histogram of the stage
+     */
+    static LatencyHistogram& getHistogram(LatencyStage stage);
+
+    /**
+     * Records a latency of a stage
+     *
+     * @param stage The stage
+     * @param latency The latency to record
+     */
+    static void record(LatencyStage stage, std::chrono::steady_clock::duration latency);
+
+    /**
+     * Records the time between two timestamps as a latency of a stage. Nothing is
+     * recorded if either timestamp is unset, ex. if it's from an incomplete LatencyTrace.
+     *
+     * @param stage The stage
+     * @param start_time The start of the stage
+     * @param end_time The end of the stage
+     */
+    static void record(LatencyStage stage, const TbotsProto::Timestamp& start_time,
+                       const TbotsProto::Timestamp& end_time);
+
+    /**
+     * Sets the number of values that were dropped from the buffer a *_QUEUE stage
+     * waits in
+     *
+     * @param stage The stage
+     * @param num_dropped_values The total number of values dropped from the buffer
+     */
+    static void setNumDroppedValues(LatencyStage stage, uint64_t num_dropped_values);
+
+    /**
+     * Creates a LatencyProfile proto with the latency distribution of every stage that
+     * has recorded a latency or dropped a value
+     *
+     * @return the LatencyProfile proto
+     */
+    static TbotsProto::LatencyProfile createLatencyProfile();
+
+    /**
+     * Sends a LatencyProfile to Thunderscope, unless one was sent less than
+     * LATENCY_PROFILE_SEND_PERIOD ago. This is cheap to call every tick.
+     */
+    static void visualizeLatencyProfile();
+
+    /**
+     * Writes a LatencyProfile to a file in the protobuf text format, and logs the
+     * percentiles of every stage
+     *
+     * @param file_path The path of the file to write
+     */
+    static void writeLatencyProfileToFile(const std::string& file_path);
+
+    /**
+     * Clears the latencies recorded for every stage
+     */
+    static void reset();
+
+    static constexpr std::chrono::seconds LATENCY_PROFILE_SEND_PERIOD{1};
+};
+
+/**
+ * Records how long it existed for as a latency of a stage when it is destroyed
+ */
+class ScopedLatencyTimer
+{
+   public:
+    /**
+     * Starts timing a stage
+     *
+     * @param stage The stage to record the latency of
+     */
+    explicit ScopedLatencyTimer(LatencyStage stage);
+
+    ~ScopedLatencyTimer();
+
+    ScopedLatencyTimer(const ScopedLatencyTimer&) = delete;
+    ScopedLatencyTimer& operator=(const ScopedLatencyTimer&) = delete;
+
+   private:
+    LatencyStage stage;
+    std::chrono::steady_clock::time_point start_time;
+};
@@ -0,0 +1,131 @@
+#include "software/util/latency_profiler/latency_profiler.h"
+
+#include <google/protobuf/text_format.h>
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <thread>
+
+class LatencyProfilerTest : public ::testing::Test
+{
+   protected:
+    void SetUp() override
+    {
+        LatencyProfiler::reset();
+    }
+
+    void TearDown() override
+    {
+        LatencyProfiler::reset();
+    }
+};
+
+TEST_F(LatencyProfilerTest, test_stages_are_recorded_separately)
+{
+    LatencyProfiler::record(LatencyStage::AI_TICK, std::chrono::milliseconds(5));
+    LatencyProfiler::record(LatencyStage::AI_TICK, std::chrono::milliseconds(7));
+    LatencyProfiler::record(LatencyStage::NAVIGATOR, std::chrono::microseconds(300));
+
+    EXPECT_EQ(2, LatencyProfiler::getHistogram(LatencyStage::AI_TICK).count());
+    EXPECT_EQ(1, LatencyProfiler::getHistogram(LatencyStage::NAVIGATOR).count());
+    EXPECT_EQ(0, LatencyProfiler::getHistogram(LatencyStage::SENSOR_FUSION).count());
+}
+
+TEST_F(LatencyProfilerTest, test_scoped_latency_timer_records_on_destruction)
+{
+    {
+        ScopedLatencyTimer latency_timer(LatencyStage::PLAY_UPDATE);
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        EXPECT_EQ(0, LatencyProfiler::getHistogram(LatencyStage::PLAY_UPDATE).count());
+    }
+
+    const LatencyHistogram& histogram =
+        LatencyProfiler::getHistogram(LatencyStage::PLAY_UPDATE);
+    EXPECT_EQ(1, histogram.count());
+    EXPECT_GE(histogram.maxMicroseconds(), 2000);
+}
+
+TEST_F(LatencyProfilerTest, test_create_latency_profile_only_has_recorded_stages)
+{
+    for (int i = 1; i <= 100; i++)
+    {
+        LatencyProfiler::record(LatencyStage::SENSOR_FUSION,
+                                std::chrono::microseconds(i * 10));
+    }
+
+    TbotsProto::LatencyProfile latency_profile = LatencyProfiler::createLatencyProfile();
+
+    EXPECT_GT(latency_profile.time_created().epoch_timestamp_seconds(), 0);
+    ASSERT_EQ(1, latency_profile.stage_latencies_size());
+    const TbotsProto::StageLatency& stage_latency = latency_profile.stage_latencies(0);
+    EXPECT_EQ("SENSOR_FUSION", stage_latency.stage());
+    EXPECT_EQ(100, stage_latency.count());
+    EXPECT_DOUBLE_EQ(0.01, stage_latency.min_ms());
+    EXPECT_DOUBLE_EQ(1.0, stage_latency.max_ms());
+    EXPECT_DOUBLE_EQ(0.505, stage_latency.mean_ms());
+    EXPECT_NEAR(0.5, stage_latency.p50_ms(), 0.01);
+    EXPECT_NEAR(0.9, stage_latency.p90_ms(), 0.01);
+    EXPECT_NEAR(0.99, stage_latency.p99_ms(), 0.01);
+    EXPECT_DOUBLE_EQ(1.0, stage_latency.p999_ms());
+
+    uint64_t bucket_count_sum = 0;
+    for (const TbotsProto::LatencyBucket& bucket : stage_latency.buckets())
+    {
+        bucket_count_sum += bucket.count();
+    }
+    EXPECT_EQ(100, bucket_count_sum);
+}
+
+TEST_F(LatencyProfilerTest, test_write_latency_profile_to_file)
+{
+    LatencyProfiler::record(LatencyStage::VISION_RECEIVE, std::chrono::microseconds(150));
+    LatencyProfiler::record(LatencyStage::PRIMITIVE_SEND, std::chrono::microseconds(80));
+
+    const std::string file_path =
+        (std::filesystem::temp_directory_path() / "latency_profiler_test.pbtxt").string();
+    LatencyProfiler::writeLatencyProfileToFile(file_path);
+
+    std::ifstream latency_profile_file(file_path);
+    std::stringstream latency_profile_text;
+    latency_profile_text << latency_profile_file.rdbuf();
+    std::filesystem::remove(file_path);
+
+    TbotsProto::LatencyProfile latency_profile;
+    ASSERT_TRUE(google::protobuf::TextFormat::ParseFromString(latency_profile_text.str(),
+                                                              &latency_profile));
+    ASSERT_EQ(2, latency_profile.stage_latencies_size());
+    EXPECT_EQ("VISION_RECEIVE", latency_profile.stage_latencies(0).stage());
+    EXPECT_EQ("PRIMITIVE_SEND", latency_profile.stage_latencies(1).stage());
+}
+
+TEST_F(LatencyProfilerTest, test_record_between_timestamps)
+{
+    TbotsProto::Timestamp start_time;
+    start_time.set_epoch_timestamp_seconds(1000.0);
+    TbotsProto::Timestamp end_time;
+    end_time.set_epoch_timestamp_seconds(1000.004);
+
+    LatencyProfiler::record(LatencyStage::AI_QUEUE, start_time, end_time);
+    // unset timestamps are ignored
+    LatencyProfiler::record(LatencyStage::AI_QUEUE, TbotsProto::Timestamp(), end_time);
+
+    const LatencyHistogram& histogram =
+        LatencyProfiler::getHistogram(LatencyStage::AI_QUEUE);
+    EXPECT_EQ(1, histogram.count());
+    EXPECT_NEAR(4000, static_cast<double>(histogram.maxMicroseconds()), 1);
+}
+
+TEST_F(LatencyProfilerTest, test_dropped_values_are_in_latency_profile)
+{
+    LatencyProfiler::setNumDroppedValues(LatencyStage::AI_QUEUE, 3);
+    LatencyProfiler::setNumDroppedValues(LatencyStage::AI_QUEUE, 7);
+
+    TbotsProto::LatencyProfile latency_profile = LatencyProfiler::createLatencyProfile();
+
+    ASSERT_EQ(1, latency_profile.stage_latencies_size());
+    EXPECT_EQ("AI_QUEUE", latency_profile.stage_latencies(0).stage());
+    EXPECT_EQ(0, latency_profile.stage_latencies(0).count());
+    EXPECT_EQ(7, latency_profile.stage_latencies(0).dropped_count());
+}
@@ -1,50 +1,57 @@
 #include "software/world/robot.h"
 
+#include <cstring>
+#include <deque>
+#include <mutex>
+
 #include "shared/constants.h"
 #include "software/logger/logger.h"
 
 Robot::Robot(RobotId id, const Point &position, const Vector &velocity,
              const Angle &orientation, const AngularVelocity &angular_velocity,
              const Timestamp &timestamp,
-             const std::set<RobotCapability> &unavailable_capabilities,
+             const RobotCapabilities &unavailable_capabilities,
              const RobotConstants_t &robot_constants)
     : id_(id),
       current_state_(position, velocity, orientation, angular_velocity),
       timestamp_(timestamp),
       unavailable_capabilities_(unavailable_capabilities),
-      robot_constants_(robot_constants)
+      robot_constants_(internRobotConstants(robot_constants))
 {
 }
 
 Robot::Robot(RobotId id, const RobotState &initial_state, const Timestamp &timestamp,
-             const std::set<RobotCapability> &unavailable_capabilities)
+             const RobotCapabilities &unavailable_capabilities)
     : id_(id),
       current_state_(initial_state),
       timestamp_(timestamp),
-      unavailable_capabilities_(unavailable_capabilities)
+      unavailable_capabilities_(unavailable_capabilities),
+      robot_constants_(internRobotConstants(create2021RobotConstants()))
 {
 }
 
 Robot::Robot(const TbotsProto::Robot &robot_proto)
     : id_(robot_proto.id()),
       current_state_(RobotState(robot_proto.current_state())),
-      timestamp_(Timestamp::fromTimestampProto(robot_proto.timestamp()))
+      timestamp_(Timestamp::fromTimestampProto(robot_proto.timestamp())),
+      unavailable_capabilities_(),
+      robot_constants_(internRobotConstants(create2021RobotConstants()))
 {
     for (const auto &unavailable_capability : robot_proto.unavailable_capabilities())
     {
         switch (unavailable_capability)
         {
             case TbotsProto::Robot_RobotCapability_Dribble:
-                unavailable_capabilities_.emplace(RobotCapability::Dribble);
+                unavailable_capabilities_.insert(RobotCapability::Dribble);
                 break;
             case TbotsProto::Robot_RobotCapability_Kick:
-                unavailable_capabilities_.emplace(RobotCapability::Kick);
+                unavailable_capabilities_.insert(RobotCapability::Kick);
                 break;
             case TbotsProto::Robot_RobotCapability_Chip:
-                unavailable_capabilities_.emplace(RobotCapability::Chip);
+                unavailable_capabilities_.insert(RobotCapability::Chip);
                 break;
             case TbotsProto::Robot_RobotCapability_Move:
-                unavailable_capabilities_.emplace(RobotCapability::Move);
+                unavailable_capabilities_.insert(RobotCapability::Move);
                 break;
         }
     }
@@ -122,31 +129,59 @@ bool Robot::operator!=(const Robot &other) const
     return !(*this == other);
 }
 
-const std::set<RobotCapability> &Robot::getUnavailableCapabilities() const
+RobotCapabilities Robot::getUnavailableCapabilities() const
 {
     return unavailable_capabilities_;
 }
 
-std::set<RobotCapability> Robot::getAvailableCapabilities() const
+RobotCapabilities Robot::getAvailableCapabilities() const
 {
     // robot capabilities = all possible capabilities - unavailable capabilities
-
-    std::set<RobotCapability> all_capabilities = allRobotCapabilities();
-    std::set<RobotCapability> robot_capabilities;
-    std::set_difference(all_capabilities.begin(), all_capabilities.end(),
-                        getUnavailableCapabilities().begin(),
-                        getUnavailableCapabilities().end(),
-                        std::inserter(robot_capabilities, robot_capabilities.begin()));
-
-    return robot_capabilities;
+    return unavailable_capabilities_.complement();
 }
 
-std::set<RobotCapability> &Robot::getMutableRobotCapabilities()
+RobotCapabilities &Robot::getMutableRobotCapabilities()
 {
     return unavailable_capabilities_;
 }
 
 const RobotConstants_t &Robot::robotConstants() const
 {
-    return robot_constants_;
+    return *robot_constants_;
+}
+
+const RobotConstants_t *Robot::internRobotConstants(
+    const RobotConstants_t &robot_constants)
+{
+    // Almost every Robot is created with the same constants, so the constants this
+    // thread interned last are checked before taking the lock
+    thread_local const RobotConstants_t *last_interned_robot_constants = nullptr;
+    if (last_interned_robot_constants &&
+        std::memcmp(last_interned_robot_constants, &robot_constants,
+                    sizeof(RobotConstants_t)) == 0)
+    {
+        return last_interned_robot_constants;
+    }
+
+    // There are only ever a handful of different robot constants, so they are never
+    // freed. A deque never moves its elements when new ones are added to the end
+    static std::mutex interned_robot_constants_mutex;
+    static std::deque<RobotConstants_t> interned_robot_constants;
+
+    std::scoped_lock lock(interned_robot_constants_mutex);
+    auto iter =
+        std::find_if(interned_robot_constants.begin(), interned_robot_constants.end(),
+                     [&](const RobotConstants_t &interned) {
+                         // RobotConstants_t only holds floats, so it has no
+                         // padding that could differ between equal constants
+                         return std::memcmp(&interned, &robot_constants,
+                                            sizeof(RobotConstants_t)) == 0;
+                     });
+    if (iter == interned_robot_constants.end())
+    {
+        interned_robot_constants.emplace_back(robot_constants);
+        iter = std::prev(interned_robot_constants.end());
+    }
+    last_interned_robot_constants = &(*iter);
+    return last_interned_robot_constants;
 }
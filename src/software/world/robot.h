@@ -1,6 +1,7 @@
 #pragma once
 
 #include <optional>
+#include <type_traits>
 
 #include "proto/team.pb.h"
 #include "software/time/timestamp.h"
@@ -27,12 +28,12 @@ class Robot
      * @param unavailable_capabilities The set of unavailable capabilities for this robot
      * @param robot_constants The robot constants for this robot
      */
-    explicit Robot(RobotId id, const Point &position, const Vector &velocity,
-                   const Angle &orientation, const AngularVelocity &angular_velocity,
-                   const Timestamp &timestamp,
-                   const std::set<RobotCapability> &unavailable_capabilities =
-                       std::set<RobotCapability>(),
-                   const RobotConstants_t &robot_constants = create2021RobotConstants());
+    explicit Robot(
+        RobotId id, const Point &position, const Vector &velocity,
+        const Angle &orientation, const AngularVelocity &angular_velocity,
+        const Timestamp &timestamp,
+        const RobotCapabilities &unavailable_capabilities = RobotCapabilities(),
+        const RobotConstants_t &robot_constants           = create2021RobotConstants());
 
     /**
      * Creates a new robot with the given initial state
@@ -43,10 +44,9 @@ class Robot
      * state
      * @param unavailable_capabilities The set of unavailable capabilities for this robot
      */
-    explicit Robot(RobotId id, const RobotState &initial_state,
-                   const Timestamp &timestamp,
-                   const std::set<RobotCapability> &unavailable_capabilities =
-                       std::set<RobotCapability>());
+    explicit Robot(
+        RobotId id, const RobotState &initial_state, const Timestamp &timestamp,
+        const RobotCapabilities &unavailable_capabilities = RobotCapabilities());
 
     /**
      * Creates a new robot based on the TbotsProto::Robot protobuf representation
@@ -118,21 +118,21 @@ class Robot
      *
      * @return the missing capabilities of the robot
      */
-    const std::set<RobotCapability> &getUnavailableCapabilities() const;
+    RobotCapabilities getUnavailableCapabilities() const;
 
     /**
      * Returns all available capabilities this robot has
      *
      * @return Returns all available capabilities this robot has
      */
-    std::set<RobotCapability> getAvailableCapabilities() const;
+    RobotCapabilities getAvailableCapabilities() const;
 
     /**
      * Returns the mutable hardware capabilities of the robot
      *
      * @return the mutable hardware capabilities of the robot
      */
-    std::set<RobotCapability> &getMutableRobotCapabilities();
+    RobotCapabilities &getMutableRobotCapabilities();
 
     /**
      * Returns the robot constants for this robot
@@ -190,12 +190,28 @@ class Robot
     };
 
    private:
+    /**
+     * Returns a pointer to a copy of the robot constants that lives for the rest of the
+     * program and is shared by every Robot with the same constants
+     *
+     * @param robot_constants The robot constants to intern
+     *
+     * @return a pointer to the interned robot constants
+     */
+    static const RobotConstants_t *internRobotConstants(
+        const RobotConstants_t &robot_constants);
+
     // The id of this robot
     RobotId id_;
     RobotState current_state_;
     Timestamp timestamp_;
     // The hardware capabilities of the robot, generated from
     // RobotCapabilityFlags::broken_dribblers/chippers/kickers dynamic parameters
-    std::set<RobotCapability> unavailable_capabilities_;
-    RobotConstants_t robot_constants_;
+    RobotCapabilities unavailable_capabilities_;
+    // The constants are interned rather than stored inline, so that copying a Robot
+    // doesn't copy them
+    const RobotConstants_t *robot_constants_;
 };
+
+// Robots are copied into every World, so they must stay cheap to copy
+static_assert(std::is_trivially_copyable_v<Robot>);
@@ -1,6 +1,9 @@
 #pragma once
 
 #include <algorithm>
+#include <bitset>
+#include <initializer_list>
+#include <ostream>
 #include <set>
 
 #include "software/util/make_enum/make_enum.h"
@@ -44,3 +47,190 @@ inline bool operator>=(const std::set<T>& lhs, const std::set<T>& rhs)
 {
     return std::includes(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
 }
+
+/**
+ * A set of RobotCapabilities that is stored as a bitset, so that it is trivially
+ * copyable and checking capabilities never allocates
+ */
+class RobotCapabilities
+{
+   public:
+    /**
+     * Creates an empty set of capabilities
+     */
+    RobotCapabilities() = default;
+
+    /**
+     * Creates a set of capabilities that contains the given capabilities. This is
+     * implicit so that a std::set can be passed wherever RobotCapabilities are expected
+     *
+     * @param capabilities The capabilities in the set
+     */
+    RobotCapabilities(const std::set<RobotCapability>& capabilities)
+    {
+        for (RobotCapability capability : capabilities)
+        {
+            insert(capability);
+        }
+    }
+
+    /**
+     * Creates a set of capabilities that contains the given capabilities
+     *
+     * @param capabilities The capabilities in the set
+     */
+    RobotCapabilities(std::initializer_list<RobotCapability> capabilities)
+    {
+        for (RobotCapability capability : capabilities)
+        {
+            insert(capability);
+        }
+    }
+
+    /**
+     * Returns a set of all capabilities
+     *
+     * @return a set of all capabilities
+     */
+    static RobotCapabilities all()
+    {
+        return {RobotCapability::Dribble, RobotCapability::Kick, RobotCapability::Chip,
+                RobotCapability::Move};
+    }
+
+    /**
+     * Returns whether the set contains the given capability
+     *
+     * @param capability The capability to check for
+     *
+     * @return true if the set contains the capability, false otherwise
+     */
+    bool contains(RobotCapability capability) const
+    {
+        return capabilities_.test(static_cast<size_t>(capability));
+    }
+
+    /**
+     * Adds the capability to the set
+     *
+     * @param capability The capability to add
+     */
+    void insert(RobotCapability capability)
+    {
+        capabilities_.set(static_cast<size_t>(capability));
+    }
+
+    /**
+     * Removes the capability from the set
+     *
+     * @param capability The capability to remove
+     */
+    void erase(RobotCapability capability)
+    {
+        capabilities_.reset(static_cast<size_t>(capability));
+    }
+
+    /**
+     * Returns the number of capabilities in the set
+     *
+     * @return the number of capabilities in the set
+     */
+    size_t size() const
+    {
+        return capabilities_.count();
+    }
+
+    /**
+     * Returns whether the set is empty
+     *
+     * @return true if the set has no capabilities, false otherwise
+     */
+    bool empty() const
+    {
+        return capabilities_.none();
+    }
+
+    /**
+     * Returns every capability that is not in this set
+     *
+     * @return every capability that is not in this set
+     */
+    RobotCapabilities complement() const
+    {
+        RobotCapabilities complement;
+        complement.capabilities_ = all().capabilities_ & ~capabilities_;
+        return complement;
+    }
+
+    /**
+     * Returns the capabilities as a std::set
+     *
+     * @return the capabilities as a std::set
+     */
+    std::set<RobotCapability> toSet() const
+    {
+        std::set<RobotCapability> capabilities;
+        for (size_t i = 0; i < capabilities_.size(); i++)
+        {
+            if (capabilities_.test(i))
+            {
+                capabilities.emplace(static_cast<RobotCapability>(i));
+            }
+        }
+        return capabilities;
+    }
+
+    /**
+     * Returns true if lhs is a subset of rhs, otherwise false
+     *
+     * @param lhs a set of capabilities
+     * @param rhs another set of capabilities
+     * @return true if lhs is a subset of rhs
+     */
+    friend bool operator<=(const RobotCapabilities& lhs, const RobotCapabilities& rhs)
+    {
+        return (lhs.capabilities_ & ~rhs.capabilities_).none();
+    }
+
+    /**
+     * Returns true if rhs is a subset of lhs, otherwise false
+     *
+     * @param lhs a set of capabilities
+     * @param rhs another set of capabilities
+     * @return true if rhs is a subset of lhs
+     */
+    friend bool operator>=(const RobotCapabilities& lhs, const RobotCapabilities& rhs)
+    {
+        return rhs <= lhs;
+    }
+
+    friend bool operator==(const RobotCapabilities& lhs, const RobotCapabilities& rhs)
+    {
+        return lhs.capabilities_ == rhs.capabilities_;
+    }
+
+    friend bool operator!=(const RobotCapabilities& lhs, const RobotCapabilities& rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+    friend std::ostream& operator<<(std::ostream& os,
+                                    const RobotCapabilities& capabilities)
+    {
+        os << "{";
+        std::string separator = "";
+        for (RobotCapability capability : capabilities.toSet())
+        {
+            os << separator << capability;
+            separator = ", ";
+        }
+        os << "}";
+        return os;
+    }
+
+   private:
+    // Indexed by the underlying value of the RobotCapability, which MAKE_ENUM
+    // guarantees is in [0, number of capabilities). There is room for more capabilities
+    // than currently exist, so that adding one only requires updating all()
+    std::bitset<8> capabilities_;
+};
@@ -65,9 +65,8 @@ TEST_F(RobotTest, construct_with_protobuf)
     auto robot_proto = createRobot(original_robot);
     Robot proto_converted_robot(*robot_proto);
 
-    EXPECT_THAT(
-        original_robot.getUnavailableCapabilities(),
-        ::testing::ContainerEq(proto_converted_robot.getUnavailableCapabilities()));
+    EXPECT_EQ(original_robot.getUnavailableCapabilities(),
+              proto_converted_robot.getUnavailableCapabilities());
     EXPECT_EQ(original_robot, proto_converted_robot);
 }
 
@@ -140,7 +140,7 @@ void Team::setRobotExpiryBuffer(const Duration& new_robot_expiry_buffer_duration
 }
 
 void Team::setUnavailableRobotCapabilities(
-    RobotId id, const std::set<RobotCapability>& new_unavailable_robot_capabilities)
+    RobotId id, const RobotCapabilities& new_unavailable_robot_capabilities)
 {
     for (Robot& robot : team_robots)
     {
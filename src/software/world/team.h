@@ -134,7 +134,7 @@ class Team
      * robot capabilities
      * */
     void setUnavailableRobotCapabilities(
-        RobotId id, const std::set<RobotCapability>& new_unavailable_robot_capabilities);
+        RobotId id, const RobotCapabilities& new_unavailable_robot_capabilities);
 
     /**
      * Returns the robot with the given id. If this team does not have that robot,
@@ -625,9 +625,6 @@ TEST_F(TeamTest, equality_operator_teams_with_different_goalie)
     Robot robot_1 = Robot(1, Point(3, -1), Vector(), Angle::zero(),
                           AngularVelocity::zero(), current_time);
 
-    Robot robot_2 = Robot(2, Point(), Vector(-0.5, 4), Angle::quarter(),
-                          AngularVelocity::half(), current_time);
-
     Team team_0 = Team(Duration::fromMilliseconds(1000));
     team_0.updateRobots({robot_0, robot_1});
     team_0.assignGoalie(0);
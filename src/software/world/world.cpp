@@ -14,7 +14,8 @@ World::World(const Field &field, const Ball &ball, const Team &friendly_team,
       // Store a small buffer of previous referee commands so we can filter out noise
       referee_command_history_(REFEREE_COMMAND_BUFFER_SIZE),
       referee_stage_history_(REFEREE_COMMAND_BUFFER_SIZE),
-      team_with_possesion_(TeamSide::ENEMY)
+      team_with_possesion_(TeamSide::ENEMY),
+      latency_trace_()
 {
     updateTimestamp(getMostRecentTimestampFromMembers());
 }
@@ -112,10 +113,6 @@ void World::updateRefereeStage(const RefereeStage &stage)
 
 Timestamp World::getMostRecentTimestampFromMembers()
 {
-    // Intit to 0.0. This way we will always get a larger or equal timestamp from one of
-    // the members
-    Timestamp most_recent_timestamp = Timestamp::fromSeconds(0.0);
-
     // Add all member timestamps to a list
     std::initializer_list<Timestamp> member_timestamps = {
         friendly_team_.getMostRecentTimestamp(), enemy_team_.getMostRecentTimestamp(),
@@ -173,3 +170,13 @@ TeamSide World::getTeamWithPossession() const
 {
     return team_with_possesion_;
 }
+
+void World::setLatencyTrace(const TbotsProto::LatencyTrace &latency_trace)
+{
+    latency_trace_ = latency_trace;
+}
+
+const TbotsProto::LatencyTrace &World::getLatencyTrace() const
+{
+    return latency_trace_;
+}
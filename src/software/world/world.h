@@ -2,7 +2,9 @@
 
 
 #include <boost/circular_buffer.hpp>
+#include <memory>
 
+#include "proto/latency_trace_msg.pb.h"
 #include "software/world/ball.h"
 #include "software/world/field.h"
 #include "software/world/game_state.h"
@@ -175,10 +177,25 @@ class World final
      */
     TeamSide getTeamWithPossession() const;
 
+    /**
+     * Sets the trace of the vision frame this World was made from
+     *
+     * @param latency_trace The trace of the vision frame
+     */
+    void setLatencyTrace(const TbotsProto::LatencyTrace& latency_trace);
+
+    /**
+     * Gets the trace of the vision frame this World was made from. This is empty if the
+     * World wasn't made from a vision frame.
+     *
+     * @return the trace of the vision frame
+     */
+    const TbotsProto::LatencyTrace& getLatencyTrace() const;
+
     /**
      * Defines the equality operator for a World. Worlds are equal if their field, ball
      * friendly_team, enemy_team and game_state are equal. The last update
-     * timestamp and histories are not part of the equality.
+     * timestamp, histories and latency trace are not part of the equality.
      *
      * @param other The world to compare against for equality
      * @return True if the other robot is equal to this world, and false otherwise
@@ -216,4 +233,13 @@ class World final
     boost::circular_buffer<RefereeStage> referee_stage_history_;
     // which team has possession of the ball
     TeamSide team_with_possesion_;
+    // the trace of the vision frame this world was made from
+    TbotsProto::LatencyTrace latency_trace_;
 };
+
+/**
+ * An immutable snapshot of the World that can be shared between threads without
+ * copying it. Nothing can modify the World it points to, so sharing it is safe even
+ * though World itself must not share any of its data.
+ */
+using WorldPtr = std::shared_ptr<const World>;
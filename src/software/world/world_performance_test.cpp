@@ -0,0 +1,48 @@
+#include <gtest/gtest.h>
+
+#include <iostream>
+
+#include "software/test_util/test_util.h"
+#include "software/world/world.h"
+
+// This test is disabled to speed up CI, it can be enabled by removing "DISABLED_" from
+// the test name
+TEST(WorldPerformanceTest, DISABLED_div_b_22_robots_copy_cost)
+{
+    std::vector<Point> robot_positions;
+    for (int i = 0; i < 11; i++)
+    {
+        robot_positions.emplace_back(Point(-4 + 0.7 * i, 0.2 * i - 1));
+    }
+    World world = ::TestUtil::createBlankTestingWorldDivB();
+    world       = ::TestUtil::setFriendlyRobotPositions(world, robot_positions,
+                                                  Timestamp::fromSeconds(0));
+    world       = ::TestUtil::setEnemyRobotPositions(world, robot_positions,
+                                               Timestamp::fromSeconds(0));
+
+    const unsigned int num_copies = 1000000;
+
+    // The World is copied every time SensorFusion publishes it
+    auto start_time = std::chrono::system_clock::now();
+    for (unsigned int i = 0; i < num_copies; i++)
+    {
+        World world_copy = world;
+        ASSERT_EQ(11, world_copy.friendlyTeam().numRobots());
+    }
+    double world_copy_ns =
+        ::TestUtil::millisecondsSince(start_time) * 1000000 / num_copies;
+
+    // Plays, tactics and evaluation functions copy the robots out of the World
+    start_time = std::chrono::system_clock::now();
+    for (unsigned int i = 0; i < num_copies; i++)
+    {
+        std::vector<Robot> robots = world.friendlyTeam().getAllRobots();
+        ASSERT_EQ(11, robots.size());
+    }
+    double robots_copy_ns =
+        ::TestUtil::millisecondsSince(start_time) * 1000000 / num_copies;
+
+    std::cout << "sizeof(Robot): " << sizeof(Robot) << " bytes" << std::endl;
+    std::cout << "World copy: " << world_copy_ns << " ns" << std::endl;
+    std::cout << "Friendly robots copy: " << robots_copy_ns << " ns" << std::endl;
+}
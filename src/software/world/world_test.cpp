@@ -214,3 +214,15 @@ TEST_F(WorldTest, set_team_with_possession)
     world.setTeamWithPossession(TeamSide::ENEMY);
     EXPECT_EQ(world.getTeamWithPossession(), TeamSide::ENEMY);
 }
+
+TEST_F(WorldTest, set_latency_trace)
+{
+    EXPECT_FALSE(world.getLatencyTrace().has_backend_received_time());
+
+    TbotsProto::LatencyTrace latency_trace;
+    latency_trace.mutable_backend_received_time()->set_epoch_timestamp_seconds(4.5);
+    world.setLatencyTrace(latency_trace);
+
+    EXPECT_EQ(4.5,
+              world.getLatencyTrace().backend_received_time().epoch_timestamp_seconds());
+}